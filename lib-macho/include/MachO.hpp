@@ -30,26 +30,66 @@
 #ifndef MACHO_HPP
 #define MACHO_HPP
 
+#include <MachO/AddressSpace.hpp>
+#include <MachO/ArchiveFile.hpp>
+#include <MachO/ArchiveMember.hpp>
+#include <MachO/CacheExtractor.hpp>
 #include <MachO/CacheFile.hpp>
 #include <MachO/CacheImageInfo.hpp>
+#include <MachO/CacheLocalSymbols.hpp>
 #include <MachO/CacheMappingInfo.hpp>
+#include <MachO/CacheSlideInfo.hpp>
+#include <MachO/CacheSubCacheInfo.hpp>
+#include <MachO/ChainedFixups.hpp>
+#include <MachO/CodeDirectory.hpp>
+#include <MachO/CodeSignature.hpp>
+#include <MachO/CodeSigner.hpp>
 #include <MachO/CPU.hpp>
 #include <MachO/DataInfo.hpp>
+#include <MachO/DebugInfo.hpp>
+#include <MachO/Demangler.hpp>
+#include <MachO/Digest.hpp>
 #include <MachO/FatArch.hpp>
 #include <MachO/FatFile.hpp>
 #include <MachO/File.hpp>
+#include <MachO/FileCopy.hpp>
 #include <MachO/FileFlags.hpp>
+#include <MachO/FileSummary.hpp>
 #include <MachO/FileType.hpp>
 #include <MachO/Functions.hpp>
+#include <MachO/IndirectSymbolTable.hpp>
+#include <MachO/Inflater.hpp>
 #include <MachO/IntegerWrapper.hpp>
 #include <MachO/LoadCommand.hpp>
+#include <MachO/MappedFile.hpp>
+#include <MachO/ObjCCategory.hpp>
+#include <MachO/ObjCClass.hpp>
+#include <MachO/ObjCIvar.hpp>
+#include <MachO/ObjCMetadata.hpp>
+#include <MachO/ObjCMethod.hpp>
+#include <MachO/ObjCProtocol.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/ParseCache.hpp>
+#include <MachO/QueryServer.hpp>
 #include <MachO/Platform.hpp>
+#include <MachO/Relocation.hpp>
+#include <MachO/RelocationList.hpp>
+#include <MachO/ScanManifest.hpp>
 #include <MachO/Section.hpp>
 #include <MachO/Section64.hpp>
 #include <MachO/SectionFlags.hpp>
+#include <MachO/SwiftConformance.hpp>
+#include <MachO/SwiftDescriptor.hpp>
+#include <MachO/SwiftField.hpp>
+#include <MachO/SwiftFieldDescriptor.hpp>
+#include <MachO/SwiftMetadata.hpp>
 #include <MachO/Symbol.hpp>
+#include <MachO/SymbolDiff.hpp>
+#include <MachO/Symbolicator.hpp>
 #include <MachO/Tool.hpp>
 #include <MachO/ToString.hpp>
+#include <MachO/ZipEntry.hpp>
+#include <MachO/ZipFile.hpp>
 
 #include <MachO/LoadCommands/BuildVersion.hpp>
 #include <MachO/LoadCommands/DyldInfo.hpp>
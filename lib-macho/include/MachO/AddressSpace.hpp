@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      AddressSpace.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_ADDRESS_SPACE_HPP
+#define MACHO_ADDRESS_SPACE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <XS.hpp>
+#include <MachO/MappedFile.hpp>
+
+namespace MachO
+{
+    class File;
+    
+    class AddressSpace: public XS::Info::Object
+    {
+        public:
+            
+            struct Range
+            {
+                uint64_t vmAddress;
+                uint64_t size;
+                uint64_t fileOffset;
+                size_t   file = 0;
+            };
+            
+            AddressSpace( const File & file );
+            AddressSpace( const MappedFile & data, const std::vector< Range > & ranges, bool bigEndian );
+            AddressSpace( const std::vector< MappedFile > & files, const std::vector< Range > & ranges, bool bigEndian );
+            AddressSpace( const AddressSpace & o );
+            AddressSpace( AddressSpace && o ) noexcept;
+            ~AddressSpace() override;
+            
+            AddressSpace & operator =( AddressSpace o );
+            
+            XS::Info getInfo() const override;
+            
+            std::vector< Range >      ranges()    const;
+            MappedFile                data()      const;
+            std::vector< MappedFile > files()     const;
+            bool                      bigEndian() const;
+            
+            bool                      contains( uint64_t address, size_t size = 1 ) const;
+            std::optional< uint64_t > toFileOffset( uint64_t address )              const;
+            const uint8_t           * pointer( uint64_t address, size_t size )      const;
+            std::string_view          readCString( uint64_t address )               const;
+            
+            template< typename T >
+            T read( uint64_t address ) const
+            {
+                static_assert( std::is_integral< T >::value, "AddressSpace::read requires an integral type" );
+                
+                T value;
+                
+                std::memcpy( &value, this->pointer( address, sizeof( T ) ), sizeof( T ) );
+                
+                return ( this->bigEndian() == MappedFile::IsBigEndianHost() ) ? value : MappedFile::Swap( value );
+            }
+            
+            friend void swap( AddressSpace & o1, AddressSpace & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_ADDRESS_SPACE_HPP */
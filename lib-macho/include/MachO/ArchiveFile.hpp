@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ArchiveFile.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_ARCHIVE_FILE_HPP
+#define MACHO_ARCHIVE_FILE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <MachO/ArchiveMember.hpp>
+#include <MachO/File.hpp>
+#include <MachO/MappedFile.hpp>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class ArchiveFile: public XS::Info::Object
+    {
+        public:
+            
+            ArchiveFile( const std::string & path );
+            ArchiveFile( const MappedFile & data );
+            ArchiveFile( const ArchiveFile & o );
+            ArchiveFile( ArchiveFile && o ) noexcept;
+            ~ArchiveFile( void ) override;
+            
+            ArchiveFile & operator =( ArchiveFile o );
+            
+            XS::Info getInfo() const override;
+            
+            static bool IsArchive( const MappedFile & data );
+            
+            std::optional< std::string > path()    const;
+            MappedFile                   data()    const;
+            std::vector< ArchiveMember > members() const;
+            
+            bool isMachO( size_t index ) const;
+            
+            /* Members are parsed in place, on first access */
+            File                                            member( size_t index ) const;
+            std::vector< std::pair< ArchiveMember, File > > parseMembers()         const;
+            
+            /* Answered from the __.SYMDEF or GNU symbol table, without parsing members */
+            bool                    hasSymbolTable()                    const;
+            std::optional< size_t > memberIndex( std::string_view symbol ) const;
+            
+            friend void swap( ArchiveFile & o1, ArchiveFile & o2 );
+            
+        private:
+            
+            class IMPL;
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_ARCHIVE_FILE_HPP */
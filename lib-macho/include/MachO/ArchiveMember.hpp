@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ArchiveMember.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_ARCHIVE_MEMBER_HPP
+#define MACHO_ARCHIVE_MEMBER_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <cstdint>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class ArchiveMember: public XS::Info::Object
+    {
+        public:
+            
+            ArchiveMember( const std::string & name, uint64_t headerOffset, uint64_t offset, uint64_t size, uint64_t modificationTime, uint32_t mode );
+            ArchiveMember( const ArchiveMember & o );
+            ArchiveMember( ArchiveMember && o ) noexcept;
+            ~ArchiveMember( void ) override;
+            
+            ArchiveMember & operator =( ArchiveMember o );
+            
+            XS::Info getInfo() const override;
+            
+            std::string name()             const;
+            uint64_t    headerOffset()     const;
+            uint64_t    offset()           const;
+            uint64_t    size()             const;
+            uint64_t    modificationTime() const;
+            uint32_t    mode()             const;
+            
+            friend void swap( ArchiveMember & o1, ArchiveMember & o2 );
+            
+        private:
+            
+            class IMPL;
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_ARCHIVE_MEMBER_HPP */
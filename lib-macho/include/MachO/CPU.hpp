@@ -57,6 +57,9 @@ namespace MachO
             std::string subTypeString() const;
             std::string description()   const;
             
+            /* Short architecture name, as used by lipo (arm64, x86_64, ...) */
+            std::string name()          const;
+            
             friend void swap( CPU & o1, CPU & o2 );
             
         private:
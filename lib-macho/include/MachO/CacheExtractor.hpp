@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CacheExtractor.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_CACHE_EXTRACTOR_HPP
+#define MACHO_CACHE_EXTRACTOR_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <MachO/CacheFile.hpp>
+
+namespace MachO
+{
+    class CacheExtractor
+    {
+        public:
+            
+            CacheExtractor( const CacheFile & cache );
+            CacheExtractor( const CacheExtractor & o );
+            CacheExtractor( CacheExtractor && o ) noexcept;
+            ~CacheExtractor( void );
+            
+            CacheExtractor & operator =( CacheExtractor o );
+            
+            CacheFile cache() const;
+            
+            /* Writes a standalone Mach-O for the image, with its own __LINKEDIT and rebased pointers */
+            void extract( size_t index, const std::string & path ) const;
+            
+            /* Images are extracted in parallel, once per install path, and the written paths are returned */
+            std::vector< std::string > extractAll( const std::string & directory ) const;
+            
+            friend void swap( CacheExtractor & o1, CacheExtractor & o2 );
+            
+        private:
+            
+            class IMPL;
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_CACHE_EXTRACTOR_HPP */
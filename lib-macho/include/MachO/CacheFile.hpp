@@ -34,8 +34,15 @@
 #include <algorithm>
 #include <vector>
 #include <optional>
+#include <string_view>
+#include <MachO/AddressSpace.hpp>
 #include <MachO/CacheImageInfo.hpp>
+#include <MachO/CacheLocalSymbols.hpp>
 #include <MachO/CacheMappingInfo.hpp>
+#include <MachO/CacheSlideInfo.hpp>
+#include <MachO/CacheSubCacheInfo.hpp>
+#include <MachO/File.hpp>
+#include <MachO/MappedFile.hpp>
 #include <XS.hpp>
 
 namespace MachO
@@ -46,6 +53,7 @@ namespace MachO
             
             CacheFile( const std::string & path );
             CacheFile( XS::IO::BinaryStream & stream );
+            CacheFile( const MappedFile & data );
             CacheFile( const CacheFile & o );
             CacheFile( CacheFile && o ) noexcept;
             ~CacheFile( void ) override;
@@ -54,16 +62,52 @@ namespace MachO
             
             XS::Info getInfo() const override;
             
-            std::optional< std::string > path()          const;
-            std::string                  header()        const;
-            uint32_t                     mappingOffset() const;
-            uint32_t                     mappingCount()  const;
-            uint32_t                     imageOffset()   const;
-            uint32_t                     imageCount()    const;
-            uint32_t                     baseAddress()   const;
+            std::optional< std::string > path()                   const;
+            std::string                  header()                 const;
+            uint32_t                     mappingOffset()          const;
+            uint32_t                     mappingCount()           const;
+            uint32_t                     imageOffset()            const;
+            uint32_t                     imageCount()             const;
+            uint64_t                     baseAddress()            const;
+            uint64_t                     codeSignatureOffset()    const;
+            uint64_t                     codeSignatureSize()      const;
+            uint64_t                     localSymbolsOffset()     const;
+            uint64_t                     localSymbolsSize()       const;
+            std::string                  uuid()                   const;
+            uint64_t                     cacheType()              const;
+            uint64_t                     imagesTextOffset()       const;
+            uint64_t                     imagesTextCount()        const;
+            uint32_t                     platform()               const;
+            uint32_t                     formatVersion()          const;
+            uint64_t                     sharedRegionStart()      const;
+            uint64_t                     sharedRegionSize()       const;
+            uint64_t                     maxSlide()               const;
+            uint64_t                     dylibsTrieAddress()      const;
+            uint64_t                     dylibsTrieSize()         const;
+            uint32_t                     mappingWithSlideOffset() const;
+            uint32_t                     mappingWithSlideCount()  const;
+            uint32_t                     subCacheArrayOffset()    const;
+            uint32_t                     subCacheArrayCount()     const;
+            std::optional< std::string > symbolFileUUID()         const;
+            uint32_t                     cacheSubType()           const;
+            uint64_t                     objcOptsOffset()         const;
+            uint64_t                     objcOptsSize()           const;
             
-            std::vector< CacheImageInfo >   images()   const;
-            std::vector< CacheMappingInfo > mappings() const;
+            std::vector< CacheImageInfo >    images()    const;
+            std::vector< CacheMappingInfo >  mappings()  const;
+            std::vector< CacheSubCacheInfo > subCaches() const;
+            
+            std::optional< MappedFile >        data()                              const;
+            AddressSpace                       addressSpace()                      const;
+            std::vector< CacheSlideInfo >      slideInfo()                         const;
+            CacheFile                          subCache( size_t index )            const;
+            std::optional< CacheFile >         symbolFile()                        const;
+            std::optional< CacheLocalSymbols > localSymbols()                      const;
+            std::vector< Symbol >              localSymbols( size_t index )        const;
+            std::optional< size_t >            imageIndex( std::string_view path ) const;
+            std::optional< uint64_t >          relativeMethodSelectorBase()        const;
+            File                               image( size_t index )               const;
+            std::vector< File >                parseImages()                       const;
             
             friend void swap( CacheFile & o1, CacheFile & o2 );
             
@@ -33,8 +33,10 @@
 #include <XS.hpp>
 #include <memory>
 #include <algorithm>
+#include <optional>
 #include <string>
 #include <XS.hpp>
+#include <MachO/MappedFile.hpp>
 
 namespace MachO
 {
@@ -43,6 +45,7 @@ namespace MachO
         public:
             
             CacheImageInfo( XS::IO::BinaryStream & stream );
+            CacheImageInfo( const MappedFile & data, size_t offset );
             CacheImageInfo( const CacheImageInfo & o );
             CacheImageInfo( CacheImageInfo && o ) noexcept;
             ~CacheImageInfo( void ) override;
@@ -54,6 +57,7 @@ namespace MachO
             uint64_t    address()          const;
             uint64_t    modificationTime() const;
             uint64_t    inode()            const;
+            uint32_t    pathFileOffset()   const;
             std::string path()             const;
             
             friend void swap( CacheImageInfo & o1, CacheImageInfo & o2 );
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CacheLocalSymbols.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_CACHE_LOCAL_SYMBOLS_HPP
+#define MACHO_CACHE_LOCAL_SYMBOLS_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include <XS.hpp>
+#include <MachO/MappedFile.hpp>
+#include <MachO/Symbol.hpp>
+
+namespace MachO
+{
+    class CacheLocalSymbols: public XS::Info::Object
+    {
+        public:
+            
+            struct Entry
+            {
+                uint64_t dylibOffset;
+                uint32_t nlistStartIndex;
+                uint32_t nlistCount;
+            };
+            
+            CacheLocalSymbols( const MappedFile & data, uint64_t offset, uint64_t size, bool is64, bool largeEntries );
+            CacheLocalSymbols( const CacheLocalSymbols & o );
+            CacheLocalSymbols( CacheLocalSymbols && o ) noexcept;
+            ~CacheLocalSymbols( void ) override;
+            
+            CacheLocalSymbols & operator =( CacheLocalSymbols o );
+            
+            XS::Info getInfo() const override;
+            
+            uint32_t nlistCount()  const;
+            uint32_t stringsSize() const;
+            uint32_t entryCount()  const;
+            
+            std::optional< Entry > entry( uint64_t dylibOffset )   const;
+            std::vector< Symbol >  symbols( uint64_t dylibOffset ) const;
+            std::string_view       string( uint32_t index )        const;
+            
+            friend void swap( CacheLocalSymbols & o1, CacheLocalSymbols & o2 );
+            
+        private:
+            
+            class IMPL;
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_CACHE_LOCAL_SYMBOLS_HPP */
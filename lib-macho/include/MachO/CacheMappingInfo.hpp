@@ -42,6 +42,7 @@ namespace MachO
         public:
             
             CacheMappingInfo( XS::IO::BinaryStream & stream );
+            CacheMappingInfo( XS::IO::BinaryStream & stream, bool hasSlideInfo );
             CacheMappingInfo( const CacheMappingInfo & o );
             CacheMappingInfo( CacheMappingInfo && o ) noexcept;
             ~CacheMappingInfo( void ) override;
@@ -50,11 +51,14 @@ namespace MachO
             
             XS::Info getInfo() const override;
             
-            uint64_t address()    const;
-            uint64_t size()       const;
-            uint64_t fileOffset() const;
-            uint32_t maxProt()    const;
-            uint32_t initProt()   const;
+            uint64_t address()             const;
+            uint64_t size()                const;
+            uint64_t fileOffset()          const;
+            uint64_t slideInfoFileOffset() const;
+            uint64_t slideInfoFileSize()   const;
+            uint64_t flags()               const;
+            uint32_t maxProt()             const;
+            uint32_t initProt()            const;
             
             friend void swap( CacheMappingInfo & o1, CacheMappingInfo & o2 );
             
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CacheSlideInfo.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_CACHE_SLIDE_INFO_HPP
+#define MACHO_CACHE_SLIDE_INFO_HPP
+
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <XS.hpp>
+#include <MachO/CacheMappingInfo.hpp>
+#include <MachO/MappedFile.hpp>
+
+namespace MachO
+{
+    class CacheSlideInfo: public XS::Info::Object
+    {
+        public:
+            
+            CacheSlideInfo( const MappedFile & data, const CacheMappingInfo & mapping );
+            CacheSlideInfo( const CacheSlideInfo & o );
+            CacheSlideInfo( CacheSlideInfo && o ) noexcept;
+            ~CacheSlideInfo( void ) override;
+            
+            CacheSlideInfo & operator =( CacheSlideInfo o );
+            
+            XS::Info getInfo() const override;
+            
+            CacheMappingInfo mapping()   const;
+            uint32_t         version()   const;
+            uint32_t         pageSize()  const;
+            uint32_t         pageCount() const;
+            uint64_t         valueAdd()  const;
+            
+            bool     contains( uint64_t address )    const;
+            uint64_t decode( uint64_t value )        const;
+            uint64_t readPointer( uint64_t address ) const;
+            
+            /* Callbacks may run concurrently, one page per task */
+            void forEachPointer( const std::function< void( uint64_t address, uint64_t target ) > & callback ) const;
+            void forEachPointer( uint32_t page, const std::function< void( uint64_t address, uint64_t target ) > & callback ) const;
+            
+            friend void swap( CacheSlideInfo & o1, CacheSlideInfo & o2 );
+            
+        private:
+            
+            class IMPL;
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_CACHE_SLIDE_INFO_HPP */
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CacheSubCacheInfo.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_CACHE_SUB_CACHE_INFO_HPP
+#define MACHO_CACHE_SUB_CACHE_INFO_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class CacheSubCacheInfo: public XS::Info::Object
+    {
+        public:
+            
+            CacheSubCacheInfo( XS::IO::BinaryStream & stream, bool hasFileSuffix, size_t index );
+            CacheSubCacheInfo( const CacheSubCacheInfo & o );
+            CacheSubCacheInfo( CacheSubCacheInfo && o ) noexcept;
+            ~CacheSubCacheInfo( void ) override;
+            
+            CacheSubCacheInfo & operator =( CacheSubCacheInfo o );
+            
+            XS::Info getInfo() const override;
+            
+            std::string uuid()       const;
+            uint64_t    vmOffset()   const;
+            std::string fileSuffix() const;
+            
+            friend void swap( CacheSubCacheInfo & o1, CacheSubCacheInfo & o2 );
+            
+        private:
+            
+            class IMPL;
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_CACHE_SUB_CACHE_INFO_HPP */
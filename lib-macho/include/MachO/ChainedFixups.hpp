@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ChainedFixups.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_CHAINED_FIXUPS_HPP
+#define MACHO_CHAINED_FIXUPS_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class File;
+    
+    class ChainedFixups: public XS::Info::Object
+    {
+        public:
+            
+            struct Pointer
+            {
+                uint64_t                  target;
+                std::optional< uint32_t > ordinal;
+            };
+            
+            ChainedFixups( const File & file );
+            ChainedFixups( const ChainedFixups & o );
+            ChainedFixups( ChainedFixups && o ) noexcept;
+            ~ChainedFixups() override;
+            
+            ChainedFixups & operator =( ChainedFixups o );
+            
+            XS::Info getInfo() const override;
+            
+            uint64_t                        baseAddress()   const;
+            uint16_t                        pointerFormat() const;
+            std::vector< std::string_view > imports()       const;
+            
+            std::optional< std::string > import( uint32_t ordinal ) const;
+            Pointer                      decode( uint64_t value )   const;
+            
+            friend void swap( ChainedFixups & o1, ChainedFixups & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_CHAINED_FIXUPS_HPP */
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CodeDirectory.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_CODE_DIRECTORY_HPP
+#define MACHO_CODE_DIRECTORY_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <XS.hpp>
+#include <MachO/Digest.hpp>
+#include <MachO/MappedFile.hpp>
+
+namespace MachO
+{
+    class CodeDirectory: public XS::Info::Object
+    {
+        public:
+            
+            /* Blob data is big-endian and must start with the CSMAGIC_CODEDIRECTORY header */
+            CodeDirectory( const MappedFile & blob );
+            CodeDirectory( const CodeDirectory & o );
+            CodeDirectory( CodeDirectory && o ) noexcept;
+            ~CodeDirectory() override;
+            
+            CodeDirectory & operator =( CodeDirectory o );
+            
+            XS::Info getInfo() const override;
+            
+            MappedFile                    blob()             const;
+            uint32_t                      version()          const;
+            uint32_t                      flags()            const;
+            uint8_t                       hashType()         const;
+            std::optional< Digest::Type > digestType()       const;
+            size_t                        hashSize()         const;
+            uint8_t                       platform()         const;
+            size_t                        pageSize()         const;
+            uint64_t                      codeLimit()        const;
+            std::string                   identifier()       const;
+            std::optional< std::string >  teamIdentifier()   const;
+            uint32_t                      specialSlotCount() const;
+            uint32_t                      codeSlotCount()    const;
+            std::optional< uint64_t >     execSegmentBase()  const;
+            std::optional< uint64_t >     execSegmentLimit() const;
+            std::optional< uint64_t >     execSegmentFlags() const;
+            
+            /* Slot hashes point into the blob; special slots are numbered from 1 */
+            const uint8_t * codeHash( size_t index )   const;
+            const uint8_t * specialHash( size_t slot ) const;
+            
+            /* Digest of the whole directory, truncated to 20 bytes */
+            std::vector< uint8_t >        cdHash()           const;
+            
+            friend void swap( CodeDirectory & o1, CodeDirectory & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_CODE_DIRECTORY_HPP */
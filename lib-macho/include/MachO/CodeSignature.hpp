@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CodeSignature.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_CODE_SIGNATURE_HPP
+#define MACHO_CODE_SIGNATURE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <XS.hpp>
+#include <MachO/CodeDirectory.hpp>
+#include <MachO/MappedFile.hpp>
+
+namespace MachO
+{
+    class File;
+    
+    class CodeSignature: public XS::Info::Object
+    {
+        public:
+            
+            struct Verification
+            {
+                bool                  valid;
+                size_t                pages;
+                std::vector< size_t > mismatchedPages;
+                std::vector< size_t > mismatchedSpecialSlots;
+            };
+            
+            CodeSignature( const File & file );
+            CodeSignature( const CodeSignature & o );
+            CodeSignature( CodeSignature && o ) noexcept;
+            ~CodeSignature() override;
+            
+            CodeSignature & operator =( CodeSignature o );
+            
+            XS::Info getInfo() const override;
+            
+            bool isSigned() const;
+            
+            /* The primary directory comes first, followed by alternate ones */
+            std::vector< CodeDirectory > codeDirectories() const;
+            std::optional< MappedFile >  cmsSignature()    const;
+            
+            /* Requirements are decompiled to the csreq language, keyed by requirement type */
+            std::vector< std::pair< uint32_t, std::string > > requirements()    const;
+            std::optional< std::string >                      entitlements()    const;
+            std::optional< std::vector< uint8_t > >           derEntitlements() const;
+            
+            /* Page hashes are checked on all threads; verify() uses the strongest directory */
+            Verification verify()                                   const;
+            Verification verify( const CodeDirectory & directory ) const;
+            
+            static std::string RequirementTypeName( uint32_t type );
+            
+            friend void swap( CodeSignature & o1, CodeSignature & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_CODE_SIGNATURE_HPP */
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CodeSigner.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_CODE_SIGNER_HPP
+#define MACHO_CODE_SIGNER_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+
+namespace MachO
+{
+    class CodeSigner
+    {
+        public:
+            
+            CodeSigner( const std::string & path );
+            CodeSigner( const CodeSigner & o );
+            CodeSigner( CodeSigner && o ) noexcept;
+            ~CodeSigner( void );
+            
+            CodeSigner & operator =( CodeSigner o );
+            
+            std::string path() const;
+            
+            /*
+             * Ad-hoc signs every architecture with a SHA-256 code directory, hashing pages on all threads.
+             * Files are updated in place through a shared mapping; thin files are resized to fit the
+             * signature, while fat slices must already have room for it.
+             */
+            void sign( const std::string & identifier )                             const;
+            void sign( const std::string & identifier, const std::string & output ) const;
+            
+            friend void swap( CodeSigner & o1, CodeSigner & o2 );
+            
+        private:
+            
+            class IMPL;
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_CODE_SIGNER_HPP */
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      DebugInfo.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_DEBUG_INFO_HPP
+#define MACHO_DEBUG_INFO_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <MachO/File.hpp>
+
+namespace MachO
+{
+    class DebugInfo
+    {
+        public:
+            
+            struct Frame
+            {
+                std::string function;
+                std::string file;
+                uint32_t    line;
+                uint32_t    column;
+            };
+            
+            /* Frames are ordered from the innermost inlined function to the concrete function */
+            struct Location
+            {
+                uint64_t             address;
+                std::vector< Frame > frames;
+            };
+            
+            /*
+             * DWARF data is read from the __DWARF segment, e.g. of a dSYM companion file.
+             * Compilation units are only decoded when an address falls in their ranges.
+             */
+            DebugInfo( const File & file );
+            
+            /*
+             * The compilation unit ranges are stored in the given directory, keyed by the
+             * UUID of the file, so later instances do not need to read .debug_info at all.
+             */
+            DebugInfo( const File & file, const std::string & indexDirectory );
+            DebugInfo( const DebugInfo & o );
+            DebugInfo( DebugInfo && o ) noexcept;
+            ~DebugInfo( void );
+            
+            DebugInfo & operator =( DebugInfo o );
+            
+            bool   hasDebugInfo() const;
+            size_t unitCount()    const;
+            
+            /* Addresses are link-time addresses, i.e. already unslid */
+            Location                lookup( uint64_t address )                        const;
+            std::vector< Location > lookup( const std::vector< uint64_t > & addresses ) const;
+            
+            friend void swap( DebugInfo & o1, DebugInfo & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_DEBUG_INFO_HPP */
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      Demangler.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_DEMANGLER_HPP
+#define MACHO_DEMANGLER_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace MachO
+{
+    class Demangler
+    {
+        public:
+            
+            /*
+             * Demangled names are memoized, so a single instance can be shared across the files
+             * of a run, and between threads.
+             */
+            Demangler( void );
+            Demangler( const Demangler & o );
+            Demangler( Demangler && o ) noexcept;
+            ~Demangler( void );
+            
+            Demangler & operator =( Demangler o );
+            
+            size_t cacheSize() const;
+            
+            /* Names that are not mangled, or cannot be demangled, are returned unchanged */
+            std::string                demangle( const std::string & name )                 const;
+            std::vector< std::string > demangle( const std::vector< std::string > & names ) const;
+            
+            /* Accepts Itanium C++ and Swift names, with or without the leading underscore of Mach-O symbols */
+            static std::optional< std::string > Demangle( const std::string & name );
+            static std::optional< std::string > Itanium( const std::string & name );
+            static std::optional< std::string > Swift( const std::string & name );
+            
+            friend void swap( Demangler & o1, Demangler & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_DEMANGLER_HPP */
@@ -35,6 +35,7 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <MachO/ArchiveFile.hpp>
 #include <MachO/FatArch.hpp>
 #include <MachO/File.hpp>
 #include <XS.hpp>
@@ -47,6 +48,7 @@ namespace MachO
             
             FatFile( const std::string & path );
             FatFile( XS::IO::BinaryStream & stream );
+            FatFile( const MappedFile & data );
             FatFile( const FatFile & o );
             FatFile( FatFile && o ) noexcept;
             ~FatFile() override;
@@ -55,8 +57,15 @@ namespace MachO
             
             XS::Info getInfo() const override;
             
-            std::optional< std::string >              path()          const;
-            std::vector< std::pair< FatArch, File > > architectures() const;
+            std::optional< std::string >                     path()          const;
+            std::vector< std::pair< FatArch, File > >        architectures() const;
+            std::vector< std::pair< FatArch, ArchiveFile > > archives()      const;
+            
+            /* Slices are copied between files by the kernel and never buffered in memory */
+            void extract( const std::string & arch, const std::string & output ) const;
+            
+            /* Inputs may be thin Mach-O files or fat files, whose slices are all kept */
+            static void Create( const std::vector< std::string > & inputs, const std::string & output );
             
             friend void swap( FatFile & o1, FatFile & o2 );
             
@@ -35,15 +35,26 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <functional>
 #include <XS.hpp>
 #include <MachO/LoadCommand.hpp>
 #include <MachO/FileFlags.hpp>
 #include <MachO/FileType.hpp>
 #include <MachO/CPU.hpp>
+#include <MachO/MappedFile.hpp>
+#include <MachO/RelocationList.hpp>
 
 namespace MachO
 {
+    class AddressSpace;
     class Symbol;
+    class Section;
+    class Section64;
+    class IndirectSymbolTable;
+    class ObjCMetadata;
+    class SwiftMetadata;
+    class CodeSignature;
+    class FileSummary;
     
     class File: public XS::Info::Object
     {
@@ -60,6 +71,8 @@ namespace MachO
                 LittleEndian,
                 BigEndian
             };
+            
+            using DataResolver = std::function< MappedFile( uint64_t vmAddress ) >;
 
             #ifdef __APPLE__
             static std::optional< std::tuple< File, const void * > > fromCurrentProcess( const std::string & path );
@@ -67,6 +80,12 @@ namespace MachO
 
             File( const std::string & path );
             File( XS::IO::BinaryStream & stream );
+            File( const MappedFile & data );
+            File( const MappedFile & data, size_t offset );
+            File( const MappedFile & data, size_t offset, const DataResolver & resolver );
+            
+            /* Backed by a cached summary; load commands are only parsed from the file when accessed */
+            File( const std::string & path, const FileSummary & summary );
             File( const File & o );
             File( File && o ) noexcept;
             ~File() override;
@@ -75,19 +94,35 @@ namespace MachO
             
             XS::Info getInfo() const override;
             
-            std::optional< std::string > path()       const;
-            Kind                         kind()       const;
-            Endianness                   endianness() const;
-            CPU                          cpu()        const;
-            FileType                     type()       const;
-            FileFlags                    flags()      const;
+            std::optional< std::string > path()         const;
+            Kind                         kind()         const;
+            Endianness                   endianness()   const;
+            CPU                          cpu()          const;
+            FileType                     type()         const;
+            FileFlags                    flags()        const;
+            std::optional< MappedFile >  mappedFile()   const;
+            AddressSpace                 addressSpace() const;
+            
+            std::vector< std::reference_wrapper< LoadCommand > > loadCommands()        const;
+            std::vector< std::string >                           linkedLibraries()     const;
+            std::vector< Symbol >                                symbols()             const;
+            std::vector< std::string >                           strings()             const;
+            std::vector< std::string >                           objcClasses()         const;
+            std::vector< std::string >                           objcMethods()         const;
+            IndirectSymbolTable                                  indirectSymbolTable() const;
+            ObjCMetadata                                         objcMetadata()        const;
+            SwiftMetadata                                        swiftMetadata()       const;
+            CodeSignature                                        codeSignature()       const;
+            
+            RelocationList relocations( const Section & section )   const;
+            RelocationList relocations( const Section64 & section ) const;
+            RelocationList externalRelocations()                    const;
+            RelocationList localRelocations()                       const;
             
-            std::vector< std::reference_wrapper< LoadCommand > > loadCommands()    const;
-            std::vector< std::string >                           linkedLibraries() const;
-            std::vector< Symbol >                                symbols()         const;
-            std::vector< std::string >                           strings()         const;
-            std::vector< std::string >                           objcClasses()     const;
-            std::vector< std::string >                           objcMethods()     const;
+            /* Embedded Mach-Os of a fileset (e.g. kernel collections), parsed in place on first access */
+            File                filesetEntry( size_t index ) const;
+            std::vector< File > filesetEntries()             const;
+            std::vector< File > parseFilesetEntries()        const;
             
             template< typename T, typename std::enable_if< std::is_base_of< LoadCommand, T >::value >::type * = nullptr >
             std::vector< T > loadCommands() const
@@ -0,0 +1,57 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      FileCopy.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_FILE_COPY_HPP
+#define MACHO_FILE_COPY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace MachO
+{
+    namespace FileCopy
+    {
+        /*
+         * Copies a byte range between two descriptors. The kernel moves the data with
+         * copy_file_range where available; otherwise the source range is mapped and written out.
+         */
+        void Range( int from, uint64_t offset, uint64_t size, int to, uint64_t destination );
+        void Range( const std::string & from, uint64_t offset, uint64_t size, int to, uint64_t destination );
+        void Write( int to, uint64_t destination, const uint8_t * data, size_t size );
+        void Read( int from, uint64_t offset, uint8_t * data, size_t size );
+        void File( const std::string & from, const std::string & to );
+        
+        /* Creates or truncates a file for writing, throwing on failure */
+        int Create( const std::string & path, int mode = 0755 );
+        int Open( const std::string & path );
+    }
+}
+
+#endif /* MACHO_FILE_COPY_HPP */
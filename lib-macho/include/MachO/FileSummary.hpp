@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      FileSummary.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_FILE_SUMMARY_HPP
+#define MACHO_FILE_SUMMARY_HPP
+
+#include <memory>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <XS.hpp>
+#include <MachO/CPU.hpp>
+#include <MachO/File.hpp>
+#include <MachO/FileFlags.hpp>
+#include <MachO/FileType.hpp>
+#include <MachO/MappedFile.hpp>
+
+namespace MachO
+{
+    class Symbol;
+    
+    class FileSummary
+    {
+        public:
+            
+            /* Identifies the exact file a summary was built from */
+            struct Identity
+            {
+                uint64_t                  device;
+                uint64_t                  inode;
+                uint64_t                  size;
+                uint64_t                  mtime;
+                bool                      hasUUID;
+                std::array< uint8_t, 16 > uuid;
+                
+                bool operator ==( const Identity & o ) const;
+                bool operator !=( const Identity & o ) const;
+            };
+            
+            struct Command
+            {
+                uint32_t command;
+                uint32_t size;
+                XS::Info info;
+            };
+            
+            /*
+             * Summaries are flat, host-endian tables of fixed-size columns referencing a shared
+             * string pool, so a mapped summary is read in place without any decoding step.
+             */
+            static std::vector< uint8_t > Serialize( const File & file, const Identity & identity );
+            
+            FileSummary( const MappedFile & data );
+            FileSummary( const FileSummary & o );
+            FileSummary( FileSummary && o ) noexcept;
+            ~FileSummary( void );
+            
+            FileSummary & operator =( FileSummary o );
+            
+            Identity         identity()   const;
+            File::Kind       kind()       const;
+            File::Endianness endianness() const;
+            CPU              cpu()        const;
+            FileType         type()       const;
+            FileFlags        flags()      const;
+            
+            std::vector< Command >     loadCommands()    const;
+            std::vector< std::string > linkedLibraries() const;
+            std::vector< Symbol >      symbols()         const;
+            std::vector< std::string > strings()         const;
+            std::vector< std::string > objcClasses()     const;
+            std::vector< std::string > objcMethods()     const;
+            
+            friend void swap( FileSummary & o1, FileSummary & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_FILE_SUMMARY_HPP */
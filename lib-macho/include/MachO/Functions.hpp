@@ -32,13 +32,21 @@
 
 #include <string>
 #include <variant>
+#include <MachO/ArchiveFile.hpp>
 #include <MachO/File.hpp>
 #include <MachO/FatFile.hpp>
 #include <MachO/CacheFile.hpp>
+#include <MachO/MappedFile.hpp>
+#include <MachO/ParseCache.hpp>
+#include <MachO/ZipFile.hpp>
 
 namespace MachO
 {
-    std::variant< File, FatFile, CacheFile > Parse( const std::string & path );
+    std::variant< File, FatFile, CacheFile, ArchiveFile, ZipFile > Parse( const std::string & path );
+    std::variant< File, FatFile, CacheFile, ArchiveFile, ZipFile > Parse( const MappedFile & data );
+    
+    /* Thin Mach-O files are served from the cache when their summary is still valid */
+    std::variant< File, FatFile, CacheFile, ArchiveFile, ZipFile > Parse( const std::string & path, const ParseCache & cache );
 }
 
 #endif /* MACHO_FUNCTIONS_HPP */
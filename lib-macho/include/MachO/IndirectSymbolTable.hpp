@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      IndirectSymbolTable.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_INDIRECT_SYMBOL_TABLE_HPP
+#define MACHO_INDIRECT_SYMBOL_TABLE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <vector>
+#include <cstdint>
+#include <XS.hpp>
+#include <MachO/File.hpp>
+#include <MachO/Symbol.hpp>
+
+namespace MachO
+{
+    class IndirectSymbolTable: public XS::Info::Object
+    {
+        public:
+
+            IndirectSymbolTable( const File & file );
+            IndirectSymbolTable( const IndirectSymbolTable & o );
+            IndirectSymbolTable( IndirectSymbolTable && o ) noexcept;
+            ~IndirectSymbolTable() override;
+
+            IndirectSymbolTable & operator =( IndirectSymbolTable o );
+
+            XS::Info getInfo() const override;
+
+            size_t                  count()   const;
+            std::vector< uint32_t > entries() const;
+
+            std::optional< uint32_t > symbolIndex( uint64_t address ) const;
+            std::optional< Symbol >   symbol( uint64_t address )      const;
+
+            friend void swap( IndirectSymbolTable & o1, IndirectSymbolTable & o2 );
+
+        private:
+
+            class IMPL;
+
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_INDIRECT_SYMBOL_TABLE_HPP */
@@ -33,6 +33,7 @@
 #include <MachO/LoadCommand.hpp>
 #include <MachO/File.hpp>
 #include <XS.hpp>
+#include <vector>
 
 namespace MachO
 {
@@ -43,6 +44,7 @@ namespace MachO
             public:
                 
                 DysymTab( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream );
+                DysymTab( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const MappedFile & data, File::Endianness endianness );
                 DysymTab( const DysymTab & o );
                 DysymTab( DysymTab && o ) noexcept;
                 ~DysymTab() override;
@@ -71,6 +73,8 @@ namespace MachO
                 uint32_t externalRelocationCount()     const;
                 uint32_t localRelocationOffset()       const;
                 uint32_t localRelocationCount()        const;
+                
+                std::vector< uint32_t > indirectSymbols() const;
 
                 friend void swap( DysymTab & o1, DysymTab & o2 );
                 
@@ -34,6 +34,7 @@
 #include <MachO/File.hpp>
 #include <XS.hpp>
 #include <MachO/Section.hpp>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -46,6 +47,7 @@ namespace MachO
             public:
                 
                 Segment( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream );
+                Segment( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const MappedFile & data );
                 Segment( const Segment & o );
                 Segment( Segment && o ) noexcept;
                 ~Segment() override;
@@ -70,6 +72,8 @@ namespace MachO
                 std::vector< Section > sections( const std::string & name )                 const;
                 std::vector< Section > sections( const std::initializer_list< std::string > & names ) const;
                 
+                std::optional< MappedFile > mappedFile() const;
+                
                 friend void swap( Segment & o1, Segment & o2 );
                 
             private:
@@ -34,6 +34,7 @@
 #include <MachO/File.hpp>
 #include <XS.hpp>
 #include <MachO/Section64.hpp>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -46,6 +47,7 @@ namespace MachO
             public:
                 
                 Segment64( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream );
+                Segment64( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const MappedFile & data );
                 Segment64( const Segment64 & o );
                 Segment64( Segment64 && o ) noexcept;
                 ~Segment64() override;
@@ -70,6 +72,8 @@ namespace MachO
                 std::vector< Section64 > sections( const std::string & name )                 const;
                 std::vector< Section64 > sections( const std::initializer_list< std::string > & names ) const;
                 
+                std::optional< MappedFile > mappedFile() const;
+                
                 friend void swap( Segment64 & o1, Segment64 & o2 );
                 
             private:
@@ -34,6 +34,8 @@
 #include <MachO/File.hpp>
 #include <MachO/Symbol.hpp>
 #include <XS.hpp>
+#include <optional>
+#include <string_view>
 
 namespace MachO
 {
@@ -42,8 +44,19 @@ namespace MachO
         class SymTab: public LoadCommand
         {
             public:
-
+                
+                /* Names point into the mapped string table, and are valid as long as a copy of the table exists */
+                struct Entry
+                {
+                    std::string_view name;
+                    uint8_t          type;
+                    uint8_t          section;
+                    uint16_t         description;
+                    uint64_t         value;
+                };
+                
                 SymTab( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream );
+                SymTab( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const MappedFile & data, File::Endianness endianness );
                 SymTab( const SymTab & o );
                 SymTab( SymTab && o ) noexcept;
                 ~SymTab() override;
@@ -61,7 +74,11 @@ namespace MachO
 
                 std::vector< std::string >  strings() const;
                 std::vector< Symbol >       symbols() const;
-
+                std::optional< Symbol >     symbol( uint32_t index ) const;
+                
+                /* Decodes the symbols without copying their names; nullopt when not backed by a mapped file */
+                std::optional< std::vector< Entry > > entries() const;
+                
                 friend void swap( SymTab & o1, SymTab & o2 );
                 
             private:
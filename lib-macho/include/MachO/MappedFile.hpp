@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      MappedFile.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_MAPPED_FILE_HPP
+#define MACHO_MAPPED_FILE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace MachO
+{
+    class MappedFile
+    {
+        public:
+
+            MappedFile( const std::string & path );
+            MappedFile( std::vector< uint8_t > data );
+            MappedFile( const MappedFile & o );
+            MappedFile( MappedFile && o ) noexcept;
+            ~MappedFile();
+
+            MappedFile & operator =( MappedFile o );
+
+            std::optional< std::string > path()   const;
+            const uint8_t              * data()   const;
+            size_t                       size()   const;
+            size_t                       offset() const;
+
+            MappedFile       slice( size_t offset, size_t size )   const;
+            bool             contains( size_t offset, size_t size ) const;
+            const uint8_t  * pointer( size_t offset, size_t size )  const;
+            std::string_view cString( size_t offset )               const;
+
+            template< typename T >
+            T read( size_t offset, bool bigEndian = false ) const
+            {
+                static_assert( std::is_integral< T >::value, "MappedFile::read requires an integral type" );
+
+                T value;
+
+                std::memcpy( &value, this->pointer( offset, sizeof( T ) ), sizeof( T ) );
+
+                return ( bigEndian == IsBigEndianHost() ) ? value : Swap( value );
+            }
+
+            template< typename T >
+            static T Swap( T value )
+            {
+                if constexpr( sizeof( T ) == 2 )
+                {
+                    return static_cast< T >( __builtin_bswap16( static_cast< uint16_t >( value ) ) );
+                }
+                else if constexpr( sizeof( T ) == 4 )
+                {
+                    return static_cast< T >( __builtin_bswap32( static_cast< uint32_t >( value ) ) );
+                }
+                else if constexpr( sizeof( T ) == 8 )
+                {
+                    return static_cast< T >( __builtin_bswap64( static_cast< uint64_t >( value ) ) );
+                }
+                else
+                {
+                    return value;
+                }
+            }
+
+            static constexpr bool IsBigEndianHost()
+            {
+                #if defined( __BYTE_ORDER__ ) && defined( __ORDER_BIG_ENDIAN__ ) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                return true;
+                #else
+                return false;
+                #endif
+            }
+
+            friend void swap( MappedFile & o1, MappedFile & o2 );
+
+        private:
+
+            class IMPL;
+
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_MAPPED_FILE_HPP */
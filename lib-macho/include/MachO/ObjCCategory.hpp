@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ObjCCategory.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_OBJC_CATEGORY_HPP
+#define MACHO_OBJC_CATEGORY_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <XS.hpp>
+#include <MachO/ObjCMethod.hpp>
+
+namespace MachO
+{
+    class ObjCClass;
+    class ObjCMetadata;
+    class ObjCProtocol;
+    
+    class ObjCCategory: public XS::Info::Object
+    {
+        public:
+            
+            ObjCCategory( const ObjCMetadata & metadata, uint64_t address );
+            ObjCCategory( const ObjCCategory & o );
+            ObjCCategory( ObjCCategory && o ) noexcept;
+            ~ObjCCategory() override;
+            
+            ObjCCategory & operator =( ObjCCategory o );
+            
+            XS::Info getInfo() const override;
+            
+            uint64_t                     address()         const;
+            std::string                  name()            const;
+            std::optional< ObjCClass >   cls()             const;
+            std::optional< std::string > className()       const;
+            std::vector< ObjCMethod >    instanceMethods() const;
+            std::vector< ObjCMethod >    classMethods()    const;
+            std::vector< ObjCProtocol >  protocols()       const;
+            
+            friend void swap( ObjCCategory & o1, ObjCCategory & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_OBJC_CATEGORY_HPP */
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ObjCIvar.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_OBJC_IVAR_HPP
+#define MACHO_OBJC_IVAR_HPP
+
+#include <cstdint>
+#include <string>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class ObjCIvar: public XS::Info::Object
+    {
+        public:
+            
+            ObjCIvar( const std::string & name, const std::string & type, uint32_t offset, uint32_t size, uint32_t alignment );
+            ObjCIvar( const ObjCIvar & o );
+            ~ObjCIvar() override;
+            
+            ObjCIvar & operator =( const ObjCIvar & o );
+            
+            XS::Info getInfo() const override;
+            
+            std::string name()      const;
+            std::string type()      const;
+            uint32_t    offset()    const;
+            uint32_t    size()      const;
+            uint32_t    alignment() const;
+            
+        private:
+            
+            std::string _name;
+            std::string _type;
+            uint32_t    _offset;
+            uint32_t    _size;
+            uint32_t    _alignment;
+    };
+}
+
+#endif /* MACHO_OBJC_IVAR_HPP */
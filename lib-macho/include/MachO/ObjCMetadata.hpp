@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ObjCMetadata.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_OBJC_METADATA_HPP
+#define MACHO_OBJC_METADATA_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <XS.hpp>
+#include <MachO/File.hpp>
+#include <MachO/ObjCClass.hpp>
+#include <MachO/ObjCCategory.hpp>
+#include <MachO/ObjCIvar.hpp>
+#include <MachO/ObjCMethod.hpp>
+#include <MachO/ObjCProtocol.hpp>
+
+namespace MachO
+{
+    class CacheFile;
+    
+    class ObjCMetadata: public XS::Info::Object
+    {
+        public:
+            
+            ObjCMetadata( const File & file );
+            ObjCMetadata( const File & image, const CacheFile & cache );
+            ObjCMetadata( const ObjCMetadata & o );
+            ObjCMetadata( ObjCMetadata && o ) noexcept;
+            ~ObjCMetadata() override;
+            
+            ObjCMetadata & operator =( ObjCMetadata o );
+            
+            XS::Info getInfo() const override;
+            
+            std::vector< ObjCClass >    classes()    const;
+            std::vector< ObjCCategory > categories() const;
+            std::vector< ObjCProtocol > protocols()  const;
+            
+            std::optional< ObjCClass > classNamed( const std::string & name ) const;
+            
+            size_t                       pointerSize()                        const;
+            bool                         contains( uint64_t address )         const;
+            uint64_t                     readPointer( uint64_t address )      const;
+            std::optional< std::string > readBinding( uint64_t address )      const;
+            uint32_t                     readUInt32( uint64_t address )       const;
+            std::string_view             readCString( uint64_t address )      const;
+            std::vector< ObjCMethod >    readMethodList( uint64_t address )   const;
+            std::vector< ObjCIvar >      readIvarList( uint64_t address )     const;
+            std::vector< ObjCProtocol >  readProtocolList( uint64_t address ) const;
+            
+            friend void swap( ObjCMetadata & o1, ObjCMetadata & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_OBJC_METADATA_HPP */
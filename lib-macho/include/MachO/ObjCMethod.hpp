@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ObjCMethod.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_OBJC_METHOD_HPP
+#define MACHO_OBJC_METHOD_HPP
+
+#include <cstdint>
+#include <string>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class ObjCMethod: public XS::Info::Object
+    {
+        public:
+            
+            ObjCMethod( const std::string & name, const std::string & types, uint64_t implementation );
+            ObjCMethod( const ObjCMethod & o );
+            ~ObjCMethod() override;
+            
+            ObjCMethod & operator =( const ObjCMethod & o );
+            
+            XS::Info getInfo() const override;
+            
+            std::string name()           const;
+            std::string types()          const;
+            uint64_t    implementation() const;
+            
+        private:
+            
+            std::string _name;
+            std::string _types;
+            uint64_t    _implementation;
+    };
+}
+
+#endif /* MACHO_OBJC_METHOD_HPP */
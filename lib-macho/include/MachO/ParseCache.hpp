@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ParseCache.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_PARSE_CACHE_HPP
+#define MACHO_PARSE_CACHE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <MachO/File.hpp>
+#include <MachO/FileSummary.hpp>
+
+namespace MachO
+{
+    class ParseCache
+    {
+        public:
+            
+            /*
+             * Summaries are stored in the given directory, one file per device and inode.
+             * An entry is only used while the file's identity, including its LC_UUID, is unchanged.
+             */
+            ParseCache( const std::string & directory );
+            ParseCache( const ParseCache & o );
+            ParseCache( ParseCache && o ) noexcept;
+            ~ParseCache( void );
+            
+            ParseCache & operator =( ParseCache o );
+            
+            std::string directory() const;
+            
+            std::optional< File > lookup( const std::string & path ) const;
+            File                  parse( const std::string & path )  const;
+            
+            /* Only reads the header and load commands; empty for anything but a thin Mach-O file */
+            static std::optional< FileSummary::Identity > Identify( const std::string & path );
+            
+            friend void swap( ParseCache & o1, ParseCache & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_PARSE_CACHE_HPP */
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      QueryServer.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_QUERY_SERVER_HPP
+#define MACHO_QUERY_SERVER_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace MachO
+{
+    class QueryServer
+    {
+        public:
+            
+            enum class Request: uint8_t
+            {
+                Libraries   = 1,
+                Symbols     = 2,
+                Symbolicate = 3,
+                UUID        = 4
+            };
+            
+            /*
+             * The image is the architecture of a Fat file, or the install path of an
+             * image in a dyld cache file. It may be empty for thin Mach-O files.
+             */
+            struct Query
+            {
+                Request     request;
+                std::string path;
+                std::string image;
+                uint64_t    address;
+            };
+            
+            struct Reply
+            {
+                bool                       success;
+                std::vector< std::string > values;
+            };
+            
+            /* Parsed files are kept in a LRU cache, and parsed again when their identity changes */
+            QueryServer( const std::string & socket, size_t capacity = 64 );
+            QueryServer( const QueryServer & o );
+            QueryServer( QueryServer && o ) noexcept;
+            ~QueryServer( void );
+            
+            QueryServer & operator =( QueryServer o );
+            
+            std::string socket()   const;
+            size_t      capacity() const;
+            
+            /* Serves clients on all threads until stop() is called */
+            void run();
+            void stop();
+            
+            std::vector< Reply > answer( const std::vector< Query > & queries ) const;
+            
+            /*
+             * Frames are a big-endian 32-bits length followed by the payload, and a single
+             * frame carries a whole batch of queries or replies.
+             */
+            static std::vector< Reply > Send( const std::string & socket, const std::vector< Query > & queries );
+            
+            friend void swap( QueryServer & o1, QueryServer & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_QUERY_SERVER_HPP */
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      Relocation.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_RELOCATION_HPP
+#define MACHO_RELOCATION_HPP
+
+#include <cstdint>
+#include <string>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class Relocation: public XS::Info::Object
+    {
+        public:
+
+            Relocation( const uint8_t * entry, bool bigEndian );
+            Relocation( const Relocation & o );
+            ~Relocation() override;
+
+            Relocation & operator =( const Relocation & o );
+
+            XS::Info getInfo() const override;
+
+            int32_t  address()      const;
+            bool     isScattered()  const;
+            bool     isPCRelative() const;
+            bool     isExtern()     const;
+            uint8_t  length()       const;
+            uint8_t  type()         const;
+            uint32_t symbolNumber() const;
+            int32_t  value()        const;
+
+        private:
+
+            uint32_t _word0;
+            uint32_t _word1;
+            bool     _bigEndian;
+    };
+}
+
+#endif /* MACHO_RELOCATION_HPP */
@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      RelocationList.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_RELOCATION_LIST_HPP
+#define MACHO_RELOCATION_LIST_HPP
+
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <cstdint>
+#include <XS.hpp>
+#include <MachO/MappedFile.hpp>
+#include <MachO/Relocation.hpp>
+
+namespace MachO
+{
+    class RelocationList: public XS::Info::Object
+    {
+        public:
+
+            struct SymbolTable
+            {
+                uint32_t symbolOffset;
+                uint32_t symbolCount;
+                uint32_t stringOffset;
+                uint32_t stringSize;
+                bool     is64;
+            };
+
+            class Iterator
+            {
+                public:
+
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type        = Relocation;
+                    using difference_type   = std::ptrdiff_t;
+                    using pointer           = const Relocation *;
+                    using reference         = Relocation;
+
+                    Iterator( const uint8_t * entry, bool bigEndian ):
+                        _entry( entry ),
+                        _bigEndian( bigEndian )
+                    {}
+
+                    Relocation operator *() const
+                    {
+                        return { this->_entry, this->_bigEndian };
+                    }
+
+                    Iterator & operator ++()
+                    {
+                        this->_entry += 8;
+
+                        return *( this );
+                    }
+
+                    Iterator operator ++( int )
+                    {
+                        Iterator it( *( this ) );
+
+                        this->_entry += 8;
+
+                        return it;
+                    }
+
+                    bool operator ==( const Iterator & o ) const
+                    {
+                        return this->_entry == o._entry;
+                    }
+
+                    bool operator !=( const Iterator & o ) const
+                    {
+                        return this->_entry != o._entry;
+                    }
+
+                private:
+
+                    const uint8_t * _entry;
+                    bool            _bigEndian;
+            };
+
+            RelocationList( const MappedFile & data, uint32_t offset, uint32_t count, bool bigEndian, std::optional< SymbolTable > symbols );
+            RelocationList( const RelocationList & o );
+            RelocationList( RelocationList && o ) noexcept;
+            ~RelocationList() override;
+
+            RelocationList & operator =( RelocationList o );
+
+            XS::Info getInfo() const override;
+
+            size_t     size()                 const;
+            Iterator   begin()                const;
+            Iterator   end()                  const;
+            Relocation operator []( size_t i ) const;
+
+            std::optional< std::string_view > symbolName( const Relocation & relocation ) const;
+
+            friend void swap( RelocationList & o1, RelocationList & o2 );
+
+        private:
+
+            class IMPL;
+
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_RELOCATION_LIST_HPP */
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ScanManifest.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_SCAN_MANIFEST_HPP
+#define MACHO_SCAN_MANIFEST_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace MachO
+{
+    class ScanManifest
+    {
+        public:
+            
+            struct Image
+            {
+                std::string                  architecture;
+                std::optional< std::string > uuid;
+                std::vector< std::string >   libraries;
+                std::vector< std::string >   symbols;
+                
+                bool operator ==( const Image & o ) const;
+                bool operator !=( const Image & o ) const;
+            };
+            
+            struct Entry
+            {
+                std::string            path;
+                uint64_t               device;
+                uint64_t               inode;
+                uint64_t               size;
+                uint64_t               mtime;
+                std::vector< uint8_t > hash;
+                std::vector< Image >   images;
+            };
+            
+            struct Change
+            {
+                enum class Kind
+                {
+                    Added,
+                    Removed,
+                    Changed
+                };
+                
+                Kind                         kind;
+                std::string                  path;
+                std::string                  architecture;
+                std::optional< std::string > oldUUID;
+                std::optional< std::string > newUUID;
+                std::vector< std::string >   addedLibraries;
+                std::vector< std::string >   removedLibraries;
+                std::vector< std::string >   addedSymbols;
+                std::vector< std::string >   removedSymbols;
+            };
+            
+            ScanManifest( void );
+            ScanManifest( const std::string & path );
+            ScanManifest( const ScanManifest & o );
+            ScanManifest( ScanManifest && o ) noexcept;
+            ~ScanManifest( void );
+            
+            ScanManifest & operator =( ScanManifest o );
+            
+            std::vector< Entry > entries() const;
+            size_t               parsed()  const;
+            
+            void write( const std::string & path ) const;
+            
+            /*
+             * Directories are scanned recursively, and only Mach-O and Fat files are kept.
+             * Files whose identity is unchanged are not opened. Files whose header and load
+             * commands hash is unchanged, and which have an LC_UUID, are not parsed again.
+             */
+            ScanManifest rescan( const std::vector< std::string > & paths ) const;
+            
+            static std::vector< Change > Compare( const ScanManifest & before, const ScanManifest & after );
+            
+            friend void swap( ScanManifest & o1, ScanManifest & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_SCAN_MANIFEST_HPP */
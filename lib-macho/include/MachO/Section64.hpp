@@ -35,6 +35,7 @@
 #include <string>
 #include <XS.hpp>
 #include <MachO/SectionFlags.hpp>
+#include <MachO/MappedFile.hpp>
 
 namespace MachO
 {
@@ -43,6 +44,7 @@ namespace MachO
         public:
             
             Section64( XS::IO::BinaryStream & stream );
+            Section64( XS::IO::BinaryStream & stream, const MappedFile & data );
             Section64( const Section64 & o );
             Section64( Section64 && o ) noexcept;
             ~Section64( void ) override;
@@ -60,6 +62,8 @@ namespace MachO
             uint32_t               relocationOffset() const;
             uint32_t               relocationCount()  const;
             SectionFlags           flags()            const;
+            uint32_t               reserved1()        const;
+            uint32_t               reserved2()        const;
             std::vector< uint8_t > data()             const;
             
             friend void swap( Section64 & o1, Section64 & o2 );
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      SwiftConformance.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_SWIFT_CONFORMANCE_HPP
+#define MACHO_SWIFT_CONFORMANCE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <cstdint>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class SwiftMetadata;
+    class SwiftDescriptor;
+    
+    class SwiftConformance: public XS::Info::Object
+    {
+        public:
+            
+            SwiftConformance( const SwiftMetadata & metadata, uint64_t address );
+            SwiftConformance( const SwiftConformance & o );
+            SwiftConformance( SwiftConformance && o ) noexcept;
+            ~SwiftConformance() override;
+            
+            SwiftConformance & operator =( SwiftConformance o );
+            
+            XS::Info getInfo() const override;
+            
+            uint64_t                         address()       const;
+            uint32_t                         flags()         const;
+            bool                             isRetroactive() const;
+            std::optional< SwiftDescriptor > protocol()      const;
+            std::string                      protocolName()  const;
+            std::optional< SwiftDescriptor > type()          const;
+            std::string                      typeName()      const;
+            uint64_t                         witnessTable()  const;
+            
+            friend void swap( SwiftConformance & o1, SwiftConformance & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_SWIFT_CONFORMANCE_HPP */
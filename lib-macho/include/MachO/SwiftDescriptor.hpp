@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      SwiftDescriptor.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_SWIFT_DESCRIPTOR_HPP
+#define MACHO_SWIFT_DESCRIPTOR_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <cstdint>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class SwiftMetadata;
+    class SwiftFieldDescriptor;
+    
+    class SwiftDescriptor: public XS::Info::Object
+    {
+        public:
+            
+            enum class Kind: uint8_t
+            {
+                Module     = 0,
+                Extension  = 1,
+                Anonymous  = 2,
+                Protocol   = 3,
+                OpaqueType = 4,
+                Class      = 16,
+                Struct     = 17,
+                Enum       = 18
+            };
+            
+            static std::string KindToString( Kind kind );
+            
+            SwiftDescriptor( const SwiftMetadata & metadata, uint64_t address );
+            SwiftDescriptor( const SwiftDescriptor & o );
+            SwiftDescriptor( SwiftDescriptor && o ) noexcept;
+            ~SwiftDescriptor() override;
+            
+            SwiftDescriptor & operator =( SwiftDescriptor o );
+            
+            XS::Info getInfo() const override;
+            
+            uint64_t                              address()         const;
+            uint32_t                              flags()           const;
+            Kind                                  kind()            const;
+            bool                                  isGeneric()       const;
+            bool                                  isType()          const;
+            std::string                           name()            const;
+            std::string                           fullName()        const;
+            std::optional< SwiftDescriptor >      parent()          const;
+            std::optional< std::string >          superclassName()  const;
+            std::optional< SwiftFieldDescriptor > fieldDescriptor() const;
+            uint32_t                              numberOfFields()  const;
+            
+            friend void swap( SwiftDescriptor & o1, SwiftDescriptor & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_SWIFT_DESCRIPTOR_HPP */
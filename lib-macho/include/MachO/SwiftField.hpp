@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      SwiftField.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_SWIFT_FIELD_HPP
+#define MACHO_SWIFT_FIELD_HPP
+
+#include <cstdint>
+#include <string>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class SwiftField: public XS::Info::Object
+    {
+        public:
+            
+            SwiftField( const std::string & name, const std::string & typeName, uint32_t flags );
+            SwiftField( const SwiftField & o );
+            ~SwiftField() override;
+            
+            SwiftField & operator =( const SwiftField & o );
+            
+            XS::Info getInfo() const override;
+            
+            std::string name()           const;
+            std::string typeName()       const;
+            uint32_t    flags()          const;
+            bool        isIndirectCase() const;
+            bool        isVariable()     const;
+            
+        private:
+            
+            std::string _name;
+            std::string _typeName;
+            uint32_t    _flags;
+    };
+}
+
+#endif /* MACHO_SWIFT_FIELD_HPP */
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      SwiftFieldDescriptor.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_SWIFT_FIELD_DESCRIPTOR_HPP
+#define MACHO_SWIFT_FIELD_DESCRIPTOR_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <XS.hpp>
+#include <MachO/SwiftField.hpp>
+
+namespace MachO
+{
+    class SwiftMetadata;
+    
+    class SwiftFieldDescriptor: public XS::Info::Object
+    {
+        public:
+            
+            enum class Kind: uint16_t
+            {
+                Struct           = 0,
+                Class            = 1,
+                Enum             = 2,
+                MultiPayloadEnum = 3,
+                Protocol         = 4,
+                ClassProtocol    = 5,
+                ObjCProtocol     = 6,
+                ObjCClass        = 7
+            };
+            
+            static std::string KindToString( Kind kind );
+            
+            SwiftFieldDescriptor( const SwiftMetadata & metadata, uint64_t address );
+            SwiftFieldDescriptor( const SwiftFieldDescriptor & o );
+            SwiftFieldDescriptor( SwiftFieldDescriptor && o ) noexcept;
+            ~SwiftFieldDescriptor() override;
+            
+            SwiftFieldDescriptor & operator =( SwiftFieldDescriptor o );
+            
+            XS::Info getInfo() const override;
+            
+            uint64_t                  address()        const;
+            Kind                      kind()           const;
+            std::string               typeName()       const;
+            std::string               superclassName() const;
+            uint32_t                  numberOfFields() const;
+            std::vector< SwiftField > fields()         const;
+            
+            friend void swap( SwiftFieldDescriptor & o1, SwiftFieldDescriptor & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_SWIFT_FIELD_DESCRIPTOR_HPP */
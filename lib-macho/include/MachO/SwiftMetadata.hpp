@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      SwiftMetadata.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_SWIFT_METADATA_HPP
+#define MACHO_SWIFT_METADATA_HPP
+
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <XS.hpp>
+#include <MachO/File.hpp>
+#include <MachO/SwiftConformance.hpp>
+#include <MachO/SwiftDescriptor.hpp>
+#include <MachO/SwiftField.hpp>
+#include <MachO/SwiftFieldDescriptor.hpp>
+
+namespace MachO
+{
+    class SwiftMetadata: public XS::Info::Object
+    {
+        public:
+            
+            enum class Record
+            {
+                Type,
+                Protocol,
+                Conformance,
+                FieldDescriptor
+            };
+            
+            template< typename T >
+            class Sequence;
+            
+            SwiftMetadata( const File & file );
+            SwiftMetadata( const SwiftMetadata & o );
+            SwiftMetadata( SwiftMetadata && o ) noexcept;
+            ~SwiftMetadata() override;
+            
+            SwiftMetadata & operator =( SwiftMetadata o );
+            
+            XS::Info getInfo() const override;
+            
+            Sequence< SwiftDescriptor >      types()            const;
+            Sequence< SwiftDescriptor >      protocols()        const;
+            Sequence< SwiftConformance >     conformances()     const;
+            Sequence< SwiftFieldDescriptor > fieldDescriptors() const;
+            
+            size_t                       pointerSize()                                    const;
+            bool                         contains( uint64_t address )                     const;
+            uint64_t                     readPointer( uint64_t address )                  const;
+            std::optional< std::string > readBinding( uint64_t address )                  const;
+            uint8_t                      readUInt8( uint64_t address )                    const;
+            uint16_t                     readUInt16( uint64_t address )                   const;
+            uint32_t                     readUInt32( uint64_t address )                   const;
+            std::string_view             readCString( uint64_t address )                  const;
+            uint64_t                     readRelativePointer( uint64_t address )          const;
+            std::optional< uint64_t >    readIndirectablePointer( uint64_t address )      const;
+            std::optional< std::string > readIndirectableBinding( uint64_t address )      const;
+            std::string                  readMangledName( uint64_t address )              const;
+            uint64_t                     resolveRecord( Record record, uint64_t address ) const;
+            uint64_t                     recordSize( Record record, uint64_t address )    const;
+            
+            friend void swap( SwiftMetadata & o1, SwiftMetadata & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+    
+    template< typename T >
+    class SwiftMetadata::Sequence
+    {
+        public:
+            
+            class Iterator
+            {
+                public:
+                    
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type        = T;
+                    using difference_type   = std::ptrdiff_t;
+                    using pointer           = const T *;
+                    using reference         = T;
+                    
+                    Iterator( const std::shared_ptr< const SwiftMetadata > & metadata, Record record, uint64_t address, uint64_t end ):
+                        _metadata( metadata ),
+                        _record(   record ),
+                        _address(  address ),
+                        _end(      end )
+                    {}
+                    
+                    T operator *() const
+                    {
+                        return { *( this->_metadata ), this->_metadata->resolveRecord( this->_record, this->_address ) };
+                    }
+                    
+                    Iterator & operator ++()
+                    {
+                        uint64_t size( this->_metadata->recordSize( this->_record, this->_address ) );
+                        
+                        this->_address = ( size == 0 || size > this->_end - this->_address ) ? this->_end : this->_address + size;
+                        
+                        return *( this );
+                    }
+                    
+                    Iterator operator ++( int )
+                    {
+                        Iterator it( *( this ) );
+                        
+                        ++( *( this ) );
+                        
+                        return it;
+                    }
+                    
+                    bool operator ==( const Iterator & o ) const
+                    {
+                        return this->_address == o._address;
+                    }
+                    
+                    bool operator !=( const Iterator & o ) const
+                    {
+                        return this->_address != o._address;
+                    }
+                    
+                private:
+                    
+                    std::shared_ptr< const SwiftMetadata > _metadata;
+                    Record                                 _record;
+                    uint64_t                               _address;
+                    uint64_t                               _end;
+            };
+            
+            /* Iterators share the metadata, so they stay valid once a temporary sequence is gone */
+            Sequence( const SwiftMetadata & metadata, Record record, uint64_t address, uint64_t size ):
+                _metadata( std::make_shared< const SwiftMetadata >( metadata ) ),
+                _record(   record ),
+                _address(  address ),
+                _size(     size )
+            {}
+            
+            Iterator begin() const
+            {
+                return { this->_metadata, this->_record, this->_address, this->_address + this->_size };
+            }
+            
+            Iterator end() const
+            {
+                return { this->_metadata, this->_record, this->_address + this->_size, this->_address + this->_size };
+            }
+            
+            bool empty() const
+            {
+                return this->_size == 0;
+            }
+            
+        private:
+            
+            std::shared_ptr< const SwiftMetadata > _metadata;
+            Record                                 _record;
+            uint64_t                               _address;
+            uint64_t                               _size;
+    };
+}
+
+#endif /* MACHO_SWIFT_METADATA_HPP */
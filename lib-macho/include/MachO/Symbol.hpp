@@ -44,6 +44,7 @@ namespace MachO
         public:
 
             Symbol( File::Kind kind, uint32_t stringTableOffset, XS::IO::BinaryStream & stream );
+            Symbol( const std::string & name, uint32_t nameIndex, uint8_t type, uint8_t section, uint16_t description, uint64_t value );
             Symbol( const Symbol & o );
             Symbol( Symbol && o ) noexcept;
             virtual ~Symbol() override;
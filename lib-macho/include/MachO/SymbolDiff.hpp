@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      SymbolDiff.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_SYMBOL_DIFF_HPP
+#define MACHO_SYMBOL_DIFF_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <MachO/File.hpp>
+
+namespace MachO
+{
+    namespace SymbolDiff
+    {
+        enum class Filter
+        {
+            All,
+            Exports,
+            Imports,
+            Locals
+        };
+        
+        /* The type and section of the missing side are zero for added and removed symbols */
+        struct Change
+        {
+            enum class Kind
+            {
+                Added,
+                Removed,
+                Changed
+            };
+            
+            Kind        kind;
+            std::string name;
+            uint8_t     oldType;
+            uint8_t     newType;
+            uint8_t     oldSection;
+            uint8_t     newSection;
+        };
+        
+        /*
+         * Symbols are matched by name, debugging entries being ignored. Changes are sorted by
+         * name. Symbols defined more than once are paired in order of type and section.
+         */
+        std::vector< Change > Compare( const File & before, const File & after, Filter filter = Filter::All );
+    }
+}
+
+#endif /* MACHO_SYMBOL_DIFF_HPP */
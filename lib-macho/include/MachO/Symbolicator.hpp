@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      Symbolicator.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_SYMBOLICATOR_HPP
+#define MACHO_SYMBOLICATOR_HPP
+
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <MachO/File.hpp>
+
+namespace MachO
+{
+    class Symbolicator
+    {
+        public:
+            
+            struct Location
+            {
+                uint64_t                     address;
+                bool                         resolved;
+                std::optional< std::string > symbol;
+                uint64_t                     start;
+                uint64_t                     offset;
+            };
+            
+            /*
+             * Functions are known from the symbol table and from LC_FUNCTION_STARTS, so addresses
+             * in stripped functions resolve to the function start, without a symbol name.
+             */
+            Symbolicator( const File & file );
+            Symbolicator( const Symbolicator & o );
+            Symbolicator( Symbolicator && o ) noexcept;
+            ~Symbolicator( void );
+            
+            Symbolicator & operator =( Symbolicator o );
+            
+            uint64_t textAddress() const;
+            
+            /* Addresses are slid by the given amount, e.g. the load address minus the __TEXT address */
+            Location                symbolicate( uint64_t address, uint64_t slide = 0 )                        const;
+            std::vector< Location > symbolicate( const std::vector< uint64_t > & addresses, uint64_t slide = 0 ) const;
+            
+            friend void swap( Symbolicator & o1, Symbolicator & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_SYMBOLICATOR_HPP */
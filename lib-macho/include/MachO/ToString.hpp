@@ -31,6 +31,7 @@
 #define MACHO_TO_STRING_HPP
 
 #include <cstdint>
+#include <cstddef>
 #include <string>
 
 namespace MachO
@@ -39,6 +40,7 @@ namespace MachO
     {
         std::string Version( uint32_t value );
         std::string Version( uint64_t value );
+        std::string Bytes( const uint8_t * data, size_t size );
     }
 }
 
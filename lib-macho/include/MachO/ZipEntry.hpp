@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ZipEntry.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_ZIP_ENTRY_HPP
+#define MACHO_ZIP_ENTRY_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <cstdint>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class ZipEntry: public XS::Info::Object
+    {
+        public:
+            
+            ZipEntry( const std::string & name, uint16_t flags, uint16_t method, uint32_t crc32, uint64_t compressedSize, uint64_t size, uint64_t localHeaderOffset );
+            ZipEntry( const ZipEntry & o );
+            ZipEntry( ZipEntry && o ) noexcept;
+            ~ZipEntry( void ) override;
+            
+            ZipEntry & operator =( ZipEntry o );
+            
+            XS::Info getInfo() const override;
+            
+            std::string name()              const;
+            uint16_t    flags()             const;
+            uint16_t    method()            const;
+            uint32_t    crc32()             const;
+            uint64_t    compressedSize()    const;
+            uint64_t    size()              const;
+            uint64_t    localHeaderOffset() const;
+            bool        isDirectory()       const;
+            bool        isEncrypted()       const;
+            
+            friend void swap( ZipEntry & o1, ZipEntry & o2 );
+            
+        private:
+            
+            class IMPL;
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_ZIP_ENTRY_HPP */
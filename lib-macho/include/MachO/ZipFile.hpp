@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ZipFile.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef MACHO_ZIP_FILE_HPP
+#define MACHO_ZIP_FILE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <MachO/MappedFile.hpp>
+#include <MachO/ZipEntry.hpp>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class ZipFile: public XS::Info::Object
+    {
+        public:
+            
+            ZipFile( const std::string & path );
+            ZipFile( const MappedFile & data );
+            ZipFile( const ZipFile & o );
+            ZipFile( ZipFile && o ) noexcept;
+            ~ZipFile( void ) override;
+            
+            ZipFile & operator =( ZipFile o );
+            
+            XS::Info getInfo() const override;
+            
+            static bool IsZip( const MappedFile & data );
+            
+            std::optional< std::string > path()    const;
+            std::vector< ZipEntry >      entries() const;
+            
+            std::optional< size_t > entryIndex( std::string_view name ) const;
+            
+            /* Stored entries are slices of the zip mapping; deflated ones are inflated and checked against their CRC */
+            MappedFile data( size_t index ) const;
+            
+            /* Only inflates as much as needed for the requested prefix */
+            std::vector< uint8_t > header( size_t index, size_t size ) const;
+            
+            bool                  isMachO( size_t index ) const;
+            std::vector< size_t > machOEntries()          const;
+            
+            friend void swap( ZipFile & o1, ZipFile & o2 );
+            
+        private:
+            
+            class IMPL;
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* MACHO_ZIP_FILE_HPP */
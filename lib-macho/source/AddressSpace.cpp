@@ -0,0 +1,387 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        AddressSpace.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/AddressSpace.hpp>
+#include <MachO/File.hpp>
+#include <MachO/Section.hpp>
+#include <MachO/Section64.hpp>
+#include <MachO/ToString.hpp>
+#include <MachO/LoadCommands/Segment.hpp>
+#include <MachO/LoadCommands/Segment64.hpp>
+#include <atomic>
+#include <stdexcept>
+
+namespace MachO
+{
+    class AddressSpace::IMPL
+    {
+        public:
+            
+            struct Entry
+            {
+                uint64_t        begin;
+                uint64_t        end;
+                const uint8_t * data;
+                const uint8_t * base;
+            };
+            
+            IMPL( const File & file );
+            IMPL( const std::vector< MappedFile > & files, const std::vector< Range > & ranges, bool bigEndian );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            void          build();
+            const Entry * find( uint64_t address ) const;
+            size_t        fileIndex( const std::optional< MappedFile > & data );
+            
+            template< typename T >
+            void addSections( const std::vector< T > & sections, std::vector< uint8_t > & buffer );
+            
+            std::vector< MappedFile >     _files;
+            std::vector< Range >          _ranges;
+            std::vector< Entry >          _entries;
+            bool                          _bigEndian;
+            bool                          _buffered;
+            mutable std::atomic< size_t > _last;
+    };
+    
+    AddressSpace::AddressSpace( const File & file ):
+        impl( std::make_unique< IMPL >( file ) )
+    {}
+    
+    AddressSpace::AddressSpace( const MappedFile & data, const std::vector< Range > & ranges, bool bigEndian ):
+        impl( std::make_unique< IMPL >( std::vector< MappedFile >( { data } ), ranges, bigEndian ) )
+    {}
+    
+    AddressSpace::AddressSpace( const std::vector< MappedFile > & files, const std::vector< Range > & ranges, bool bigEndian ):
+        impl( std::make_unique< IMPL >( files, ranges, bigEndian ) )
+    {}
+    
+    AddressSpace::AddressSpace( const AddressSpace & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    AddressSpace::AddressSpace( AddressSpace && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    AddressSpace::~AddressSpace()
+    {}
+    
+    AddressSpace & AddressSpace::operator =( AddressSpace o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info AddressSpace::getInfo() const
+    {
+        XS::Info i( "Address space", std::to_string( this->impl->_ranges.size() ) );
+        
+        for( const auto & range: this->impl->_ranges )
+        {
+            XS::Info info( XS::ToString::Hex( range.vmAddress ) );
+            
+            info.addChild( { "Size",        XS::ToString::Size( range.size ) } );
+            info.addChild( { "File offset", XS::ToString::Hex(  range.fileOffset ) } );
+            
+            if( this->impl->_files.size() > 1 )
+            {
+                info.addChild( { "File", std::to_string( range.file ) } );
+            }
+            
+            i.addChild( info );
+        }
+        
+        return i;
+    }
+    
+    std::vector< AddressSpace::Range > AddressSpace::ranges() const
+    {
+        return this->impl->_ranges;
+    }
+    
+    MappedFile AddressSpace::data() const
+    {
+        return this->impl->_files.front();
+    }
+    
+    std::vector< MappedFile > AddressSpace::files() const
+    {
+        return this->impl->_files;
+    }
+    
+    bool AddressSpace::bigEndian() const
+    {
+        return this->impl->_bigEndian;
+    }
+    
+    bool AddressSpace::contains( uint64_t address, size_t size ) const
+    {
+        const IMPL::Entry * entry( this->impl->find( address ) );
+        
+        return entry != nullptr && size <= entry->end - address;
+    }
+    
+    std::optional< uint64_t > AddressSpace::toFileOffset( uint64_t address ) const
+    {
+        const IMPL::Entry * entry( this->impl->find( address ) );
+        
+        /* Sections copied into a buffer have no offset in the original file */
+        if( entry == nullptr || this->impl->_buffered )
+        {
+            return {};
+        }
+        
+        return static_cast< uint64_t >( entry->data - entry->base ) + ( address - entry->begin );
+    }
+    
+    const uint8_t * AddressSpace::pointer( uint64_t address, size_t size ) const
+    {
+        const IMPL::Entry * entry( this->impl->find( address ) );
+        
+        if( entry == nullptr || size > entry->end - address )
+        {
+            throw std::runtime_error( "Invalid virtual address: " + XS::ToString::Hex( address ) );
+        }
+        
+        return entry->data + ( address - entry->begin );
+    }
+    
+    std::string_view AddressSpace::readCString( uint64_t address ) const
+    {
+        const IMPL::Entry * entry( this->impl->find( address ) );
+        
+        if( entry == nullptr )
+        {
+            throw std::runtime_error( "Invalid virtual address: " + XS::ToString::Hex( address ) );
+        }
+        
+        {
+            const char * p( reinterpret_cast< const char * >( entry->data + ( address - entry->begin ) ) );
+            size_t       available( static_cast< size_t >( entry->end - address ) );
+            const void * end( std::memchr( p, 0, available ) );
+            
+            return { p, ( end == nullptr ) ? available : static_cast< size_t >( static_cast< const char * >( end ) - p ) };
+        }
+    }
+    
+    void swap( AddressSpace & o1, AddressSpace & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    AddressSpace::IMPL::IMPL( const File & file ):
+        _files(     { MappedFile( std::vector< uint8_t >() ) } ),
+        _bigEndian( file.endianness() == File::Endianness::BigEndian ),
+        _buffered(  false ),
+        _last(      0 )
+    {
+        std::optional< MappedFile > data( file.mappedFile() );
+        
+        if( data.has_value() )
+        {
+            this->_files.front() = *( data );
+            
+            for( const auto & segment: file.loadCommands< LoadCommands::Segment >() )
+            {
+                this->_ranges.push_back( { segment.vmAddress(), std::min( segment.vmSize(), segment.fileSize() ), segment.fileOffset(), this->fileIndex( segment.mappedFile() ) } );
+            }
+            
+            for( const auto & segment: file.loadCommands< LoadCommands::Segment64 >() )
+            {
+                this->_ranges.push_back( { segment.vmAddress(), std::min( segment.vmSize(), segment.fileSize() ), segment.fileOffset(), this->fileIndex( segment.mappedFile() ) } );
+            }
+        }
+        else
+        {
+            std::vector< uint8_t > buffer;
+            
+            for( const auto & segment: file.loadCommands< LoadCommands::Segment >() )
+            {
+                this->addSections( segment.sections(), buffer );
+            }
+            
+            for( const auto & segment: file.loadCommands< LoadCommands::Segment64 >() )
+            {
+                this->addSections( segment.sections(), buffer );
+            }
+            
+            this->_files.front() = MappedFile( std::move( buffer ) );
+            this->_buffered      = true;
+        }
+        
+        this->build();
+    }
+    
+    AddressSpace::IMPL::IMPL( const std::vector< MappedFile > & files, const std::vector< Range > & ranges, bool bigEndian ):
+        _files(     files ),
+        _ranges(    ranges ),
+        _bigEndian( bigEndian ),
+        _buffered(  false ),
+        _last(      0 )
+    {
+        this->build();
+    }
+    
+    /* Entries point into mappings shared by both copies, so they need no rebuild */
+    AddressSpace::IMPL::IMPL( const IMPL & o ):
+        _files(     o._files ),
+        _ranges(    o._ranges ),
+        _entries(   o._entries ),
+        _bigEndian( o._bigEndian ),
+        _buffered(  o._buffered ),
+        _last(      0 )
+    {}
+    
+    AddressSpace::IMPL::~IMPL()
+    {}
+    
+    template< typename T >
+    void AddressSpace::IMPL::addSections( const std::vector< T > & sections, std::vector< uint8_t > & buffer )
+    {
+        for( const auto & section: sections )
+        {
+            std::vector< uint8_t > data( section.data() );
+            
+            if( data.size() == 0 )
+            {
+                continue;
+            }
+            
+            this->_ranges.push_back( { section.address(), data.size(), buffer.size() } );
+            buffer.insert( buffer.end(), data.begin(), data.end() );
+        }
+    }
+    
+    /* Segments of dyld cache images may live in other sub-cache files than the header */
+    size_t AddressSpace::IMPL::fileIndex( const std::optional< MappedFile > & data )
+    {
+        if( data.has_value() == false )
+        {
+            return 0;
+        }
+        
+        for( size_t i = 0; i < this->_files.size(); i++ )
+        {
+            if( this->_files[ i ].data() == data->data() )
+            {
+                return i;
+            }
+        }
+        
+        this->_files.push_back( *( data ) );
+        
+        return this->_files.size() - 1;
+    }
+    
+    void AddressSpace::IMPL::build()
+    {
+        if( this->_files.size() == 0 )
+        {
+            throw std::runtime_error( "An address space needs at least one backing file" );
+        }
+        
+        this->_ranges.erase
+        (
+            std::remove_if
+            (
+                this->_ranges.begin(),
+                this->_ranges.end(),
+                [ & ]( const Range & range )
+                {
+                    return range.size == 0 || range.file >= this->_files.size() || this->_files[ range.file ].contains( range.fileOffset, range.size ) == false;
+                }
+            ),
+            this->_ranges.end()
+        );
+        
+        std::sort
+        (
+            this->_ranges.begin(),
+            this->_ranges.end(),
+            []( const Range & r1, const Range & r2 )
+            {
+                return r1.vmAddress < r2.vmAddress;
+            }
+        );
+        
+        this->_entries.clear();
+        
+        for( const auto & range: this->_ranges )
+        {
+            const uint8_t * base( this->_files[ range.file ].data() );
+            
+            this->_entries.push_back( { range.vmAddress, range.vmAddress + range.size, base + range.fileOffset, base } );
+        }
+    }
+    
+    const AddressSpace::IMPL::Entry * AddressSpace::IMPL::find( uint64_t address ) const
+    {
+        size_t last( this->_last.load( std::memory_order_relaxed ) );
+        
+        if( last < this->_entries.size() && address >= this->_entries[ last ].begin && address < this->_entries[ last ].end )
+        {
+            return &( this->_entries[ last ] );
+        }
+        
+        {
+            auto it = std::upper_bound
+            (
+                this->_entries.begin(),
+                this->_entries.end(),
+                address,
+                []( uint64_t value, const Entry & entry )
+                {
+                    return value < entry.begin;
+                }
+            );
+            
+            if( it == this->_entries.begin() )
+            {
+                return nullptr;
+            }
+            
+            --it;
+            
+            if( address >= it->end )
+            {
+                return nullptr;
+            }
+            
+            this->_last.store( static_cast< size_t >( it - this->_entries.begin() ), std::memory_order_relaxed );
+            
+            return &( *( it ) );
+        }
+    }
+}
@@ -0,0 +1,502 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ArchiveFile.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ArchiveFile.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/ToString.hpp>
+#include <XS.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace MachO
+{
+    class ArchiveFile::IMPL
+    {
+        public:
+            
+            enum class SymbolTableFormat
+            {
+                None,
+                BSD,
+                BSD64,
+                GNU,
+                GNU64
+            };
+            
+            class Members
+            {
+                public:
+                    
+                    std::mutex                                     _mutex;
+                    std::vector< std::optional< File > >           _files;
+                    std::once_flag                                 _symbolsOnce;
+                    std::unordered_map< std::string_view, size_t > _symbols;
+            };
+            
+            IMPL( const std::string & path );
+            IMPL( const MappedFile & data );
+            IMPL( const IMPL & o );
+            ~IMPL( void );
+            
+            void parse();
+            void parseSymbolTable();
+            
+            static uint64_t ParseNumber( const uint8_t * field, size_t size, int base );
+            
+            std::optional< std::string > _path;
+            MappedFile                   _data;
+            std::vector< ArchiveMember > _members;
+            SymbolTableFormat            _symbolTableFormat;
+            uint64_t                     _symbolTableOffset;
+            uint64_t                     _symbolTableSize;
+            std::shared_ptr< Members >   _cache;
+    };
+    
+    ArchiveFile::ArchiveFile( const std::string & path ):
+        impl( std::make_unique< IMPL >( path ) )
+    {}
+    
+    ArchiveFile::ArchiveFile( const MappedFile & data ):
+        impl( std::make_unique< IMPL >( data ) )
+    {}
+    
+    ArchiveFile::ArchiveFile( const ArchiveFile & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ArchiveFile::ArchiveFile( ArchiveFile && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ArchiveFile::~ArchiveFile( void )
+    {}
+    
+    ArchiveFile & ArchiveFile::operator =( ArchiveFile o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info ArchiveFile::getInfo() const
+    {
+        XS::Info i( "Archive file" );
+        XS::Info members( "Members", std::to_string( this->impl->_members.size() ) );
+        
+        if( this->impl->_path.has_value() )
+        {
+            i.value( XS::ToString::Filename( *( this->impl->_path ) ) );
+        }
+        
+        for( const auto & member: this->impl->_members )
+        {
+            members.addChild( member );
+        }
+        
+        i.addChild( members );
+        
+        return i;
+    }
+    
+    bool ArchiveFile::IsArchive( const MappedFile & data )
+    {
+        return data.size() >= 8 && std::memcmp( data.data(), "!<arch>\n", 8 ) == 0;
+    }
+    
+    std::optional< std::string > ArchiveFile::path() const
+    {
+        return this->impl->_path;
+    }
+    
+    MappedFile ArchiveFile::data() const
+    {
+        return this->impl->_data;
+    }
+    
+    std::vector< ArchiveMember > ArchiveFile::members() const
+    {
+        return this->impl->_members;
+    }
+    
+    bool ArchiveFile::isMachO( size_t index ) const
+    {
+        if( index >= this->impl->_members.size() )
+        {
+            throw std::out_of_range( "Invalid archive member index: " + std::to_string( index ) );
+        }
+        
+        if( this->impl->_members[ index ].size() < 4 )
+        {
+            return false;
+        }
+        
+        {
+            uint32_t magic( this->impl->_data.read< uint32_t >( this->impl->_members[ index ].offset(), true ) );
+            
+            return magic == 0xFEEDFACE || magic == 0xFEEDFACF || magic == 0xCEFAEDFE || magic == 0xCFFAEDFE;
+        }
+    }
+    
+    File ArchiveFile::member( size_t index ) const
+    {
+        if( index >= this->impl->_members.size() )
+        {
+            throw std::out_of_range( "Invalid archive member index: " + std::to_string( index ) );
+        }
+        
+        {
+            std::lock_guard< std::mutex > lock( this->impl->_cache->_mutex );
+            
+            if( this->impl->_cache->_files[ index ].has_value() )
+            {
+                return *( this->impl->_cache->_files[ index ] );
+            }
+        }
+        
+        {
+            /* Object file offsets are relative to the member, so it is parsed over a slice of the archive */
+            const ArchiveMember & member( this->impl->_members[ index ] );
+            File                  file( this->impl->_data.slice( member.offset(), member.size() ), 0 );
+            
+            std::lock_guard< std::mutex > lock( this->impl->_cache->_mutex );
+            
+            if( this->impl->_cache->_files[ index ].has_value() == false )
+            {
+                this->impl->_cache->_files[ index ] = file;
+            }
+            
+            return *( this->impl->_cache->_files[ index ] );
+        }
+    }
+    
+    std::vector< std::pair< ArchiveMember, File > > ArchiveFile::parseMembers() const
+    {
+        std::vector< std::pair< ArchiveMember, File > > files;
+        
+        Parallel::For
+        (
+            this->impl->_members.size(),
+            [ & ]( size_t i )
+            {
+                if( this->isMachO( i ) )
+                {
+                    this->member( i );
+                }
+            }
+        );
+        
+        for( size_t i = 0; i < this->impl->_members.size(); i++ )
+        {
+            if( this->isMachO( i ) )
+            {
+                files.push_back( { this->impl->_members[ i ], this->member( i ) } );
+            }
+        }
+        
+        return files;
+    }
+    
+    bool ArchiveFile::hasSymbolTable() const
+    {
+        return this->impl->_symbolTableFormat != IMPL::SymbolTableFormat::None;
+    }
+    
+    std::optional< size_t > ArchiveFile::memberIndex( std::string_view symbol ) const
+    {
+        std::call_once
+        (
+            this->impl->_cache->_symbolsOnce,
+            [ & ]
+            {
+                this->impl->parseSymbolTable();
+            }
+        );
+        
+        {
+            auto it( this->impl->_cache->_symbols.find( symbol ) );
+            
+            if( it == this->impl->_cache->_symbols.end() )
+            {
+                return {};
+            }
+            
+            return it->second;
+        }
+    }
+    
+    void swap( ArchiveFile & o1, ArchiveFile & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ArchiveFile::IMPL::IMPL( const std::string & path ):
+        _path(              path ),
+        _data(              MappedFile( path ) ),
+        _symbolTableFormat( SymbolTableFormat::None ),
+        _symbolTableOffset( 0 ),
+        _symbolTableSize(   0 ),
+        _cache(             std::make_shared< Members >() )
+    {
+        this->parse();
+    }
+    
+    ArchiveFile::IMPL::IMPL( const MappedFile & data ):
+        _path(              data.path() ),
+        _data(              data ),
+        _symbolTableFormat( SymbolTableFormat::None ),
+        _symbolTableOffset( 0 ),
+        _symbolTableSize(   0 ),
+        _cache(             std::make_shared< Members >() )
+    {
+        this->parse();
+    }
+    
+    ArchiveFile::IMPL::IMPL( const IMPL & o ):
+        _path(              o._path ),
+        _data(              o._data ),
+        _members(           o._members ),
+        _symbolTableFormat( o._symbolTableFormat ),
+        _symbolTableOffset( o._symbolTableOffset ),
+        _symbolTableSize(   o._symbolTableSize ),
+        _cache(             o._cache )
+    {}
+    
+    ArchiveFile::IMPL::~IMPL( void )
+    {}
+    
+    void ArchiveFile::IMPL::parse()
+    {
+        uint64_t offset( 8 );
+        uint64_t longNamesOffset( 0 );
+        uint64_t longNamesSize( 0 );
+        
+        if( ArchiveFile::IsArchive( this->_data ) == false )
+        {
+            throw std::runtime_error( "Invalid archive signature" );
+        }
+        
+        while( offset + 60 <= this->_data.size() )
+        {
+            const uint8_t * header( this->_data.pointer( offset, 60 ) );
+            std::string     name( reinterpret_cast< const char * >( header ), 16 );
+            uint64_t        size( ParseNumber( header + 48, 10, 10 ) );
+            uint64_t        dataOffset( offset + 60 );
+            uint64_t        dataSize( size );
+            
+            if( header[ 58 ] != '`' || header[ 59 ] != '\n' )
+            {
+                throw std::runtime_error( "Invalid archive member header: " + XS::ToString::Hex( offset ) );
+            }
+            
+            if( this->_data.contains( dataOffset, size ) == false )
+            {
+                throw std::runtime_error( "Invalid archive member size: " + XS::ToString::Hex( size ) );
+            }
+            
+            name = name.substr( 0, name.find_last_not_of( ' ' ) + 1 );
+            
+            if( name.substr( 0, 3 ) == "#1/" )
+            {
+                /* BSD extended name, stored at the beginning of the member data */
+                uint64_t length( ParseNumber( reinterpret_cast< const uint8_t * >( name.data() ) + 3, name.size() - 3, 10 ) );
+                
+                if( length > size )
+                {
+                    throw std::runtime_error( "Invalid archive member name length: " + XS::ToString::Hex( length ) );
+                }
+                
+                name        = std::string( this->_data.cString( dataOffset ).substr( 0, length ) );
+                dataOffset += length;
+                dataSize   -= length;
+            }
+            else if( name == "//" )
+            {
+                longNamesOffset = dataOffset;
+                longNamesSize   = dataSize;
+                name            = {};
+            }
+            else if( name == "/" || name == "/SYM64/" )
+            {
+                this->_symbolTableFormat = ( name == "/" ) ? SymbolTableFormat::GNU : SymbolTableFormat::GNU64;
+                this->_symbolTableOffset = dataOffset;
+                this->_symbolTableSize   = dataSize;
+                name                     = {};
+            }
+            else if( name.size() > 1 && name[ 0 ] == '/' && name.find_first_not_of( "0123456789", 1 ) == std::string::npos )
+            {
+                /* GNU extended name, as an offset in the // member */
+                uint64_t nameOffset( ParseNumber( reinterpret_cast< const uint8_t * >( name.data() ) + 1, name.size() - 1, 10 ) );
+                
+                if( nameOffset >= longNamesSize )
+                {
+                    throw std::runtime_error( "Invalid archive member name offset: " + XS::ToString::Hex( nameOffset ) );
+                }
+                
+                {
+                    std::string_view names( reinterpret_cast< const char * >( this->_data.pointer( longNamesOffset, longNamesSize ) ), longNamesSize );
+                    
+                    name = std::string( names.substr( nameOffset, names.find( '\n', nameOffset ) - nameOffset ) );
+                }
+            }
+            
+            if( name.size() > 1 && name.back() == '/' )
+            {
+                name.pop_back();
+            }
+            
+            if( name == "__.SYMDEF" || name == "__.SYMDEF SORTED" || name == "__.SYMDEF_64" || name == "__.SYMDEF_64 SORTED" )
+            {
+                this->_symbolTableFormat = ( name.substr( 0, 12 ) == "__.SYMDEF_64" ) ? SymbolTableFormat::BSD64 : SymbolTableFormat::BSD;
+                this->_symbolTableOffset = dataOffset;
+                this->_symbolTableSize   = dataSize;
+            }
+            else if( name.size() > 0 )
+            {
+                this->_members.push_back( { name, offset, dataOffset, dataSize, ParseNumber( header + 16, 12, 10 ), static_cast< uint32_t >( ParseNumber( header + 40, 8, 8 ) ) } );
+            }
+            
+            offset += 60 + size + ( size & 1 );
+        }
+        
+        this->_cache->_files.resize( this->_members.size() );
+    }
+    
+    void ArchiveFile::IMPL::parseSymbolTable()
+    {
+        std::unordered_map< uint64_t, size_t > headers;
+        uint64_t                               offset( this->_symbolTableOffset );
+        uint64_t                               end( this->_symbolTableOffset + this->_symbolTableSize );
+        
+        for( size_t i = 0; i < this->_members.size(); i++ )
+        {
+            headers[ this->_members[ i ].headerOffset() ] = i;
+        }
+        
+        auto add = [ & ]( std::string_view name, uint64_t header )
+        {
+            auto it( headers.find( header ) );
+            
+            if( it != headers.end() && name.size() > 0 )
+            {
+                this->_cache->_symbols.emplace( name, it->second );
+            }
+        };
+        
+        if( this->_symbolTableFormat == SymbolTableFormat::BSD || this->_symbolTableFormat == SymbolTableFormat::BSD64 )
+        {
+            /* The ranlib table uses the byte order of the archived objects */
+            bool     is64( this->_symbolTableFormat == SymbolTableFormat::BSD64 );
+            size_t   word( ( is64 ) ? 8 : 4 );
+            bool     bigEndian( false );
+            uint64_t size( 0 );
+            
+            if( this->_symbolTableSize < word * 2 )
+            {
+                return;
+            }
+            
+            size = ( is64 ) ? this->_data.read< uint64_t >( offset ) : this->_data.read< uint32_t >( offset );
+            
+            if( size > this->_symbolTableSize - word )
+            {
+                bigEndian = true;
+                size      = ( is64 ) ? this->_data.read< uint64_t >( offset, true ) : this->_data.read< uint32_t >( offset, true );
+            }
+            
+            if( size > this->_symbolTableSize - word * 2 )
+            {
+                throw std::runtime_error( "Invalid archive symbol table size: " + XS::ToString::Hex( size ) );
+            }
+            
+            {
+                uint64_t entries( offset + word );
+                uint64_t strings( entries + size + word );
+                
+                for( uint64_t i = 0; i < size / ( word * 2 ); i++ )
+                {
+                    uint64_t entry( entries + i * word * 2 );
+                    uint64_t strx( ( is64 ) ? this->_data.read< uint64_t >( entry,        bigEndian ) : this->_data.read< uint32_t >( entry,        bigEndian ) );
+                    uint64_t header( ( is64 ) ? this->_data.read< uint64_t >( entry + word, bigEndian ) : this->_data.read< uint32_t >( entry + word, bigEndian ) );
+                    
+                    if( strings + strx < end )
+                    {
+                        add( this->_data.cString( strings + strx ), header );
+                    }
+                }
+            }
+        }
+        else if( this->_symbolTableFormat == SymbolTableFormat::GNU || this->_symbolTableFormat == SymbolTableFormat::GNU64 )
+        {
+            /* GNU symbol tables are always big-endian */
+            bool     is64( this->_symbolTableFormat == SymbolTableFormat::GNU64 );
+            size_t   word( ( is64 ) ? 8 : 4 );
+            uint64_t count( 0 );
+            
+            if( this->_symbolTableSize < word )
+            {
+                return;
+            }
+            
+            count = ( is64 ) ? this->_data.read< uint64_t >( offset, true ) : this->_data.read< uint32_t >( offset, true );
+            
+            if( count > ( this->_symbolTableSize - word ) / word )
+            {
+                throw std::runtime_error( "Invalid archive symbol count: " + XS::ToString::Hex( count ) );
+            }
+            
+            {
+                uint64_t name( offset + word + count * word );
+                
+                for( uint64_t i = 0; i < count && name < end; i++ )
+                {
+                    uint64_t         entry( offset + word + i * word );
+                    uint64_t         header( ( is64 ) ? this->_data.read< uint64_t >( entry, true ) : this->_data.read< uint32_t >( entry, true ) );
+                    std::string_view symbol( this->_data.cString( name ) );
+                    
+                    add( symbol, header );
+                    
+                    name += symbol.size() + 1;
+                }
+            }
+        }
+    }
+    
+    uint64_t ArchiveFile::IMPL::ParseNumber( const uint8_t * field, size_t size, int base )
+    {
+        std::string value( reinterpret_cast< const char * >( field ), size );
+        
+        return std::strtoull( value.c_str(), nullptr, base );
+    }
+}
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ArchiveMember.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ArchiveMember.hpp>
+#include <MachO/ToString.hpp>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class ArchiveMember::IMPL
+    {
+        public:
+            
+            IMPL( const std::string & name, uint64_t headerOffset, uint64_t offset, uint64_t size, uint64_t modificationTime, uint32_t mode );
+            IMPL( const IMPL & o );
+            ~IMPL( void );
+            
+            std::string _name;
+            uint64_t    _headerOffset;
+            uint64_t    _offset;
+            uint64_t    _size;
+            uint64_t    _modificationTime;
+            uint32_t    _mode;
+    };
+    
+    ArchiveMember::ArchiveMember( const std::string & name, uint64_t headerOffset, uint64_t offset, uint64_t size, uint64_t modificationTime, uint32_t mode ):
+        impl( std::make_unique< IMPL >( name, headerOffset, offset, size, modificationTime, mode ) )
+    {}
+    
+    ArchiveMember::ArchiveMember( const ArchiveMember & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ArchiveMember::ArchiveMember( ArchiveMember && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ArchiveMember::~ArchiveMember( void )
+    {}
+    
+    ArchiveMember & ArchiveMember::operator =( ArchiveMember o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info ArchiveMember::getInfo() const
+    {
+        XS::Info i( "Archive member", this->name() );
+        
+        i.addChild( { "Offset",            XS::ToString::Hex( this->offset() ) } );
+        i.addChild( { "Size",              XS::ToString::Size( this->size() ) } );
+        i.addChild( { "Modification time", XS::ToString::DateTime( this->modificationTime() ) } );
+        i.addChild( { "Mode",              XS::ToString::Hex( this->mode() ) } );
+        
+        return i;
+    }
+    
+    std::string ArchiveMember::name() const
+    {
+        return this->impl->_name;
+    }
+    
+    uint64_t ArchiveMember::headerOffset() const
+    {
+        return this->impl->_headerOffset;
+    }
+    
+    uint64_t ArchiveMember::offset() const
+    {
+        return this->impl->_offset;
+    }
+    
+    uint64_t ArchiveMember::size() const
+    {
+        return this->impl->_size;
+    }
+    
+    uint64_t ArchiveMember::modificationTime() const
+    {
+        return this->impl->_modificationTime;
+    }
+    
+    uint32_t ArchiveMember::mode() const
+    {
+        return this->impl->_mode;
+    }
+    
+    void swap( ArchiveMember & o1, ArchiveMember & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ArchiveMember::IMPL::IMPL( const std::string & name, uint64_t headerOffset, uint64_t offset, uint64_t size, uint64_t modificationTime, uint32_t mode ):
+        _name(             name ),
+        _headerOffset(     headerOffset ),
+        _offset(           offset ),
+        _size(             size ),
+        _modificationTime( modificationTime ),
+        _mode(             mode )
+    {}
+    
+    ArchiveMember::IMPL::IMPL( const IMPL & o ):
+        _name(             o._name ),
+        _headerOffset(     o._headerOffset ),
+        _offset(           o._offset ),
+        _size(             o._size ),
+        _modificationTime( o._modificationTime ),
+        _mode(             o._mode )
+    {}
+    
+    ArchiveMember::IMPL::~IMPL( void )
+    {}
+}
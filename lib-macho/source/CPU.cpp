@@ -315,6 +315,49 @@ namespace MachO
         return this->typeString() + " - " + this->subTypeString();
     }
     
+    std::string CPU::name() const
+    {
+        uint32_t abi(     this->type() &  0xFF000000 );
+        uint32_t type(    this->type() & ~0xFF000000 );
+        uint32_t subType( this->subType() & 0x00FFFFFF );
+        
+        switch( type )
+        {
+            case 7:
+                
+                if( abi == 0x01000000 )
+                {
+                    return ( subType == 8 ) ? "x86_64h" : "x86_64";
+                }
+                
+                return "i386";
+            
+            case 12:
+                
+                if( abi == 0x01000000 )
+                {
+                    return ( subType == 2 ) ? "arm64e" : "arm64";
+                }
+                
+                if( abi == 0x02000000 )
+                {
+                    return "arm64_32";
+                }
+                
+                switch( subType )
+                {
+                    case 6:  return "armv6";
+                    case 9:  return "armv7";
+                    case 11: return "armv7s";
+                    case 12: return "armv7k";
+                    default: return "arm";
+                }
+            
+            case 18: return ( abi == 0x01000000 ) ? "ppc64" : "ppc";
+            default: return XS::ToString::Hex( this->type() );
+        }
+    }
+    
     void swap( CPU & o1, CPU & o2 )
     {
         using std::swap;
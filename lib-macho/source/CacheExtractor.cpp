@@ -0,0 +1,834 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CacheExtractor.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/CacheExtractor.hpp>
+#include <MachO/Parallel.hpp>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace MachO
+{
+    class CacheExtractor::IMPL
+    {
+        public:
+            
+            struct Segment
+            {
+                size_t   command;
+                bool     linkEdit;
+                uint64_t vmAddress;
+                uint64_t vmSize;
+                uint64_t fileOffset;
+                uint64_t fileSize;
+                uint64_t newFileOffset;
+            };
+            
+            class Output
+            {
+                public:
+                    
+                    Output( const std::string & path );
+                    Output( const Output & o ) = delete;
+                    ~Output();
+                    
+                    Output & operator =( const Output & o ) = delete;
+                    
+                    void write( const uint8_t * data, size_t size, uint64_t offset );
+                    void copy( const std::string & path, uint64_t sourceOffset, const uint8_t * data, size_t size, uint64_t offset );
+                    void truncate( uint64_t size );
+                    
+                    std::string _path;
+                    int         _fd;
+            };
+            
+            IMPL( const CacheFile & cache );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            void extract( size_t index, const std::string & path ) const;
+            void rebase( Output & output, const Segment & segment, bool is64 ) const;
+            
+            template< typename T >
+            static T Read( const std::vector< uint8_t > & buffer, size_t offset, bool bigEndian );
+            
+            template< typename T >
+            static void Write( std::vector< uint8_t > & buffer, size_t offset, T value, bool bigEndian );
+            
+            static uint64_t    Align( uint64_t value, uint64_t alignment );
+            static void        CreateDirectories( const std::string & path );
+            static std::string RelativePath( const std::string & path );
+            
+            CacheFile                     _cache;
+            AddressSpace                  _space;
+            std::vector< CacheImageInfo > _images;
+            std::vector< CacheSlideInfo > _slideInfo;
+    };
+    
+    CacheExtractor::CacheExtractor( const CacheFile & cache ):
+        impl( std::make_unique< IMPL >( cache ) )
+    {}
+    
+    CacheExtractor::CacheExtractor( const CacheExtractor & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    CacheExtractor::CacheExtractor( CacheExtractor && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    CacheExtractor::~CacheExtractor( void )
+    {}
+    
+    CacheExtractor & CacheExtractor::operator =( CacheExtractor o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    CacheFile CacheExtractor::cache() const
+    {
+        return this->impl->_cache;
+    }
+    
+    void CacheExtractor::extract( size_t index, const std::string & path ) const
+    {
+        if( index >= this->impl->_images.size() )
+        {
+            throw std::out_of_range( "Invalid image index: " + std::to_string( index ) );
+        }
+        
+        this->impl->extract( index, path );
+    }
+    
+    std::vector< std::string > CacheExtractor::extractAll( const std::string & directory ) const
+    {
+        std::vector< std::string >        paths;
+        std::vector< size_t >             indices;
+        std::unordered_set< std::string > seen;
+        
+        /* Aliased images share an install path, and only the first one is written */
+        for( size_t i = 0; i < this->impl->_images.size(); i++ )
+        {
+            std::string path( directory + "/" + IMPL::RelativePath( this->impl->_images[ i ].path() ) );
+            
+            if( seen.insert( path ).second )
+            {
+                paths.push_back( path );
+                indices.push_back( i );
+            }
+        }
+        
+        Parallel::For
+        (
+            paths.size(),
+            [ & ]( size_t i )
+            {
+                size_t slash( paths[ i ].rfind( '/' ) );
+                
+                if( slash != std::string::npos && slash > 0 )
+                {
+                    IMPL::CreateDirectories( paths[ i ].substr( 0, slash ) );
+                }
+                
+                this->impl->extract( indices[ i ], paths[ i ] );
+            }
+        );
+        
+        return paths;
+    }
+    
+    void swap( CacheExtractor & o1, CacheExtractor & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    CacheExtractor::IMPL::IMPL( const CacheFile & cache ):
+        _cache(     cache ),
+        _space(     cache.addressSpace() ),
+        _images(    cache.images() ),
+        _slideInfo( cache.slideInfo() )
+    {}
+    
+    CacheExtractor::IMPL::IMPL( const IMPL & o ):
+        _cache(     o._cache ),
+        _space(     o._space ),
+        _images(    o._images ),
+        _slideInfo( o._slideInfo )
+    {}
+    
+    CacheExtractor::IMPL::~IMPL()
+    {}
+    
+    void CacheExtractor::IMPL::extract( size_t index, const std::string & path ) const
+    {
+        uint64_t                 address( this->_images[ index ].address() );
+        uint32_t                 magic( this->_space.read< uint32_t >( address ) );
+        bool                     bigEndian( this->_space.bigEndian() );
+        bool                     is64( magic == 0xFEEDFACF );
+        size_t                   headerSize( ( is64 ) ? 32 : 28 );
+        std::vector< uint8_t >   header;
+        std::vector< uint8_t >   linkEdit;
+        std::vector< Segment >   segments;
+        std::optional< size_t >  symTab;
+        std::optional< size_t >  dysymTab;
+        std::optional< size_t >  dyldInfo;
+        std::vector< size_t >    linkEditData;
+        const Segment          * linkEditSegment( nullptr );
+        
+        if( magic != 0xFEEDFACE && magic != 0xFEEDFACF )
+        {
+            throw std::runtime_error( "Invalid image header: " + XS::ToString::Hex( magic ) );
+        }
+        
+        {
+            uint32_t count( this->_space.read< uint32_t >( address + 16 ) );
+            uint32_t size( this->_space.read< uint32_t >( address + 20 ) );
+            size_t   offset( headerSize );
+            
+            header.resize( headerSize + size );
+            std::memcpy( header.data(), this->_space.pointer( address, header.size() ), header.size() );
+            
+            for( uint32_t i = 0; i < count; i++ )
+            {
+                if( offset + 8 > header.size() )
+                {
+                    throw std::runtime_error( "Invalid load command offset: " + XS::ToString::Hex( offset ) );
+                }
+                
+                {
+                    uint32_t command( Read< uint32_t >( header, offset,     bigEndian ) );
+                    uint32_t commandSize( Read< uint32_t >( header, offset + 4, bigEndian ) );
+                    
+                    if( commandSize < 8 || commandSize > header.size() - offset )
+                    {
+                        throw std::runtime_error( "Invalid load command size: " + XS::ToString::Hex( commandSize ) );
+                    }
+                    
+                    if( command == 0x01 || command == 0x19 )
+                    {
+                        Segment segment;
+                        bool    segment64( command == 0x19 );
+                        
+                        segment.command       = offset;
+                        segment.linkEdit      = std::strncmp( reinterpret_cast< const char * >( header.data() + offset + 8 ), "__LINKEDIT", 16 ) == 0;
+                        segment.vmAddress     = ( segment64 ) ? Read< uint64_t >( header, offset + 24, bigEndian ) : Read< uint32_t >( header, offset + 24, bigEndian );
+                        segment.vmSize        = ( segment64 ) ? Read< uint64_t >( header, offset + 32, bigEndian ) : Read< uint32_t >( header, offset + 28, bigEndian );
+                        segment.fileOffset    = ( segment64 ) ? Read< uint64_t >( header, offset + 40, bigEndian ) : Read< uint32_t >( header, offset + 32, bigEndian );
+                        segment.fileSize      = ( segment64 ) ? Read< uint64_t >( header, offset + 48, bigEndian ) : Read< uint32_t >( header, offset + 36, bigEndian );
+                        segment.newFileOffset = 0;
+                        
+                        segments.push_back( segment );
+                    }
+                    else if( command == 0x02 )
+                    {
+                        symTab = offset;
+                    }
+                    else if( command == 0x0B )
+                    {
+                        dysymTab = offset;
+                    }
+                    else if( command == 0x22 || command == 0x80000022 )
+                    {
+                        dyldInfo = offset;
+                    }
+                    else if( command == 0x1D || command == 0x1E || command == 0x26 || command == 0x29 || command == 0x2B || command == 0x2E || command == 0x80000033 || command == 0x80000034 )
+                    {
+                        linkEditData.push_back( offset );
+                    }
+                    
+                    offset += commandSize;
+                }
+            }
+        }
+        
+        for( const auto & segment: segments )
+        {
+            if( segment.linkEdit )
+            {
+                linkEditSegment = &segment;
+            }
+        }
+        
+        if( linkEditSegment == nullptr )
+        {
+            throw std::runtime_error( "Missing __LINKEDIT segment in image: " + this->_images[ index ].path() );
+        }
+        
+        {
+            uint32_t cpu( Read< uint32_t >( header, 4, bigEndian ) );
+            uint64_t pageSize( ( ( cpu & 0xFF ) == 0x0C ) ? 0x4000 : 0x1000 );
+            uint64_t cursor( 0 );
+            uint64_t linkEditOffset( 0 );
+            uint64_t linkEditAddress( linkEditSegment->vmAddress );
+            uint64_t linkEditBase( linkEditSegment->fileOffset );
+            
+            /* Segment payloads are laid out contiguously, page-aligned, in load command order */
+            for( auto & segment: segments )
+            {
+                if( segment.linkEdit || segment.fileSize == 0 )
+                {
+                    continue;
+                }
+                
+                segment.newFileOffset = cursor;
+                cursor                = Align( cursor + std::max< uint64_t >( segment.fileSize, ( cursor == 0 ) ? header.size() : 0 ), pageSize );
+            }
+            
+            linkEditOffset = cursor;
+            
+            {
+                auto append = [ & ]( uint64_t offset, uint64_t size ) -> uint32_t
+                {
+                    size_t position( Align( linkEdit.size(), ( is64 ) ? 8 : 4 ) );
+                    
+                    if( size == 0 )
+                    {
+                        return 0;
+                    }
+                    
+                    linkEdit.resize( position + size );
+                    std::memcpy( linkEdit.data() + position, this->_space.pointer( linkEditAddress + ( offset - linkEditBase ), size ), size );
+                    
+                    return static_cast< uint32_t >( linkEditOffset + position );
+                };
+                
+                if( dyldInfo.has_value() )
+                {
+                    for( size_t i = 0; i < 5; i++ )
+                    {
+                        size_t   field( *( dyldInfo ) + 8 + i * 8 );
+                        uint32_t offset( Read< uint32_t >( header, field, bigEndian ) );
+                        uint32_t size( Read< uint32_t >( header, field + 4, bigEndian ) );
+                        
+                        Write< uint32_t >( header, field, append( offset, size ), bigEndian );
+                    }
+                }
+                
+                for( size_t command: linkEditData )
+                {
+                    uint32_t type( Read< uint32_t >( header, command, bigEndian ) );
+                    uint32_t offset( Read< uint32_t >( header, command + 8, bigEndian ) );
+                    uint32_t size( Read< uint32_t >( header, command + 12, bigEndian ) );
+                    
+                    /* The cache signature and split segment info describe the cache, not the image */
+                    if( type == 0x1D || type == 0x1E )
+                    {
+                        Write< uint32_t >( header, command + 8,  0, bigEndian );
+                        Write< uint32_t >( header, command + 12, 0, bigEndian );
+                        
+                        continue;
+                    }
+                    
+                    Write< uint32_t >( header, command + 8, append( offset, size ), bigEndian );
+                }
+                
+                if( symTab.has_value() )
+                {
+                    uint32_t                                    symbolOffset( Read< uint32_t >( header, *( symTab ) + 8,  bigEndian ) );
+                    uint32_t                                    symbolCount( Read< uint32_t >( header, *( symTab ) + 12, bigEndian ) );
+                    uint32_t                                    stringOffset( Read< uint32_t >( header, *( symTab ) + 16, bigEndian ) );
+                    size_t                                      entrySize( ( is64 ) ? 16 : 12 );
+                    uint32_t                                    insert( symbolCount );
+                    std::vector< Symbol >                       locals( this->_cache.localSymbols( index ) );
+                    std::vector< char >                         strings( { ' ', 0 } );
+                    std::unordered_map< std::string, uint32_t > indexes;
+                    std::vector< uint8_t >                      symbols;
+                    
+                    auto addString = [ & ]( const std::string & name ) -> uint32_t
+                    {
+                        auto it( indexes.find( name ) );
+                        
+                        if( it != indexes.end() )
+                        {
+                            return it->second;
+                        }
+                        
+                        {
+                            uint32_t strx( static_cast< uint32_t >( strings.size() ) );
+                            
+                            strings.insert( strings.end(), name.begin(), name.end() );
+                            strings.push_back( 0 );
+                            indexes.emplace( name, strx );
+                            
+                            return strx;
+                        }
+                    };
+                    
+                    auto remap = [ & ]( uint32_t symbol ) -> uint32_t
+                    {
+                        return ( symbol < insert ) ? symbol : symbol + static_cast< uint32_t >( locals.size() );
+                    };
+                    
+                    if( dysymTab.has_value() )
+                    {
+                        insert = std::min( symbolCount, Read< uint32_t >( header, *( dysymTab ) + 8, bigEndian ) + Read< uint32_t >( header, *( dysymTab ) + 12, bigEndian ) );
+                    }
+                    
+                    symbols.reserve( ( symbolCount + locals.size() ) * entrySize );
+                    
+                    for( uint32_t i = 0; i <= symbolCount; i++ )
+                    {
+                        /* Unmapped local symbols are inserted after the image's own locals */
+                        if( i == insert )
+                        {
+                            for( const auto & local: locals )
+                            {
+                                size_t position( symbols.size() );
+                                
+                                symbols.resize( position + entrySize );
+                                Write< uint32_t >( symbols, position, addString( local.name() ), bigEndian );
+                                
+                                symbols[ position + 4 ] = local.type();
+                                symbols[ position + 5 ] = local.section();
+                                
+                                Write< uint16_t >( symbols, position + 6, local.description(), bigEndian );
+                                
+                                if( is64 )
+                                {
+                                    Write< uint64_t >( symbols, position + 8, local.value(), bigEndian );
+                                }
+                                else
+                                {
+                                    Write< uint32_t >( symbols, position + 8, static_cast< uint32_t >( local.value() ), bigEndian );
+                                }
+                            }
+                        }
+                        
+                        if( i == symbolCount )
+                        {
+                            break;
+                        }
+                        
+                        {
+                            size_t          position( symbols.size() );
+                            uint64_t        entryAddress( linkEditAddress + ( symbolOffset + i * entrySize - linkEditBase ) );
+                            const uint8_t * entry( this->_space.pointer( entryAddress, entrySize ) );
+                            uint32_t        strx( this->_space.read< uint32_t >( entryAddress ) );
+                            
+                            symbols.insert( symbols.end(), entry, entry + entrySize );
+                            
+                            if( strx != 0 )
+                            {
+                                std::string_view name( this->_space.readCString( linkEditAddress + ( stringOffset + strx - linkEditBase ) ) );
+                                
+                                Write< uint32_t >( symbols, position, addString( std::string( name ) ), bigEndian );
+                            }
+                        }
+                    }
+                    
+                    if( dysymTab.has_value() )
+                    {
+                        size_t   command( *( dysymTab ) );
+                        uint32_t indirectOffset( Read< uint32_t >( header, command + 56, bigEndian ) );
+                        uint32_t indirectCount( Read< uint32_t >( header, command + 60, bigEndian ) );
+                        uint32_t newIndirectOffset( append( indirectOffset, static_cast< uint64_t >( indirectCount ) * 4 ) );
+                        
+                        for( uint32_t i = 0; i < indirectCount; i++ )
+                        {
+                            size_t   position( newIndirectOffset - linkEditOffset + i * 4 );
+                            uint32_t symbol( Read< uint32_t >( linkEdit, position, bigEndian ) );
+                            
+                            /* INDIRECT_SYMBOL_LOCAL and INDIRECT_SYMBOL_ABS are kept as-is */
+                            if( ( symbol & 0xC0000000 ) == 0 )
+                            {
+                                Write< uint32_t >( linkEdit, position, remap( symbol ), bigEndian );
+                            }
+                        }
+                        
+                        Write< uint32_t >( header, command + 12, Read< uint32_t >( header, command + 12, bigEndian ) + static_cast< uint32_t >( locals.size() ), bigEndian );
+                        Write< uint32_t >( header, command + 16, remap( Read< uint32_t >( header, command + 16, bigEndian ) ), bigEndian );
+                        Write< uint32_t >( header, command + 24, remap( Read< uint32_t >( header, command + 24, bigEndian ) ), bigEndian );
+                        Write< uint32_t >( header, command + 56, newIndirectOffset, bigEndian );
+                        
+                        /* TOC, module table, external references and relocations are not used in caches */
+                        for( size_t field: { 32, 36, 40, 44, 48, 52, 64, 68, 72, 76 } )
+                        {
+                            Write< uint32_t >( header, command + field, 0, bigEndian );
+                        }
+                    }
+                    
+                    {
+                        size_t position( Align( linkEdit.size(), ( is64 ) ? 8 : 4 ) );
+                        
+                        linkEdit.resize( position );
+                        linkEdit.insert( linkEdit.end(), symbols.begin(), symbols.end() );
+                        Write< uint32_t >( header, *( symTab ) + 8,  static_cast< uint32_t >( linkEditOffset + position ), bigEndian );
+                        Write< uint32_t >( header, *( symTab ) + 12, static_cast< uint32_t >( symbols.size() / entrySize ), bigEndian );
+                    }
+                    
+                    {
+                        size_t position( linkEdit.size() );
+                        
+                        strings.resize( Align( strings.size(), ( is64 ) ? 8 : 4 ), 0 );
+                        linkEdit.insert( linkEdit.end(), strings.begin(), strings.end() );
+                        Write< uint32_t >( header, *( symTab ) + 16, static_cast< uint32_t >( linkEditOffset + position ), bigEndian );
+                        Write< uint32_t >( header, *( symTab ) + 20, static_cast< uint32_t >( strings.size() ), bigEndian );
+                    }
+                }
+            }
+            
+            /* Segment and section file offsets now point into the extracted file */
+            for( auto & segment: segments )
+            {
+                bool     segment64( Read< uint32_t >( header, segment.command, bigEndian ) == 0x19 );
+                size_t   sections( segment.command + ( ( segment64 ) ? 72 : 56 ) );
+                uint32_t sectionCount( Read< uint32_t >( header, segment.command + ( ( segment64 ) ? 64 : 48 ), bigEndian ) );
+                size_t   sectionSize( ( segment64 ) ? 80 : 68 );
+                
+                if( segment.linkEdit )
+                {
+                    segment.newFileOffset = linkEditOffset;
+                    segment.fileSize      = linkEdit.size();
+                    segment.vmSize        = std::max( segment.vmSize, Align( linkEdit.size(), pageSize ) );
+                }
+                
+                if( segment64 )
+                {
+                    Write< uint64_t >( header, segment.command + 32, segment.vmSize,        bigEndian );
+                    Write< uint64_t >( header, segment.command + 40, segment.newFileOffset, bigEndian );
+                    Write< uint64_t >( header, segment.command + 48, segment.fileSize,      bigEndian );
+                }
+                else
+                {
+                    Write< uint32_t >( header, segment.command + 28, static_cast< uint32_t >( segment.vmSize ),        bigEndian );
+                    Write< uint32_t >( header, segment.command + 32, static_cast< uint32_t >( segment.newFileOffset ), bigEndian );
+                    Write< uint32_t >( header, segment.command + 36, static_cast< uint32_t >( segment.fileSize ),      bigEndian );
+                }
+                
+                if( sections + sectionCount * sectionSize > header.size() )
+                {
+                    throw std::runtime_error( "Invalid section count: " + XS::ToString::Hex( sectionCount ) );
+                }
+                
+                for( uint32_t i = 0; i < sectionCount; i++ )
+                {
+                    size_t   section( sections + i * sectionSize );
+                    uint64_t sectionAddress( ( segment64 ) ? Read< uint64_t >( header, section + 32, bigEndian ) : Read< uint32_t >( header, section + 32, bigEndian ) );
+                    size_t   offsetField( section + ( ( segment64 ) ? 48 : 40 ) );
+                    
+                    if( Read< uint32_t >( header, offsetField, bigEndian ) != 0 )
+                    {
+                        Write< uint32_t >( header, offsetField, static_cast< uint32_t >( segment.newFileOffset + ( sectionAddress - segment.vmAddress ) ), bigEndian );
+                    }
+                    
+                    Write< uint32_t >( header, offsetField + 8,  0, bigEndian );
+                    Write< uint32_t >( header, offsetField + 12, 0, bigEndian );
+                }
+            }
+            
+            /* MH_DYLIB_IN_CACHE */
+            Write< uint32_t >( header, 24, Read< uint32_t >( header, 24, bigEndian ) & ~0x80000000U, bigEndian );
+            
+            {
+                Output                             output( path );
+                std::vector< MappedFile >          files( this->_space.files() );
+                std::vector< AddressSpace::Range > ranges( this->_space.ranges() );
+                
+                for( const auto & segment: segments )
+                {
+                    if( segment.linkEdit || segment.fileSize == 0 )
+                    {
+                        continue;
+                    }
+                    
+                    {
+                        auto range = std::find_if
+                        (
+                            ranges.begin(),
+                            ranges.end(),
+                            [ & ]( const AddressSpace::Range & r )
+                            {
+                                return segment.vmAddress >= r.vmAddress && segment.vmAddress - r.vmAddress + segment.fileSize <= r.size;
+                            }
+                        );
+                        
+                        if( range == ranges.end() || range->file >= files.size() || files[ range->file ].path().has_value() == false )
+                        {
+                            output.write( this->_space.pointer( segment.vmAddress, segment.fileSize ), segment.fileSize, segment.newFileOffset );
+                        }
+                        else
+                        {
+                            const MappedFile & file( files[ range->file ] );
+                            uint64_t           offset( range->fileOffset + ( segment.vmAddress - range->vmAddress ) );
+                            
+                            output.copy( *( file.path() ), file.offset() + offset, file.pointer( offset, segment.fileSize ), segment.fileSize, segment.newFileOffset );
+                        }
+                    }
+                    
+                    this->rebase( output, segment, is64 );
+                }
+                
+                output.write( header.data(),   header.size(),   0 );
+                output.write( linkEdit.data(), linkEdit.size(), linkEditOffset );
+                output.truncate( linkEditOffset + linkEdit.size() );
+            }
+        }
+    }
+    
+    void CacheExtractor::IMPL::rebase( Output & output, const Segment & segment, bool is64 ) const
+    {
+        bool bigEndian( this->_space.bigEndian() );
+        
+        for( const auto & slideInfo: this->_slideInfo )
+        {
+            uint64_t mapping( slideInfo.mapping().address() );
+            uint64_t pageSize( slideInfo.pageSize() );
+            uint64_t begin( std::max( segment.vmAddress, mapping ) );
+            uint64_t end( std::min( segment.vmAddress + segment.fileSize, mapping + slideInfo.mapping().size() ) );
+            
+            if( pageSize == 0 || begin >= end )
+            {
+                continue;
+            }
+            
+            /* Pages are patched one at a time, so memory stays bounded by the page size */
+            for( uint64_t page = ( begin - mapping ) / pageSize; page < slideInfo.pageCount() && mapping + page * pageSize < end; page++ )
+            {
+                uint64_t               pageBegin( std::max( begin, mapping + page * pageSize ) );
+                uint64_t               pageEnd( std::min( end, mapping + ( page + 1 ) * pageSize ) );
+                const uint8_t        * data( this->_space.pointer( pageBegin, pageEnd - pageBegin ) );
+                std::vector< uint8_t > buffer( data, data + ( pageEnd - pageBegin ) );
+                bool                   changed( false );
+                
+                slideInfo.forEachPointer
+                (
+                    static_cast< uint32_t >( page ),
+                    [ & ]( uint64_t pointer, uint64_t target )
+                    {
+                        size_t size( ( is64 ) ? 8 : 4 );
+                        
+                        if( pointer < pageBegin || pointer + size > pageEnd )
+                        {
+                            return;
+                        }
+                        
+                        if( is64 )
+                        {
+                            Write< uint64_t >( buffer, pointer - pageBegin, target, bigEndian );
+                        }
+                        else
+                        {
+                            Write< uint32_t >( buffer, pointer - pageBegin, static_cast< uint32_t >( target ), bigEndian );
+                        }
+                        
+                        changed = true;
+                    }
+                );
+                
+                if( changed )
+                {
+                    output.write( buffer.data(), buffer.size(), segment.newFileOffset + ( pageBegin - segment.vmAddress ) );
+                }
+            }
+        }
+    }
+    
+    template< typename T >
+    T CacheExtractor::IMPL::Read( const std::vector< uint8_t > & buffer, size_t offset, bool bigEndian )
+    {
+        T value;
+        
+        if( offset + sizeof( T ) > buffer.size() )
+        {
+            throw std::runtime_error( "Invalid read offset: " + XS::ToString::Hex( offset ) );
+        }
+        
+        std::memcpy( &value, buffer.data() + offset, sizeof( T ) );
+        
+        return ( bigEndian == MappedFile::IsBigEndianHost() ) ? value : MappedFile::Swap( value );
+    }
+    
+    template< typename T >
+    void CacheExtractor::IMPL::Write( std::vector< uint8_t > & buffer, size_t offset, T value, bool bigEndian )
+    {
+        if( offset + sizeof( T ) > buffer.size() )
+        {
+            throw std::runtime_error( "Invalid write offset: " + XS::ToString::Hex( offset ) );
+        }
+        
+        value = ( bigEndian == MappedFile::IsBigEndianHost() ) ? value : MappedFile::Swap( value );
+        
+        std::memcpy( buffer.data() + offset, &value, sizeof( T ) );
+    }
+    
+    uint64_t CacheExtractor::IMPL::Align( uint64_t value, uint64_t alignment )
+    {
+        return ( value + alignment - 1 ) & ~( alignment - 1 );
+    }
+    
+    void CacheExtractor::IMPL::CreateDirectories( const std::string & path )
+    {
+        for( size_t i = 1; i <= path.size(); i++ )
+        {
+            if( i == path.size() || path[ i ] == '/' )
+            {
+                std::string directory( path.substr( 0, i ) );
+                
+                if( mkdir( directory.c_str(), 0755 ) != 0 && errno != EEXIST )
+                {
+                    throw std::runtime_error( "Cannot create directory: " + directory );
+                }
+            }
+        }
+    }
+    
+    /* Install paths come from the cache, so they must not escape the output directory */
+    std::string CacheExtractor::IMPL::RelativePath( const std::string & path )
+    {
+        std::string relative;
+        size_t      begin( 0 );
+        
+        while( begin <= path.size() )
+        {
+            size_t      end( std::min( path.find( '/', begin ), path.size() ) );
+            std::string component( path.substr( begin, end - begin ) );
+            
+            begin = end + 1;
+            
+            if( component.empty() || component == "." )
+            {
+                continue;
+            }
+            
+            if( component == ".." )
+            {
+                throw std::runtime_error( "Invalid image path: " + path );
+            }
+            
+            relative += ( ( relative.empty() ) ? "" : "/" ) + component;
+        }
+        
+        if( relative.empty() )
+        {
+            throw std::runtime_error( "Invalid image path: " + path );
+        }
+        
+        return relative;
+    }
+    
+    CacheExtractor::IMPL::Output::Output( const std::string & path ):
+        _path( path ),
+        _fd(   open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 ) )
+    {
+        if( this->_fd < 0 )
+        {
+            throw std::runtime_error( "Cannot create file: " + path );
+        }
+    }
+    
+    CacheExtractor::IMPL::Output::~Output()
+    {
+        close( this->_fd );
+    }
+    
+    void CacheExtractor::IMPL::Output::write( const uint8_t * data, size_t size, uint64_t offset )
+    {
+        while( size > 0 )
+        {
+            ssize_t written( pwrite( this->_fd, data, size, static_cast< off_t >( offset ) ) );
+            
+            if( written < 0 && errno == EINTR )
+            {
+                continue;
+            }
+            
+            if( written <= 0 )
+            {
+                throw std::runtime_error( "Cannot write file: " + this->_path );
+            }
+            
+            data   += written;
+            size   -= static_cast< size_t >( written );
+            offset += static_cast< uint64_t >( written );
+        }
+    }
+    
+    void CacheExtractor::IMPL::Output::copy( const std::string & path, uint64_t sourceOffset, const uint8_t * data, size_t size, uint64_t offset )
+    {
+        #ifdef __linux__
+        
+        int fd( open( path.c_str(), O_RDONLY ) );
+        
+        if( fd >= 0 )
+        {
+            off_t in( static_cast< off_t >( sourceOffset ) );
+            off_t out( static_cast< off_t >( offset ) );
+            
+            /* Copied in-kernel when possible, falling back to writing from the mapping on cross-device or unsupported files */
+            while( size > 0 )
+            {
+                ssize_t copied( copy_file_range( fd, &in, this->_fd, &out, size, 0 ) );
+                
+                if( copied < 0 && errno == EINTR )
+                {
+                    continue;
+                }
+                
+                if( copied <= 0 )
+                {
+                    break;
+                }
+                
+                data += copied;
+                size -= static_cast< size_t >( copied );
+            }
+            
+            close( fd );
+            
+            offset = static_cast< uint64_t >( out );
+        }
+        
+        #else
+        
+        ( void )path;
+        ( void )sourceOffset;
+        
+        #endif
+        
+        this->write( data, size, offset );
+    }
+    
+    void CacheExtractor::IMPL::Output::truncate( uint64_t size )
+    {
+        if( ftruncate( this->_fd, static_cast< off_t >( size ) ) != 0 )
+        {
+            throw std::runtime_error( "Cannot resize file: " + this->_path );
+        }
+    }
+}
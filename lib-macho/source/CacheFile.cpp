@@ -28,8 +28,12 @@
  */
 
 #include <MachO/CacheFile.hpp>
+#include <MachO/Parallel.hpp>
 #include <MachO/ToString.hpp>
 #include <XS.hpp>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
 
 namespace MachO
 {
@@ -37,22 +41,86 @@ namespace MachO
     {
         public:
             
+            class Region
+            {
+                public:
+                    
+                    uint64_t   _begin;
+                    uint64_t   _end;
+                    uint64_t   _fileOffset;
+                    MappedFile _data;
+            };
+            
+            class Regions
+            {
+                public:
+                    
+                    std::once_flag        _once;
+                    std::vector< Region > _regions;
+            };
+            
+            class Files
+            {
+                public:
+                    
+                    std::mutex                                     _mutex;
+                    std::vector< std::shared_ptr< CacheFile > >    _subCaches;
+                    std::shared_ptr< CacheFile >                   _symbolFile;
+                    std::vector< std::unique_ptr< Regions > >      _regions;
+                    std::once_flag                                 _localSymbolsOnce;
+                    std::optional< CacheLocalSymbols >             _localSymbols;
+                    std::once_flag                                 _pathsOnce;
+                    std::unordered_map< std::string_view, size_t > _paths;
+            };
+            
             IMPL( const std::string & path );
             IMPL( XS::IO::BinaryStream & stream );
+            IMPL( const MappedFile & data );
             IMPL( const IMPL & o );
             ~IMPL( void );
             
-            void parse( XS::IO::BinaryStream & stream );
-            
-            std::optional< std::string >    _path;
-            std::string                     _header;
-            uint32_t                        _mappingOffset;
-            uint32_t                        _mappingCount;
-            uint32_t                        _imageOffset;
-            uint32_t                        _imageCount;
-            uint32_t                        _baseAddress;
-            std::vector< CacheImageInfo >   _images;
-            std::vector< CacheMappingInfo > _mappings;
+            void                          parse( XS::IO::BinaryStream & stream );
+            const std::vector< Region > & regions( const CacheFile & cache, size_t index );
+            const Region                & region( const CacheFile & cache, uint64_t address );
+            
+            static const Region          * FindRegion( const std::vector< Region > & regions, uint64_t address );
+            static std::optional< size_t > FindInTrie( const uint8_t * trie, size_t size, std::string_view path );
+            
+            std::optional< std::string >     _path;
+            std::string                      _header;
+            uint32_t                         _mappingOffset;
+            uint32_t                         _mappingCount;
+            uint32_t                         _imageOffset;
+            uint32_t                         _imageCount;
+            uint64_t                         _baseAddress;
+            uint64_t                         _codeSignatureOffset;
+            uint64_t                         _codeSignatureSize;
+            uint64_t                         _localSymbolsOffset;
+            uint64_t                         _localSymbolsSize;
+            uint8_t                          _uuid[ 16 ];
+            uint64_t                         _cacheType;
+            uint64_t                         _imagesTextOffset;
+            uint64_t                         _imagesTextCount;
+            uint32_t                         _platform;
+            uint32_t                         _formatVersion;
+            uint64_t                         _sharedRegionStart;
+            uint64_t                         _sharedRegionSize;
+            uint64_t                         _maxSlide;
+            uint64_t                         _dylibsTrieAddress;
+            uint64_t                         _dylibsTrieSize;
+            uint32_t                         _mappingWithSlideOffset;
+            uint32_t                         _mappingWithSlideCount;
+            uint32_t                         _subCacheArrayOffset;
+            uint32_t                         _subCacheArrayCount;
+            uint8_t                          _symbolFileUUID[ 16 ];
+            uint32_t                         _cacheSubType;
+            uint64_t                         _objcOptsOffset;
+            uint64_t                         _objcOptsSize;
+            std::vector< CacheImageInfo >    _images;
+            std::vector< CacheMappingInfo >  _mappings;
+            std::vector< CacheSubCacheInfo > _subCaches;
+            std::optional< MappedFile >      _data;
+            std::shared_ptr< Files >         _files;
     };
 
     CacheFile::CacheFile( const std::string & path ):
@@ -62,6 +130,10 @@ namespace MachO
     CacheFile::CacheFile( XS::IO::BinaryStream & stream ):
         impl( std::make_unique< IMPL >( stream ) )
     {}
+    
+    CacheFile::CacheFile( const MappedFile & data ):
+        impl( std::make_unique< IMPL >( data ) )
+    {}
 
     CacheFile::CacheFile( const CacheFile & o ):
         impl( std::make_unique< IMPL >( *( o.impl ) ) )
@@ -83,9 +155,11 @@ namespace MachO
     
     XS::Info CacheFile::getInfo() const
     {
-        XS::Info i( "Dyld cache file" );
-        XS::Info mappings( "Mappings" );
-        XS::Info images( "Images" );
+        XS::Info                     i( "Dyld cache file" );
+        XS::Info                     mappings( "Mappings" );
+        XS::Info                     images( "Images" );
+        XS::Info                     subCaches( "Sub-caches" );
+        std::optional< std::string > symbolFileUUID( this->symbolFileUUID() );
         
         if( this->impl->_path.has_value() )
         {
@@ -93,12 +167,40 @@ namespace MachO
         }
         
         i.addChild( { "Header",         this->header() } );
+        i.addChild( { "UUID",           this->uuid() } );
+        i.addChild( { "Format version", std::to_string( this->formatVersion() ) } );
+        i.addChild( { "Platform",       std::to_string( this->platform() ) } );
+        i.addChild( { "Cache type",     XS::ToString::Hex( this->cacheType() ) } );
         i.addChild( { "Mapping offset", XS::ToString::Hex( this->mappingOffset() ) } );
         i.addChild( { "Mapping count",  XS::ToString::Hex( this->mappingCount() ) } );
         i.addChild( { "Image offset",   XS::ToString::Hex( this->imageOffset() ) } );
         i.addChild( { "Image count",    XS::ToString::Hex( this->imageCount() ) } );
         i.addChild( { "Base address",   XS::ToString::Hex( this->baseAddress() ) } );
         
+        if( this->sharedRegionSize() > 0 )
+        {
+            i.addChild( { "Shared region start", XS::ToString::Hex(  this->sharedRegionStart() ) } );
+            i.addChild( { "Shared region size",  XS::ToString::Size( this->sharedRegionSize() ) } );
+            i.addChild( { "Max slide",           XS::ToString::Size( this->maxSlide() ) } );
+        }
+        
+        if( this->localSymbolsSize() > 0 )
+        {
+            i.addChild( { "Local symbols offset", XS::ToString::Hex(  this->localSymbolsOffset() ) } );
+            i.addChild( { "Local symbols size",   XS::ToString::Size( this->localSymbolsSize() ) } );
+        }
+        
+        if( this->objcOptsSize() > 0 )
+        {
+            i.addChild( { "ObjC optimizations offset", XS::ToString::Hex(  this->objcOptsOffset() ) } );
+            i.addChild( { "ObjC optimizations size",   XS::ToString::Size( this->objcOptsSize() ) } );
+        }
+        
+        if( symbolFileUUID.has_value() )
+        {
+            i.addChild( { "Symbol file UUID", *( symbolFileUUID ) } );
+        }
+        
         for( const auto & mapping: this->mappings() )
         {
             mappings.addChild( mapping );
@@ -109,12 +211,23 @@ namespace MachO
             images.addChild( image );
         }
         
+        for( const auto & subCache: this->subCaches() )
+        {
+            subCaches.addChild( subCache );
+        }
+        
         if( this->mappings().size() > 0 )
         {
             mappings.value( std::to_string( this->mappings().size() ) );
             i.addChild( mappings );
         }
         
+        if( this->subCaches().size() > 0 )
+        {
+            subCaches.value( std::to_string( this->subCaches().size() ) );
+            i.addChild( subCaches );
+        }
+        
         if( this->images().size() > 0 )
         {
             images.value( std::to_string( this->images().size() ) );
@@ -154,11 +267,156 @@ namespace MachO
         return this->impl->_imageCount;
     }
     
-    uint32_t CacheFile::baseAddress() const
+    uint64_t CacheFile::baseAddress() const
     {
         return this->impl->_baseAddress;
     }
     
+    uint64_t CacheFile::codeSignatureOffset() const
+    {
+        return this->impl->_codeSignatureOffset;
+    }
+    
+    uint64_t CacheFile::codeSignatureSize() const
+    {
+        return this->impl->_codeSignatureSize;
+    }
+    
+    uint64_t CacheFile::localSymbolsOffset() const
+    {
+        return this->impl->_localSymbolsOffset;
+    }
+    
+    uint64_t CacheFile::localSymbolsSize() const
+    {
+        return this->impl->_localSymbolsSize;
+    }
+    
+    std::string CacheFile::uuid() const
+    {
+        return XS::ToString::UUID( this->impl->_uuid );
+    }
+    
+    uint64_t CacheFile::cacheType() const
+    {
+        return this->impl->_cacheType;
+    }
+    
+    uint64_t CacheFile::imagesTextOffset() const
+    {
+        return this->impl->_imagesTextOffset;
+    }
+    
+    uint64_t CacheFile::imagesTextCount() const
+    {
+        return this->impl->_imagesTextCount;
+    }
+    
+    uint32_t CacheFile::platform() const
+    {
+        return this->impl->_platform;
+    }
+    
+    uint32_t CacheFile::formatVersion() const
+    {
+        return this->impl->_formatVersion;
+    }
+    
+    uint64_t CacheFile::sharedRegionStart() const
+    {
+        return this->impl->_sharedRegionStart;
+    }
+    
+    uint64_t CacheFile::sharedRegionSize() const
+    {
+        return this->impl->_sharedRegionSize;
+    }
+    
+    uint64_t CacheFile::maxSlide() const
+    {
+        return this->impl->_maxSlide;
+    }
+    
+    uint64_t CacheFile::dylibsTrieAddress() const
+    {
+        return this->impl->_dylibsTrieAddress;
+    }
+    
+    uint64_t CacheFile::dylibsTrieSize() const
+    {
+        return this->impl->_dylibsTrieSize;
+    }
+    
+    uint32_t CacheFile::mappingWithSlideOffset() const
+    {
+        return this->impl->_mappingWithSlideOffset;
+    }
+    
+    uint32_t CacheFile::mappingWithSlideCount() const
+    {
+        return this->impl->_mappingWithSlideCount;
+    }
+    
+    uint32_t CacheFile::subCacheArrayOffset() const
+    {
+        return this->impl->_subCacheArrayOffset;
+    }
+    
+    uint32_t CacheFile::subCacheArrayCount() const
+    {
+        return this->impl->_subCacheArrayCount;
+    }
+    
+    std::optional< std::string > CacheFile::symbolFileUUID() const
+    {
+        for( auto c: this->impl->_symbolFileUUID )
+        {
+            if( c != 0 )
+            {
+                return XS::ToString::UUID( this->impl->_symbolFileUUID );
+            }
+        }
+        
+        return {};
+    }
+    
+    uint32_t CacheFile::cacheSubType() const
+    {
+        return this->impl->_cacheSubType;
+    }
+    
+    uint64_t CacheFile::objcOptsOffset() const
+    {
+        return this->impl->_objcOptsOffset;
+    }
+    
+    uint64_t CacheFile::objcOptsSize() const
+    {
+        return this->impl->_objcOptsSize;
+    }
+    
+    std::optional< uint64_t > CacheFile::relativeMethodSelectorBase() const
+    {
+        /* ObjCOptimizationHeader::relativeMethodSelectorBaseAddressOffset, relative to the start of the cache */
+        if( this->impl->_data.has_value() == false || this->impl->_mappings.size() == 0 || this->impl->_objcOptsOffset == 0 || this->impl->_objcOptsSize < 0x38 )
+        {
+            return {};
+        }
+        
+        {
+            uint64_t             address( this->impl->_mappings.front().address() + this->impl->_objcOptsOffset );
+            const IMPL::Region & region( this->impl->region( *( this ), address ) );
+            uint64_t             offset( region._data.read< uint64_t >( region._fileOffset + ( address - region._begin ) + 0x30 ) );
+            
+            if( offset == 0 )
+            {
+                return {};
+            }
+            
+            return this->impl->_mappings.front().address() + offset;
+        }
+    }
+    
     std::vector< CacheImageInfo > CacheFile::images() const
     {
         return this->impl->_images;
@@ -169,6 +427,273 @@ namespace MachO
         return this->impl->_mappings;
     }
     
+    std::vector< CacheSubCacheInfo > CacheFile::subCaches() const
+    {
+        return this->impl->_subCaches;
+    }
+    
+    std::optional< MappedFile > CacheFile::data() const
+    {
+        return this->impl->_data;
+    }
+    
+    AddressSpace CacheFile::addressSpace() const
+    {
+        std::vector< MappedFile >          files;
+        std::vector< AddressSpace::Range > ranges;
+        std::vector< IMPL::Region >        regions;
+        
+        /* The whole cache is addressable, so every sub-cache is opened */
+        for( size_t i = 0; i <= this->impl->_subCaches.size(); i++ )
+        {
+            const std::vector< IMPL::Region > & list( this->impl->regions( *( this ), i ) );
+            
+            regions.insert( regions.end(), list.begin(), list.end() );
+        }
+        
+        for( const auto & region: regions )
+        {
+            auto it = std::find_if
+            (
+                files.begin(),
+                files.end(),
+                [ & ]( const MappedFile & file )
+                {
+                    return file.data() == region._data.data();
+                }
+            );
+            
+            if( it == files.end() )
+            {
+                it = files.insert( files.end(), region._data );
+            }
+            
+            ranges.push_back( { region._begin, region._end - region._begin, region._fileOffset, static_cast< size_t >( it - files.begin() ) } );
+        }
+        
+        return { files, ranges, false };
+    }
+    
+    std::vector< CacheSlideInfo > CacheFile::slideInfo() const
+    {
+        std::vector< CacheSlideInfo > infos;
+        std::vector< CacheFile >      caches( { *( this ) } );
+        
+        for( size_t i = 0; i < this->impl->_subCaches.size(); i++ )
+        {
+            caches.push_back( this->subCache( i ) );
+        }
+        
+        for( const auto & cache: caches )
+        {
+            std::optional< MappedFile > data( cache.data() );
+            
+            if( data.has_value() == false )
+            {
+                continue;
+            }
+            
+            for( const auto & mapping: cache.mappings() )
+            {
+                if( mapping.slideInfoFileSize() > 0 )
+                {
+                    infos.push_back( { *( data ), mapping } );
+                }
+            }
+        }
+        
+        return infos;
+    }
+    
+    CacheFile CacheFile::subCache( size_t index ) const
+    {
+        if( index >= this->impl->_subCaches.size() )
+        {
+            throw std::out_of_range( "Invalid sub-cache index: " + std::to_string( index ) );
+        }
+        
+        if( this->impl->_path.has_value() == false )
+        {
+            throw std::runtime_error( "Sub-caches are only available for caches opened from a path" );
+        }
+        
+        {
+            std::lock_guard< std::mutex > lock( this->impl->_files->_mutex );
+            
+            if( this->impl->_files->_subCaches[ index ] == nullptr )
+            {
+                this->impl->_files->_subCaches[ index ] = std::make_shared< CacheFile >( MappedFile( *( this->impl->_path ) + this->impl->_subCaches[ index ].fileSuffix() ) );
+            }
+            
+            return *( this->impl->_files->_subCaches[ index ] );
+        }
+    }
+    
+    std::optional< CacheFile > CacheFile::symbolFile() const
+    {
+        if( this->symbolFileUUID().has_value() == false || this->impl->_path.has_value() == false )
+        {
+            return {};
+        }
+        
+        {
+            std::lock_guard< std::mutex > lock( this->impl->_files->_mutex );
+            
+            if( this->impl->_files->_symbolFile == nullptr )
+            {
+                this->impl->_files->_symbolFile = std::make_shared< CacheFile >( MappedFile( *( this->impl->_path ) + ".symbols" ) );
+            }
+            
+            return *( this->impl->_files->_symbolFile );
+        }
+    }
+    
+    std::optional< CacheLocalSymbols > CacheFile::localSymbols() const
+    {
+        std::call_once
+        (
+            this->impl->_files->_localSymbolsOnce,
+            [ this ]
+            {
+                /* Split caches move the local symbols to the .symbols file, which has its own header */
+                std::optional< CacheFile >  symbolFile( this->symbolFile() );
+                const CacheFile           & file( ( symbolFile.has_value() ) ? *( symbolFile ) : *( this ) );
+                std::optional< MappedFile > data( file.data() );
+                bool                        is64( this->impl->_header.find( "64" ) != std::string::npos && this->impl->_header.find( "64_32" ) == std::string::npos );
+                
+                if( data.has_value() && file.localSymbolsSize() > 0 )
+                {
+                    this->impl->_files->_localSymbols = CacheLocalSymbols( *( data ), file.localSymbolsOffset(), file.localSymbolsSize(), is64, file.mappingOffset() >= 0x190 );
+                }
+            }
+        );
+        
+        return this->impl->_files->_localSymbols;
+    }
+    
+    std::vector< Symbol > CacheFile::localSymbols( size_t index ) const
+    {
+        std::optional< CacheLocalSymbols > symbols( this->localSymbols() );
+        
+        if( index >= this->impl->_images.size() )
+        {
+            throw std::out_of_range( "Invalid image index: " + std::to_string( index ) );
+        }
+        
+        if( symbols.has_value() == false || this->impl->_mappings.size() == 0 )
+        {
+            return {};
+        }
+        
+        return symbols->symbols( this->impl->_images[ index ].address() - this->impl->_mappings.front().address() );
+    }
+    
+    std::optional< size_t > CacheFile::imageIndex( std::string_view path ) const
+    {
+        if( this->impl->_data.has_value() == false )
+        {
+            for( size_t i = 0; i < this->impl->_images.size(); i++ )
+            {
+                if( this->impl->_images[ i ].path() == path )
+                {
+                    return i;
+                }
+            }
+            
+            return {};
+        }
+        
+        /* The cache's own trie also knows about aliases, so prefer it when present */
+        if( this->impl->_dylibsTrieAddress != 0 && this->impl->_dylibsTrieSize != 0 )
+        {
+            const IMPL::Region    & region( this->impl->region( *( this ), this->impl->_dylibsTrieAddress ) );
+            size_t                  offset( region._fileOffset + ( this->impl->_dylibsTrieAddress - region._begin ) );
+            std::optional< size_t > index( IMPL::FindInTrie( region._data.pointer( offset, this->impl->_dylibsTrieSize ), this->impl->_dylibsTrieSize, path ) );
+            
+            if( index.has_value() && *( index ) < this->impl->_images.size() )
+            {
+                return index;
+            }
+            
+            return {};
+        }
+        
+        std::call_once
+        (
+            this->impl->_files->_pathsOnce,
+            [ this ]
+            {
+                std::unordered_map< std::string_view, size_t > & paths( this->impl->_files->_paths );
+                
+                paths.reserve( this->impl->_images.size() );
+                
+                for( size_t i = 0; i < this->impl->_images.size(); i++ )
+                {
+                    paths.emplace( this->impl->_data->cString( this->impl->_images[ i ].pathFileOffset() ), i );
+                }
+            }
+        );
+        
+        {
+            auto it( this->impl->_files->_paths.find( path ) );
+            
+            if( it == this->impl->_files->_paths.end() )
+            {
+                return {};
+            }
+            
+            return it->second;
+        }
+    }
+    
+    File CacheFile::image( size_t index ) const
+    {
+        if( index >= this->impl->_images.size() )
+        {
+            throw std::out_of_range( "Invalid image index: " + std::to_string( index ) );
+        }
+        
+        {
+            uint64_t             address( this->impl->_images[ index ].address() );
+            const IMPL::Region & header( this->impl->region( *( this ), address ) );
+            
+            /* Sub-caches are only opened when one of the image's segments lives in them */
+            return
+            {
+                header._data,
+                header._fileOffset + ( address - header._begin ),
+                [ this ]( uint64_t vmAddress )
+                {
+                    return this->impl->region( *( this ), vmAddress )._data;
+                }
+            };
+        }
+    }
+    
+    std::vector< File > CacheFile::parseImages() const
+    {
+        std::vector< std::optional< File > > parsed( this->impl->_images.size() );
+        std::vector< File >                  files;
+        
+        Parallel::For
+        (
+            parsed.size(),
+            [ & ]( size_t i )
+            {
+                parsed[ i ] = this->image( i );
+            }
+        );
+        
+        files.reserve( parsed.size() );
+        
+        for( auto & file: parsed )
+        {
+            files.push_back( std::move( *( file ) ) );
+        }
+        
+        return files;
+    }
+    
     void swap( CacheFile & o1, CacheFile & o2 )
     {
         using std::swap;
@@ -177,54 +702,405 @@ namespace MachO
     }
 
     CacheFile::IMPL::IMPL( const std::string & path ):
-        _path( path )
+        _path(  path ),
+        _data(  MappedFile( path ) ),
+        _files( std::make_shared< Files >() )
     {
-        XS::IO::BinaryFileStream stream( path );
+        if( this->_data->size() < 0x20 )
+        {
+            throw std::runtime_error( "Invalid dyld cache file: " + path );
+        }
         
-        this->parse( stream );
+        {
+            XS::IO::BinaryMemoryStream stream( this->_data->data() );
+            
+            this->parse( stream );
+        }
     }
     
-    CacheFile::IMPL::IMPL( XS::IO::BinaryStream & stream )
+    CacheFile::IMPL::IMPL( XS::IO::BinaryStream & stream ):
+        _files( std::make_shared< Files >() )
     {
         this->parse( stream );
     }
     
+    CacheFile::IMPL::IMPL( const MappedFile & data ):
+        _path(  data.path() ),
+        _data(  data ),
+        _files( std::make_shared< Files >() )
+    {
+        if( data.size() < 0x20 )
+        {
+            throw std::runtime_error( "Invalid dyld cache file" );
+        }
+        
+        {
+            XS::IO::BinaryMemoryStream stream( data.data() );
+            
+            this->parse( stream );
+        }
+    }
+    
     CacheFile::IMPL::IMPL( const IMPL & o ):
-        _path(          o._path ),
-        _header(        o._header ),
-        _mappingOffset( o._mappingOffset ),
-        _mappingCount(  o._mappingCount ),
-        _imageOffset(   o._imageOffset ),
-        _imageCount(    o._imageCount ),
-        _baseAddress(   o._baseAddress ),
-        _images(        o._images ),
-        _mappings(      o._mappings )
-    {}
+        _path(                   o._path ),
+        _header(                 o._header ),
+        _mappingOffset(          o._mappingOffset ),
+        _mappingCount(           o._mappingCount ),
+        _imageOffset(            o._imageOffset ),
+        _imageCount(             o._imageCount ),
+        _baseAddress(            o._baseAddress ),
+        _codeSignatureOffset(    o._codeSignatureOffset ),
+        _codeSignatureSize(      o._codeSignatureSize ),
+        _localSymbolsOffset(     o._localSymbolsOffset ),
+        _localSymbolsSize(       o._localSymbolsSize ),
+        _cacheType(              o._cacheType ),
+        _imagesTextOffset(       o._imagesTextOffset ),
+        _imagesTextCount(        o._imagesTextCount ),
+        _platform(               o._platform ),
+        _formatVersion(          o._formatVersion ),
+        _sharedRegionStart(      o._sharedRegionStart ),
+        _sharedRegionSize(       o._sharedRegionSize ),
+        _maxSlide(               o._maxSlide ),
+        _dylibsTrieAddress(      o._dylibsTrieAddress ),
+        _dylibsTrieSize(         o._dylibsTrieSize ),
+        _mappingWithSlideOffset( o._mappingWithSlideOffset ),
+        _mappingWithSlideCount(  o._mappingWithSlideCount ),
+        _subCacheArrayOffset(    o._subCacheArrayOffset ),
+        _subCacheArrayCount(     o._subCacheArrayCount ),
+        _cacheSubType(           o._cacheSubType ),
+        _objcOptsOffset(         o._objcOptsOffset ),
+        _objcOptsSize(           o._objcOptsSize ),
+        _images(                 o._images ),
+        _mappings(               o._mappings ),
+        _subCaches(              o._subCaches ),
+        _data(                   o._data ),
+        _files(                  o._files )
+    {
+        memcpy( this->_uuid,           o._uuid,           16 );
+        memcpy( this->_symbolFileUUID, o._symbolFileUUID, 16 );
+    }
 
     CacheFile::IMPL::~IMPL( void )
     {}
     
     void CacheFile::IMPL::parse( XS::IO::BinaryStream & stream )
     {
+        /* Mapped caches are read without bounds, so each table is checked against the mapping first */
+        auto check = [ & ]( uint64_t offset, uint64_t count, size_t size )
+        {
+            if( this->_data.has_value() && ( count > this->_data->size() / size || this->_data->contains( offset, count * size ) == false ) )
+            {
+                throw std::runtime_error( "Invalid dyld cache table offset: " + XS::ToString::Hex( offset ) );
+            }
+        };
+        
         this->_header        = stream.readString( 16 );
         this->_mappingOffset = stream.readUInt32();
-        this->_mappingCount  = stream.readUInt32();
-        this->_imageOffset   = stream.readUInt32();
-        this->_imageCount    = stream.readUInt32();
-        this->_baseAddress   = stream.readUInt32();
         
+        check( 0, std::min< size_t >( this->_mappingOffset, 0x200 ), 1 );
+        stream.seek( 0, XS::IO::BinaryStream::SeekDirection::Begin );
+        
+        {
+            /* Fields past mappingOffset are not part of older headers */
+            MappedFile header( stream.read( std::min< size_t >( this->_mappingOffset, 0x200 ) ) );
+            
+            auto u32 = [ & ]( size_t offset ) -> uint32_t
+            {
+                return ( header.contains( offset, 4 ) ) ? header.read< uint32_t >( offset ) : 0;
+            };
+            
+            auto u64 = [ & ]( size_t offset ) -> uint64_t
+            {
+                return ( header.contains( offset, 8 ) ) ? header.read< uint64_t >( offset ) : 0;
+            };
+            
+            auto readUUID = [ & ]( size_t offset, uint8_t * bytes )
+            {
+                memset( bytes, 0, 16 );
+                
+                if( header.contains( offset, 16 ) )
+                {
+                    memcpy( bytes, header.pointer( offset, 16 ), 16 );
+                }
+            };
+            
+            this->_mappingCount           = u32( 0x14 );
+            this->_imageOffset            = u32( 0x18 );
+            this->_imageCount             = u32( 0x1C );
+            this->_baseAddress            = u64( 0x20 );
+            this->_codeSignatureOffset    = u64( 0x28 );
+            this->_codeSignatureSize      = u64( 0x30 );
+            this->_localSymbolsOffset     = u64( 0x48 );
+            this->_localSymbolsSize       = u64( 0x50 );
+            this->_cacheType              = u64( 0x68 );
+            this->_imagesTextOffset       = u64( 0x88 );
+            this->_imagesTextCount        = u64( 0x90 );
+            this->_platform               = u32( 0xD8 );
+            this->_formatVersion          = u32( 0xDC ) & 0xFF;
+            this->_sharedRegionStart      = u64( 0xE0 );
+            this->_sharedRegionSize       = u64( 0xE8 );
+            this->_maxSlide               = u64( 0xF0 );
+            this->_dylibsTrieAddress      = u64( 0x108 );
+            this->_dylibsTrieSize         = u64( 0x110 );
+            this->_mappingWithSlideOffset = u32( 0x138 );
+            this->_mappingWithSlideCount  = u32( 0x13C );
+            this->_subCacheArrayOffset    = u32( 0x188 );
+            this->_subCacheArrayCount     = u32( 0x18C );
+            this->_cacheSubType           = u32( 0x1C8 );
+            this->_objcOptsOffset         = u64( 0x1D0 );
+            this->_objcOptsSize           = u64( 0x1D8 );
+            
+            readUUID( 0x58,  this->_uuid );
+            readUUID( 0x190, this->_symbolFileUUID );
+            
+            /* imagesOffset / imagesCount replace the original fields in split caches */
+            if( u32( 0x1C0 ) != 0 )
+            {
+                this->_imageOffset = u32( 0x1C0 );
+                this->_imageCount  = u32( 0x1C4 );
+            }
+        }
+        
+        check( this->_imageOffset, this->_imageCount, 32 );
         stream.seek( this->_imageOffset, XS::IO::BinaryStream::SeekDirection::Begin );
         
-        for( uint32_t i = 0; i < this->_imageCount; i++ )
+        if( this->_data.has_value() )
+        {
+            this->_images.reserve( this->_imageCount );
+            
+            for( uint32_t i = 0; i < this->_imageCount; i++ )
+            {
+                this->_images.push_back( { *( this->_data ), this->_imageOffset + static_cast< size_t >( i ) * 32 } );
+            }
+        }
+        else
+        {
+            for( uint32_t i = 0; i < this->_imageCount; i++ )
+            {
+                this->_images.push_back( stream );
+            }
+        }
+        
+        if( this->_mappingWithSlideOffset != 0 && this->_mappingWithSlideCount != 0 )
+        {
+            check( this->_mappingWithSlideOffset, this->_mappingWithSlideCount, 56 );
+            stream.seek( this->_mappingWithSlideOffset, XS::IO::BinaryStream::SeekDirection::Begin );
+            
+            for( uint32_t i = 0; i < this->_mappingWithSlideCount; i++ )
+            {
+                this->_mappings.push_back( { stream, true } );
+            }
+        }
+        else
+        {
+            check( this->_mappingOffset, this->_mappingCount, 32 );
+            stream.seek( this->_mappingOffset, XS::IO::BinaryStream::SeekDirection::Begin );
+            
+            for( uint32_t i = 0; i < this->_mappingCount; i++ )
+            {
+                this->_mappings.push_back( stream );
+            }
+        }
+        
+        check( this->_subCacheArrayOffset, this->_subCacheArrayCount, ( this->_mappingOffset > 0x1C8 ) ? 56 : 24 );
+        stream.seek( this->_subCacheArrayOffset, XS::IO::BinaryStream::SeekDirection::Begin );
+        
+        for( uint32_t i = 0; i < this->_subCacheArrayCount; i++ )
         {
-            this->_images.push_back( stream );
+            /* dyld_subcache_entry gained a file suffix once the header grew past cacheSubType */
+            this->_subCaches.push_back( { stream, this->_mappingOffset > 0x1C8, i } );
         }
         
-        stream.seek( this->_mappingOffset, XS::IO::BinaryStream::SeekDirection::Begin );
+        this->_files->_subCaches.resize( this->_subCaches.size() );
         
-        for( uint32_t i = 0; i < this->_mappingCount; i++ )
+        /* The main cache's regions come first, followed by one entry per sub-cache */
+        for( size_t i = 0; i <= this->_subCaches.size(); i++ )
         {
-            this->_mappings.push_back( stream );
+            this->_files->_regions.push_back( std::make_unique< Regions >() );
         }
     }
+    
+    const std::vector< CacheFile::IMPL::Region > & CacheFile::IMPL::regions( const CacheFile & cache, size_t index )
+    {
+        Regions & regions( *( this->_files->_regions[ index ] ) );
+        
+        if( this->_data.has_value() == false )
+        {
+            throw std::runtime_error( "Images are only available for caches backed by a mapped file" );
+        }
+        
+        std::call_once
+        (
+            regions._once,
+            [ & ]
+            {
+                CacheFile             file( ( index == 0 ) ? cache : cache.subCache( index - 1 ) );
+                MappedFile            data( *( file.data() ) );
+                std::vector< Region > list;
+                
+                for( const auto & mapping: file.mappings() )
+                {
+                    if( mapping.size() > 0 && data.contains( mapping.fileOffset(), mapping.size() ) )
+                    {
+                        list.push_back( { mapping.address(), mapping.address() + mapping.size(), mapping.fileOffset(), data } );
+                    }
+                }
+                
+                std::sort
+                (
+                    list.begin(),
+                    list.end(),
+                    []( const Region & r1, const Region & r2 )
+                    {
+                        return r1._begin < r2._begin;
+                    }
+                );
+                
+                regions._regions = std::move( list );
+            }
+        );
+        
+        return regions._regions;
+    }
+    
+    /* Sub-caches start at their VM offset from the main cache, so only the one holding the address is opened */
+    const CacheFile::IMPL::Region & CacheFile::IMPL::region( const CacheFile & cache, uint64_t address )
+    {
+        const Region          * region( FindRegion( this->regions( cache, 0 ), address ) );
+        uint64_t                base( ( this->_mappings.size() > 0 ) ? this->_mappings.front().address() : 0 );
+        std::optional< size_t > index;
+        
+        if( region != nullptr )
+        {
+            return *( region );
+        }
+        
+        for( size_t i = 0; i < this->_subCaches.size(); i++ )
+        {
+            uint64_t start( base + this->_subCaches[ i ].vmOffset() );
+            
+            if( address >= start && ( index.has_value() == false || this->_subCaches[ i ].vmOffset() >= this->_subCaches[ *( index ) ].vmOffset() ) )
+            {
+                index = i;
+            }
+        }
+        
+        if( index.has_value() )
+        {
+            region = FindRegion( this->regions( cache, *( index ) + 1 ), address );
+        }
+        
+        if( region == nullptr )
+        {
+            throw std::runtime_error( "Invalid cache address: " + XS::ToString::Hex( address ) );
+        }
+        
+        return *( region );
+    }
+    
+    const CacheFile::IMPL::Region * CacheFile::IMPL::FindRegion( const std::vector< Region > & regions, uint64_t address )
+    {
+        auto it = std::upper_bound
+        (
+            regions.begin(),
+            regions.end(),
+            address,
+            []( uint64_t value, const Region & r )
+            {
+                return value < r._begin;
+            }
+        );
+        
+        if( it == regions.begin() || address >= ( it - 1 )->_end )
+        {
+            return nullptr;
+        }
+        
+        return &( *( it - 1 ) );
+    }
+    
+    std::optional< size_t > CacheFile::IMPL::FindInTrie( const uint8_t * trie, size_t size, std::string_view path )
+    {
+        size_t node( 0 );
+        size_t matched( 0 );
+        
+        auto uleb = [ & ]( size_t & pos ) -> uint64_t
+        {
+            uint64_t value( 0 );
+            
+            for( unsigned int shift = 0; pos < size && shift < 64; shift += 7 )
+            {
+                uint8_t byte( trie[ pos++ ] );
+                
+                value |= static_cast< uint64_t >( byte & 0x7F ) << shift;
+                
+                if( ( byte & 0x80 ) == 0 )
+                {
+                    return value;
+                }
+            }
+            
+            throw std::runtime_error( "Invalid dylibs trie" );
+        };
+        
+        while( node < size )
+        {
+            size_t   pos( node );
+            uint64_t terminalSize( uleb( pos ) );
+            
+            if( matched == path.size() )
+            {
+                if( terminalSize == 0 )
+                {
+                    return {};
+                }
+                
+                return static_cast< size_t >( uleb( pos ) );
+            }
+            
+            pos += terminalSize;
+            
+            if( pos >= size )
+            {
+                return {};
+            }
+            
+            {
+                uint8_t count( trie[ pos++ ] );
+                size_t  next( size );
+                
+                for( uint8_t i = 0; i < count && next == size; i++ )
+                {
+                    const char * edge( reinterpret_cast< const char * >( trie + pos ) );
+                    size_t       length( strnlen( edge, size - pos ) );
+                    
+                    if( pos + length >= size )
+                    {
+                        return {};
+                    }
+                    
+                    pos += length + 1;
+                    
+                    {
+                        uint64_t child( uleb( pos ) );
+                        
+                        if( length > 0 && path.substr( matched, length ) == std::string_view( edge, length ) )
+                        {
+                            matched += length;
+                            next     = static_cast< size_t >( child );
+                        }
+                    }
+                }
+                
+                if( next >= size )
+                {
+                    return {};
+                }
+                
+                node = next;
+            }
+        }
+        
+        return {};
+    }
 }
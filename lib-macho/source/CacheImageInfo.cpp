@@ -38,19 +38,26 @@ namespace MachO
         public:
             
             IMPL( XS::IO::BinaryStream & stream );
+            IMPL( const MappedFile & data, size_t offset );
             IMPL( const IMPL & o );
             ~IMPL( void );
             
-            uint64_t    _address;
-            uint64_t    _modificationTime;
-            uint64_t    _inode;
-            std::string _path;
+            uint64_t                     _address;
+            uint64_t                     _modificationTime;
+            uint64_t                     _inode;
+            uint32_t                     _pathFileOffset;
+            std::optional< std::string > _path;
+            std::optional< MappedFile >  _data;
     };
 
     CacheImageInfo::CacheImageInfo( XS::IO::BinaryStream & stream ):
         impl( std::make_unique< IMPL >( stream ) )
     {}
 
+    CacheImageInfo::CacheImageInfo( const MappedFile & data, size_t offset ):
+        impl( std::make_unique< IMPL >( data, offset ) )
+    {}
+
     CacheImageInfo::CacheImageInfo( const CacheImageInfo & o ):
         impl( std::make_unique< IMPL >( *( o.impl ) ) )
     {}
@@ -96,9 +103,24 @@ namespace MachO
         return this->impl->_inode;
     }
     
+    uint32_t CacheImageInfo::pathFileOffset() const
+    {
+        return this->impl->_pathFileOffset;
+    }
+    
     std::string CacheImageInfo::path() const
     {
-        return this->impl->_path;
+        if( this->impl->_path.has_value() )
+        {
+            return *( this->impl->_path );
+        }
+        
+        if( this->impl->_data.has_value() == false || this->impl->_data->contains( this->impl->_pathFileOffset, 1 ) == false )
+        {
+            return {};
+        }
+        
+        return std::string( this->impl->_data->cString( this->impl->_pathFileOffset ) );
     }
     
     void swap( CacheImageInfo & o1, CacheImageInfo & o2 )
@@ -111,24 +133,35 @@ namespace MachO
     CacheImageInfo::IMPL::IMPL( XS::IO::BinaryStream & stream ):
         _address(          stream.readUInt64() ),
         _modificationTime( stream.readUInt64() ),
-        _inode(            stream.readUInt64() )
+        _inode(            stream.readUInt64() ),
+        _pathFileOffset(   stream.readUInt32() )
     {
-        uint32_t offset( stream.readUInt32() );
-        size_t   pos( stream.tell() );
+        size_t pos( stream.tell() );
         
-        stream.seek( offset, XS::IO::BinaryStream::SeekDirection::Begin );
+        stream.seek( this->_pathFileOffset, XS::IO::BinaryStream::SeekDirection::Begin );
         
         this->_path = stream.readNULLTerminatedString();
         
         stream.seek( pos, XS::IO::BinaryStream::SeekDirection::Begin );
         stream.readUInt32();
     }
+    
+    /* Mapped caches only keep the path offset, the name is read from the mapping when asked for */
+    CacheImageInfo::IMPL::IMPL( const MappedFile & data, size_t offset ):
+        _address(          data.read< uint64_t >( offset ) ),
+        _modificationTime( data.read< uint64_t >( offset + 8 ) ),
+        _inode(            data.read< uint64_t >( offset + 16 ) ),
+        _pathFileOffset(   data.read< uint32_t >( offset + 24 ) ),
+        _data(             data )
+    {}
 
     CacheImageInfo::IMPL::IMPL( const IMPL & o ):
         _address(          o._address ),
         _modificationTime( o._modificationTime ),
         _inode(            o._inode ),
-        _path(             o._path )
+        _pathFileOffset(   o._pathFileOffset ),
+        _path(             o._path ),
+        _data(             o._data )
     {}
 
     CacheImageInfo::IMPL::~IMPL( void )
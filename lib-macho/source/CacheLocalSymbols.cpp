@@ -0,0 +1,275 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CacheLocalSymbols.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/CacheLocalSymbols.hpp>
+#include <MachO/ToString.hpp>
+#include <XS.hpp>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace MachO
+{
+    class CacheLocalSymbols::IMPL
+    {
+        public:
+            
+            class Index
+            {
+                public:
+                    
+                    std::once_flag                        _once;
+                    std::unordered_map< uint64_t, Entry >  _entries;
+            };
+            
+            IMPL( const MappedFile & data, uint64_t offset, uint64_t size, bool is64, bool largeEntries );
+            IMPL( const IMPL & o );
+            ~IMPL( void );
+            
+            Entry readEntry( uint32_t index ) const;
+            
+            MappedFile               _data;
+            MappedFile               _info;
+            uint64_t                 _offset;
+            bool                     _is64;
+            bool                     _largeEntries;
+            uint32_t                 _nlistOffset;
+            uint32_t                 _nlistCount;
+            uint32_t                 _stringsOffset;
+            uint32_t                 _stringsSize;
+            uint32_t                 _entriesOffset;
+            uint32_t                 _entriesCount;
+            std::shared_ptr< Index > _index;
+    };
+
+    CacheLocalSymbols::CacheLocalSymbols( const MappedFile & data, uint64_t offset, uint64_t size, bool is64, bool largeEntries ):
+        impl( std::make_unique< IMPL >( data, offset, size, is64, largeEntries ) )
+    {}
+
+    CacheLocalSymbols::CacheLocalSymbols( const CacheLocalSymbols & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+
+    CacheLocalSymbols::CacheLocalSymbols( CacheLocalSymbols && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+
+    CacheLocalSymbols::~CacheLocalSymbols( void )
+    {}
+
+    CacheLocalSymbols & CacheLocalSymbols::operator =( CacheLocalSymbols o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info CacheLocalSymbols::getInfo() const
+    {
+        XS::Info i( "Local symbols" );
+        
+        i.addChild( { "Symbol count", std::to_string( this->nlistCount() ) } );
+        i.addChild( { "Strings size", XS::ToString::Size( this->stringsSize() ) } );
+        i.addChild( { "Image count",  std::to_string( this->entryCount() ) } );
+        
+        return i;
+    }
+    
+    uint32_t CacheLocalSymbols::nlistCount() const
+    {
+        return this->impl->_nlistCount;
+    }
+    
+    uint32_t CacheLocalSymbols::stringsSize() const
+    {
+        return this->impl->_stringsSize;
+    }
+    
+    uint32_t CacheLocalSymbols::entryCount() const
+    {
+        return this->impl->_entriesCount;
+    }
+    
+    std::optional< CacheLocalSymbols::Entry > CacheLocalSymbols::entry( uint64_t dylibOffset ) const
+    {
+        IMPL::Index & index( *( this->impl->_index ) );
+        
+        std::call_once
+        (
+            index._once,
+            [ & ]
+            {
+                index._entries.reserve( this->impl->_entriesCount );
+                
+                for( uint32_t i = 0; i < this->impl->_entriesCount; i++ )
+                {
+                    Entry entry( this->impl->readEntry( i ) );
+                    
+                    index._entries[ entry.dylibOffset ] = entry;
+                }
+            }
+        );
+        
+        {
+            auto it( index._entries.find( dylibOffset ) );
+            
+            if( it == index._entries.end() )
+            {
+                return {};
+            }
+            
+            return it->second;
+        }
+    }
+    
+    std::vector< Symbol > CacheLocalSymbols::symbols( uint64_t dylibOffset ) const
+    {
+        std::optional< Entry > entry( this->entry( dylibOffset ) );
+        std::vector< Symbol >  symbols;
+        size_t                 size( ( this->impl->_is64 ) ? 16 : 12 );
+        
+        if( entry.has_value() == false || entry->nlistCount == 0 )
+        {
+            return {};
+        }
+        
+        if( static_cast< uint64_t >( entry->nlistStartIndex ) + entry->nlistCount > this->impl->_nlistCount )
+        {
+            throw std::runtime_error( "Invalid local symbols entry: " + XS::ToString::Hex( dylibOffset ) );
+        }
+        
+        {
+            size_t offset( this->impl->_nlistOffset + static_cast< size_t >( entry->nlistStartIndex ) * size );
+            
+            symbols.reserve( entry->nlistCount );
+            
+            for( uint32_t i = 0; i < entry->nlistCount; i++, offset += size )
+            {
+                uint32_t    index( this->impl->_info.read< uint32_t >( offset ) );
+                std::string name;
+                
+                /* Names are bounded by the string pool */
+                if( index != 0 && index < this->impl->_stringsSize )
+                {
+                    name = this->string( index );
+                }
+                
+                symbols.push_back
+                (
+                    {
+                        name,
+                        index,
+                        this->impl->_info.read< uint8_t >( offset + 4 ),
+                        this->impl->_info.read< uint8_t >( offset + 5 ),
+                        this->impl->_info.read< uint16_t >( offset + 6 ),
+                        ( this->impl->_is64 ) ? this->impl->_info.read< uint64_t >( offset + 8 ) : this->impl->_info.read< uint32_t >( offset + 8 )
+                    }
+                );
+            }
+        }
+        
+        return symbols;
+    }
+    
+    std::string_view CacheLocalSymbols::string( uint32_t index ) const
+    {
+        if( index >= this->impl->_stringsSize )
+        {
+            throw std::out_of_range( "Invalid local symbols string index: " + XS::ToString::Hex( index ) );
+        }
+        
+        {
+            std::string_view s( this->impl->_info.cString( static_cast< size_t >( this->impl->_stringsOffset ) + index ) );
+            
+            return s.substr( 0, this->impl->_stringsSize - index );
+        }
+    }
+    
+    void swap( CacheLocalSymbols & o1, CacheLocalSymbols & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+
+    CacheLocalSymbols::IMPL::IMPL( const MappedFile & data, uint64_t offset, uint64_t size, bool is64, bool largeEntries ):
+        _data(          data ),
+        _info(          data.slice( offset, size ) ),
+        _offset(        offset ),
+        _is64(          is64 ),
+        _largeEntries(  largeEntries ),
+        _nlistOffset(   this->_info.read< uint32_t >( 0 ) ),
+        _nlistCount(    this->_info.read< uint32_t >( 4 ) ),
+        _stringsOffset( this->_info.read< uint32_t >( 8 ) ),
+        _stringsSize(   this->_info.read< uint32_t >( 12 ) ),
+        _entriesOffset( this->_info.read< uint32_t >( 16 ) ),
+        _entriesCount(  this->_info.read< uint32_t >( 20 ) ),
+        _index(         std::make_shared< Index >() )
+    {
+        this->_info.pointer( this->_nlistOffset,   static_cast< size_t >( this->_nlistCount ) * ( ( is64 ) ? 16 : 12 ) );
+        this->_info.pointer( this->_stringsOffset, this->_stringsSize );
+        this->_info.pointer( this->_entriesOffset, static_cast< size_t >( this->_entriesCount ) * ( ( largeEntries ) ? 16 : 12 ) );
+    }
+
+    CacheLocalSymbols::IMPL::IMPL( const IMPL & o ):
+        _data(          o._data ),
+        _info(          o._info ),
+        _offset(        o._offset ),
+        _is64(          o._is64 ),
+        _largeEntries(  o._largeEntries ),
+        _nlistOffset(   o._nlistOffset ),
+        _nlistCount(    o._nlistCount ),
+        _stringsOffset( o._stringsOffset ),
+        _stringsSize(   o._stringsSize ),
+        _entriesOffset( o._entriesOffset ),
+        _entriesCount(  o._entriesCount ),
+        _index(         o._index )
+    {}
+
+    CacheLocalSymbols::IMPL::~IMPL( void )
+    {}
+    
+    CacheLocalSymbols::Entry CacheLocalSymbols::IMPL::readEntry( uint32_t index ) const
+    {
+        /* dyld_cache_local_symbols_entry_64 widened dylibOffset when caches outgrew 4GB */
+        if( this->_largeEntries )
+        {
+            size_t offset( this->_entriesOffset + static_cast< size_t >( index ) * 16 );
+            
+            return { this->_info.read< uint64_t >( offset ), this->_info.read< uint32_t >( offset + 8 ), this->_info.read< uint32_t >( offset + 12 ) };
+        }
+        
+        {
+            size_t offset( this->_entriesOffset + static_cast< size_t >( index ) * 12 );
+            
+            return { this->_info.read< uint32_t >( offset ), this->_info.read< uint32_t >( offset + 4 ), this->_info.read< uint32_t >( offset + 8 ) };
+        }
+    }
+}
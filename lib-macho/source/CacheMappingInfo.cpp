@@ -37,19 +37,26 @@ namespace MachO
     {
         public:
             
-            IMPL( XS::IO::BinaryStream & stream );
+            IMPL( XS::IO::BinaryStream & stream, bool hasSlideInfo );
             IMPL( const IMPL & o );
             ~IMPL( void );
             
             uint64_t _address;
             uint64_t _size;
             uint64_t _fileOffset;
+            uint64_t _slideInfoFileOffset;
+            uint64_t _slideInfoFileSize;
+            uint64_t _flags;
             uint32_t _maxProt;
             uint32_t _initProt;
     };
 
     CacheMappingInfo::CacheMappingInfo( XS::IO::BinaryStream & stream ):
-        impl( std::make_unique< IMPL >( stream ) )
+        impl( std::make_unique< IMPL >( stream, false ) )
+    {}
+
+    CacheMappingInfo::CacheMappingInfo( XS::IO::BinaryStream & stream, bool hasSlideInfo ):
+        impl( std::make_unique< IMPL >( stream, hasSlideInfo ) )
     {}
 
     CacheMappingInfo::CacheMappingInfo( const CacheMappingInfo & o ):
@@ -80,6 +87,17 @@ namespace MachO
         i.addChild( { "Max prot",    XS::ToString::Hex( this->maxProt() ) } );
         i.addChild( { "Init prot",   XS::ToString::Hex( this->initProt() ) } );
         
+        if( this->slideInfoFileSize() > 0 )
+        {
+            i.addChild( { "Slide info offset", XS::ToString::Hex( this->slideInfoFileOffset() ) } );
+            i.addChild( { "Slide info size",   XS::ToString::Hex( this->slideInfoFileSize() ) } );
+        }
+        
+        if( this->flags() != 0 )
+        {
+            i.addChild( { "Flags", XS::ToString::Hex( this->flags() ) } );
+        }
+        
         return i;
     }
     
@@ -98,6 +116,21 @@ namespace MachO
         return this->impl->_fileOffset;
     }
     
+    uint64_t CacheMappingInfo::slideInfoFileOffset() const
+    {
+        return this->impl->_slideInfoFileOffset;
+    }
+    
+    uint64_t CacheMappingInfo::slideInfoFileSize() const
+    {
+        return this->impl->_slideInfoFileSize;
+    }
+    
+    uint64_t CacheMappingInfo::flags() const
+    {
+        return this->impl->_flags;
+    }
+    
     uint32_t CacheMappingInfo::maxProt() const
     {
         return this->impl->_maxProt;
@@ -115,20 +148,26 @@ namespace MachO
         swap( o1.impl, o2.impl );
     }
 
-    CacheMappingInfo::IMPL::IMPL( XS::IO::BinaryStream & stream ):
-        _address(    stream.readUInt64() ),
-        _size(       stream.readUInt64() ),
-        _fileOffset( stream.readUInt64() ),
-        _maxProt(    stream.readUInt32() ),
-        _initProt(   stream.readUInt32() )
+    CacheMappingInfo::IMPL::IMPL( XS::IO::BinaryStream & stream, bool hasSlideInfo ):
+        _address(             stream.readUInt64() ),
+        _size(                stream.readUInt64() ),
+        _fileOffset(          stream.readUInt64() ),
+        _slideInfoFileOffset( ( hasSlideInfo ) ? stream.readUInt64() : 0 ),
+        _slideInfoFileSize(   ( hasSlideInfo ) ? stream.readUInt64() : 0 ),
+        _flags(               ( hasSlideInfo ) ? stream.readUInt64() : 0 ),
+        _maxProt(             stream.readUInt32() ),
+        _initProt(            stream.readUInt32() )
     {}
 
     CacheMappingInfo::IMPL::IMPL( const IMPL & o ):
-        _address(    o._address ),
-        _size(       o._size ),
-        _fileOffset( o._fileOffset ),
-        _maxProt(    o._maxProt ),
-        _initProt(   o._initProt )
+        _address(             o._address ),
+        _size(                o._size ),
+        _fileOffset(          o._fileOffset ),
+        _slideInfoFileOffset( o._slideInfoFileOffset ),
+        _slideInfoFileSize(   o._slideInfoFileSize ),
+        _flags(               o._flags ),
+        _maxProt(             o._maxProt ),
+        _initProt(            o._initProt )
     {}
 
     CacheMappingInfo::IMPL::~IMPL( void )
@@ -0,0 +1,358 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CacheSlideInfo.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/CacheSlideInfo.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/ToString.hpp>
+#include <XS.hpp>
+#include <stdexcept>
+
+namespace MachO
+{
+    class CacheSlideInfo::IMPL
+    {
+        public:
+            
+            IMPL( const MappedFile & data, const CacheMappingInfo & mapping );
+            IMPL( const IMPL & o );
+            ~IMPL( void );
+            
+            uint16_t pageStart( uint32_t page ) const;
+            uint64_t readRaw( size_t offset )   const;
+            
+            MappedFile       _data;
+            CacheMappingInfo _mapping;
+            MappedFile       _info;
+            uint32_t         _version;
+            uint32_t         _pageSize;
+            uint32_t         _pageStartsOffset;
+            uint32_t         _pageCount;
+            uint32_t         _pageExtrasOffset;
+            uint32_t         _pageExtrasCount;
+            uint64_t         _deltaMask;
+            uint64_t         _valueAdd;
+    };
+
+    CacheSlideInfo::CacheSlideInfo( const MappedFile & data, const CacheMappingInfo & mapping ):
+        impl( std::make_unique< IMPL >( data, mapping ) )
+    {}
+
+    CacheSlideInfo::CacheSlideInfo( const CacheSlideInfo & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+
+    CacheSlideInfo::CacheSlideInfo( CacheSlideInfo && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+
+    CacheSlideInfo::~CacheSlideInfo( void )
+    {}
+
+    CacheSlideInfo & CacheSlideInfo::operator =( CacheSlideInfo o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info CacheSlideInfo::getInfo() const
+    {
+        XS::Info i( "Slide info", XS::ToString::Hex( this->impl->_mapping.address() ) );
+        
+        i.addChild( { "Version",    std::to_string( this->version() ) } );
+        i.addChild( { "Page size",  XS::ToString::Hex( this->pageSize() ) } );
+        i.addChild( { "Page count", std::to_string( this->pageCount() ) } );
+        i.addChild( { "Value add",  XS::ToString::Hex( this->valueAdd() ) } );
+        
+        return i;
+    }
+    
+    CacheMappingInfo CacheSlideInfo::mapping() const
+    {
+        return this->impl->_mapping;
+    }
+    
+    uint32_t CacheSlideInfo::version() const
+    {
+        return this->impl->_version;
+    }
+    
+    uint32_t CacheSlideInfo::pageSize() const
+    {
+        return this->impl->_pageSize;
+    }
+    
+    uint32_t CacheSlideInfo::pageCount() const
+    {
+        return this->impl->_pageCount;
+    }
+    
+    uint64_t CacheSlideInfo::valueAdd() const
+    {
+        return this->impl->_valueAdd;
+    }
+    
+    bool CacheSlideInfo::contains( uint64_t address ) const
+    {
+        return address >= this->impl->_mapping.address() && address - this->impl->_mapping.address() < this->impl->_mapping.size();
+    }
+    
+    uint64_t CacheSlideInfo::decode( uint64_t value ) const
+    {
+        switch( this->impl->_version )
+        {
+            case 2:
+            {
+                uint64_t target( value & ~( this->impl->_deltaMask ) );
+                
+                return ( target == 0 ) ? 0 : target + this->impl->_valueAdd;
+            }
+            
+            case 3:
+            {
+                /* dyld_cache_slide_pointer3: authenticated pointers store a 32 bits offset from the cache base */
+                if( value >> 63 )
+                {
+                    return ( value & 0xFFFFFFFF ) + this->impl->_valueAdd;
+                }
+                
+                {
+                    uint64_t top8(     value & 0x0007F80000000000 );
+                    uint64_t bottom43( value & 0x000007FFFFFFFFFF );
+                    
+                    return ( top8 << 13 ) | bottom43;
+                }
+            }
+            
+            case 5:
+            {
+                /* dyld_cache_slide_pointer5: 34 bits runtime offset, high byte only on plain pointers */
+                uint64_t target( ( value & 0x3FFFFFFFF ) + this->impl->_valueAdd );
+                
+                if( value >> 63 )
+                {
+                    return target;
+                }
+                
+                return target | ( ( ( value >> 34 ) & 0xFF ) << 56 );
+            }
+            
+            default: break;
+        }
+        
+        throw std::runtime_error( "Unsupported slide info version: " + std::to_string( this->impl->_version ) );
+    }
+    
+    uint64_t CacheSlideInfo::readPointer( uint64_t address ) const
+    {
+        if( this->contains( address ) == false )
+        {
+            throw std::runtime_error( "Invalid slide info address: " + XS::ToString::Hex( address ) );
+        }
+        
+        return this->decode( this->impl->readRaw( this->impl->_mapping.fileOffset() + ( address - this->impl->_mapping.address() ) ) );
+    }
+    
+    void CacheSlideInfo::forEachPointer( const std::function< void( uint64_t address, uint64_t target ) > & callback ) const
+    {
+        Parallel::For
+        (
+            this->impl->_pageCount,
+            [ & ]( size_t page )
+            {
+                this->forEachPointer( static_cast< uint32_t >( page ), callback );
+            }
+        );
+    }
+    
+    void CacheSlideInfo::forEachPointer( uint32_t page, const std::function< void( uint64_t address, uint64_t target ) > & callback ) const
+    {
+        uint64_t pageAddress( this->impl->_mapping.address()    + static_cast< uint64_t >( page ) * this->impl->_pageSize );
+        uint64_t pageOffset(  this->impl->_mapping.fileOffset() + static_cast< uint64_t >( page ) * this->impl->_pageSize );
+        uint16_t start(       this->impl->pageStart( page ) );
+        
+        auto walk = [ & ]( uint64_t offset )
+        {
+            uint64_t delta( 0 );
+            
+            do
+            {
+                uint64_t value;
+                
+                if( offset + 8 > this->impl->_pageSize )
+                {
+                    throw std::runtime_error( "Invalid slide info chain in page " + std::to_string( page ) );
+                }
+                
+                value = this->impl->readRaw( pageOffset + offset );
+                
+                if( this->impl->_version == 2 )
+                {
+                    /* Deltas are in 4 bytes units, stored in the bits covered by the delta mask */
+                    uint64_t target( this->decode( value ) );
+                    
+                    delta = ( ( value & this->impl->_deltaMask ) >> __builtin_ctzll( this->impl->_deltaMask ) ) * 4;
+                    
+                    if( target != 0 )
+                    {
+                        callback( pageAddress + offset, target );
+                    }
+                }
+                else
+                {
+                    delta = ( ( value >> ( ( this->impl->_version == 3 ) ? 51 : 52 ) ) & 0x7FF ) * 8;
+                    
+                    callback( pageAddress + offset, this->decode( value ) );
+                }
+                
+                offset += delta;
+            }
+            while( delta != 0 );
+        };
+        
+        if( this->impl->_version == 2 )
+        {
+            if( start & 0x4000 )
+            {
+                return;
+            }
+            
+            if( start & 0x8000 )
+            {
+                /* DYLD_CACHE_SLIDE_PAGE_ATTR_EXTRA: the start is an index of a run of chain starts */
+                for( uint32_t i = start & 0x3FFF; i < this->impl->_pageExtrasCount; i++ )
+                {
+                    uint16_t extra( this->impl->_info.read< uint16_t >( this->impl->_pageExtrasOffset + static_cast< size_t >( i ) * 2, false ) );
+                    
+                    walk( static_cast< uint64_t >( extra & 0x3FFF ) * 4 );
+                    
+                    if( extra & 0x8000 )
+                    {
+                        break;
+                    }
+                }
+                
+                return;
+            }
+            
+            walk( static_cast< uint64_t >( start ) * 4 );
+        }
+        else if( start != 0xFFFF )
+        {
+            walk( start );
+        }
+    }
+    
+    void swap( CacheSlideInfo & o1, CacheSlideInfo & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+
+    CacheSlideInfo::IMPL::IMPL( const MappedFile & data, const CacheMappingInfo & mapping ):
+        _data(             data ),
+        _mapping(          mapping ),
+        _info(             data.slice( mapping.slideInfoFileOffset(), mapping.slideInfoFileSize() ) ),
+        _version(          0 ),
+        _pageSize(         0 ),
+        _pageStartsOffset( 0 ),
+        _pageCount(        0 ),
+        _pageExtrasOffset( 0 ),
+        _pageExtrasCount(  0 ),
+        _deltaMask(        0 ),
+        _valueAdd(         0 )
+    {
+        this->_version = this->_info.read< uint32_t >( 0, false );
+        
+        if( this->_version == 2 )
+        {
+            this->_pageSize         = this->_info.read< uint32_t >( 4,  false );
+            this->_pageStartsOffset = this->_info.read< uint32_t >( 8,  false );
+            this->_pageCount        = this->_info.read< uint32_t >( 12, false );
+            this->_pageExtrasOffset = this->_info.read< uint32_t >( 16, false );
+            this->_pageExtrasCount  = this->_info.read< uint32_t >( 20, false );
+            this->_deltaMask        = this->_info.read< uint64_t >( 24, false );
+            this->_valueAdd         = this->_info.read< uint64_t >( 32, false );
+            
+            if( this->_deltaMask == 0 )
+            {
+                throw std::runtime_error( "Invalid slide info delta mask" );
+            }
+            
+            this->_info.pointer( this->_pageExtrasOffset, static_cast< size_t >( this->_pageExtrasCount ) * 2 );
+        }
+        else if( this->_version == 3 || this->_version == 5 )
+        {
+            this->_pageSize         = this->_info.read< uint32_t >( 4,  false );
+            this->_pageCount        = this->_info.read< uint32_t >( 8,  false );
+            this->_valueAdd         = this->_info.read< uint64_t >( 16, false );
+            this->_pageStartsOffset = 24;
+        }
+        else
+        {
+            throw std::runtime_error( "Unsupported slide info version: " + std::to_string( this->_version ) );
+        }
+        
+        this->_info.pointer( this->_pageStartsOffset, static_cast< size_t >( this->_pageCount ) * 2 );
+    }
+
+    CacheSlideInfo::IMPL::IMPL( const IMPL & o ):
+        _data(             o._data ),
+        _mapping(          o._mapping ),
+        _info(             o._info ),
+        _version(          o._version ),
+        _pageSize(         o._pageSize ),
+        _pageStartsOffset( o._pageStartsOffset ),
+        _pageCount(        o._pageCount ),
+        _pageExtrasOffset( o._pageExtrasOffset ),
+        _pageExtrasCount(  o._pageExtrasCount ),
+        _deltaMask(        o._deltaMask ),
+        _valueAdd(         o._valueAdd )
+    {}
+
+    CacheSlideInfo::IMPL::~IMPL( void )
+    {}
+    
+    uint16_t CacheSlideInfo::IMPL::pageStart( uint32_t page ) const
+    {
+        if( page >= this->_pageCount )
+        {
+            throw std::out_of_range( "Invalid slide info page: " + std::to_string( page ) );
+        }
+        
+        return this->_info.read< uint16_t >( this->_pageStartsOffset + static_cast< size_t >( page ) * 2, false );
+    }
+    
+    uint64_t CacheSlideInfo::IMPL::readRaw( size_t offset ) const
+    {
+        return this->_data.read< uint64_t >( offset, false );
+    }
+}
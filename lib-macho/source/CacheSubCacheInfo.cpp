@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CacheSubCacheInfo.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/CacheSubCacheInfo.hpp>
+#include <MachO/ToString.hpp>
+#include <XS.hpp>
+#include <cstring>
+
+namespace MachO
+{
+    class CacheSubCacheInfo::IMPL
+    {
+        public:
+            
+            IMPL( XS::IO::BinaryStream & stream, bool hasFileSuffix, size_t index );
+            IMPL( const IMPL & o );
+            ~IMPL( void );
+            
+            uint8_t     _uuid[ 16 ];
+            uint64_t    _vmOffset;
+            std::string _fileSuffix;
+    };
+
+    CacheSubCacheInfo::CacheSubCacheInfo( XS::IO::BinaryStream & stream, bool hasFileSuffix, size_t index ):
+        impl( std::make_unique< IMPL >( stream, hasFileSuffix, index ) )
+    {}
+
+    CacheSubCacheInfo::CacheSubCacheInfo( const CacheSubCacheInfo & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+
+    CacheSubCacheInfo::CacheSubCacheInfo( CacheSubCacheInfo && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+
+    CacheSubCacheInfo::~CacheSubCacheInfo( void )
+    {}
+
+    CacheSubCacheInfo & CacheSubCacheInfo::operator =( CacheSubCacheInfo o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info CacheSubCacheInfo::getInfo() const
+    {
+        XS::Info i( "Sub-cache info", this->fileSuffix() );
+        
+        i.addChild( { "UUID",      this->uuid() } );
+        i.addChild( { "VM offset", XS::ToString::Hex( this->vmOffset() ) } );
+        
+        return i;
+    }
+    
+    std::string CacheSubCacheInfo::uuid() const
+    {
+        return XS::ToString::UUID( this->impl->_uuid );
+    }
+    
+    uint64_t CacheSubCacheInfo::vmOffset() const
+    {
+        return this->impl->_vmOffset;
+    }
+    
+    std::string CacheSubCacheInfo::fileSuffix() const
+    {
+        return this->impl->_fileSuffix;
+    }
+    
+    void swap( CacheSubCacheInfo & o1, CacheSubCacheInfo & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+
+    CacheSubCacheInfo::IMPL::IMPL( XS::IO::BinaryStream & stream, bool hasFileSuffix, size_t index )
+    {
+        stream.read( this->_uuid, 16 );
+        
+        this->_vmOffset = stream.readUInt64();
+        
+        /* dyld_subcache_entry has a 32 bytes suffix, dyld_subcache_entry_v1 uses the 1-based index */
+        if( hasFileSuffix )
+        {
+            this->_fileSuffix = stream.readString( 32 );
+            this->_fileSuffix = this->_fileSuffix.substr( 0, this->_fileSuffix.find( '\0' ) );
+        }
+        else
+        {
+            this->_fileSuffix = "." + std::to_string( index + 1 );
+        }
+    }
+
+    CacheSubCacheInfo::IMPL::IMPL( const IMPL & o ):
+        _vmOffset(   o._vmOffset ),
+        _fileSuffix( o._fileSuffix )
+    {
+        memcpy( this->_uuid, o._uuid, 16 );
+    }
+
+    CacheSubCacheInfo::IMPL::~IMPL( void )
+    {}
+}
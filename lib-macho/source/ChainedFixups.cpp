@@ -0,0 +1,300 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ChainedFixups.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ChainedFixups.hpp>
+#include <MachO/File.hpp>
+#include <MachO/ToString.hpp>
+#include <MachO/LoadCommands/LinkEditData.hpp>
+#include <MachO/LoadCommands/Segment.hpp>
+#include <MachO/LoadCommands/Segment64.hpp>
+
+namespace MachO
+{
+    class ChainedFixups::IMPL
+    {
+        public:
+            
+            IMPL( const File & file );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            std::optional< MappedFile >     _data;
+            size_t                          _pointerSize;
+            uint64_t                        _baseAddress;
+            uint16_t                        _pointerFormat;
+            std::vector< std::string_view > _imports;
+    };
+    
+    ChainedFixups::ChainedFixups( const File & file ):
+        impl( std::make_unique< IMPL >( file ) )
+    {}
+    
+    ChainedFixups::ChainedFixups( const ChainedFixups & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ChainedFixups::ChainedFixups( ChainedFixups && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ChainedFixups::~ChainedFixups()
+    {}
+    
+    ChainedFixups & ChainedFixups::operator =( ChainedFixups o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info ChainedFixups::getInfo() const
+    {
+        XS::Info i( "Chained fixups" );
+        XS::Info imports( "Imports", std::to_string( this->impl->_imports.size() ) );
+        
+        i.addChild( { "Base address",   XS::ToString::Hex( this->baseAddress() ) } );
+        i.addChild( { "Pointer format", std::to_string( this->pointerFormat() ) } );
+        
+        for( const auto & name: this->impl->_imports )
+        {
+            imports.addChild( { std::string( name ) } );
+        }
+        
+        i.addChild( imports );
+        
+        return i;
+    }
+    
+    uint64_t ChainedFixups::baseAddress() const
+    {
+        return this->impl->_baseAddress;
+    }
+    
+    uint16_t ChainedFixups::pointerFormat() const
+    {
+        return this->impl->_pointerFormat;
+    }
+    
+    std::vector< std::string_view > ChainedFixups::imports() const
+    {
+        return this->impl->_imports;
+    }
+    
+    std::optional< std::string > ChainedFixups::import( uint32_t ordinal ) const
+    {
+        if( ordinal >= this->impl->_imports.size() )
+        {
+            return {};
+        }
+        
+        return std::string( this->impl->_imports[ ordinal ] );
+    }
+    
+    ChainedFixups::Pointer ChainedFixups::decode( uint64_t value ) const
+    {
+        uint64_t base( this->impl->_baseAddress );
+        uint16_t format( this->impl->_pointerFormat );
+        
+        switch( format )
+        {
+            /* DYLD_CHAINED_PTR_ARM64E, ARM64E_KERNEL, ARM64E_USERLAND, ARM64E_FIRMWARE, ARM64E_USERLAND24 */
+            case 1:
+            case 7:
+            case 9:
+            case 10:
+            case 12:
+                
+                if( ( value & 0x4000000000000000 ) != 0 )
+                {
+                    return { 0, static_cast< uint32_t >( value & ( ( format == 12 ) ? 0xFFFFFF : 0xFFFF ) ) };
+                }
+                
+                if( ( value & 0x8000000000000000 ) != 0 )
+                {
+                    return { base + ( value & 0xFFFFFFFF ), {} };
+                }
+                
+                return { ( ( format == 1 ) ? 0 : base ) + ( value & 0x7FFFFFFFFFF ), {} };
+            
+            /* DYLD_CHAINED_PTR_64, PTR_64_OFFSET */
+            case 2:
+            case 6:
+                
+                if( ( value & 0x8000000000000000 ) != 0 )
+                {
+                    return { 0, static_cast< uint32_t >( value & 0xFFFFFF ) };
+                }
+                
+                return { ( ( format == 2 ) ? 0 : base ) + ( value & 0xFFFFFFFFF ), {} };
+            
+            /* DYLD_CHAINED_PTR_64_KERNEL_CACHE, X86_64_KERNEL_CACHE: no binds, bit 63 is isAuth */
+            case 8:
+            case 11:
+                
+                return { base + ( value & 0x3FFFFFFF ), {} };
+            
+            /* DYLD_CHAINED_PTR_32, PTR_32_CACHE, PTR_32_FIRMWARE */
+            case 3:
+            case 4:
+            case 5:
+                
+                if( format == 3 && ( value & 0x80000000 ) != 0 )
+                {
+                    return { 0, static_cast< uint32_t >( value & 0xFFFFF ) };
+                }
+                
+                return { value & ( ( format == 4 ) ? 0x3FFFFFFF : 0x3FFFFFF ), {} };
+            
+            default:
+                
+                break;
+        }
+        
+        if( this->impl->_pointerSize == 4 )
+        {
+            return { value & 0xFFFFFFFF, {} };
+        }
+        
+        /* Authenticated pointers hold an offset from the image base; strip PAC/TBI bits otherwise */
+        if( ( value & 0x8000000000000000 ) != 0 )
+        {
+            return { base + ( value & 0xFFFFFFFF ), {} };
+        }
+        
+        return { value & 0x7FFFFFFFFFFF, {} };
+    }
+    
+    void swap( ChainedFixups & o1, ChainedFixups & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ChainedFixups::IMPL::IMPL( const File & file ):
+        _data(          file.mappedFile() ),
+        _pointerSize(   ( file.kind() == File::Kind::MachO64 ) ? 8 : 4 ),
+        _baseAddress(   0 ),
+        _pointerFormat( 0 )
+    {
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment >() )
+        {
+            if( segment.name() == "__TEXT" )
+            {
+                this->_baseAddress = segment.vmAddress();
+            }
+        }
+        
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment64 >() )
+        {
+            if( segment.name() == "__TEXT" )
+            {
+                this->_baseAddress = segment.vmAddress();
+            }
+        }
+        
+        if( this->_data.has_value() == false )
+        {
+            return;
+        }
+        
+        for( const auto & command: file.loadCommands< LoadCommands::LinkEditData >() )
+        {
+            /* LC_DYLD_CHAINED_FIXUPS */
+            if( command.command() != ( 0x34 | 0x80000000 ) )
+            {
+                continue;
+            }
+            
+            {
+                const MappedFile & data( *( this->_data ) );
+                uint64_t           header( command.dataOffset() );
+                uint64_t           starts( header + data.read< uint32_t >( header + 4 ) );
+                uint64_t           imports( header + data.read< uint32_t >( header + 8 ) );
+                uint64_t           symbols( header + data.read< uint32_t >( header + 12 ) );
+                uint32_t           count( data.read< uint32_t >( header + 16 ) );
+                uint32_t           format( data.read< uint32_t >( header + 20 ) );
+                uint32_t           segments( data.read< uint32_t >( starts ) );
+                
+                for( uint32_t i = 0; i < segments; i++ )
+                {
+                    uint32_t offset( data.read< uint32_t >( starts + 4 + i * 4 ) );
+                    
+                    if( offset != 0 )
+                    {
+                        this->_pointerFormat = data.read< uint16_t >( starts + offset + 6 );
+                        
+                        break;
+                    }
+                }
+                
+                this->_imports.reserve( count );
+                
+                for( uint32_t i = 0; i < count; i++ )
+                {
+                    uint64_t name;
+                    
+                    /* DYLD_CHAINED_IMPORT, DYLD_CHAINED_IMPORT_ADDEND, DYLD_CHAINED_IMPORT_ADDEND64 */
+                    if( format == 1 )
+                    {
+                        name = data.read< uint32_t >( imports + i * 4 ) >> 9;
+                    }
+                    else if( format == 2 )
+                    {
+                        name = data.read< uint32_t >( imports + i * 8 ) >> 9;
+                    }
+                    else if( format == 3 )
+                    {
+                        name = data.read< uint64_t >( imports + i * 16 ) >> 32;
+                    }
+                    else
+                    {
+                        throw std::runtime_error( "Unsupported chained fixups import format: " + XS::ToString::Hex( format ) );
+                    }
+                    
+                    this->_imports.push_back( data.cString( symbols + name ) );
+                }
+            }
+            
+            break;
+        }
+    }
+    
+    ChainedFixups::IMPL::IMPL( const IMPL & o ):
+        _data(          o._data ),
+        _pointerSize(   o._pointerSize ),
+        _baseAddress(   o._baseAddress ),
+        _pointerFormat( o._pointerFormat ),
+        _imports(       o._imports )
+    {}
+    
+    ChainedFixups::IMPL::~IMPL()
+    {}
+}
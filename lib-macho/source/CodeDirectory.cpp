@@ -0,0 +1,335 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CodeDirectory.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/CodeDirectory.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    class CodeDirectory::IMPL
+    {
+        public:
+            
+            IMPL( const MappedFile & blob );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            MappedFile                   _blob;
+            uint32_t                     _version;
+            uint32_t                     _flags;
+            uint32_t                     _hashOffset;
+            uint32_t                     _specialSlotCount;
+            uint32_t                     _codeSlotCount;
+            uint64_t                     _codeLimit;
+            uint8_t                      _hashSize;
+            uint8_t                      _hashType;
+            uint8_t                      _platform;
+            uint8_t                      _pageSize;
+            std::string                  _identifier;
+            std::optional< std::string > _teamIdentifier;
+            std::optional< uint64_t >    _execSegmentBase;
+            std::optional< uint64_t >    _execSegmentLimit;
+            std::optional< uint64_t >    _execSegmentFlags;
+    };
+    
+    CodeDirectory::CodeDirectory( const MappedFile & blob ):
+        impl( std::make_unique< IMPL >( blob ) )
+    {}
+    
+    CodeDirectory::CodeDirectory( const CodeDirectory & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    CodeDirectory::CodeDirectory( CodeDirectory && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    CodeDirectory::~CodeDirectory()
+    {}
+    
+    CodeDirectory & CodeDirectory::operator =( CodeDirectory o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info CodeDirectory::getInfo() const
+    {
+        XS::Info                      i( "Code directory" );
+        std::optional< Digest::Type > type( this->digestType() );
+        std::vector< uint8_t >        cdHash( this->cdHash() );
+        
+        i.value( this->identifier() );
+        
+        i.addChild( { "Version",       XS::ToString::Hex( this->version() ) } );
+        i.addChild( { "Flags",         XS::ToString::Hex( this->flags() ) } );
+        i.addChild( { "Hash type",     ( type.has_value() ) ? Digest::Name( *( type ) ) : XS::ToString::Hex( this->hashType() ) } );
+        i.addChild( { "Hash size",     std::to_string( this->hashSize() ) } );
+        i.addChild( { "Page size",     ( this->pageSize() == 0 ) ? "none" : XS::ToString::Size( this->pageSize() ) } );
+        i.addChild( { "Code limit",    XS::ToString::Hex( this->codeLimit() ) } );
+        i.addChild( { "Special slots", std::to_string( this->specialSlotCount() ) } );
+        i.addChild( { "Code slots",    std::to_string( this->codeSlotCount() ) } );
+        
+        if( this->teamIdentifier().has_value() )
+        {
+            i.addChild( { "Team identifier", *( this->teamIdentifier() ) } );
+        }
+        
+        if( this->execSegmentLimit().has_value() )
+        {
+            i.addChild( { "Exec segment base",  XS::ToString::Hex( *( this->execSegmentBase() ) ) } );
+            i.addChild( { "Exec segment limit", XS::ToString::Hex( *( this->execSegmentLimit() ) ) } );
+            i.addChild( { "Exec segment flags", XS::ToString::Hex( *( this->execSegmentFlags() ) ) } );
+        }
+        
+        if( cdHash.size() > 0 )
+        {
+            i.addChild( { "CDHash", ToString::Bytes( cdHash.data(), cdHash.size() ) } );
+        }
+        
+        return i;
+    }
+    
+    MappedFile CodeDirectory::blob() const
+    {
+        return this->impl->_blob;
+    }
+    
+    uint32_t CodeDirectory::version() const
+    {
+        return this->impl->_version;
+    }
+    
+    uint32_t CodeDirectory::flags() const
+    {
+        return this->impl->_flags;
+    }
+    
+    uint8_t CodeDirectory::hashType() const
+    {
+        return this->impl->_hashType;
+    }
+    
+    std::optional< Digest::Type > CodeDirectory::digestType() const
+    {
+        /* CS_HASHTYPE_SHA1, SHA256, SHA256_TRUNCATED, SHA384 */
+        switch( this->impl->_hashType )
+        {
+            case 1:  return Digest::Type::SHA1;
+            case 2:  return Digest::Type::SHA256;
+            case 3:  return Digest::Type::SHA256;
+            case 4:  return Digest::Type::SHA384;
+            default: return {};
+        }
+    }
+    
+    size_t CodeDirectory::hashSize() const
+    {
+        return this->impl->_hashSize;
+    }
+    
+    uint8_t CodeDirectory::platform() const
+    {
+        return this->impl->_platform;
+    }
+    
+    size_t CodeDirectory::pageSize() const
+    {
+        return ( this->impl->_pageSize == 0 ) ? 0 : static_cast< size_t >( 1 ) << this->impl->_pageSize;
+    }
+    
+    uint64_t CodeDirectory::codeLimit() const
+    {
+        return this->impl->_codeLimit;
+    }
+    
+    std::string CodeDirectory::identifier() const
+    {
+        return this->impl->_identifier;
+    }
+    
+    std::optional< std::string > CodeDirectory::teamIdentifier() const
+    {
+        return this->impl->_teamIdentifier;
+    }
+    
+    uint32_t CodeDirectory::specialSlotCount() const
+    {
+        return this->impl->_specialSlotCount;
+    }
+    
+    uint32_t CodeDirectory::codeSlotCount() const
+    {
+        return this->impl->_codeSlotCount;
+    }
+    
+    std::optional< uint64_t > CodeDirectory::execSegmentBase() const
+    {
+        return this->impl->_execSegmentBase;
+    }
+    
+    std::optional< uint64_t > CodeDirectory::execSegmentLimit() const
+    {
+        return this->impl->_execSegmentLimit;
+    }
+    
+    std::optional< uint64_t > CodeDirectory::execSegmentFlags() const
+    {
+        return this->impl->_execSegmentFlags;
+    }
+    
+    const uint8_t * CodeDirectory::codeHash( size_t index ) const
+    {
+        if( index >= this->impl->_codeSlotCount )
+        {
+            throw std::out_of_range( "Invalid code slot index: " + std::to_string( index ) );
+        }
+        
+        return this->impl->_blob.pointer( this->impl->_hashOffset + index * this->impl->_hashSize, this->impl->_hashSize );
+    }
+    
+    const uint8_t * CodeDirectory::specialHash( size_t slot ) const
+    {
+        if( slot == 0 || slot > this->impl->_specialSlotCount )
+        {
+            throw std::out_of_range( "Invalid special slot: " + std::to_string( slot ) );
+        }
+        
+        return this->impl->_blob.pointer( this->impl->_hashOffset - slot * this->impl->_hashSize, this->impl->_hashSize );
+    }
+    
+    std::vector< uint8_t > CodeDirectory::cdHash() const
+    {
+        std::optional< Digest::Type > type( this->digestType() );
+        std::vector< uint8_t >        hash;
+        
+        if( type.has_value() == false )
+        {
+            return {};
+        }
+        
+        hash = Digest::Compute( *( type ), this->impl->_blob.data(), this->impl->_blob.size() );
+        
+        hash.resize( 20 );
+        
+        return hash;
+    }
+    
+    void swap( CodeDirectory & o1, CodeDirectory & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    CodeDirectory::IMPL::IMPL( const MappedFile & blob ):
+        _blob( blob )
+    {
+        uint32_t magic(  blob.read< uint32_t >( 0, true ) );
+        uint32_t length( blob.read< uint32_t >( 4, true ) );
+        
+        if( magic != 0xFADE0C02 )
+        {
+            throw std::runtime_error( "Invalid code directory magic: " + XS::ToString::Hex( magic ) );
+        }
+        
+        if( length < 44 || length > blob.size() )
+        {
+            throw std::runtime_error( "Invalid code directory length: " + XS::ToString::Hex( length ) );
+        }
+        
+        this->_blob             = blob.slice( 0, length );
+        this->_version          = blob.read< uint32_t >(  8, true );
+        this->_flags            = blob.read< uint32_t >( 12, true );
+        this->_hashOffset       = blob.read< uint32_t >( 16, true );
+        this->_specialSlotCount = blob.read< uint32_t >( 24, true );
+        this->_codeSlotCount    = blob.read< uint32_t >( 28, true );
+        this->_codeLimit        = blob.read< uint32_t >( 32, true );
+        this->_hashSize         = blob.read< uint8_t  >( 36 );
+        this->_hashType         = blob.read< uint8_t  >( 37 );
+        this->_platform         = blob.read< uint8_t  >( 38 );
+        this->_pageSize         = blob.read< uint8_t  >( 39 );
+        this->_identifier       = std::string( this->_blob.cString( blob.read< uint32_t >( 20, true ) ) );
+        
+        /* Fields were appended over time; each one is only present from a given version */
+        if( this->_version >= 0x20200 && length >= 52 )
+        {
+            uint32_t offset( blob.read< uint32_t >( 48, true ) );
+            
+            if( offset != 0 )
+            {
+                this->_teamIdentifier = std::string( this->_blob.cString( offset ) );
+            }
+        }
+        
+        if( this->_version >= 0x20300 && length >= 64 )
+        {
+            uint64_t limit( blob.read< uint64_t >( 56, true ) );
+            
+            if( limit != 0 )
+            {
+                this->_codeLimit = limit;
+            }
+        }
+        
+        if( this->_version >= 0x20400 && length >= 88 )
+        {
+            this->_execSegmentBase  = blob.read< uint64_t >( 64, true );
+            this->_execSegmentLimit = blob.read< uint64_t >( 72, true );
+            this->_execSegmentFlags = blob.read< uint64_t >( 80, true );
+        }
+        
+        /* Validates that every slot lies within the blob */
+        this->_blob.pointer( this->_hashOffset - static_cast< size_t >( this->_specialSlotCount ) * this->_hashSize, ( static_cast< size_t >( this->_specialSlotCount ) + this->_codeSlotCount ) * this->_hashSize );
+    }
+    
+    CodeDirectory::IMPL::IMPL( const IMPL & o ):
+        _blob(             o._blob ),
+        _version(          o._version ),
+        _flags(            o._flags ),
+        _hashOffset(       o._hashOffset ),
+        _specialSlotCount( o._specialSlotCount ),
+        _codeSlotCount(    o._codeSlotCount ),
+        _codeLimit(        o._codeLimit ),
+        _hashSize(         o._hashSize ),
+        _hashType(         o._hashType ),
+        _platform(         o._platform ),
+        _pageSize(         o._pageSize ),
+        _identifier(       o._identifier ),
+        _teamIdentifier(   o._teamIdentifier ),
+        _execSegmentBase(  o._execSegmentBase ),
+        _execSegmentLimit( o._execSegmentLimit ),
+        _execSegmentFlags( o._execSegmentFlags )
+    {}
+    
+    CodeDirectory::IMPL::~IMPL()
+    {}
+}
@@ -0,0 +1,663 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CodeSignature.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/CodeSignature.hpp>
+#include <MachO/File.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/ToString.hpp>
+#include <MachO/LoadCommands/LinkEditData.hpp>
+#include <cstring>
+
+namespace MachO
+{
+    class CodeSignature::IMPL
+    {
+        public:
+            
+            IMPL( const File & file );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            static std::string Data( const MappedFile & blob, size_t & offset );
+            static std::string Quote( const std::string & data );
+            static std::string OID( const std::string & data );
+            static std::string Slot( const MappedFile & blob, size_t & offset );
+            static std::string Match( const MappedFile & blob, size_t & offset );
+            static std::string Expression( const MappedFile & blob, size_t & offset, int context, size_t depth );
+            
+            std::optional< MappedFile >  _data;
+            std::optional< MappedFile >  _blob;
+            std::vector< CodeDirectory > _directories;
+            std::optional< MappedFile >  _requirements;
+            std::optional< MappedFile >  _entitlements;
+            std::optional< MappedFile >  _derEntitlements;
+            std::optional< MappedFile >  _cms;
+    };
+    
+    CodeSignature::CodeSignature( const File & file ):
+        impl( std::make_unique< IMPL >( file ) )
+    {}
+    
+    CodeSignature::CodeSignature( const CodeSignature & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    CodeSignature::CodeSignature( CodeSignature && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    CodeSignature::~CodeSignature()
+    {}
+    
+    CodeSignature & CodeSignature::operator =( CodeSignature o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info CodeSignature::getInfo() const
+    {
+        XS::Info i( "Code signature" );
+        
+        if( this->isSigned() == false )
+        {
+            i.value( "none" );
+            
+            return i;
+        }
+        
+        i.value( XS::ToString::Size( this->impl->_blob->size() ) );
+        
+        for( const auto & directory: this->impl->_directories )
+        {
+            i.addChild( directory );
+        }
+        
+        if( this->impl->_requirements.has_value() )
+        {
+            XS::Info requirements( "Requirements" );
+            
+            for( const auto & p: this->requirements() )
+            {
+                requirements.addChild( { RequirementTypeName( p.first ), p.second } );
+            }
+            
+            requirements.value( std::to_string( requirements.children().size() ) );
+            i.addChild( requirements );
+        }
+        
+        if( this->impl->_entitlements.has_value() )
+        {
+            i.addChild( { "Entitlements", XS::ToString::Size( this->impl->_entitlements->size() ) } );
+        }
+        
+        if( this->impl->_derEntitlements.has_value() )
+        {
+            i.addChild( { "DER entitlements", XS::ToString::Size( this->impl->_derEntitlements->size() ) } );
+        }
+        
+        if( this->impl->_cms.has_value() )
+        {
+            i.addChild( { "CMS signature", XS::ToString::Size( this->impl->_cms->size() ) } );
+        }
+        
+        return i;
+    }
+    
+    bool CodeSignature::isSigned() const
+    {
+        return this->impl->_blob.has_value();
+    }
+    
+    std::vector< CodeDirectory > CodeSignature::codeDirectories() const
+    {
+        return this->impl->_directories;
+    }
+    
+    std::optional< MappedFile > CodeSignature::cmsSignature() const
+    {
+        return this->impl->_cms;
+    }
+    
+    std::vector< std::pair< uint32_t, std::string > > CodeSignature::requirements() const
+    {
+        std::vector< std::pair< uint32_t, std::string > > requirements;
+        
+        if( this->impl->_requirements.has_value() == false )
+        {
+            return {};
+        }
+        
+        {
+            const MappedFile & blob( *( this->impl->_requirements ) );
+            uint32_t           count( blob.read< uint32_t >( 8, true ) );
+            
+            for( uint32_t i = 0; i < count; i++ )
+            {
+                uint32_t type( blob.read< uint32_t >( 12 + i * 8, true ) );
+                uint32_t offset( blob.read< uint32_t >( 16 + i * 8, true ) );
+                uint32_t magic( blob.read< uint32_t >( offset, true ) );
+                uint32_t kind( blob.read< uint32_t >( offset + 8, true ) );
+                size_t   position( offset + 12 );
+                
+                /* CSMAGIC_REQUIREMENT, expression form */
+                if( magic != 0xFADE0C00 || kind != 1 )
+                {
+                    throw std::runtime_error( "Invalid code requirement: " + XS::ToString::Hex( magic ) );
+                }
+                
+                requirements.push_back( { type, IMPL::Expression( blob.slice( 0, offset + blob.read< uint32_t >( offset + 4, true ) ), position, 0, 0 ) } );
+            }
+        }
+        
+        return requirements;
+    }
+    
+    std::optional< std::string > CodeSignature::entitlements() const
+    {
+        if( this->impl->_entitlements.has_value() == false )
+        {
+            return {};
+        }
+        
+        {
+            const MappedFile & blob( *( this->impl->_entitlements ) );
+            
+            return std::string( reinterpret_cast< const char * >( blob.data() ) + 8, blob.size() - 8 );
+        }
+    }
+    
+    std::optional< std::vector< uint8_t > > CodeSignature::derEntitlements() const
+    {
+        if( this->impl->_derEntitlements.has_value() == false )
+        {
+            return {};
+        }
+        
+        {
+            const MappedFile & blob( *( this->impl->_derEntitlements ) );
+            
+            return std::vector< uint8_t >( blob.data() + 8, blob.data() + blob.size() );
+        }
+    }
+    
+    CodeSignature::Verification CodeSignature::verify() const
+    {
+        std::optional< CodeDirectory > best;
+        
+        /* Same preference as the kernel: SHA-384, SHA-256, truncated SHA-256, then SHA-1 */
+        auto rank = []( const CodeDirectory & directory ) -> int
+        {
+            switch( directory.hashType() )
+            {
+                case 4:  return 4;
+                case 2:  return 3;
+                case 3:  return 2;
+                case 1:  return 1;
+                default: return 0;
+            }
+        };
+        
+        for( const auto & directory: this->impl->_directories )
+        {
+            if( best.has_value() == false || rank( directory ) > rank( *( best ) ) )
+            {
+                best = directory;
+            }
+        }
+        
+        if( best.has_value() == false )
+        {
+            return { false, 0, {}, {} };
+        }
+        
+        return this->verify( *( best ) );
+    }
+    
+    CodeSignature::Verification CodeSignature::verify( const CodeDirectory & directory ) const
+    {
+        Verification                  result { true, directory.codeSlotCount(), {}, {} };
+        std::optional< Digest::Type > type( directory.digestType() );
+        size_t                        hashSize( directory.hashSize() );
+        uint64_t                      limit( directory.codeLimit() );
+        size_t                        pageSize( ( directory.pageSize() == 0 ) ? static_cast< size_t >( limit ) : directory.pageSize() );
+        
+        if( this->impl->_data.has_value() == false || type.has_value() == false || hashSize > Digest::Size( *( type ) ) || limit > this->impl->_data->size() )
+        {
+            result.valid = false;
+            
+            return result;
+        }
+        
+        if( pageSize == 0 || ( limit + pageSize - 1 ) / pageSize != directory.codeSlotCount() )
+        {
+            result.valid = false;
+            
+            return result;
+        }
+        
+        {
+            const uint8_t * data( this->impl->_data->data() );
+            size_t          count( directory.codeSlotCount() );
+            size_t          chunk( std::max< size_t >( 1, 0x100000 / pageSize ) );
+            size_t          chunks( ( count + chunk - 1 ) / chunk );
+            
+            std::vector< std::vector< size_t > > mismatches( chunks );
+            
+            /* Pages are grouped in 1MB chunks, so each thread streams through a contiguous range */
+            Parallel::For
+            (
+                chunks,
+                [ & ]( size_t index )
+                {
+                    uint8_t digest[ 64 ];
+                    
+                    for( size_t page = index * chunk; page < std::min( count, ( index + 1 ) * chunk ); page++ )
+                    {
+                        size_t offset( page * pageSize );
+                        size_t size( std::min< uint64_t >( pageSize, limit - offset ) );
+                        
+                        Digest::Compute( *( type ), data + offset, size, digest );
+                        
+                        if( std::memcmp( digest, directory.codeHash( page ), hashSize ) != 0 )
+                        {
+                            mismatches[ index ].push_back( page );
+                        }
+                    }
+                }
+            );
+            
+            for( const auto & pages: mismatches )
+            {
+                result.mismatchedPages.insert( result.mismatchedPages.end(), pages.begin(), pages.end() );
+            }
+        }
+        
+        {
+            /* Only the slots whose blobs live in the signature itself can be checked */
+            std::vector< std::pair< size_t, std::optional< MappedFile > > > slots
+            {
+                { 2, this->impl->_requirements },
+                { 5, this->impl->_entitlements },
+                { 7, this->impl->_derEntitlements }
+            };
+            
+            for( const auto & p: slots )
+            {
+                uint8_t digest[ 64 ] = {};
+                
+                if( p.first > directory.specialSlotCount() )
+                {
+                    if( p.second.has_value() )
+                    {
+                        result.mismatchedSpecialSlots.push_back( p.first );
+                    }
+                    
+                    continue;
+                }
+                
+                if( p.second.has_value() )
+                {
+                    Digest::Compute( *( type ), p.second->data(), p.second->size(), digest );
+                }
+                
+                if( std::memcmp( digest, directory.specialHash( p.first ), hashSize ) != 0 )
+                {
+                    result.mismatchedSpecialSlots.push_back( p.first );
+                }
+            }
+        }
+        
+        result.valid = result.mismatchedPages.empty() && result.mismatchedSpecialSlots.empty();
+        
+        return result;
+    }
+    
+    std::string CodeSignature::RequirementTypeName( uint32_t type )
+    {
+        switch( type )
+        {
+            case 1:  return "host";
+            case 2:  return "guest";
+            case 3:  return "designated";
+            case 4:  return "library";
+            case 5:  return "plugin";
+            default: return XS::ToString::Hex( type );
+        }
+    }
+    
+    void swap( CodeSignature & o1, CodeSignature & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    CodeSignature::IMPL::IMPL( const File & file ):
+        _data( file.mappedFile() )
+    {
+        if( this->_data.has_value() == false )
+        {
+            return;
+        }
+        
+        for( const auto & command: file.loadCommands< LoadCommands::LinkEditData >() )
+        {
+            /* LC_CODE_SIGNATURE */
+            if( command.command() != 0x1D )
+            {
+                continue;
+            }
+            
+            {
+                MappedFile blob( this->_data->slice( command.dataOffset(), command.dataSize() ) );
+                uint32_t   magic( blob.read< uint32_t >( 0, true ) );
+                uint32_t   count( blob.read< uint32_t >( 8, true ) );
+                
+                /* CSMAGIC_EMBEDDED_SIGNATURE */
+                if( magic != 0xFADE0CC0 )
+                {
+                    throw std::runtime_error( "Invalid code signature magic: " + XS::ToString::Hex( magic ) );
+                }
+                
+                blob        = blob.slice( 0, std::min< size_t >( blob.read< uint32_t >( 4, true ), blob.size() ) );
+                this->_blob = blob;
+                
+                for( uint32_t i = 0; i < count; i++ )
+                {
+                    uint32_t   type( blob.read< uint32_t >( 12 + i * 8, true ) );
+                    uint32_t   offset( blob.read< uint32_t >( 16 + i * 8, true ) );
+                    MappedFile data( blob.slice( offset, blob.read< uint32_t >( offset + 4, true ) ) );
+                    
+                    /* CSSLOT_CODEDIRECTORY, then CSSLOT_ALTERNATE_CODEDIRECTORIES */
+                    if( type == 0 )
+                    {
+                        this->_directories.insert( this->_directories.begin(), CodeDirectory( data ) );
+                    }
+                    else if( type >= 0x1000 && type < 0x1005 )
+                    {
+                        this->_directories.push_back( CodeDirectory( data ) );
+                    }
+                    else if( type == 2 )
+                    {
+                        this->_requirements = data;
+                    }
+                    else if( type == 5 )
+                    {
+                        this->_entitlements = data;
+                    }
+                    else if( type == 7 )
+                    {
+                        this->_derEntitlements = data;
+                    }
+                    else if( type == 0x10000 )
+                    {
+                        this->_cms = data;
+                    }
+                }
+            }
+            
+            break;
+        }
+    }
+    
+    CodeSignature::IMPL::IMPL( const IMPL & o ):
+        _data(            o._data ),
+        _blob(            o._blob ),
+        _directories(     o._directories ),
+        _requirements(    o._requirements ),
+        _entitlements(    o._entitlements ),
+        _derEntitlements( o._derEntitlements ),
+        _cms(             o._cms )
+    {}
+    
+    CodeSignature::IMPL::~IMPL()
+    {}
+    
+    std::string CodeSignature::IMPL::Data( const MappedFile & blob, size_t & offset )
+    {
+        uint32_t        length( blob.read< uint32_t >( offset, true ) );
+        const uint8_t * data( blob.pointer( offset + 4, length ) );
+        
+        offset += 4 + ( ( static_cast< size_t >( length ) + 3 ) & ~static_cast< size_t >( 3 ) );
+        
+        return std::string( reinterpret_cast< const char * >( data ), length );
+    }
+    
+    std::string CodeSignature::IMPL::Quote( const std::string & data )
+    {
+        for( auto c: data )
+        {
+            if( c < 0x20 || c == 0x7F || c == '"' || c == '\\' )
+            {
+                return "H\"" + ToString::Bytes( reinterpret_cast< const uint8_t * >( data.data() ), data.size() ) + "\"";
+            }
+        }
+        
+        return "\"" + data + "\"";
+    }
+    
+    std::string CodeSignature::IMPL::OID( const std::string & data )
+    {
+        std::string oid;
+        uint64_t    value( 0 );
+        
+        for( size_t i = 0; i < data.size(); i++ )
+        {
+            value = ( value << 7 ) | ( static_cast< uint8_t >( data[ i ] ) & 0x7F );
+            
+            if( ( static_cast< uint8_t >( data[ i ] ) & 0x80 ) != 0 )
+            {
+                continue;
+            }
+            
+            if( oid.empty() )
+            {
+                oid = std::to_string( std::min< uint64_t >( value / 40, 2 ) ) + "." + std::to_string( value - std::min< uint64_t >( value / 40, 2 ) * 40 );
+            }
+            else
+            {
+                oid += "." + std::to_string( value );
+            }
+            
+            value = 0;
+        }
+        
+        return oid;
+    }
+    
+    std::string CodeSignature::IMPL::Slot( const MappedFile & blob, size_t & offset )
+    {
+        int32_t slot( static_cast< int32_t >( blob.read< uint32_t >( offset, true ) ) );
+        
+        offset += 4;
+        
+        if( slot == 0 )
+        {
+            return "leaf";
+        }
+        
+        if( slot == -1 )
+        {
+            return "root";
+        }
+        
+        return std::to_string( slot );
+    }
+    
+    std::string CodeSignature::IMPL::Match( const MappedFile & blob, size_t & offset )
+    {
+        uint32_t op( blob.read< uint32_t >( offset, true ) );
+        
+        offset += 4;
+        
+        switch( op )
+        {
+            case 0:  return "/* exists */";
+            case 1:  return "= "  + Quote( Data( blob, offset ) );
+            case 2:  return "~ "  + Quote( Data( blob, offset ) );
+            case 3:  return "= "  + Quote( Data( blob, offset ) ) + "*";
+            case 4:  return "= *" + Quote( Data( blob, offset ) );
+            case 5:  return "< "  + Quote( Data( blob, offset ) );
+            case 6:  return "> "  + Quote( Data( blob, offset ) );
+            case 7:  return "<= " + Quote( Data( blob, offset ) );
+            case 8:  return ">= " + Quote( Data( blob, offset ) );
+            case 9:  return "= timestamp "  + Quote( Data( blob, offset ) );
+            case 10: return "< timestamp "  + Quote( Data( blob, offset ) );
+            case 11: return "> timestamp "  + Quote( Data( blob, offset ) );
+            case 12: return "<= timestamp " + Quote( Data( blob, offset ) );
+            case 13: return ">= timestamp " + Quote( Data( blob, offset ) );
+            case 14: return "absent";
+            default: break;
+        }
+        
+        throw std::runtime_error( "Unsupported code requirement match operation: " + XS::ToString::Hex( op ) );
+    }
+    
+    /* Context is 0 at the top level, 1 inside 'and', 2 inside '!'; parentheses follow precedence */
+    std::string CodeSignature::IMPL::Expression( const MappedFile & blob, size_t & offset, int context, size_t depth )
+    {
+        uint32_t op( blob.read< uint32_t >( offset, true ) );
+        
+        if( depth > 256 )
+        {
+            throw std::runtime_error( "Code requirement is nested too deeply" );
+        }
+        
+        offset += 4;
+        
+        switch( op & 0x00FFFFFF )
+        {
+            case 0:  return "never";
+            case 1:  return "always";
+            case 2:  return "identifier " + Quote( Data( blob, offset ) );
+            case 3:  return "anchor apple";
+            case 13: return "anchor trusted";
+            case 15: return "anchor apple generic";
+            case 21: return "notarized";
+            case 23: return "legacy";
+            
+            case 4:
+            {
+                std::string slot( Slot( blob, offset ) );
+                std::string hash( Data( blob, offset ) );
+                
+                return "certificate " + slot + " = H\"" + ToString::Bytes( reinterpret_cast< const uint8_t * >( hash.data() ), hash.size() ) + "\"";
+            }
+            
+            case 5:
+            {
+                std::string key( Data( blob, offset ) );
+                
+                return "info[" + key + "] = " + Quote( Data( blob, offset ) );
+            }
+            
+            case 6:
+            case 7:
+            {
+                bool        isAnd( ( op & 0x00FFFFFF ) == 6 );
+                std::string lhs( Expression( blob, offset, ( isAnd ) ? 1 : 0, depth + 1 ) );
+                std::string rhs( Expression( blob, offset, ( isAnd ) ? 1 : 0, depth + 1 ) );
+                std::string s( lhs + ( ( isAnd ) ? " and " : " or " ) + rhs );
+                
+                return ( context > ( ( isAnd ) ? 1 : 0 ) ) ? "(" + s + ")" : s;
+            }
+            
+            case 8:
+            {
+                std::string hash( Data( blob, offset ) );
+                
+                return "cdhash H\"" + ToString::Bytes( reinterpret_cast< const uint8_t * >( hash.data() ), hash.size() ) + "\"";
+            }
+            
+            case 9:  return "! " + Expression( blob, offset, 2, depth + 1 );
+            
+            case 10:
+            {
+                std::string key( Data( blob, offset ) );
+                
+                return "info[" + key + "] " + Match( blob, offset );
+            }
+            
+            case 11:
+            {
+                std::string slot( Slot( blob, offset ) );
+                std::string key( Data( blob, offset ) );
+                
+                return "certificate " + slot + "[" + key + "] " + Match( blob, offset );
+            }
+            
+            case 12: return "certificate " + Slot( blob, offset ) + " trusted";
+            
+            case 14:
+            case 17:
+            case 22:
+            {
+                std::string slot( Slot( blob, offset ) );
+                std::string oid( OID( Data( blob, offset ) ) );
+                std::string kind( ( ( op & 0x00FFFFFF ) == 14 ) ? "field" : ( ( ( op & 0x00FFFFFF ) == 17 ) ? "policy" : "timestamp" ) );
+                
+                return "certificate " + slot + "[" + kind + "." + oid + "] " + Match( blob, offset );
+            }
+            
+            case 16:
+            {
+                std::string key( Data( blob, offset ) );
+                
+                return "entitlement[" + key + "] " + Match( blob, offset );
+            }
+            
+            case 18: return "anchor apple " + Data( blob, offset );
+            case 19: return "(" + Data( blob, offset ) + ")";
+            
+            case 20:
+            {
+                uint32_t platform( blob.read< uint32_t >( offset, true ) );
+                
+                offset += 4;
+                
+                return "platform = " + std::to_string( platform );
+            }
+            
+            default: break;
+        }
+        
+        /* opGenericSkip: unknown operations carrying a single data argument */
+        if( ( op & 0x40000000 ) != 0 )
+        {
+            Data( blob, offset );
+            
+            return "/* unsupported operation " + XS::ToString::Hex( op ) + " */";
+        }
+        
+        throw std::runtime_error( "Unsupported code requirement operation: " + XS::ToString::Hex( op ) );
+    }
+}
@@ -0,0 +1,521 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CodeSigner.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/CodeSigner.hpp>
+#include <MachO/Digest.hpp>
+#include <MachO/FileCopy.hpp>
+#include <MachO/MappedFile.hpp>
+#include <MachO/Parallel.hpp>
+#include <XS.hpp>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace MachO
+{
+    class CodeSigner::IMPL
+    {
+        public:
+            
+            /* Offsets of the load commands to patch, and where the signature goes, relative to the slice */
+            struct Layout
+            {
+                bool                    is64;
+                size_t                  linkEdit;
+                std::optional< size_t > signature;
+                size_t                  commandsEnd;
+                uint64_t                linkEditOffset;
+                uint64_t                segmentAlignment;
+                uint64_t                textOffset;
+                uint64_t                textSize;
+                bool                    mainBinary;
+                uint64_t                codeLimit;
+                size_t                  codeDirectorySize;
+                size_t                  size;
+            };
+            
+            class Mapping
+            {
+                public:
+                    
+                    Mapping( const std::string & path );
+                    Mapping( const Mapping & o ) = delete;
+                    ~Mapping();
+                    
+                    Mapping & operator =( const Mapping & o ) = delete;
+                    
+                    void      resize( uint64_t size );
+                    uint8_t * map();
+                    
+                    std::string _path;
+                    int         _fd;
+                    uint64_t    _size;
+                    void      * _map;
+            };
+            
+            IMPL( const std::string & path );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            static Layout Plan( const MappedFile & slice, const std::string & identifier );
+            static void   Sign( uint8_t * slice, const Layout & layout, const std::string & identifier );
+            
+            template< typename T >
+            static T Read( const uint8_t * data, size_t offset, bool bigEndian );
+            
+            template< typename T >
+            static void Write( uint8_t * data, size_t offset, T value, bool bigEndian );
+            
+            static uint64_t Align( uint64_t value, uint64_t alignment );
+            
+            std::string _path;
+    };
+    
+    CodeSigner::CodeSigner( const std::string & path ):
+        impl( std::make_unique< IMPL >( path ) )
+    {}
+    
+    CodeSigner::CodeSigner( const CodeSigner & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    CodeSigner::CodeSigner( CodeSigner && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    CodeSigner::~CodeSigner( void )
+    {}
+    
+    CodeSigner & CodeSigner::operator =( CodeSigner o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    std::string CodeSigner::path() const
+    {
+        return this->impl->_path;
+    }
+    
+    void CodeSigner::sign( const std::string & identifier ) const
+    {
+        std::vector< std::pair< uint64_t, IMPL::Layout > > slices;
+        std::optional< uint64_t >                          size;
+        
+        /* Layouts are planned on a read-only mapping, before the file is resized */
+        {
+            MappedFile data( this->impl->_path );
+            uint32_t   magic( data.read< uint32_t >( 0, true ) );
+            
+            if( magic == 0xCAFEBABE )
+            {
+                uint32_t count( data.read< uint32_t >( 4, true ) );
+                
+                for( uint32_t i = 0; i < count; i++ )
+                {
+                    uint32_t     offset( data.read< uint32_t >( 16 + i * 20, true ) );
+                    uint32_t     available( data.read< uint32_t >( 20 + i * 20, true ) );
+                    IMPL::Layout layout( IMPL::Plan( data.slice( offset, available ), identifier ) );
+                    
+                    if( layout.codeLimit + layout.size > available )
+                    {
+                        throw std::runtime_error( "Not enough room to sign fat architecture in place: " + std::to_string( i ) );
+                    }
+                    
+                    slices.push_back( { offset, layout } );
+                }
+            }
+            else
+            {
+                IMPL::Layout layout( IMPL::Plan( data, identifier ) );
+                
+                slices.push_back( { 0, layout } );
+                
+                size = layout.codeLimit + layout.size;
+            }
+        }
+        
+        {
+            IMPL::Mapping mapping( this->impl->_path );
+            
+            if( size.has_value() )
+            {
+                mapping.resize( *( size ) );
+            }
+            
+            {
+                uint8_t * data( mapping.map() );
+                
+                for( const auto & p: slices )
+                {
+                    IMPL::Sign( data + p.first, p.second, identifier );
+                }
+            }
+        }
+    }
+    
+    void CodeSigner::sign( const std::string & identifier, const std::string & output ) const
+    {
+        FileCopy::File( this->impl->_path, output );
+        
+        CodeSigner( output ).sign( identifier );
+    }
+    
+    void swap( CodeSigner & o1, CodeSigner & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    CodeSigner::IMPL::IMPL( const std::string & path ):
+        _path( path )
+    {}
+    
+    CodeSigner::IMPL::IMPL( const IMPL & o ):
+        _path( o._path )
+    {}
+    
+    CodeSigner::IMPL::~IMPL()
+    {}
+    
+    CodeSigner::IMPL::Layout CodeSigner::IMPL::Plan( const MappedFile & slice, const std::string & identifier )
+    {
+        Layout   layout {};
+        uint32_t magic( slice.read< uint32_t >( 0 ) );
+        uint32_t cpu( slice.read< uint32_t >( 4 ) );
+        uint32_t count( slice.read< uint32_t >( 16 ) );
+        size_t   offset;
+        uint64_t firstSection( slice.size() );
+        bool     hasLinkEdit( false );
+        
+        if( magic != 0xFEEDFACE && magic != 0xFEEDFACF )
+        {
+            throw std::runtime_error( "Only little-endian Mach-O files can be signed: " + XS::ToString::Hex( magic ) );
+        }
+        
+        layout.is64             = magic == 0xFEEDFACF;
+        layout.mainBinary       = slice.read< uint32_t >( 12 ) == 0x02;
+        layout.segmentAlignment = ( ( cpu & 0xFF ) == 0x0C ) ? 0x4000 : 0x1000;
+        offset                  = ( layout.is64 ) ? 32 : 28;
+        
+        for( uint32_t i = 0; i < count; i++ )
+        {
+            uint32_t command( slice.read< uint32_t >( offset ) );
+            uint32_t size( slice.read< uint32_t >( offset + 4 ) );
+            
+            if( size < 8 )
+            {
+                throw std::runtime_error( "Invalid load command size: " + XS::ToString::Hex( size ) );
+            }
+            
+            /* LC_SEGMENT, LC_SEGMENT_64 */
+            if( command == 0x01 || command == 0x19 )
+            {
+                std::string name( reinterpret_cast< const char * >( slice.pointer( offset + 8, 16 ) ), 16 );
+                uint64_t    fileOffset( ( command == 0x19 ) ? slice.read< uint64_t >( offset + 40 ) : slice.read< uint32_t >( offset + 32 ) );
+                uint64_t    fileSize( ( command == 0x19 ) ? slice.read< uint64_t >( offset + 48 ) : slice.read< uint32_t >( offset + 36 ) );
+                uint32_t    sections( slice.read< uint32_t >( offset + ( ( command == 0x19 ) ? 64 : 48 ) ) );
+                size_t      sectionSize( ( command == 0x19 ) ? 80 : 68 );
+                
+                name = name.substr( 0, name.find( '\0' ) );
+                
+                if( name == "__LINKEDIT" )
+                {
+                    hasLinkEdit           = true;
+                    layout.linkEdit       = offset;
+                    layout.linkEditOffset = fileOffset;
+                    layout.codeLimit      = fileOffset + fileSize;
+                }
+                else if( name == "__TEXT" )
+                {
+                    layout.textOffset = fileOffset;
+                    layout.textSize   = fileSize;
+                }
+                
+                /* Load commands may only grow up to the first section holding file data */
+                for( uint32_t j = 0; j < sections; j++ )
+                {
+                    size_t   section( offset + ( ( command == 0x19 ) ? 72 : 56 ) + j * sectionSize );
+                    uint32_t sectionOffset( slice.read< uint32_t >( section + ( ( command == 0x19 ) ? 48 : 40 ) ) );
+                    
+                    if( sectionOffset != 0 )
+                    {
+                        firstSection = std::min< uint64_t >( firstSection, sectionOffset );
+                    }
+                }
+            }
+            
+            /* LC_CODE_SIGNATURE */
+            if( command == 0x1D )
+            {
+                layout.signature = offset;
+                layout.codeLimit = slice.read< uint32_t >( offset + 8 );
+            }
+            
+            offset += size;
+        }
+        
+        layout.commandsEnd = offset;
+        
+        if( hasLinkEdit == false )
+        {
+            throw std::runtime_error( "Cannot sign a Mach-O file without a __LINKEDIT segment" );
+        }
+        
+        if( layout.signature.has_value() == false )
+        {
+            if( layout.commandsEnd + 16 > firstSection )
+            {
+                throw std::runtime_error( "Not enough room to add LC_CODE_SIGNATURE" );
+            }
+            
+            layout.codeLimit = Align( layout.codeLimit, 16 );
+        }
+        
+        if( layout.codeLimit < layout.linkEditOffset )
+        {
+            throw std::runtime_error( "Code signature is not located in __LINKEDIT" );
+        }
+        
+        {
+            uint64_t pages( ( layout.codeLimit + 0xFFF ) / 0x1000 );
+            
+            /* CodeDirectory v0x20400 header, identifier, two special slots and one SHA-256 hash per 4KB page */
+            layout.codeDirectorySize = 88 + identifier.size() + 1 + ( 2 + pages ) * 32;
+            layout.size              = static_cast< size_t >( Align( 12 + 2 * 8 + layout.codeDirectorySize + 12, 16 ) );
+        }
+        
+        /* Without an existing signature, only zero padding may be overwritten */
+        if( layout.signature.has_value() == false && layout.codeLimit < slice.size() )
+        {
+            const uint8_t * trailing( slice.data() + layout.codeLimit );
+            size_t          size( static_cast< size_t >( std::min< uint64_t >( slice.size() - layout.codeLimit, layout.size ) ) );
+            
+            if( std::any_of( trailing, trailing + size, []( uint8_t c ) { return c != 0; } ) )
+            {
+                throw std::runtime_error( "Unexpected data after __LINKEDIT" );
+            }
+        }
+        
+        return layout;
+    }
+    
+    void CodeSigner::IMPL::Sign( uint8_t * slice, const Layout & layout, const std::string & identifier )
+    {
+        uint64_t               linkEditSize( layout.codeLimit + layout.size - layout.linkEditOffset );
+        size_t                 pages( static_cast< size_t >( ( layout.codeLimit + 0xFFF ) / 0x1000 ) );
+        size_t                 hashOffset( 88 + identifier.size() + 1 + 2 * 32 );
+        size_t                 directoryOffset( 12 + 2 * 8 );
+        size_t                 requirementsOffset( directoryOffset + layout.codeDirectorySize );
+        std::vector< uint8_t > blob( layout.size );
+        uint8_t              * directory( blob.data() + directoryOffset );
+        
+        /* Load commands first, as they are part of the first hashed page */
+        if( layout.signature.has_value() )
+        {
+            Write< uint32_t >( slice, *( layout.signature ) + 8,  static_cast< uint32_t >( layout.codeLimit ), false );
+            Write< uint32_t >( slice, *( layout.signature ) + 12, static_cast< uint32_t >( layout.size ), false );
+        }
+        else
+        {
+            uint32_t count( Read< uint32_t >( slice, 16, false ) );
+            uint32_t size( Read< uint32_t >( slice, 20, false ) );
+            
+            Write< uint32_t >( slice, layout.commandsEnd,      0x1D, false );
+            Write< uint32_t >( slice, layout.commandsEnd + 4,  16, false );
+            Write< uint32_t >( slice, layout.commandsEnd + 8,  static_cast< uint32_t >( layout.codeLimit ), false );
+            Write< uint32_t >( slice, layout.commandsEnd + 12, static_cast< uint32_t >( layout.size ), false );
+            Write< uint32_t >( slice, 16,                      count + 1, false );
+            Write< uint32_t >( slice, 20,                      size + 16, false );
+        }
+        
+        if( layout.is64 )
+        {
+            Write< uint64_t >( slice, layout.linkEdit + 32, Align( linkEditSize, layout.segmentAlignment ), false );
+            Write< uint64_t >( slice, layout.linkEdit + 48, linkEditSize, false );
+        }
+        else
+        {
+            Write< uint32_t >( slice, layout.linkEdit + 28, static_cast< uint32_t >( Align( linkEditSize, layout.segmentAlignment ) ), false );
+            Write< uint32_t >( slice, layout.linkEdit + 36, static_cast< uint32_t >( linkEditSize ), false );
+        }
+        
+        /* SuperBlob with the code directory and an empty requirement set */
+        Write< uint32_t >( blob.data(), 0,  0xFADE0CC0, true );
+        Write< uint32_t >( blob.data(), 4,  static_cast< uint32_t >( requirementsOffset + 12 ), true );
+        Write< uint32_t >( blob.data(), 8,  2, true );
+        Write< uint32_t >( blob.data(), 12, 0, true );
+        Write< uint32_t >( blob.data(), 16, static_cast< uint32_t >( directoryOffset ), true );
+        Write< uint32_t >( blob.data(), 20, 2, true );
+        Write< uint32_t >( blob.data(), 24, static_cast< uint32_t >( requirementsOffset ), true );
+        
+        Write< uint32_t >( blob.data(), requirementsOffset,     0xFADE0C01, true );
+        Write< uint32_t >( blob.data(), requirementsOffset + 4, 12, true );
+        Write< uint32_t >( blob.data(), requirementsOffset + 8, 0, true );
+        
+        Write< uint32_t >( directory, 0,  0xFADE0C02, true );
+        Write< uint32_t >( directory, 4,  static_cast< uint32_t >( layout.codeDirectorySize ), true );
+        Write< uint32_t >( directory, 8,  0x20400, true );
+        Write< uint32_t >( directory, 12, 0x02, true );
+        Write< uint32_t >( directory, 16, static_cast< uint32_t >( hashOffset ), true );
+        Write< uint32_t >( directory, 20, 88, true );
+        Write< uint32_t >( directory, 24, 2, true );
+        Write< uint32_t >( directory, 28, static_cast< uint32_t >( pages ), true );
+        Write< uint32_t >( directory, 32, ( layout.codeLimit > 0xFFFFFFFF ) ? 0 : static_cast< uint32_t >( layout.codeLimit ), true );
+        Write< uint8_t  >( directory, 36, 32, true );
+        Write< uint8_t  >( directory, 37, 2, true );
+        Write< uint8_t  >( directory, 39, 12, true );
+        Write< uint64_t >( directory, 56, ( layout.codeLimit > 0xFFFFFFFF ) ? layout.codeLimit : 0, true );
+        Write< uint64_t >( directory, 64, layout.textOffset, true );
+        Write< uint64_t >( directory, 72, layout.textSize, true );
+        Write< uint64_t >( directory, 80, ( layout.mainBinary ) ? 1 : 0, true );
+        
+        std::memcpy( directory + 88, identifier.c_str(), identifier.size() + 1 );
+        
+        Digest::Compute( Digest::Type::SHA256, blob.data() + requirementsOffset, 12, directory + hashOffset - 2 * 32 );
+        
+        {
+            size_t chunk( 0x100000 / 0x1000 );
+            
+            /* Each thread hashes a contiguous 1MB run of pages straight from the mapping */
+            Parallel::For
+            (
+                ( pages + chunk - 1 ) / chunk,
+                [ & ]( size_t index )
+                {
+                    for( size_t page = index * chunk; page < std::min( pages, ( index + 1 ) * chunk ); page++ )
+                    {
+                        uint64_t offset( static_cast< uint64_t >( page ) * 0x1000 );
+                        size_t   size( static_cast< size_t >( std::min< uint64_t >( 0x1000, layout.codeLimit - offset ) ) );
+                        
+                        Digest::Compute( Digest::Type::SHA256, slice + offset, size, directory + hashOffset + page * 32 );
+                    }
+                }
+            );
+        }
+        
+        std::memcpy( slice + layout.codeLimit, blob.data(), blob.size() );
+    }
+    
+    template< typename T >
+    T CodeSigner::IMPL::Read( const uint8_t * data, size_t offset, bool bigEndian )
+    {
+        T value;
+        
+        std::memcpy( &value, data + offset, sizeof( T ) );
+        
+        return ( bigEndian == MappedFile::IsBigEndianHost() ) ? value : MappedFile::Swap( value );
+    }
+    
+    template< typename T >
+    void CodeSigner::IMPL::Write( uint8_t * data, size_t offset, T value, bool bigEndian )
+    {
+        if( bigEndian != MappedFile::IsBigEndianHost() )
+        {
+            value = MappedFile::Swap( value );
+        }
+        
+        std::memcpy( data + offset, &value, sizeof( T ) );
+    }
+    
+    uint64_t CodeSigner::IMPL::Align( uint64_t value, uint64_t alignment )
+    {
+        return ( value + alignment - 1 ) & ~( alignment - 1 );
+    }
+    
+    CodeSigner::IMPL::Mapping::Mapping( const std::string & path ):
+        _path( path ),
+        _fd(   open( path.c_str(), O_RDWR ) ),
+        _size( 0 ),
+        _map(  nullptr )
+    {
+        struct stat st;
+        
+        if( this->_fd < 0 || fstat( this->_fd, &st ) != 0 )
+        {
+            if( this->_fd >= 0 )
+            {
+                close( this->_fd );
+            }
+            
+            throw std::runtime_error( "Cannot open file for writing: " + path );
+        }
+        
+        this->_size = static_cast< uint64_t >( st.st_size );
+    }
+    
+    CodeSigner::IMPL::Mapping::~Mapping()
+    {
+        if( this->_map != nullptr )
+        {
+            munmap( this->_map, this->_size );
+        }
+        
+        close( this->_fd );
+    }
+    
+    void CodeSigner::IMPL::Mapping::resize( uint64_t size )
+    {
+        if( this->_map != nullptr )
+        {
+            throw std::runtime_error( "Cannot resize a mapped file: " + this->_path );
+        }
+        
+        if( size != this->_size && ftruncate( this->_fd, static_cast< off_t >( size ) ) != 0 )
+        {
+            throw std::runtime_error( "Cannot resize file: " + this->_path );
+        }
+        
+        this->_size = size;
+    }
+    
+    uint8_t * CodeSigner::IMPL::Mapping::map()
+    {
+        if( this->_map == nullptr )
+        {
+            void * map( mmap( nullptr, this->_size, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0 ) );
+            
+            if( map == MAP_FAILED )
+            {
+                throw std::runtime_error( "Cannot map file: " + this->_path );
+            }
+            
+            this->_map = map;
+        }
+        
+        return static_cast< uint8_t * >( this->_map );
+    }
+}
@@ -0,0 +1,1677 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        DebugInfo.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/DebugInfo.hpp>
+#include <MachO/FileCopy.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/LoadCommands/Segment.hpp>
+#include <MachO/LoadCommands/Segment64.hpp>
+#include <MachO/LoadCommands/UUID.hpp>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <unistd.h>
+
+namespace MachO
+{
+    class DebugInfo::IMPL
+    {
+        public:
+            
+            static constexpr uint32_t Magic      = 0x4D4F4458;
+            static constexpr uint32_t Version    = 1;
+            static constexpr size_t   NoFunction = std::numeric_limits< size_t >::max();
+            
+            enum SectionName: size_t
+            {
+                Info,
+                Abbrev,
+                Line,
+                Str,
+                LineStr,
+                StrOffsets,
+                Addr,
+                Ranges,
+                RngLists,
+                ARanges,
+                SectionCount
+            };
+            
+            class Cursor
+            {
+                public:
+                    
+                    Cursor( const MappedFile & data, size_t position, bool bigEndian );
+                    
+                    template< typename T >
+                    T read()
+                    {
+                        T value( this->_data.read< T >( this->_position, this->_bigEndian ) );
+                        
+                        this->_position += sizeof( T );
+                        
+                        return value;
+                    }
+                    
+                    uint64_t         read( size_t size );
+                    uint64_t         uleb();
+                    int64_t          sleb();
+                    uint64_t         offset( bool dwarf64 );
+                    std::string_view string();
+                    void             skip( uint64_t size );
+                    
+                    const MappedFile & _data;
+                    size_t             _position;
+                    bool               _bigEndian;
+            };
+            
+            struct Attribute
+            {
+                uint64_t name;
+                uint64_t form;
+                int64_t  implicit;
+            };
+            
+            struct Abbreviation
+            {
+                uint64_t                 tag;
+                bool                     children;
+                std::vector< Attribute > attributes;
+            };
+            
+            struct Value
+            {
+                uint64_t         form;
+                uint64_t         data;
+                std::string_view string;
+            };
+            
+            struct Row
+            {
+                uint64_t address;
+                uint32_t file;
+                uint32_t line;
+                uint32_t column;
+                bool     end;
+            };
+            
+            struct Function
+            {
+                std::vector< std::pair< uint64_t, uint64_t > > ranges;
+                uint64_t                                       die;
+                std::vector< size_t >                          children;
+                uint32_t                                       callFile;
+                uint32_t                                       callLine;
+                uint32_t                                       callColumn;
+            };
+            
+            struct Name
+            {
+                std::string_view name;
+                std::string_view linkage;
+                uint64_t         reference;
+            };
+            
+            struct Span
+            {
+                uint64_t begin;
+                uint64_t end;
+                size_t   index;
+            };
+            
+            struct Unit
+            {
+                size_t                                         offset;
+                size_t                                         end;
+                size_t                                         dies;
+                uint16_t                                       version;
+                uint8_t                                        addressSize;
+                bool                                           dwarf64;
+                uint64_t                                       base;
+                uint64_t                                       strOffsetsBase;
+                uint64_t                                       addrBase;
+                uint64_t                                       rnglistsBase;
+                std::optional< uint64_t >                      lines;
+                std::string_view                               directory;
+                std::vector< std::pair< uint64_t, uint64_t > > ranges;
+                std::vector< Abbreviation >                    abbreviations;
+                std::vector< Row >                             rows;
+                std::vector< std::string >                     files;
+                std::vector< Function >                        functions;
+                std::vector< Span >                            spans;
+                std::unordered_map< uint64_t, Name >           names;
+            };
+            
+            /* Units are decoded at most once, on first use, and are then immutable */
+            struct Slot
+            {
+                std::once_flag          once;
+                std::unique_ptr< Unit > unit;
+            };
+            
+            IMPL( const File & file, const std::string & directory );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            void addSection( const std::string & segment, const std::string & section, const std::optional< MappedFile > & data, size_t offset, uint64_t size );
+            void createSlots();
+            void buildIndex();
+            void readARanges( std::vector< bool > & covered );
+            bool readIndex( const std::string & path );
+            void writeIndex( const std::string & path ) const;
+            
+            const Unit            * unit( size_t index )                                                            const;
+            std::unique_ptr< Unit > header( size_t offset )                                                         const;
+            void                    load( Unit & unit )                                                             const;
+            void                    readLines( Unit & unit )                                                        const;
+            Value                   readValue( Cursor & cursor, uint64_t form, int64_t implicit, const Unit & unit ) const;
+            std::string_view        string( const Value & value, const Unit & unit )                                const;
+            uint64_t                address( const Value & value, const Unit & unit )                               const;
+            uint64_t                reference( const Value & value, const Unit & unit )                             const;
+            
+            std::vector< std::pair< uint64_t, uint64_t > > readRanges( const Value & value, const Unit & unit, uint64_t base ) const;
+            
+            std::string name( uint64_t die, unsigned int depth ) const;
+            Location    locate( uint64_t address )               const;
+            
+            static std::string Join( std::string_view directory, std::string_view name );
+            
+            bool                                   _bigEndian;
+            std::vector< MappedFile >              _sections;
+            std::optional< std::string >           _uuid;
+            std::vector< uint64_t >                _units;
+            std::vector< Span >                    _spans;
+            std::vector< std::unique_ptr< Slot > > _slots;
+    };
+    
+    DebugInfo::DebugInfo( const File & file ):
+        impl( std::make_unique< IMPL >( file, "" ) )
+    {}
+    
+    DebugInfo::DebugInfo( const File & file, const std::string & indexDirectory ):
+        impl( std::make_unique< IMPL >( file, indexDirectory ) )
+    {}
+    
+    DebugInfo::DebugInfo( const DebugInfo & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    DebugInfo::DebugInfo( DebugInfo && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    DebugInfo::~DebugInfo( void )
+    {}
+    
+    DebugInfo & DebugInfo::operator =( DebugInfo o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    bool DebugInfo::hasDebugInfo() const
+    {
+        return this->impl->_sections[ IMPL::Info ].size() > 0;
+    }
+    
+    size_t DebugInfo::unitCount() const
+    {
+        return this->impl->_units.size();
+    }
+    
+    DebugInfo::Location DebugInfo::lookup( uint64_t address ) const
+    {
+        return this->impl->locate( address );
+    }
+    
+    std::vector< DebugInfo::Location > DebugInfo::lookup( const std::vector< uint64_t > & addresses ) const
+    {
+        std::vector< std::pair< uint64_t, size_t > > sorted;
+        std::vector< Location >                      locations( addresses.size() );
+        size_t                                       chunk( 1024 );
+        
+        sorted.reserve( addresses.size() );
+        
+        for( size_t i = 0; i < addresses.size(); i++ )
+        {
+            sorted.emplace_back( addresses[ i ], i );
+        }
+        
+        /* Neighbouring addresses usually share a unit, so sorted chunks decode fewer units concurrently */
+        std::sort( sorted.begin(), sorted.end() );
+        
+        Parallel::For
+        (
+            ( sorted.size() + chunk - 1 ) / chunk,
+            [ & ]( size_t n )
+            {
+                size_t end( std::min( ( n + 1 ) * chunk, sorted.size() ) );
+                
+                for( size_t i = n * chunk; i < end; i++ )
+                {
+                    locations[ sorted[ i ].second ] = this->impl->locate( sorted[ i ].first );
+                }
+            }
+        );
+        
+        return locations;
+    }
+    
+    void swap( DebugInfo & o1, DebugInfo & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    DebugInfo::IMPL::IMPL( const File & file, const std::string & directory ):
+        _bigEndian( file.endianness() == File::Endianness::BigEndian ),
+        _sections( SectionCount, MappedFile( std::vector< uint8_t >() ) )
+    {
+        std::optional< MappedFile > data( file.mappedFile() );
+        
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment >() )
+        {
+            for( const auto & section: segment.sections() )
+            {
+                this->addSection( section.segment(), section.section(), data, section.offset(), section.size() );
+            }
+        }
+        
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment64 >() )
+        {
+            for( const auto & section: segment.sections() )
+            {
+                this->addSection( section.segment(), section.section(), data, section.offset(), section.size() );
+            }
+        }
+        
+        for( const auto & command: file.loadCommands< LoadCommands::UUID >() )
+        {
+            this->_uuid = command.uuid();
+        }
+        
+        if( this->_sections[ Info ].size() == 0 )
+        {
+            return;
+        }
+        
+        if( directory.size() > 0 && this->_uuid.has_value() )
+        {
+            std::string path( directory + "/" + *( this->_uuid ) + ".dwarfindex" );
+            
+            if( this->readIndex( path ) == false )
+            {
+                this->buildIndex();
+                
+                /* The index only saves time, so a read-only directory is not an error */
+                try
+                {
+                    this->writeIndex( path );
+                }
+                catch( const std::exception & )
+                {}
+            }
+        }
+        else
+        {
+            this->buildIndex();
+        }
+        
+        this->createSlots();
+    }
+    
+    DebugInfo::IMPL::IMPL( const IMPL & o ):
+        _bigEndian( o._bigEndian ),
+        _sections(  o._sections ),
+        _uuid(      o._uuid ),
+        _units(     o._units ),
+        _spans(     o._spans )
+    {
+        this->createSlots();
+    }
+    
+    DebugInfo::IMPL::~IMPL()
+    {}
+    
+    void DebugInfo::IMPL::addSection( const std::string & segment, const std::string & section, const std::optional< MappedFile > & data, size_t offset, uint64_t size )
+    {
+        static const std::vector< std::string > names
+        {
+            "__debug_info",
+            "__debug_abbrev",
+            "__debug_line",
+            "__debug_str",
+            "__debug_line_str",
+            "__debug_str_offs",
+            "__debug_addr",
+            "__debug_ranges",
+            "__debug_rnglists",
+            "__debug_aranges"
+        };
+        
+        std::string name( section.substr( 0, section.find( '\0' ) ) );
+        auto        it( std::find( names.begin(), names.end(), name ) );
+        
+        if( segment.substr( 0, segment.find( '\0' ) ) != "__DWARF" || it == names.end() || data.has_value() == false )
+        {
+            return;
+        }
+        
+        /* Sections are sliced from the mapping, as copying .debug_info of a large dSYM would defeat lazy decoding */
+        if( data->contains( offset, size ) == false )
+        {
+            throw std::runtime_error( "Invalid DWARF section: " + name );
+        }
+        
+        this->_sections[ static_cast< size_t >( it - names.begin() ) ] = data->slice( offset, size );
+    }
+    
+    void DebugInfo::IMPL::createSlots()
+    {
+        this->_slots.clear();
+        
+        for( size_t i = 0; i < this->_units.size(); i++ )
+        {
+            this->_slots.push_back( std::make_unique< Slot >() );
+        }
+    }
+    
+    void DebugInfo::IMPL::buildIndex()
+    {
+        const MappedFile  & info( this->_sections[ Info ] );
+        Cursor              cursor( info, 0, this->_bigEndian );
+        std::vector< bool > covered;
+        
+        /* Unit headers are chained by their lengths, so listing units does not decode them */
+        while( cursor._position + 4 <= info.size() )
+        {
+            size_t   offset( cursor._position );
+            uint64_t length( cursor.read< uint32_t >() );
+            
+            if( length == 0xFFFFFFFF && cursor._position + 8 <= info.size() )
+            {
+                length = cursor.read< uint64_t >();
+            }
+            else if( length >= 0xFFFFFFF0 )
+            {
+                break;
+            }
+            
+            if( length > info.size() - cursor._position )
+            {
+                break;
+            }
+            
+            this->_units.push_back( offset );
+            cursor.skip( length );
+        }
+        
+        covered.resize( this->_units.size(), false );
+        
+        try
+        {
+            this->readARanges( covered );
+        }
+        catch( const std::exception & )
+        {}
+        
+        /* Units missing from .debug_aranges only need their top-level DIE to be read */
+        for( size_t i = 0; i < this->_units.size(); i++ )
+        {
+            if( covered[ i ] )
+            {
+                continue;
+            }
+            
+            try
+            {
+                std::unique_ptr< Unit > unit( this->header( this->_units[ i ] ) );
+                
+                for( const auto & range: unit->ranges )
+                {
+                    this->_spans.push_back( { range.first, range.second, i } );
+                }
+            }
+            catch( const std::exception & )
+            {}
+        }
+        
+        std::sort
+        (
+            this->_spans.begin(),
+            this->_spans.end(),
+            []( const Span & s1, const Span & s2 )
+            {
+                return s1.begin < s2.begin;
+            }
+        );
+    }
+    
+    void DebugInfo::IMPL::readARanges( std::vector< bool > & covered )
+    {
+        const MappedFile & aranges( this->_sections[ ARanges ] );
+        Cursor             cursor( aranges, 0, this->_bigEndian );
+        
+        while( cursor._position + 4 <= aranges.size() )
+        {
+            size_t   start( cursor._position );
+            uint64_t length( cursor.read< uint32_t >() );
+            bool     dwarf64( length == 0xFFFFFFFF );
+            size_t   end;
+            uint64_t info;
+            uint8_t  addressSize;
+            size_t   tuple;
+            
+            if( dwarf64 )
+            {
+                length = cursor.read< uint64_t >();
+            }
+            
+            if( length > aranges.size() - cursor._position )
+            {
+                return;
+            }
+            
+            end = cursor._position + length;
+            
+            cursor.read< uint16_t >();
+            
+            info        = cursor.offset( dwarf64 );
+            addressSize = cursor.read< uint8_t >();
+            
+            cursor.read< uint8_t >();
+            
+            {
+                auto it( std::lower_bound( this->_units.begin(), this->_units.end(), info ) );
+                
+                if( addressSize == 0 || addressSize > 8 || it == this->_units.end() || *( it ) != info )
+                {
+                    cursor._position = end;
+                    
+                    continue;
+                }
+                
+                /* Tuples are aligned to twice the address size, from the start of the set */
+                tuple            = addressSize * 2;
+                cursor._position = start + ( ( cursor._position - start + tuple - 1 ) / tuple ) * tuple;
+                
+                while( cursor._position + tuple <= end )
+                {
+                    uint64_t address( cursor.read( addressSize ) );
+                    uint64_t size(    cursor.read( addressSize ) );
+                    
+                    if( address == 0 && size == 0 )
+                    {
+                        break;
+                    }
+                    
+                    if( size > 0 )
+                    {
+                        this->_spans.push_back( { address, address + size, static_cast< size_t >( it - this->_units.begin() ) } );
+                    }
+                }
+                
+                covered[ static_cast< size_t >( it - this->_units.begin() ) ] = true;
+            }
+            
+            cursor._position = end;
+        }
+    }
+    
+    bool DebugInfo::IMPL::readIndex( const std::string & path )
+    {
+        try
+        {
+            MappedFile data( path );
+            bool       host( MappedFile::IsBigEndianHost() );
+            size_t     position( 32 );
+            uint64_t   units;
+            uint64_t   spans;
+            
+            if
+            (
+                   data.size() < 32
+                || data.read< uint32_t >( 0, host ) != Magic
+                || data.read< uint32_t >( 4, host ) != Version
+                || data.read< uint64_t >( 8, host ) != this->_sections[ Info ].size()
+            )
+            {
+                return false;
+            }
+            
+            units = data.read< uint64_t >( 16, host );
+            spans = data.read< uint64_t >( 24, host );
+            
+            if( units > data.size() / 8 || spans > data.size() / 24 || 32 + units * 8 + spans * 24 != data.size() )
+            {
+                return false;
+            }
+            
+            for( uint64_t i = 0; i < units; i++, position += 8 )
+            {
+                this->_units.push_back( data.read< uint64_t >( position, host ) );
+            }
+            
+            for( uint64_t i = 0; i < spans; i++, position += 24 )
+            {
+                Span span { data.read< uint64_t >( position, host ), data.read< uint64_t >( position + 8, host ), static_cast< size_t >( data.read< uint64_t >( position + 16, host ) ) };
+                
+                if( span.index >= this->_units.size() )
+                {
+                    this->_units.clear();
+                    this->_spans.clear();
+                    
+                    return false;
+                }
+                
+                this->_spans.push_back( span );
+            }
+            
+            return true;
+        }
+        catch( const std::exception & )
+        {
+            this->_units.clear();
+            this->_spans.clear();
+            
+            return false;
+        }
+    }
+    
+    void DebugInfo::IMPL::writeIndex( const std::string & path ) const
+    {
+        std::vector< uint64_t > data;
+        std::string             temporary( path + "." + std::to_string( getpid() ) );
+        int                     fd;
+        
+        data.push_back( ( static_cast< uint64_t >( Version ) << 32 ) | Magic );
+        data.push_back( this->_sections[ Info ].size() );
+        data.push_back( this->_units.size() );
+        data.push_back( this->_spans.size() );
+        data.insert( data.end(), this->_units.begin(), this->_units.end() );
+        
+        for( const auto & span: this->_spans )
+        {
+            data.push_back( span.begin );
+            data.push_back( span.end );
+            data.push_back( span.index );
+        }
+        
+        /* Host-endian, like the other caches, and replaced atomically */
+        if( MappedFile::IsBigEndianHost() )
+        {
+            data[ 0 ] = ( static_cast< uint64_t >( Magic ) << 32 ) | Version;
+        }
+        
+        fd = FileCopy::Create( temporary, 0644 );
+        
+        try
+        {
+            FileCopy::Write( fd, 0, reinterpret_cast< const uint8_t * >( data.data() ), data.size() * sizeof( uint64_t ) );
+        }
+        catch( ... )
+        {
+            close( fd );
+            unlink( temporary.c_str() );
+            
+            throw;
+        }
+        
+        close( fd );
+        
+        if( rename( temporary.c_str(), path.c_str() ) != 0 )
+        {
+            unlink( temporary.c_str() );
+            
+            throw std::runtime_error( "Cannot write DWARF index: " + path );
+        }
+    }
+    
+    const DebugInfo::IMPL::Unit * DebugInfo::IMPL::unit( size_t index ) const
+    {
+        Slot & slot( *( this->_slots[ index ] ) );
+        
+        std::call_once
+        (
+            slot.once,
+            [ & ]()
+            {
+                /* A malformed unit stays unresolved, without affecting the other ones */
+                try
+                {
+                    std::unique_ptr< Unit > unit( this->header( this->_units[ index ] ) );
+                    
+                    this->load( *( unit ) );
+                    
+                    slot.unit = std::move( unit );
+                }
+                catch( const std::exception & )
+                {}
+            }
+        );
+        
+        return slot.unit.get();
+    }
+    
+    std::unique_ptr< DebugInfo::IMPL::Unit > DebugInfo::IMPL::header( size_t offset ) const
+    {
+        const MappedFile                           & info( this->_sections[ Info ] );
+        std::unique_ptr< Unit >                      unit( std::make_unique< Unit >() );
+        Cursor                                       cursor( info, offset, this->_bigEndian );
+        uint64_t                                     length( cursor.read< uint32_t >() );
+        uint64_t                                     abbreviations;
+        uint64_t                                     code;
+        std::vector< std::pair< uint64_t, Value > >  values;
+        std::optional< Value >                       low;
+        std::optional< Value >                       high;
+        std::optional< Value >                       ranges;
+        
+        unit->offset         = offset;
+        unit->dwarf64        = length == 0xFFFFFFFF;
+        unit->base           = 0;
+        unit->strOffsetsBase = 0;
+        unit->addrBase       = 0;
+        unit->rnglistsBase   = 0;
+        
+        if( unit->dwarf64 )
+        {
+            length = cursor.read< uint64_t >();
+        }
+        
+        if( length > info.size() - cursor._position )
+        {
+            throw std::runtime_error( "Invalid DWARF unit length" );
+        }
+        
+        unit->end     = cursor._position + length;
+        unit->version = cursor.read< uint16_t >();
+        
+        if( unit->version < 2 || unit->version > 5 )
+        {
+            throw std::runtime_error( "Unsupported DWARF version: " + std::to_string( unit->version ) );
+        }
+        
+        if( unit->version >= 5 )
+        {
+            uint8_t type( cursor.read< uint8_t >() );
+            
+            unit->addressSize = cursor.read< uint8_t >();
+            abbreviations     = cursor.offset( unit->dwarf64 );
+            
+            /* Skeleton and split units carry an ID, type units a signature and a type offset */
+            if( type == 0x04 || type == 0x05 )
+            {
+                cursor.skip( 8 );
+            }
+            else if( type == 0x02 || type == 0x06 )
+            {
+                cursor.skip( 8 );
+                cursor.offset( unit->dwarf64 );
+            }
+        }
+        else
+        {
+            abbreviations     = cursor.offset( unit->dwarf64 );
+            unit->addressSize = cursor.read< uint8_t >();
+        }
+        
+        if( unit->addressSize == 0 || unit->addressSize > 8 )
+        {
+            throw std::runtime_error( "Invalid DWARF address size" );
+        }
+        
+        unit->dies = cursor._position;
+        
+        {
+            Cursor abbrev( this->_sections[ Abbrev ], abbreviations, this->_bigEndian );
+            
+            while( ( code = abbrev.uleb() ) != 0 )
+            {
+                Abbreviation abbreviation { abbrev.uleb(), abbrev.read< uint8_t >() != 0, {} };
+                
+                while( true )
+                {
+                    Attribute attribute { abbrev.uleb(), abbrev.uleb(), 0 };
+                    
+                    if( attribute.name == 0 && attribute.form == 0 )
+                    {
+                        break;
+                    }
+                    
+                    if( attribute.form == 0x21 )
+                    {
+                        attribute.implicit = abbrev.sleb();
+                    }
+                    
+                    abbreviation.attributes.push_back( attribute );
+                }
+                
+                if( code > 0xFFFFF )
+                {
+                    throw std::runtime_error( "Invalid DWARF abbreviation code" );
+                }
+                
+                if( code >= unit->abbreviations.size() )
+                {
+                    unit->abbreviations.resize( code + 1, { 0, false, {} } );
+                }
+                
+                unit->abbreviations[ code ] = std::move( abbreviation );
+            }
+        }
+        
+        code = cursor.uleb();
+        
+        if( code == 0 || code >= unit->abbreviations.size() || unit->abbreviations[ code ].tag == 0 )
+        {
+            return unit;
+        }
+        
+        /* Attributes of the unit DIE may use the bases it defines, so they are resolved after reading it */
+        for( const auto & attribute: unit->abbreviations[ code ].attributes )
+        {
+            values.emplace_back( attribute.name, this->readValue( cursor, attribute.form, attribute.implicit, *( unit ) ) );
+        }
+        
+        for( const auto & value: values )
+        {
+            switch( value.first )
+            {
+                case 0x72:            unit->strOffsetsBase = value.second.data; break;
+                case 0x73: case 0x2133: unit->addrBase     = value.second.data; break;
+                case 0x74:            unit->rnglistsBase   = value.second.data; break;
+                case 0x10:            unit->lines          = value.second.data; break;
+                case 0x11:            low                  = value.second;      break;
+                case 0x12:            high                 = value.second;      break;
+                case 0x55:            ranges               = value.second;      break;
+                default:                                                        break;
+            }
+        }
+        
+        for( const auto & value: values )
+        {
+            if( value.first == 0x1B )
+            {
+                unit->directory = this->string( value.second, *( unit ) );
+            }
+        }
+        
+        if( low.has_value() )
+        {
+            unit->base = this->address( *( low ), *( unit ) );
+        }
+        
+        if( ranges.has_value() )
+        {
+            unit->ranges = this->readRanges( *( ranges ), *( unit ), unit->base );
+        }
+        else if( low.has_value() && high.has_value() )
+        {
+            uint64_t end( this->address( *( high ), *( unit ) ) );
+            
+            unit->ranges.emplace_back( unit->base, ( high->form == 0x01 || high->form == 0x1B || ( high->form >= 0x29 && high->form <= 0x2C ) ) ? end : unit->base + end );
+        }
+        
+        unit->ranges.erase
+        (
+            std::remove_if( unit->ranges.begin(), unit->ranges.end(), []( const std::pair< uint64_t, uint64_t > & r ) { return r.first >= r.second; } ),
+            unit->ranges.end()
+        );
+        
+        return unit;
+    }
+    
+    void DebugInfo::IMPL::load( Unit & unit ) const
+    {
+        Cursor                cursor( this->_sections[ Info ], unit.dies, this->_bigEndian );
+        std::vector< size_t > parents;
+        
+        /* Only subprograms and inlined subroutines are kept, along with the names they refer to */
+        while( cursor._position < unit.end )
+        {
+            uint64_t                                       die( cursor._position );
+            uint64_t                                       code( cursor.uleb() );
+            bool                                           function;
+            bool                                           named( false );
+            Name                                           name { {}, {}, 0 };
+            std::optional< Value >                         low;
+            std::optional< Value >                         high;
+            std::optional< Value >                         ranges;
+            Function                                       record { {}, die, {}, 0, 0, 0 };
+            size_t                                         parent( ( parents.size() > 0 ) ? parents.back() : NoFunction );
+            
+            if( code == 0 )
+            {
+                if( parents.size() > 0 )
+                {
+                    parents.pop_back();
+                }
+                
+                continue;
+            }
+            
+            if( code >= unit.abbreviations.size() || unit.abbreviations[ code ].tag == 0 )
+            {
+                throw std::runtime_error( "Invalid DWARF abbreviation code" );
+            }
+            
+            {
+                const Abbreviation & abbreviation( unit.abbreviations[ code ] );
+                
+                function = abbreviation.tag == 0x2E || abbreviation.tag == 0x1D;
+                
+                for( const auto & attribute: abbreviation.attributes )
+                {
+                    Value value( this->readValue( cursor, attribute.form, attribute.implicit, unit ) );
+                    
+                    switch( attribute.name )
+                    {
+                        case 0x03:             name.name      = this->string( value, unit );    named = true; break;
+                        case 0x6E: case 0x2007: name.linkage  = this->string( value, unit );    named = true; break;
+                        case 0x31: case 0x47:  name.reference = this->reference( value, unit ); named = true; break;
+                        case 0x11:             low            = value;                                        break;
+                        case 0x12:             high           = value;                                        break;
+                        case 0x55:             ranges         = value;                                        break;
+                        case 0x58:             record.callFile   = static_cast< uint32_t >( value.data );    break;
+                        case 0x59:             record.callLine   = static_cast< uint32_t >( value.data );    break;
+                        case 0x57:             record.callColumn = static_cast< uint32_t >( value.data );    break;
+                        default:                                                                              break;
+                    }
+                }
+                
+                if( named )
+                {
+                    unit.names[ die ] = name;
+                }
+                
+                if( function )
+                {
+                    if( ranges.has_value() )
+                    {
+                        record.ranges = this->readRanges( *( ranges ), unit, unit.base );
+                    }
+                    else if( low.has_value() && high.has_value() )
+                    {
+                        uint64_t begin( this->address( *( low ), unit ) );
+                        uint64_t end(   this->address( *( high ), unit ) );
+                        
+                        record.ranges.emplace_back( begin, ( high->form == 0x01 || high->form == 0x1B || ( high->form >= 0x29 && high->form <= 0x2C ) ) ? end : begin + end );
+                    }
+                    
+                    record.ranges.erase
+                    (
+                        std::remove_if( record.ranges.begin(), record.ranges.end(), []( const std::pair< uint64_t, uint64_t > & r ) { return r.first >= r.second; } ),
+                        record.ranges.end()
+                    );
+                    
+                    /* Abstract instances and declarations have no code, and are only kept as names */
+                    if( record.ranges.size() > 0 )
+                    {
+                        if( parent != NoFunction )
+                        {
+                            unit.functions[ parent ].children.push_back( unit.functions.size() );
+                        }
+                        
+                        parent = unit.functions.size();
+                        
+                        unit.functions.push_back( std::move( record ) );
+                    }
+                }
+                
+                if( abbreviation.children )
+                {
+                    parents.push_back( parent );
+                }
+            }
+        }
+        
+        for( size_t i = 0; i < unit.functions.size(); i++ )
+        {
+            for( const auto & range: unit.functions[ i ].ranges )
+            {
+                unit.spans.push_back( { range.first, range.second, i } );
+            }
+        }
+        
+        /* Nested functions are reached from their parents, so the spans only need the outermost ones */
+        {
+            std::vector< bool > nested( unit.functions.size(), false );
+            
+            for( const auto & function: unit.functions )
+            {
+                for( size_t child: function.children )
+                {
+                    nested[ child ] = true;
+                }
+            }
+            
+            unit.spans.erase
+            (
+                std::remove_if( unit.spans.begin(), unit.spans.end(), [ & ]( const Span & s ) { return nested[ s.index ]; } ),
+                unit.spans.end()
+            );
+        }
+        
+        std::sort
+        (
+            unit.spans.begin(),
+            unit.spans.end(),
+            []( const Span & s1, const Span & s2 )
+            {
+                return s1.begin < s2.begin;
+            }
+        );
+        
+        this->readLines( unit );
+    }
+    
+    void DebugInfo::IMPL::readLines( Unit & unit ) const
+    {
+        const MappedFile                 & data( this->_sections[ Line ] );
+        std::vector< std::string >         directories;
+        std::vector< std::vector< Row > >  sequences;
+        std::vector< Row >                 sequence;
+        std::vector< uint8_t >             lengths;
+        Row                                row { 0, 1, 1, 0, false };
+        uint64_t                           length;
+        bool                               dwarf64;
+        uint16_t                           version;
+        size_t                             end;
+        size_t                             program;
+        uint8_t                            minimumLength;
+        int8_t                             lineBase;
+        uint8_t                            lineRange;
+        uint8_t                            opcodeBase;
+        
+        if( unit.lines.has_value() == false )
+        {
+            return;
+        }
+        
+        Cursor cursor( data, *( unit.lines ), this->_bigEndian );
+        
+        length  = cursor.read< uint32_t >();
+        dwarf64 = length == 0xFFFFFFFF;
+        
+        if( dwarf64 )
+        {
+            length = cursor.read< uint64_t >();
+        }
+        
+        if( length > data.size() - cursor._position )
+        {
+            throw std::runtime_error( "Invalid DWARF line table length" );
+        }
+        
+        end     = cursor._position + length;
+        version = cursor.read< uint16_t >();
+        
+        if( version < 2 || version > 5 )
+        {
+            throw std::runtime_error( "Unsupported DWARF line table version: " + std::to_string( version ) );
+        }
+        
+        if( version >= 5 )
+        {
+            cursor.skip( 2 );
+        }
+        
+        program       = cursor.offset( dwarf64 );
+        program      += cursor._position;
+        minimumLength = cursor.read< uint8_t >();
+        
+        if( version >= 4 )
+        {
+            cursor.read< uint8_t >();
+        }
+        
+        cursor.read< uint8_t >();
+        
+        lineBase   = cursor.read< int8_t >();
+        lineRange  = cursor.read< uint8_t >();
+        opcodeBase = cursor.read< uint8_t >();
+        
+        if( lineRange == 0 || opcodeBase == 0 )
+        {
+            throw std::runtime_error( "Invalid DWARF line table header" );
+        }
+        
+        lengths.push_back( 0 );
+        
+        for( uint8_t i = 1; i < opcodeBase; i++ )
+        {
+            lengths.push_back( cursor.read< uint8_t >() );
+        }
+        
+        if( version < 5 )
+        {
+            /* Directory and file indexes are one-based, zero being the compilation directory */
+            std::string_view name;
+            
+            directories.push_back( std::string( unit.directory ) );
+            unit.files.push_back( "" );
+            
+            while( ( name = cursor.string() ).size() > 0 )
+            {
+                directories.push_back( Join( unit.directory, name ) );
+            }
+            
+            while( ( name = cursor.string() ).size() > 0 )
+            {
+                uint64_t directory( cursor.uleb() );
+                
+                cursor.uleb();
+                cursor.uleb();
+                unit.files.push_back( Join( ( directory < directories.size() ) ? directories[ directory ] : "", name ) );
+            }
+        }
+        else
+        {
+            /* Entries are described by (content, form) pairs, and directory zero is the compilation directory */
+            for( int list = 0; list < 2; list++ )
+            {
+                std::vector< std::pair< uint64_t, uint64_t > > formats;
+                uint8_t                                        count( cursor.read< uint8_t >() );
+                uint64_t                                       entries;
+                
+                for( uint8_t i = 0; i < count; i++ )
+                {
+                    uint64_t content( cursor.uleb() );
+                    
+                    formats.emplace_back( content, cursor.uleb() );
+                }
+                
+                entries = cursor.uleb();
+                
+                for( uint64_t i = 0; i < entries; i++ )
+                {
+                    std::string_view path;
+                    uint64_t         directory( 0 );
+                    
+                    for( const auto & format: formats )
+                    {
+                        Value value( this->readValue( cursor, format.second, 0, unit ) );
+                        
+                        if( format.first == 0x01 )
+                        {
+                            path = this->string( value, unit );
+                        }
+                        else if( format.first == 0x02 )
+                        {
+                            directory = value.data;
+                        }
+                    }
+                    
+                    if( list == 0 )
+                    {
+                        directories.push_back( Join( unit.directory, path ) );
+                    }
+                    else
+                    {
+                        unit.files.push_back( Join( ( directory < directories.size() ) ? directories[ directory ] : "", path ) );
+                    }
+                }
+            }
+        }
+        
+        cursor._position = program;
+        
+        while( cursor._position < end )
+        {
+            uint8_t opcode( cursor.read< uint8_t >() );
+            
+            if( opcode >= opcodeBase )
+            {
+                uint8_t adjusted( static_cast< uint8_t >( opcode - opcodeBase ) );
+                
+                row.address += static_cast< uint64_t >( adjusted / lineRange ) * minimumLength;
+                row.line    += static_cast< uint32_t >( lineBase + static_cast< int >( adjusted % lineRange ) );
+                
+                sequence.push_back( row );
+            }
+            else if( opcode == 0 )
+            {
+                uint64_t size( cursor.uleb() );
+                size_t   next( cursor._position + size );
+                uint8_t  extended( ( size > 0 ) ? cursor.read< uint8_t >() : 0 );
+                
+                if( extended == 0x01 )
+                {
+                    row.end = true;
+                    
+                    sequence.push_back( row );
+                    sequences.push_back( std::move( sequence ) );
+                    
+                    sequence = {};
+                    row      = { 0, 1, 1, 0, false };
+                }
+                else if( extended == 0x02 && size > 1 && size <= 9 )
+                {
+                    row.address = cursor.read( size - 1 );
+                }
+                else if( extended == 0x03 )
+                {
+                    std::string_view name( cursor.string() );
+                    uint64_t         directory( cursor.uleb() );
+                    
+                    unit.files.push_back( Join( ( directory < directories.size() ) ? directories[ directory ] : "", name ) );
+                }
+                
+                cursor._position = next;
+            }
+            else
+            {
+                switch( opcode )
+                {
+                    case 0x01: sequence.push_back( row );                                                                                 break;
+                    case 0x02: row.address += cursor.uleb() * minimumLength;                                                              break;
+                    case 0x03: row.line    += static_cast< uint32_t >( cursor.sleb() );                                                   break;
+                    case 0x04: row.file     = static_cast< uint32_t >( cursor.uleb() );                                                   break;
+                    case 0x05: row.column   = static_cast< uint32_t >( cursor.uleb() );                                                   break;
+                    case 0x08: row.address += static_cast< uint64_t >( ( 255 - opcodeBase ) / lineRange ) * minimumLength;                break;
+                    case 0x09: row.address += cursor.read< uint16_t >();                                                                  break;
+                    case 0x06: case 0x07: case 0x0A: case 0x0B:                                                                           break;
+                    
+                    default:
+                        
+                        for( uint8_t i = 0; i < lengths[ opcode ]; i++ )
+                        {
+                            cursor.uleb();
+                        }
+                        
+                        break;
+                }
+            }
+        }
+        
+        /* Sequences do not overlap, so once ordered they form a single sorted table */
+        std::sort
+        (
+            sequences.begin(),
+            sequences.end(),
+            []( const std::vector< Row > & s1, const std::vector< Row > & s2 )
+            {
+                return s1.front().address < s2.front().address;
+            }
+        );
+        
+        for( const auto & s: sequences )
+        {
+            unit.rows.insert( unit.rows.end(), s.begin(), s.end() );
+        }
+    }
+    
+    DebugInfo::IMPL::Value DebugInfo::IMPL::readValue( Cursor & cursor, uint64_t form, int64_t implicit, const Unit & unit ) const
+    {
+        Value value { form, 0, {} };
+        
+        switch( form )
+        {
+            case 0x01:                                                         value.data   = cursor.read( unit.addressSize );       break;
+            case 0x03:                                                         cursor.skip( cursor.read< uint16_t >() );             break;
+            case 0x04:                                                         cursor.skip( cursor.read< uint32_t >() );             break;
+            case 0x09: case 0x18:                                              cursor.skip( cursor.uleb() );                         break;
+            case 0x0A:                                                         cursor.skip( cursor.read< uint8_t >() );              break;
+            case 0x08:                                                         value.string = cursor.string();                       break;
+            case 0x0D:                                                         value.data   = static_cast< uint64_t >( cursor.sleb() ); break;
+            case 0x0B: case 0x0C: case 0x11: case 0x25: case 0x29:             value.data   = cursor.read< uint8_t >();              break;
+            case 0x05: case 0x12: case 0x26: case 0x2A:                        value.data   = cursor.read< uint16_t >();             break;
+            case 0x27: case 0x2B:                                              value.data   = cursor.read( 3 );                      break;
+            case 0x06: case 0x13: case 0x1C: case 0x28: case 0x2C:             value.data   = cursor.read< uint32_t >();             break;
+            case 0x07: case 0x14: case 0x20: case 0x24:                        value.data   = cursor.read< uint64_t >();             break;
+            case 0x0E: case 0x17: case 0x1D: case 0x1F: case 0x1F20: case 0x1F21: value.data = cursor.offset( unit.dwarf64 );         break;
+            case 0x0F: case 0x15: case 0x1A: case 0x1B: case 0x22: case 0x23: case 0x1F01: case 0x1F02: value.data = cursor.uleb();   break;
+            case 0x10:                                                         value.data   = ( unit.version <= 2 ) ? cursor.read( unit.addressSize ) : cursor.offset( unit.dwarf64 ); break;
+            case 0x19:                                                         value.data   = 1;                                     break;
+            case 0x1E:                                                         cursor.skip( 16 );                                    break;
+            case 0x21:                                                         value.data   = static_cast< uint64_t >( implicit );   break;
+            case 0x16:                                                         return this->readValue( cursor, cursor.uleb(), implicit, unit );
+            
+            default: throw std::runtime_error( "Unsupported DWARF form: " + std::to_string( form ) );
+        }
+        
+        return value;
+    }
+    
+    std::string_view DebugInfo::IMPL::string( const Value & value, const Unit & unit ) const
+    {
+        switch( value.form )
+        {
+            case 0x08: return value.string;
+            case 0x0E: return this->_sections[ Str ].cString( value.data );
+            case 0x1F: return this->_sections[ LineStr ].cString( value.data );
+            
+            case 0x1A: case 0x25: case 0x26: case 0x27: case 0x28: case 0x1F02:
+            {
+                size_t size( ( unit.dwarf64 ) ? 8 : 4 );
+                Cursor cursor( this->_sections[ StrOffsets ], unit.strOffsetsBase + value.data * size, this->_bigEndian );
+                
+                return this->_sections[ Str ].cString( cursor.read( size ) );
+            }
+            
+            default: return {};
+        }
+    }
+    
+    uint64_t DebugInfo::IMPL::address( const Value & value, const Unit & unit ) const
+    {
+        if( value.form == 0x1B || value.form == 0x1F01 || ( value.form >= 0x29 && value.form <= 0x2C ) )
+        {
+            Cursor cursor( this->_sections[ Addr ], unit.addrBase + value.data * unit.addressSize, this->_bigEndian );
+            
+            return cursor.read( unit.addressSize );
+        }
+        
+        return value.data;
+    }
+    
+    uint64_t DebugInfo::IMPL::reference( const Value & value, const Unit & unit ) const
+    {
+        if( value.form >= 0x11 && value.form <= 0x15 )
+        {
+            return unit.offset + value.data;
+        }
+        
+        return ( value.form == 0x10 ) ? value.data : 0;
+    }
+    
+    std::vector< std::pair< uint64_t, uint64_t > > DebugInfo::IMPL::readRanges( const Value & value, const Unit & unit, uint64_t base ) const
+    {
+        std::vector< std::pair< uint64_t, uint64_t > > ranges;
+        uint64_t                                       largest( ( unit.addressSize == 8 ) ? std::numeric_limits< uint64_t >::max() : ( static_cast< uint64_t >( 1 ) << ( unit.addressSize * 8 ) ) - 1 );
+        
+        if( unit.version < 5 )
+        {
+            Cursor cursor( this->_sections[ Ranges ], value.data, this->_bigEndian );
+            
+            while( true )
+            {
+                uint64_t begin( cursor.read( unit.addressSize ) );
+                uint64_t end(   cursor.read( unit.addressSize ) );
+                
+                if( begin == 0 && end == 0 )
+                {
+                    break;
+                }
+                
+                if( begin == largest )
+                {
+                    base = end;
+                }
+                else
+                {
+                    ranges.emplace_back( base + begin, base + end );
+                }
+            }
+        }
+        else
+        {
+            size_t offset( value.data );
+            
+            /* Indexed lists are relative to DW_AT_rnglists_base, through its offsets table */
+            if( value.form == 0x23 )
+            {
+                size_t size( ( unit.dwarf64 ) ? 8 : 4 );
+                Cursor table( this->_sections[ RngLists ], unit.rnglistsBase + value.data * size, this->_bigEndian );
+                
+                offset = unit.rnglistsBase + table.read( size );
+            }
+            
+            {
+                Cursor cursor( this->_sections[ RngLists ], offset, this->_bigEndian );
+                
+                while( true )
+                {
+                    uint8_t kind( cursor.read< uint8_t >() );
+                    Value   index { 0x1B, 0, {} };
+                    
+                    if( kind == 0x00 )
+                    {
+                        break;
+                    }
+                    
+                    switch( kind )
+                    {
+                        case 0x01:
+                            
+                            index.data = cursor.uleb();
+                            base       = this->address( index, unit );
+                            
+                            break;
+                        
+                        case 0x02:
+                        case 0x03:
+                        {
+                            uint64_t begin;
+                            
+                            index.data = cursor.uleb();
+                            begin      = this->address( index, unit );
+                            
+                            if( kind == 0x02 )
+                            {
+                                index.data = cursor.uleb();
+                                
+                                ranges.emplace_back( begin, this->address( index, unit ) );
+                            }
+                            else
+                            {
+                                ranges.emplace_back( begin, begin + cursor.uleb() );
+                            }
+                            
+                            break;
+                        }
+                        
+                        case 0x04:
+                        {
+                            uint64_t begin( cursor.uleb() );
+                            
+                            ranges.emplace_back( base + begin, base + cursor.uleb() );
+                            
+                            break;
+                        }
+                        
+                        case 0x05: base = cursor.read( unit.addressSize ); break;
+                        
+                        case 0x06:
+                        {
+                            uint64_t begin( cursor.read( unit.addressSize ) );
+                            
+                            ranges.emplace_back( begin, cursor.read( unit.addressSize ) );
+                            
+                            break;
+                        }
+                        
+                        case 0x07:
+                        {
+                            uint64_t begin( cursor.read( unit.addressSize ) );
+                            
+                            ranges.emplace_back( begin, begin + cursor.uleb() );
+                            
+                            break;
+                        }
+                        
+                        default: throw std::runtime_error( "Invalid DWARF range list entry" );
+                    }
+                }
+            }
+        }
+        
+        return ranges;
+    }
+    
+    std::string DebugInfo::IMPL::name( uint64_t die, unsigned int depth ) const
+    {
+        auto         it( std::upper_bound( this->_units.begin(), this->_units.end(), die ) );
+        const Unit * unit;
+        
+        if( it == this->_units.begin() || ( unit = this->unit( static_cast< size_t >( it - this->_units.begin() ) - 1 ) ) == nullptr )
+        {
+            return {};
+        }
+        
+        {
+            auto name( unit->names.find( die ) );
+            
+            if( name == unit->names.end() )
+            {
+                return {};
+            }
+            
+            /* Mangled names are preferred, like symbol names, and concrete instances name their origin */
+            if( name->second.linkage.size() > 0 )
+            {
+                return std::string( name->second.linkage );
+            }
+            
+            if( name->second.name.size() > 0 )
+            {
+                return std::string( name->second.name );
+            }
+            
+            if( name->second.reference != 0 && depth < 8 )
+            {
+                return this->name( name->second.reference, depth + 1 );
+            }
+        }
+        
+        return {};
+    }
+    
+    DebugInfo::Location DebugInfo::IMPL::locate( uint64_t address ) const
+    {
+        Location              location { address, {} };
+        std::vector< size_t > chain;
+        const Row           * row( nullptr );
+        const Unit          * unit( nullptr );
+        auto                  span( std::upper_bound( this->_spans.begin(), this->_spans.end(), address, []( uint64_t a, const Span & s ) { return a < s.begin; } ) );
+        
+        /* Unit ranges may be interleaved, so a few preceding spans are checked for one containing the address */
+        for( size_t i = 0; i < 16 && span != this->_spans.begin(); i++ )
+        {
+            span--;
+            
+            if( address < span->end )
+            {
+                unit = this->unit( span->index );
+                
+                break;
+            }
+        }
+        
+        if( unit == nullptr )
+        {
+            return location;
+        }
+        
+        {
+            auto it( std::upper_bound( unit->rows.begin(), unit->rows.end(), address, []( uint64_t a, const Row & r ) { return a < r.address; } ) );
+            
+            if( it != unit->rows.begin() && ( it - 1 )->end == false )
+            {
+                row = &( *( it - 1 ) );
+            }
+        }
+        
+        {
+            auto it( std::upper_bound( unit->spans.begin(), unit->spans.end(), address, []( uint64_t a, const Span & s ) { return a < s.begin; } ) );
+            
+            if( it != unit->spans.begin() && address < ( it - 1 )->end )
+            {
+                chain.push_back( ( it - 1 )->index );
+            }
+            
+            /* Inlined subroutines are nested in the function they were inlined into */
+            while( chain.size() > 0 && chain.size() < 256 )
+            {
+                size_t next( NoFunction );
+                
+                for( size_t child: unit->functions[ chain.back() ].children )
+                {
+                    for( const auto & range: unit->functions[ child ].ranges )
+                    {
+                        if( address >= range.first && address < range.second )
+                        {
+                            next = child;
+                        }
+                    }
+                }
+                
+                if( next == NoFunction )
+                {
+                    break;
+                }
+                
+                chain.push_back( next );
+            }
+        }
+        
+        if( chain.size() == 0 && row == nullptr )
+        {
+            return location;
+        }
+        
+        {
+            auto file
+            (
+                [ & ]( uint32_t index )
+                {
+                    return ( index < unit->files.size() ) ? unit->files[ index ] : std::string();
+                }
+            );
+            
+            location.frames.push_back
+            (
+                {
+                    ( chain.size() > 0 ) ? this->name( unit->functions[ chain.back() ].die, 0 ) : std::string(),
+                    ( row != nullptr ) ? file( row->file ) : std::string(),
+                    ( row != nullptr ) ? row->line   : 0,
+                    ( row != nullptr ) ? row->column : 0
+                }
+            );
+            
+            /* Each inlined subroutine gives the call site in the function it was inlined into */
+            for( size_t i = chain.size(); i > 1; i-- )
+            {
+                const Function & inlined( unit->functions[ chain[ i - 1 ] ] );
+                
+                location.frames.push_back( { this->name( unit->functions[ chain[ i - 2 ] ].die, 0 ), file( inlined.callFile ), inlined.callLine, inlined.callColumn } );
+            }
+        }
+        
+        return location;
+    }
+    
+    std::string DebugInfo::IMPL::Join( std::string_view directory, std::string_view name )
+    {
+        if( name.size() > 0 && name[ 0 ] == '/' )
+        {
+            return std::string( name );
+        }
+        
+        if( directory.size() == 0 )
+        {
+            return std::string( name );
+        }
+        
+        return std::string( directory ) + ( ( directory.back() == '/' ) ? "" : "/" ) + std::string( name );
+    }
+    
+    DebugInfo::IMPL::Cursor::Cursor( const MappedFile & data, size_t position, bool bigEndian ):
+        _data(      data ),
+        _position(  position ),
+        _bigEndian( bigEndian )
+    {}
+    
+    uint64_t DebugInfo::IMPL::Cursor::read( size_t size )
+    {
+        const uint8_t * p( this->_data.pointer( this->_position, size ) );
+        uint64_t        value( 0 );
+        
+        for( size_t i = 0; i < size; i++ )
+        {
+            value |= static_cast< uint64_t >( p[ ( this->_bigEndian ) ? size - i - 1 : i ] ) << ( i * 8 );
+        }
+        
+        this->_position += size;
+        
+        return value;
+    }
+    
+    uint64_t DebugInfo::IMPL::Cursor::uleb()
+    {
+        uint64_t     value( 0 );
+        unsigned int shift( 0 );
+        uint8_t      byte;
+        
+        do
+        {
+            byte   = this->read< uint8_t >();
+            value |= ( shift < 64 ) ? static_cast< uint64_t >( byte & 0x7F ) << shift : 0;
+            shift += 7;
+        }
+        while( ( byte & 0x80 ) != 0 );
+        
+        return value;
+    }
+    
+    int64_t DebugInfo::IMPL::Cursor::sleb()
+    {
+        uint64_t     value( 0 );
+        unsigned int shift( 0 );
+        uint8_t      byte;
+        
+        do
+        {
+            byte   = this->read< uint8_t >();
+            value |= ( shift < 64 ) ? static_cast< uint64_t >( byte & 0x7F ) << shift : 0;
+            shift += 7;
+        }
+        while( ( byte & 0x80 ) != 0 );
+        
+        if( shift < 64 && ( byte & 0x40 ) != 0 )
+        {
+            value |= std::numeric_limits< uint64_t >::max() << shift;
+        }
+        
+        return static_cast< int64_t >( value );
+    }
+    
+    uint64_t DebugInfo::IMPL::Cursor::offset( bool dwarf64 )
+    {
+        return ( dwarf64 ) ? this->read< uint64_t >() : this->read< uint32_t >();
+    }
+    
+    std::string_view DebugInfo::IMPL::Cursor::string()
+    {
+        std::string_view string( this->_data.cString( this->_position ) );
+        
+        if( this->_position + string.size() >= this->_data.size() )
+        {
+            throw std::runtime_error( "Unterminated DWARF string" );
+        }
+        
+        this->_position += string.size() + 1;
+        
+        return string;
+    }
+    
+    void DebugInfo::IMPL::Cursor::skip( uint64_t size )
+    {
+        if( size > this->_data.size() - std::min( this->_position, this->_data.size() ) )
+        {
+            throw std::runtime_error( "Invalid DWARF data size" );
+        }
+        
+        this->_position += size;
+    }
+}
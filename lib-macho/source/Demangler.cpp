@@ -0,0 +1,5870 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Demangler.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/Demangler.hpp>
+#include <MachO/Parallel.hpp>
+#include <array>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+
+namespace MachO
+{
+    class Demangler::IMPL
+    {
+        public:
+            
+            static constexpr size_t ShardCount = 64;
+            
+            /* Lookups only lock the shard owning a name, so workers rarely contend */
+            struct Shard
+            {
+                std::mutex                                     mutex;
+                std::unordered_map< std::string, std::string > names;
+            };
+            
+            /*
+             * Itanium C++ ABI names, printed like the LLVM demangler. Names are parsed into a node
+             * tree first, as substitutions and template parameters refer back to earlier nodes.
+             */
+            class ItaniumParser
+            {
+                public:
+                    
+                    static constexpr unsigned Unbounded = std::numeric_limits< unsigned >::max();
+                    static constexpr unsigned MaxDepth  = 256;
+                    static constexpr size_t   MaxLength = 0x10000;
+                    
+                    enum class Kind
+                    {
+                        Name,
+                        Nested,
+                        Template,
+                        Std,
+                        Special,
+                        CtorDtor,
+                        AbiTag,
+                        Conversion,
+                        LiteralOperator,
+                        Local,
+                        Encoding,
+                        SpecialName,
+                        CtorVtable,
+                        DotSuffix,
+                        Qualified,
+                        VendorQualified,
+                        PostfixQualified,
+                        Pointer,
+                        Reference,
+                        Member,
+                        Function,
+                        DynamicException,
+                        Array,
+                        Vector,
+                        TemplateArgs,
+                        ArgumentPack,
+                        ParameterPack,
+                        PackExpansion,
+                        Closure,
+                        Unnamed,
+                        Elaborated,
+                        Forward,
+                        Binary,
+                        Prefix,
+                        Postfix,
+                        Subscript,
+                        Access,
+                        Conditional,
+                        Cast,
+                        Call,
+                        ConversionExpression,
+                        Enclosing,
+                        FunctionParam,
+                        Integer,
+                        Bool,
+                        EnumLiteral,
+                        SizeofPack
+                    };
+                    
+                    enum Qualifiers: unsigned
+                    {
+                        QualifierNone     = 0,
+                        QualifierConst    = 1,
+                        QualifierVolatile = 2,
+                        QualifierRestrict = 4
+                    };
+                    
+                    enum References: unsigned
+                    {
+                        ReferenceNone   = 0,
+                        ReferenceLValue = 1,
+                        ReferenceRValue = 2
+                    };
+                    
+                    enum class OperatorKind
+                    {
+                        Binary,
+                        Prefix,
+                        Postfix,
+                        Array,
+                        Member,
+                        Call,
+                        Conditional,
+                        New,
+                        Delete
+                    };
+                    
+                    struct Operator
+                    {
+                        const char       * code;
+                        std::string_view   name;
+                        std::string_view   symbol;
+                        OperatorKind       kind;
+                    };
+                    
+                    struct Node
+                    {
+                        Kind                  kind;
+                        std::string_view      text;
+                        std::string_view      extra;
+                        Node                * first;
+                        Node                * second;
+                        std::vector< Node * > nodes;
+                        unsigned              qualifiers;
+                        unsigned              reference;
+                        bool                  flag;
+                    };
+                    
+                    /* Pack expansions print their pattern once per element of the pack they contain */
+                    struct Output
+                    {
+                        std::string text;
+                        unsigned    packIndex;
+                        unsigned    packMax;
+                        unsigned    depth;
+                        bool        overflow;
+                    };
+                    
+                    struct State
+                    {
+                        unsigned qualifiers;
+                        unsigned reference;
+                        bool     ctorDtorConversion;
+                        bool     endsWithTemplateArgs;
+                        size_t   forwardReferences;
+                    };
+                    
+                    class Guard
+                    {
+                        public:
+                            
+                            Guard( unsigned & depth ): _depth( ++depth )
+                            {}
+                            
+                            ~Guard()
+                            {
+                                this->_depth--;
+                            }
+                            
+                            unsigned & _depth;
+                    };
+                    
+                    ItaniumParser( std::string_view name );
+                    
+                    std::optional< std::string > demangle();
+                    
+                    char look( size_t offset = 0 )     const;
+                    bool consume( char c );
+                    bool consume( std::string_view s );
+                    bool atEnd()                       const;
+                    bool atEndOfEncoding()             const;
+                    
+                    Node * make( Kind kind, Node * first = nullptr, Node * second = nullptr, std::string_view text = {} );
+                    
+                    std::string_view number( bool negative = false );
+                    bool             positive( size_t & value );
+                    bool             seqID( size_t & value );
+                    bool             callOffset();
+                    void             discriminator();
+                    unsigned         cvQualifiers();
+                    std::string_view bareSourceName();
+                    
+                    Node * parse();
+                    Node * encoding();
+                    Node * specialName();
+                    Node * name( State * state );
+                    Node * unscopedName( State * state, bool & substitution );
+                    Node * unqualifiedName( State * state );
+                    Node * sourceName();
+                    Node * unnamedTypeName();
+                    Node * operatorName( State * state );
+                    Node * ctorDtorName( Node * & soFar, State * state );
+                    Node * nestedName( State * state );
+                    Node * localName( State * state );
+                    Node * abiTags( Node * node );
+                    Node * substitution();
+                    Node * templateParam();
+                    Node * templateArgs( bool tag = false );
+                    Node * templateArg();
+                    Node * type();
+                    Node * qualifiedType();
+                    Node * functionType();
+                    Node * arrayType();
+                    Node * vectorType();
+                    Node * decltypeType();
+                    Node * classEnumType();
+                    Node * expression();
+                    Node * primary();
+                    Node * integer( std::string_view type );
+                    Node * functionParam();
+                    Node * unresolvedName( bool global );
+                    Node * unresolvedType();
+                    Node * simpleID();
+                    Node * baseUnresolvedName();
+                    bool   resolveForwardReferences( State & state );
+                    
+                    static const Operator * FindOperator( char c1, char c2 );
+                    
+                    static void         Print( const Node * node, Output & out );
+                    static void         PrintLeft( const Node * node, Output & out );
+                    static void         PrintRight( const Node * node, Output & out );
+                    static void         PrintList( const std::vector< Node * > & nodes, Output & out );
+                    static void         PrintQualifiers( unsigned qualifiers, Output & out );
+                    static void         PrintPackExpansion( const Node * node, Output & out );
+                    static bool         Enter( Output & out );
+                    static void         InitializePack( const Node * node, Output & out );
+                    static const Node * Syntax( const Node * node, Output & out );
+                    static bool         HasRHS( const Node * node, Output & out );
+                    static bool         HasArray( const Node * node, Output & out );
+                    static bool         HasFunction( const Node * node, Output & out );
+                    static bool         IsPack( const Node * node, Output & out, unsigned & index );
+                    
+                    static std::string_view                       BaseName( const Node * node );
+                    static std::pair< unsigned, const Node * >    Collapse( const Node * node, Output & out );
+                    
+                    std::string_view      _name;
+                    size_t                _position;
+                    unsigned              _depth;
+                    std::deque< Node >    _nodes;
+                    std::vector< Node * > _substitutions;
+                    std::vector< Node * > _templateParams;
+                    std::vector< Node * > _forwardReferences;
+                    bool                  _tryTemplateArgs;
+                    bool                  _permitForwardReferences;
+                    bool                  _lambdaParams;
+            };
+            
+            /*
+             * Swift 5 names, printed like swift-demangle. The mangling is a postfix stack language,
+             * so operators pop their operands from the node stack. Only the common subset of the
+             * grammar is handled, other names are left mangled.
+             */
+            class SwiftParser
+            {
+                public:
+                    
+                    static constexpr size_t   MaxWords    = 26;
+                    static constexpr size_t   MaxNodes    = 0x4000;
+                    static constexpr size_t   MaxRepeat   = 2048;
+                    static constexpr unsigned MaxDepth    = 512;
+                    static constexpr size_t   MaxLength   = 0x10000;
+                    
+                    enum class Kind
+                    {
+                        Module,
+                        Identifier,
+                        Operator,
+                        LocalName,
+                        PrivateName,
+                        Class,
+                        Structure,
+                        Enum,
+                        Protocol,
+                        TypeAlias,
+                        Extension,
+                        BoundGeneric,
+                        Type,
+                        TypeList,
+                        Tuple,
+                        TupleElement,
+                        EmptyList,
+                        FirstElementMarker,
+                        VariadicMarker,
+                        LabelList,
+                        FunctionType,
+                        Throws,
+                        Async,
+                        Sendable,
+                        Metatype,
+                        ProtocolList,
+                        Builtin,
+                        Prefixed,
+                        GenericParam,
+                        DependentMember,
+                        DependentGenericType,
+                        Signature,
+                        ParamCount,
+                        Requirement,
+                        Function,
+                        Variable,
+                        Subscript,
+                        Accessor,
+                        Allocator,
+                        Constructor,
+                        Deallocator,
+                        Destructor,
+                        Closure,
+                        Initializer,
+                        DefaultArgument,
+                        Static,
+                        Global,
+                        Conformance,
+                        Witness,
+                        Attribute
+                    };
+                    
+                    enum FunctionFlags: uint64_t
+                    {
+                        FunctionThrows   = 1,
+                        FunctionAsync    = 2,
+                        FunctionSendable = 4
+                    };
+                    
+                    struct Node
+                    {
+                        Kind                  kind;
+                        std::string           text;
+                        std::vector< Node * > children;
+                        uint64_t              index;
+                    };
+                    
+                    struct Output
+                    {
+                        std::string text;
+                        unsigned    depth;
+                        bool        overflow;
+                    };
+                    
+                    SwiftParser( std::string_view name );
+                    
+                    std::optional< std::string > demangle();
+                    
+                    char peek()                     const;
+                    char next();
+                    bool next( char c );
+                    bool natural( uint64_t & value );
+                    bool index( uint64_t & value );
+                    
+                    Node * make( Kind kind, std::string text = {} );
+                    Node * make( Kind kind, std::initializer_list< Node * > children );
+                    Node * type( Node * node );
+                    void   push( Node * node );
+                    Node * pop();
+                    Node * pop( Kind kind );
+                    Node * popModule();
+                    Node * popContext();
+                    Node * popDeclName();
+                    Node * popEntity();
+                    Node * popProtocol();
+                    Node * popConformance();
+                    Node * popLabels( Node * type );
+                    
+                    Node * parseOperator();
+                    Node * identifier();
+                    Node * multiSubstitution();
+                    Node * standardSubstitution();
+                    Node * nominal( Kind kind );
+                    Node * boundGeneric();
+                    Node * tuple();
+                    Node * functionType( std::string prefix );
+                    Node * functionEntity();
+                    Node * entity( Kind kind );
+                    Node * accessor( Node * storage );
+                    Node * subscript();
+                    Node * extension();
+                    Node * localName();
+                    Node * operatorName();
+                    Node * protocolList();
+                    Node * genericParam();
+                    Node * signature( bool counts );
+                    Node * requirement();
+                    Node * associatedType();
+                    Node * metadata();
+                    Node * witness();
+                    Node * thunk();
+                    Node * special();
+                    Node * builtin();
+                    
+                    static bool        IsContext( Kind kind );
+                    static bool        IsDeclName( Kind kind );
+                    static std::string ParamName( uint64_t depth, uint64_t index );
+                    
+                    static void Print( const Node * node, Output & out );
+                    static void PrintFunction( const Node * type, const Node * labels, Output & out );
+                    static void PrintParameters( const Node * parameters, const Node * labels, Output & out );
+                    static void PrintList( const std::vector< Node * > & nodes, const char * separator, Output & out );
+                    
+                    std::string_view                _name;
+                    size_t                          _position;
+                    std::deque< Node >              _nodes;
+                    std::vector< Node * >           _stack;
+                    std::vector< Node * >           _substitutions;
+                    std::vector< std::string_view > _words;
+            };
+            
+            IMPL();
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            Shard & shard( const std::string & name ) const;
+            
+            mutable std::array< Shard, ShardCount > _shards;
+    };
+    
+    Demangler::Demangler( void ):
+        impl( std::make_unique< IMPL >() )
+    {}
+    
+    Demangler::Demangler( const Demangler & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    Demangler::Demangler( Demangler && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    Demangler::~Demangler( void )
+    {}
+    
+    Demangler & Demangler::operator =( Demangler o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    size_t Demangler::cacheSize() const
+    {
+        size_t size( 0 );
+        
+        for( auto & shard: this->impl->_shards )
+        {
+            std::lock_guard< std::mutex > lock( shard.mutex );
+            
+            size += shard.names.size();
+        }
+        
+        return size;
+    }
+    
+    std::string Demangler::demangle( const std::string & name ) const
+    {
+        IMPL::Shard & shard( this->impl->shard( name ) );
+        
+        {
+            std::lock_guard< std::mutex > lock( shard.mutex );
+            auto                          it( shard.names.find( name ) );
+            
+            if( it != shard.names.end() )
+            {
+                return it->second;
+            }
+        }
+        
+        {
+            std::string demangled( Demangle( name ).value_or( name ) );
+            
+            {
+                std::lock_guard< std::mutex > lock( shard.mutex );
+                
+                shard.names.emplace( name, demangled );
+            }
+            
+            return demangled;
+        }
+    }
+    
+    std::vector< std::string > Demangler::demangle( const std::vector< std::string > & names ) const
+    {
+        std::vector< std::string > demangled( names.size() );
+        size_t                     chunk( 1024 );
+        
+        Parallel::For
+        (
+            ( names.size() + chunk - 1 ) / chunk,
+            [ & ]( size_t n )
+            {
+                size_t end( std::min( ( n + 1 ) * chunk, names.size() ) );
+                
+                for( size_t i = n * chunk; i < end; i++ )
+                {
+                    demangled[ i ] = this->demangle( names[ i ] );
+                }
+            }
+        );
+        
+        return demangled;
+    }
+    
+    std::optional< std::string > Demangler::Demangle( const std::string & name )
+    {
+        std::string_view view( name );
+        
+        /* Mach-O symbols are C names, prefixed with an underscore */
+        if( view.substr( 0, 2 ) == "_Z" || view.substr( 0, 3 ) == "__Z" || view.substr( 0, 4 ) == "___Z" || view.substr( 0, 5 ) == "____Z" )
+        {
+            return Itanium( name );
+        }
+        
+        if( view.substr( 0, 2 ) == "$s" || view.substr( 0, 3 ) == "_$s" || view.substr( 0, 2 ) == "$S" || view.substr( 0, 3 ) == "_$S" )
+        {
+            return Swift( name );
+        }
+        
+        return {};
+    }
+    
+    std::optional< std::string > Demangler::Itanium( const std::string & name )
+    {
+        return IMPL::ItaniumParser( name ).demangle();
+    }
+    
+    std::optional< std::string > Demangler::Swift( const std::string & name )
+    {
+        std::string_view view( name );
+        
+        if( view.substr( 0, 1 ) == "_" )
+        {
+            view.remove_prefix( 1 );
+        }
+        
+        if( view.substr( 0, 2 ) != "$s" && view.substr( 0, 2 ) != "$S" )
+        {
+            return {};
+        }
+        
+        return IMPL::SwiftParser( view.substr( 2 ) ).demangle();
+    }
+    
+    void swap( Demangler & o1, Demangler & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    Demangler::IMPL::IMPL()
+    {}
+    
+    Demangler::IMPL::IMPL( const IMPL & o )
+    {
+        for( size_t i = 0; i < ShardCount; i++ )
+        {
+            std::lock_guard< std::mutex > lock( o._shards[ i ].mutex );
+            
+            this->_shards[ i ].names = o._shards[ i ].names;
+        }
+    }
+    
+    Demangler::IMPL::~IMPL()
+    {}
+    
+    Demangler::IMPL::Shard & Demangler::IMPL::shard( const std::string & name ) const
+    {
+        return this->_shards[ std::hash< std::string >()( name ) % ShardCount ];
+    }
+    
+    Demangler::IMPL::ItaniumParser::ItaniumParser( std::string_view name ):
+        _name(                    name ),
+        _position(                0 ),
+        _depth(                   0 ),
+        _tryTemplateArgs(         true ),
+        _permitForwardReferences( false ),
+        _lambdaParams(            false )
+    {}
+    
+    std::optional< std::string > Demangler::IMPL::ItaniumParser::demangle()
+    {
+        Node * root( this->parse() );
+        Output out { {}, Unbounded, Unbounded, 0, false };
+        
+        if( root == nullptr || this->_forwardReferences.empty() == false )
+        {
+            return {};
+        }
+        
+        Print( root, out );
+        
+        if( out.overflow )
+        {
+            return {};
+        }
+        
+        return out.text;
+    }
+    
+    char Demangler::IMPL::ItaniumParser::look( size_t offset ) const
+    {
+        return ( this->_position + offset < this->_name.size() ) ? this->_name[ this->_position + offset ] : '\0';
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::consume( char c )
+    {
+        if( this->look() != c || this->atEnd() )
+        {
+            return false;
+        }
+        
+        this->_position++;
+        
+        return true;
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::consume( std::string_view s )
+    {
+        if( this->_name.substr( this->_position, s.size() ) != s )
+        {
+            return false;
+        }
+        
+        this->_position += s.size();
+        
+        return true;
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::atEnd() const
+    {
+        return this->_position >= this->_name.size();
+    }
+    
+    /* Block invocation functions end with _block_invoke, after the encoding */
+    bool Demangler::IMPL::ItaniumParser::atEndOfEncoding() const
+    {
+        return this->atEnd() || this->look() == 'E' || this->look() == '.' || this->look() == '_';
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::make( Kind kind, Node * first, Node * second, std::string_view text )
+    {
+        this->_nodes.push_back( { kind, text, {}, first, second, {}, QualifierNone, ReferenceNone, false } );
+        
+        return &( this->_nodes.back() );
+    }
+    
+    std::string_view Demangler::IMPL::ItaniumParser::number( bool negative )
+    {
+        size_t start( this->_position );
+        
+        if( negative )
+        {
+            this->consume( 'n' );
+        }
+        
+        if( this->look() < '0' || this->look() > '9' )
+        {
+            this->_position = start;
+            
+            return {};
+        }
+        
+        while( this->look() >= '0' && this->look() <= '9' )
+        {
+            this->_position++;
+        }
+        
+        return this->_name.substr( start, this->_position - start );
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::positive( size_t & value )
+    {
+        value = 0;
+        
+        if( this->look() < '0' || this->look() > '9' )
+        {
+            return false;
+        }
+        
+        while( this->look() >= '0' && this->look() <= '9' )
+        {
+            value = value * 10 + static_cast< size_t >( this->look() - '0' );
+            
+            this->_position++;
+            
+            if( value > MaxLength * 16 )
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::seqID( size_t & value )
+    {
+        value = 0;
+        
+        if( ( this->look() < '0' || this->look() > '9' ) && ( this->look() < 'A' || this->look() > 'Z' ) )
+        {
+            return false;
+        }
+        
+        while( true )
+        {
+            char c( this->look() );
+            
+            if( c >= '0' && c <= '9' )
+            {
+                value = value * 36 + static_cast< size_t >( c - '0' );
+            }
+            else if( c >= 'A' && c <= 'Z' )
+            {
+                value = value * 36 + static_cast< size_t >( c - 'A' ) + 10;
+            }
+            else
+            {
+                return true;
+            }
+            
+            this->_position++;
+            
+            if( value > MaxLength * 16 )
+            {
+                return false;
+            }
+        }
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::callOffset()
+    {
+        if( this->consume( 'h' ) )
+        {
+            return this->number( true ).empty() == false && this->consume( '_' );
+        }
+        
+        if( this->consume( 'v' ) )
+        {
+            return this->number( true ).empty() == false && this->consume( '_' ) && this->number( true ).empty() == false && this->consume( '_' );
+        }
+        
+        return false;
+    }
+    
+    /* Discriminators of local entities are not printed */
+    void Demangler::IMPL::ItaniumParser::discriminator()
+    {
+        if( this->look() == '_' )
+        {
+            if( this->look( 1 ) >= '0' && this->look( 1 ) <= '9' )
+            {
+                this->_position += 2;
+            }
+            else if( this->look( 1 ) == '_' )
+            {
+                size_t end( this->_position + 2 );
+                
+                while( end < this->_name.size() && this->_name[ end ] >= '0' && this->_name[ end ] <= '9' )
+                {
+                    end++;
+                }
+                
+                if( end < this->_name.size() && this->_name[ end ] == '_' )
+                {
+                    this->_position = end + 1;
+                }
+            }
+        }
+        else if( this->look() >= '0' && this->look() <= '9' )
+        {
+            size_t end( this->_position );
+            
+            while( end < this->_name.size() && this->_name[ end ] >= '0' && this->_name[ end ] <= '9' )
+            {
+                end++;
+            }
+            
+            if( end == this->_name.size() )
+            {
+                this->_position = end;
+            }
+        }
+    }
+    
+    unsigned Demangler::IMPL::ItaniumParser::cvQualifiers()
+    {
+        unsigned qualifiers( QualifierNone );
+        
+        if( this->consume( 'r' ) ) { qualifiers |= QualifierRestrict; }
+        if( this->consume( 'V' ) ) { qualifiers |= QualifierVolatile; }
+        if( this->consume( 'K' ) ) { qualifiers |= QualifierConst; }
+        
+        return qualifiers;
+    }
+    
+    std::string_view Demangler::IMPL::ItaniumParser::bareSourceName()
+    {
+        size_t length;
+        
+        if( this->positive( length ) == false || length == 0 || length > this->_name.size() - this->_position )
+        {
+            return {};
+        }
+        
+        this->_position += length;
+        
+        return this->_name.substr( this->_position - length, length );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::parse()
+    {
+        if( this->consume( "_Z" ) || this->consume( "__Z" ) )
+        {
+            Node * encoding( this->encoding() );
+            
+            if( encoding == nullptr )
+            {
+                return nullptr;
+            }
+            
+            /* Clone suffixes, e.g. .cold or .constprop.0 */
+            if( this->look() == '.' )
+            {
+                encoding        = this->make( Kind::DotSuffix, encoding, nullptr, this->_name.substr( this->_position ) );
+                this->_position = this->_name.size();
+            }
+            
+            return this->atEnd() ? encoding : nullptr;
+        }
+        
+        if( this->consume( "___Z" ) || this->consume( "____Z" ) )
+        {
+            Node * encoding( this->encoding() );
+            
+            if( encoding == nullptr || this->consume( "_block_invoke" ) == false )
+            {
+                return nullptr;
+            }
+            
+            {
+                bool required( this->consume( '_' ) );
+                
+                if( this->number().empty() && required )
+                {
+                    return nullptr;
+                }
+            }
+            
+            if( this->look() == '.' )
+            {
+                this->_position = this->_name.size();
+            }
+            
+            return this->atEnd() ? this->make( Kind::SpecialName, encoding, nullptr, "invocation function for block in " ) : nullptr;
+        }
+        
+        return nullptr;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::encoding()
+    {
+        Guard  guard( this->_depth );
+        State  state { QualifierNone, ReferenceNone, false, false, this->_forwardReferences.size() };
+        Node * name;
+        Node * result( nullptr );
+        Node * encoding;
+        
+        if( this->_depth > MaxDepth )
+        {
+            return nullptr;
+        }
+        
+        if( this->look() == 'G' || this->look() == 'T' )
+        {
+            return this->specialName();
+        }
+        
+        name = this->name( &state );
+        
+        if( name == nullptr || this->resolveForwardReferences( state ) == false )
+        {
+            return nullptr;
+        }
+        
+        if( this->atEndOfEncoding() )
+        {
+            return name;
+        }
+        
+        /* Only function templates, other than constructors and conversions, mangle their return type */
+        if( state.ctorDtorConversion == false && state.endsWithTemplateArgs )
+        {
+            if( ( result = this->type() ) == nullptr )
+            {
+                return nullptr;
+            }
+        }
+        
+        encoding             = this->make( Kind::Encoding, result, name );
+        encoding->qualifiers = state.qualifiers;
+        encoding->reference  = state.reference;
+        
+        if( this->consume( 'v' ) )
+        {
+            return encoding;
+        }
+        
+        do
+        {
+            Node * parameter( this->type() );
+            
+            if( parameter == nullptr )
+            {
+                return nullptr;
+            }
+            
+            encoding->nodes.push_back( parameter );
+        }
+        while( this->atEndOfEncoding() == false );
+        
+        return encoding;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::specialName()
+    {
+        auto prefixed
+        {
+            [ & ]( std::string_view prefix, Node * node ) -> Node *
+            {
+                return ( node == nullptr ) ? nullptr : this->make( Kind::SpecialName, node, nullptr, prefix );
+            }
+        };
+        
+        if( this->look() == 'T' )
+        {
+            char c( this->look( 1 ) );
+            
+            switch( c )
+            {
+                case 'A': this->_position += 2; return prefixed( "template parameter object for ", this->templateArg() );
+                case 'V': this->_position += 2; return prefixed( "vtable for ",                    this->type() );
+                case 'T': this->_position += 2; return prefixed( "VTT for ",                       this->type() );
+                case 'I': this->_position += 2; return prefixed( "typeinfo for ",                  this->type() );
+                case 'S': this->_position += 2; return prefixed( "typeinfo name for ",             this->type() );
+                case 'W': this->_position += 2; return prefixed( "thread-local wrapper routine for ",        this->name( nullptr ) );
+                case 'H': this->_position += 2; return prefixed( "thread-local initialization routine for ", this->name( nullptr ) );
+                
+                case 'c':
+                    
+                    this->_position += 2;
+                    
+                    if( this->callOffset() == false || this->callOffset() == false )
+                    {
+                        return nullptr;
+                    }
+                    
+                    return prefixed( "covariant return thunk to ", this->encoding() );
+                
+                case 'C':
+                {
+                    Node * derived;
+                    Node * base;
+                    
+                    this->_position += 2;
+                    
+                    if( ( derived = this->type() ) == nullptr || this->number( true ).empty() || this->consume( '_' ) == false || ( base = this->type() ) == nullptr )
+                    {
+                        return nullptr;
+                    }
+                    
+                    return this->make( Kind::CtorVtable, base, derived );
+                }
+                
+                default:
+                {
+                    bool isVirtual( c == 'v' );
+                    
+                    this->_position++;
+                    
+                    if( this->callOffset() == false )
+                    {
+                        return nullptr;
+                    }
+                    
+                    return prefixed( isVirtual ? "virtual thunk to " : "non-virtual thunk to ", this->encoding() );
+                }
+            }
+        }
+        
+        if( this->consume( "GV" ) )
+        {
+            return prefixed( "guard variable for ", this->name( nullptr ) );
+        }
+        
+        if( this->consume( "GR" ) )
+        {
+            Node * name( this->name( nullptr ) );
+            size_t id;
+            bool   hasID( this->seqID( id ) );
+            
+            if( this->consume( '_' ) == false && hasID )
+            {
+                return nullptr;
+            }
+            
+            return prefixed( "reference temporary for ", name );
+        }
+        
+        return nullptr;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::name( State * state )
+    {
+        Guard  guard( this->_depth );
+        bool   substitution( false );
+        Node * result;
+        
+        if( this->_depth > MaxDepth )
+        {
+            return nullptr;
+        }
+        
+        this->consume( 'L' );
+        
+        if( this->look() == 'N' )
+        {
+            return this->nestedName( state );
+        }
+        
+        if( this->look() == 'Z' )
+        {
+            return this->localName( state );
+        }
+        
+        if( ( result = this->unscopedName( state, substitution ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        if( this->look() == 'I' )
+        {
+            Node * args;
+            
+            if( substitution == false )
+            {
+                this->_substitutions.push_back( result );
+            }
+            
+            if( ( args = this->templateArgs( state != nullptr ) ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            if( state != nullptr )
+            {
+                state->endsWithTemplateArgs = true;
+            }
+            
+            return this->make( Kind::Template, result, args );
+        }
+        
+        /* A substitution can only be an unscoped template name */
+        return substitution ? nullptr : result;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::unscopedName( State * state, bool & substitution )
+    {
+        if( this->consume( "St" ) )
+        {
+            Node * name;
+            
+            /* Internal linkage, e.g. std::__ioinit */
+            this->consume( 'L' );
+            
+            name = this->unqualifiedName( state );
+            
+            return ( name == nullptr ) ? nullptr : this->make( Kind::Std, name );
+        }
+        
+        if( this->look() == 'S' )
+        {
+            substitution = true;
+            
+            return this->substitution();
+        }
+        
+        return this->unqualifiedName( state );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::unqualifiedName( State * state )
+    {
+        Node * result;
+        
+        if( this->look() == 'U' )
+        {
+            result = this->unnamedTypeName();
+        }
+        else if( this->look() >= '1' && this->look() <= '9' )
+        {
+            result = this->sourceName();
+        }
+        else
+        {
+            result = this->operatorName( state );
+        }
+        
+        return ( result == nullptr ) ? nullptr : this->abiTags( result );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::sourceName()
+    {
+        std::string_view name( this->bareSourceName() );
+        
+        if( name.empty() )
+        {
+            return nullptr;
+        }
+        
+        if( name.substr( 0, 10 ) == "_GLOBAL__N" )
+        {
+            return this->make( Kind::Name, nullptr, nullptr, "(anonymous namespace)" );
+        }
+        
+        return this->make( Kind::Name, nullptr, nullptr, name );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::unnamedTypeName()
+    {
+        if( this->consume( "Ut" ) )
+        {
+            std::string_view count( this->number() );
+            
+            return this->consume( '_' ) ? this->make( Kind::Unnamed, nullptr, nullptr, count ) : nullptr;
+        }
+        
+        if( this->consume( "Ul" ) )
+        {
+            Node * closure( this->make( Kind::Closure ) );
+            bool   lambdaParams( this->_lambdaParams );
+            
+            /* Parameters of generic lambdas are mangled as template parameters, and printed as auto */
+            this->_lambdaParams = true;
+            
+            if( this->consume( "vE" ) == false )
+            {
+                do
+                {
+                    Node * parameter( this->type() );
+                    
+                    if( parameter == nullptr )
+                    {
+                        this->_lambdaParams = lambdaParams;
+                        
+                        return nullptr;
+                    }
+                    
+                    closure->nodes.push_back( parameter );
+                }
+                while( this->consume( 'E' ) == false );
+            }
+            
+            this->_lambdaParams = lambdaParams;
+            closure->text       = this->number();
+            
+            return this->consume( '_' ) ? closure : nullptr;
+        }
+        
+        if( this->consume( "Ub" ) )
+        {
+            this->number();
+            
+            return this->consume( '_' ) ? this->make( Kind::Name, nullptr, nullptr, "'block-literal'" ) : nullptr;
+        }
+        
+        return nullptr;
+    }
+    
+    const Demangler::IMPL::ItaniumParser::Operator * Demangler::IMPL::ItaniumParser::FindOperator( char c1, char c2 )
+    {
+        static const Operator operators[] =
+        {
+            { "aa", "operator&&",       "&&",       OperatorKind::Binary      },
+            { "ad", "operator&",        "&",        OperatorKind::Prefix      },
+            { "an", "operator&",        "&",        OperatorKind::Binary      },
+            { "aN", "operator&=",       "&=",       OperatorKind::Binary      },
+            { "aS", "operator=",        "=",        OperatorKind::Binary      },
+            { "aw", "operator co_await", "co_await", OperatorKind::Prefix     },
+            { "cl", "operator()",       "()",       OperatorKind::Call        },
+            { "cm", "operator,",        ",",        OperatorKind::Binary      },
+            { "co", "operator~",        "~",        OperatorKind::Prefix      },
+            { "da", "operator delete[]", "delete[]", OperatorKind::Delete     },
+            { "de", "operator*",        "*",        OperatorKind::Prefix      },
+            { "dl", "operator delete",  "delete",   OperatorKind::Delete      },
+            { "dv", "operator/",        "/",        OperatorKind::Binary      },
+            { "dV", "operator/=",       "/=",       OperatorKind::Binary      },
+            { "eo", "operator^",        "^",        OperatorKind::Binary      },
+            { "eO", "operator^=",       "^=",       OperatorKind::Binary      },
+            { "eq", "operator==",       "==",       OperatorKind::Binary      },
+            { "ge", "operator>=",       ">=",       OperatorKind::Binary      },
+            { "gt", "operator>",        ">",        OperatorKind::Binary      },
+            { "ix", "operator[]",       "[]",       OperatorKind::Array       },
+            { "le", "operator<=",       "<=",       OperatorKind::Binary      },
+            { "ls", "operator<<",       "<<",       OperatorKind::Binary      },
+            { "lS", "operator<<=",      "<<=",      OperatorKind::Binary      },
+            { "lt", "operator<",        "<",        OperatorKind::Binary      },
+            { "mi", "operator-",        "-",        OperatorKind::Binary      },
+            { "mI", "operator-=",       "-=",       OperatorKind::Binary      },
+            { "ml", "operator*",        "*",        OperatorKind::Binary      },
+            { "mL", "operator*=",       "*=",       OperatorKind::Binary      },
+            { "mm", "operator--",       "--",       OperatorKind::Postfix     },
+            { "na", "operator new[]",   "new[]",    OperatorKind::New         },
+            { "ne", "operator!=",       "!=",       OperatorKind::Binary      },
+            { "ng", "operator-",        "-",        OperatorKind::Prefix      },
+            { "nt", "operator!",        "!",        OperatorKind::Prefix      },
+            { "nw", "operator new",     "new",      OperatorKind::New         },
+            { "oo", "operator||",       "||",       OperatorKind::Binary      },
+            { "or", "operator|",        "|",        OperatorKind::Binary      },
+            { "oR", "operator|=",       "|=",       OperatorKind::Binary      },
+            { "pm", "operator->*",      "->*",      OperatorKind::Binary      },
+            { "pl", "operator+",        "+",        OperatorKind::Binary      },
+            { "pL", "operator+=",       "+=",       OperatorKind::Binary      },
+            { "pp", "operator++",       "++",       OperatorKind::Postfix     },
+            { "ps", "operator+",        "+",        OperatorKind::Prefix      },
+            { "pt", "operator->",       "->",       OperatorKind::Member      },
+            { "qu", "operator?",        "?",        OperatorKind::Conditional },
+            { "rm", "operator%",        "%",        OperatorKind::Binary      },
+            { "rM", "operator%=",       "%=",       OperatorKind::Binary      },
+            { "rs", "operator>>",       ">>",       OperatorKind::Binary      },
+            { "rS", "operator>>=",      ">>=",      OperatorKind::Binary      },
+            { "ss", "operator<=>",      "<=>",      OperatorKind::Binary      }
+        };
+        
+        for( const auto & op: operators )
+        {
+            if( op.code[ 0 ] == c1 && op.code[ 1 ] == c2 )
+            {
+                return &op;
+            }
+        }
+        
+        return nullptr;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::operatorName( State * state )
+    {
+        const Operator * op( FindOperator( this->look(), this->look( 1 ) ) );
+        
+        if( op != nullptr )
+        {
+            this->_position += 2;
+            
+            return this->make( Kind::Name, nullptr, nullptr, op->name );
+        }
+        
+        if( this->consume( "cv" ) )
+        {
+            bool   tryTemplateArgs( this->_tryTemplateArgs );
+            bool   permitForwardReferences( this->_permitForwardReferences );
+            Node * type;
+            
+            /* The template arguments following a conversion to a template parameter belong to the operator */
+            this->_tryTemplateArgs         = false;
+            this->_permitForwardReferences = permitForwardReferences || state != nullptr;
+            type                           = this->type();
+            this->_tryTemplateArgs         = tryTemplateArgs;
+            this->_permitForwardReferences = permitForwardReferences;
+            
+            if( type == nullptr )
+            {
+                return nullptr;
+            }
+            
+            if( state != nullptr )
+            {
+                state->ctorDtorConversion = true;
+            }
+            
+            return this->make( Kind::Conversion, type );
+        }
+        
+        if( this->consume( "li" ) )
+        {
+            Node * name( this->sourceName() );
+            
+            return ( name == nullptr ) ? nullptr : this->make( Kind::LiteralOperator, name );
+        }
+        
+        if( this->look() == 'v' && this->look( 1 ) >= '0' && this->look( 1 ) <= '9' )
+        {
+            Node * name;
+            
+            this->_position += 2;
+            
+            return ( ( name = this->sourceName() ) == nullptr ) ? nullptr : this->make( Kind::Conversion, name );
+        }
+        
+        return nullptr;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::ctorDtorName( Node * & soFar, State * state )
+    {
+        if( soFar->kind == Kind::Special )
+        {
+            static const std::pair< std::string_view, std::string_view > expanded[] =
+            {
+                { "std::allocator",                                                       "allocator"      },
+                { "std::basic_string",                                                    "basic_string"   },
+                { "std::basic_string<char, std::char_traits<char>, std::allocator<char> >", "basic_string" },
+                { "std::basic_istream<char, std::char_traits<char> >",                    "basic_istream"  },
+                { "std::basic_ostream<char, std::char_traits<char> >",                    "basic_ostream"  },
+                { "std::basic_iostream<char, std::char_traits<char> >",                   "basic_iostream" }
+            };
+            
+            Node * node( this->make( Kind::Special ) );
+            
+            node->text  = expanded[ soFar->qualifiers ].first;
+            node->extra = expanded[ soFar->qualifiers ].second;
+            soFar       = node;
+        }
+        
+        if( this->consume( 'C' ) )
+        {
+            bool   inherited( this->consume( 'I' ) );
+            Node * ctor;
+            
+            if( this->look() < '1' || this->look() > '5' )
+            {
+                return nullptr;
+            }
+            
+            this->_position++;
+            
+            if( state != nullptr )
+            {
+                state->ctorDtorConversion = true;
+            }
+            
+            if( inherited && this->name( state ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            ctor = this->make( Kind::CtorDtor, soFar );
+            
+            return ctor;
+        }
+        
+        if( this->look() == 'D' && ( this->look( 1 ) == '0' || this->look( 1 ) == '1' || this->look( 1 ) == '2' || this->look( 1 ) == '4' || this->look( 1 ) == '5' ) )
+        {
+            Node * dtor;
+            
+            this->_position += 2;
+            
+            if( state != nullptr )
+            {
+                state->ctorDtorConversion = true;
+            }
+            
+            dtor       = this->make( Kind::CtorDtor, soFar );
+            dtor->flag = true;
+            
+            return dtor;
+        }
+        
+        return nullptr;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::nestedName( State * state )
+    {
+        Node * soFar( nullptr );
+        auto   push
+        {
+            [ & ]( Node * component ) -> bool
+            {
+                if( component == nullptr )
+                {
+                    return false;
+                }
+                
+                soFar = ( soFar == nullptr ) ? component : this->make( Kind::Nested, soFar, component );
+                
+                if( state != nullptr )
+                {
+                    state->endsWithTemplateArgs = false;
+                }
+                
+                return true;
+            }
+        };
+        
+        if( this->consume( 'N' ) == false )
+        {
+            return nullptr;
+        }
+        
+        {
+            unsigned qualifiers( this->cvQualifiers() );
+            unsigned reference( ReferenceNone );
+            
+            if( this->consume( 'O' ) )
+            {
+                reference = ReferenceRValue;
+            }
+            else if( this->consume( 'R' ) )
+            {
+                reference = ReferenceLValue;
+            }
+            
+            if( state != nullptr )
+            {
+                state->qualifiers = qualifiers;
+                state->reference  = reference;
+            }
+        }
+        
+        if( this->consume( "St" ) )
+        {
+            soFar = this->make( Kind::Name, nullptr, nullptr, "std" );
+        }
+        
+        while( this->consume( 'E' ) == false )
+        {
+            if( this->atEnd() )
+            {
+                return nullptr;
+            }
+            
+            this->consume( 'L' );
+            
+            if( this->consume( 'M' ) )
+            {
+                if( soFar == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                continue;
+            }
+            
+            if( this->look() == 'T' )
+            {
+                if( push( this->templateParam() ) == false )
+                {
+                    return nullptr;
+                }
+            }
+            else if( this->look() == 'I' )
+            {
+                Node * args( this->templateArgs( state != nullptr ) );
+                
+                if( args == nullptr || soFar == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                soFar = this->make( Kind::Template, soFar, args );
+                
+                if( state != nullptr )
+                {
+                    state->endsWithTemplateArgs = true;
+                }
+            }
+            else if( this->look() == 'D' && ( this->look( 1 ) == 't' || this->look( 1 ) == 'T' ) )
+            {
+                if( push( this->decltypeType() ) == false )
+                {
+                    return nullptr;
+                }
+            }
+            else if( this->look() == 'S' && this->look( 1 ) != 't' )
+            {
+                Node * substitution( this->substitution() );
+                
+                if( push( substitution ) == false )
+                {
+                    return nullptr;
+                }
+                
+                if( soFar == substitution )
+                {
+                    continue;
+                }
+            }
+            else if( this->look() == 'C' || ( this->look() == 'D' && this->look( 1 ) != 'C' ) )
+            {
+                if( soFar == nullptr || push( this->ctorDtorName( soFar, state ) ) == false || ( soFar = this->abiTags( soFar ) ) == nullptr )
+                {
+                    return nullptr;
+                }
+            }
+            else if( push( this->unqualifiedName( state ) ) == false )
+            {
+                return nullptr;
+            }
+            
+            this->_substitutions.push_back( soFar );
+        }
+        
+        /* The complete name is not a substitution candidate, as it is never a prefix */
+        if( soFar == nullptr || this->_substitutions.empty() )
+        {
+            return nullptr;
+        }
+        
+        this->_substitutions.pop_back();
+        
+        return soFar;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::localName( State * state )
+    {
+        Node * encoding;
+        Node * entity;
+        
+        if( this->consume( 'Z' ) == false || ( encoding = this->encoding() ) == nullptr || this->consume( 'E' ) == false )
+        {
+            return nullptr;
+        }
+        
+        if( this->consume( 's' ) )
+        {
+            this->discriminator();
+            
+            return this->make( Kind::Local, encoding, this->make( Kind::Name, nullptr, nullptr, "string literal" ) );
+        }
+        
+        if( this->consume( 'd' ) )
+        {
+            this->number( true );
+            
+            if( this->consume( '_' ) == false || ( entity = this->name( state ) ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            return this->make( Kind::Local, encoding, entity );
+        }
+        
+        if( ( entity = this->name( state ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        this->discriminator();
+        
+        return this->make( Kind::Local, encoding, entity );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::abiTags( Node * node )
+    {
+        while( node != nullptr && this->consume( 'B' ) )
+        {
+            std::string_view tag( this->bareSourceName() );
+            
+            node = tag.empty() ? nullptr : this->make( Kind::AbiTag, node, nullptr, tag );
+        }
+        
+        return node;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::substitution()
+    {
+        size_t index;
+        
+        if( this->consume( 'S' ) == false )
+        {
+            return nullptr;
+        }
+        
+        if( this->look() >= 'a' && this->look() <= 'z' )
+        {
+            static const std::pair< char, std::pair< std::string_view, std::string_view > > special[] =
+            {
+                { 'a', { "std::allocator",    "allocator"    } },
+                { 'b', { "std::basic_string", "basic_string" } },
+                { 's', { "std::string",       "string"       } },
+                { 'i', { "std::istream",      "istream"      } },
+                { 'o', { "std::ostream",      "ostream"      } },
+                { 'd', { "std::iostream",     "iostream"     } }
+            };
+            
+            for( unsigned i = 0; i < sizeof( special ) / sizeof( special[ 0 ] ); i++ )
+            {
+                if( special[ i ].first == this->look() )
+                {
+                    Node * node( this->make( Kind::Special ) );
+                    Node * tagged;
+                    
+                    this->_position++;
+                    
+                    node->text       = special[ i ].second.first;
+                    node->extra      = special[ i ].second.second;
+                    node->qualifiers = i;
+                    
+                    /* ABI tags make a new substitution candidate */
+                    if( ( tagged = this->abiTags( node ) ) != node && tagged != nullptr )
+                    {
+                        this->_substitutions.push_back( tagged );
+                    }
+                    
+                    return tagged;
+                }
+            }
+            
+            return nullptr;
+        }
+        
+        if( this->consume( '_' ) )
+        {
+            return this->_substitutions.empty() ? nullptr : this->_substitutions.front();
+        }
+        
+        if( this->seqID( index ) == false || this->consume( '_' ) == false || index + 1 >= this->_substitutions.size() )
+        {
+            return nullptr;
+        }
+        
+        return this->_substitutions[ index + 1 ];
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::templateParam()
+    {
+        size_t index( 0 );
+        
+        if( this->consume( 'T' ) == false )
+        {
+            return nullptr;
+        }
+        
+        if( this->consume( '_' ) == false )
+        {
+            if( this->positive( index ) == false || this->consume( '_' ) == false )
+            {
+                return nullptr;
+            }
+            
+            index++;
+        }
+        
+        if( this->_lambdaParams )
+        {
+            return this->make( Kind::Name, nullptr, nullptr, "auto" );
+        }
+        
+        /* Conversion operators may refer to the template arguments that follow them */
+        if( this->_permitForwardReferences )
+        {
+            Node * reference( this->make( Kind::Forward ) );
+            
+            reference->qualifiers = static_cast< unsigned >( index );
+            
+            this->_forwardReferences.push_back( reference );
+            
+            return reference;
+        }
+        
+        return ( index < this->_templateParams.size() ) ? this->_templateParams[ index ] : nullptr;
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::resolveForwardReferences( State & state )
+    {
+        for( size_t i = state.forwardReferences; i < this->_forwardReferences.size(); i++ )
+        {
+            Node * reference( this->_forwardReferences[ i ] );
+            
+            if( reference->qualifiers >= this->_templateParams.size() )
+            {
+                return false;
+            }
+            
+            reference->first = this->_templateParams[ reference->qualifiers ];
+        }
+        
+        this->_forwardReferences.resize( state.forwardReferences );
+        
+        return true;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::templateArgs( bool tag )
+    {
+        Node * args;
+        
+        if( this->consume( 'I' ) == false )
+        {
+            return nullptr;
+        }
+        
+        /* Template parameters refer to the innermost arguments of the encoding */
+        if( tag )
+        {
+            this->_templateParams.clear();
+        }
+        
+        args = this->make( Kind::TemplateArgs );
+        
+        while( this->consume( 'E' ) == false )
+        {
+            Node * arg;
+            
+            if( tag )
+            {
+                std::vector< Node * > params( std::move( this->_templateParams ) );
+                
+                this->_templateParams.clear();
+                
+                arg                   = this->templateArg();
+                this->_templateParams = std::move( params );
+                
+                if( arg == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                if( arg->kind == Kind::ArgumentPack )
+                {
+                    Node * pack( this->make( Kind::ParameterPack ) );
+                    
+                    pack->nodes = arg->nodes;
+                    
+                    this->_templateParams.push_back( pack );
+                }
+                else
+                {
+                    this->_templateParams.push_back( arg );
+                }
+            }
+            else if( ( arg = this->templateArg() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            args->nodes.push_back( arg );
+        }
+        
+        return args;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::templateArg()
+    {
+        Node * arg;
+        
+        switch( this->look() )
+        {
+            case 'X':
+                
+                this->_position++;
+                
+                return ( ( arg = this->expression() ) == nullptr || this->consume( 'E' ) == false ) ? nullptr : arg;
+            
+            case 'J':
+                
+                this->_position++;
+                arg = this->make( Kind::ArgumentPack );
+                
+                while( this->consume( 'E' ) == false )
+                {
+                    Node * element( this->templateArg() );
+                    
+                    if( element == nullptr )
+                    {
+                        return nullptr;
+                    }
+                    
+                    arg->nodes.push_back( element );
+                }
+                
+                return arg;
+            
+            case 'L':
+                
+                if( this->look( 1 ) == 'Z' )
+                {
+                    this->_position += 2;
+                    
+                    return ( ( arg = this->encoding() ) == nullptr || this->consume( 'E' ) == false ) ? nullptr : arg;
+                }
+                
+                return this->primary();
+            
+            default: return this->type();
+        }
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::type()
+    {
+        static const std::pair< char, std::string_view > builtins[] =
+        {
+            { 'v', "void"               },
+            { 'w', "wchar_t"            },
+            { 'b', "bool"               },
+            { 'c', "char"               },
+            { 'a', "signed char"        },
+            { 'h', "unsigned char"      },
+            { 's', "short"              },
+            { 't', "unsigned short"     },
+            { 'i', "int"                },
+            { 'j', "unsigned int"       },
+            { 'l', "long"               },
+            { 'm', "unsigned long"      },
+            { 'x', "long long"          },
+            { 'y', "unsigned long long" },
+            { 'n', "__int128"           },
+            { 'o', "unsigned __int128"  },
+            { 'f', "float"              },
+            { 'd', "double"             },
+            { 'e', "long double"        },
+            { 'g', "__float128"         },
+            { 'z', "..."                }
+        };
+        
+        static const std::pair< char, std::string_view > extended[] =
+        {
+            { 'd', "decimal64"      },
+            { 'e', "decimal128"     },
+            { 'f', "decimal32"      },
+            { 'h', "half"           },
+            { 'i', "char32_t"       },
+            { 's', "char16_t"       },
+            { 'u', "char8_t"        },
+            { 'a', "auto"           },
+            { 'c', "decltype(auto)" },
+            { 'n', "std::nullptr_t" }
+        };
+        
+        Guard  guard( this->_depth );
+        Node * result( nullptr );
+        char   c( this->look() );
+        
+        if( this->_depth > MaxDepth || this->atEnd() )
+        {
+            return nullptr;
+        }
+        
+        for( const auto & builtin: builtins )
+        {
+            if( builtin.first == c )
+            {
+                this->_position++;
+                
+                return this->make( Kind::Name, nullptr, nullptr, builtin.second );
+            }
+        }
+        
+        switch( c )
+        {
+            case 'r':
+            case 'V':
+            case 'K':
+            {
+                size_t after( 0 );
+                
+                if( this->look( after ) == 'r' ) { after++; }
+                if( this->look( after ) == 'V' ) { after++; }
+                if( this->look( after ) == 'K' ) { after++; }
+                
+                /* Qualifiers of member function types belong to the function type */
+                if( this->look( after ) == 'F' || ( this->look( after ) == 'D' && std::string_view( "oOwx" ).find( this->look( after + 1 ) ) != std::string_view::npos ) )
+                {
+                    result = this->functionType();
+                }
+                else
+                {
+                    result = this->qualifiedType();
+                }
+                
+                break;
+            }
+            
+            case 'U': result = this->qualifiedType(); break;
+            case 'F': result = this->functionType();  break;
+            case 'A': result = this->arrayType();     break;
+            
+            case 'u':
+            {
+                std::string_view name;
+                
+                this->_position++;
+                
+                if( ( name = this->bareSourceName() ).empty() )
+                {
+                    return nullptr;
+                }
+                
+                result = this->make( Kind::Name, nullptr, nullptr, name );
+                
+                break;
+            }
+            
+            case 'D':
+                
+                for( const auto & builtin: extended )
+                {
+                    if( builtin.first == this->look( 1 ) )
+                    {
+                        this->_position += 2;
+                        
+                        return this->make( Kind::Name, nullptr, nullptr, builtin.second );
+                    }
+                }
+                
+                switch( this->look( 1 ) )
+                {
+                    case 'F':
+                    {
+                        std::string_view bits;
+                        
+                        this->_position += 2;
+                        
+                        if( ( bits = this->number() ).empty() || this->consume( '_' ) == false )
+                        {
+                            return nullptr;
+                        }
+                        
+                        return this->make( Kind::Enclosing, this->make( Kind::Name, nullptr, nullptr, bits ), nullptr, "_Float" );
+                    }
+                    
+                    case 't':
+                    case 'T': result = this->decltypeType();   break;
+                    case 'v': result = this->vectorType(); break;
+                    
+                    case 'p':
+                    {
+                        Node * pattern;
+                        
+                        this->_position += 2;
+                        
+                        if( ( pattern = this->type() ) == nullptr )
+                        {
+                            return nullptr;
+                        }
+                        
+                        result = this->make( Kind::PackExpansion, pattern );
+                        
+                        break;
+                    }
+                    
+                    case 'o':
+                    case 'O':
+                    case 'w':
+                    case 'x': result = this->functionType(); break;
+                    
+                    default: return nullptr;
+                }
+                
+                break;
+            
+            case 'M':
+            {
+                Node * cls;
+                Node * member;
+                
+                this->_position++;
+                
+                if( ( cls = this->type() ) == nullptr || ( member = this->type() ) == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                result = this->make( Kind::Member, cls, member );
+                
+                break;
+            }
+            
+            case 'T':
+                
+                if( this->look( 1 ) == 's' || this->look( 1 ) == 'u' || this->look( 1 ) == 'e' )
+                {
+                    result = this->classEnumType();
+                    
+                    break;
+                }
+                
+                if( ( result = this->templateParam() ) == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                /* A template template parameter, followed by its arguments */
+                if( this->_tryTemplateArgs && this->look() == 'I' )
+                {
+                    Node * args;
+                    
+                    this->_substitutions.push_back( result );
+                    
+                    if( ( args = this->templateArgs() ) == nullptr )
+                    {
+                        return nullptr;
+                    }
+                    
+                    result = this->make( Kind::Template, result, args );
+                }
+                
+                break;
+            
+            case 'P':
+            case 'R':
+            case 'O':
+            {
+                Node * pointee;
+                
+                this->_position++;
+                
+                if( ( pointee = this->type() ) == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                result = this->make( ( c == 'P' ) ? Kind::Pointer : Kind::Reference, pointee );
+                
+                result->reference = ( c == 'R' ) ? ReferenceLValue : ReferenceRValue;
+                
+                break;
+            }
+            
+            case 'C':
+            case 'G':
+            {
+                Node * base;
+                
+                this->_position++;
+                
+                if( ( base = this->type() ) == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                result = this->make( Kind::PostfixQualified, base, nullptr, ( c == 'C' ) ? " complex" : " imaginary" );
+                
+                break;
+            }
+            
+            case 'S':
+                
+                if( this->look( 1 ) != 't' )
+                {
+                    Node * substitution( this->substitution() );
+                    Node * args;
+                    
+                    if( substitution == nullptr )
+                    {
+                        return nullptr;
+                    }
+                    
+                    /* Substitutions are not substitution candidates themselves */
+                    if( this->_tryTemplateArgs == false || this->look() != 'I' )
+                    {
+                        return substitution;
+                    }
+                    
+                    if( ( args = this->templateArgs() ) == nullptr )
+                    {
+                        return nullptr;
+                    }
+                    
+                    result = this->make( Kind::Template, substitution, args );
+                    
+                    break;
+                }
+                
+                result = this->classEnumType();
+                
+                break;
+            
+            default: result = this->classEnumType(); break;
+        }
+        
+        if( result != nullptr )
+        {
+            this->_substitutions.push_back( result );
+        }
+        
+        return result;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::qualifiedType()
+    {
+        unsigned qualifiers;
+        Node *   type;
+        
+        if( this->consume( 'U' ) )
+        {
+            std::string_view qualifier( this->bareSourceName() );
+            Node *           args( nullptr );
+            
+            if( qualifier.empty() || ( this->look() == 'I' && ( args = this->templateArgs() ) == nullptr ) || ( type = this->qualifiedType() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            return this->make( Kind::VendorQualified, type, args, qualifier );
+        }
+        
+        qualifiers = this->cvQualifiers();
+        
+        if( ( type = this->type() ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        if( qualifiers != QualifierNone )
+        {
+            type             = this->make( Kind::Qualified, type );
+            type->qualifiers = qualifiers;
+        }
+        
+        return type;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::functionType()
+    {
+        unsigned qualifiers( this->cvQualifiers() );
+        Node *   exception( nullptr );
+        Node *   function;
+        Node *   result;
+        
+        if( this->consume( "Do" ) )
+        {
+            exception = this->make( Kind::Name, nullptr, nullptr, "noexcept" );
+        }
+        else if( this->consume( "DO" ) )
+        {
+            Node * expression( this->expression() );
+            
+            if( expression == nullptr || this->consume( 'E' ) == false )
+            {
+                return nullptr;
+            }
+            
+            exception        = this->make( Kind::Enclosing, expression, nullptr, "noexcept(" );
+            exception->extra = ")";
+        }
+        else if( this->consume( "Dw" ) )
+        {
+            exception = this->make( Kind::DynamicException );
+            
+            while( this->consume( 'E' ) == false )
+            {
+                Node * type( this->type() );
+                
+                if( type == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                exception->nodes.push_back( type );
+            }
+        }
+        
+        this->consume( "Dx" );
+        
+        if( this->consume( 'F' ) == false )
+        {
+            return nullptr;
+        }
+        
+        this->consume( 'Y' );
+        
+        if( ( result = this->type() ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        function             = this->make( Kind::Function, result, exception );
+        function->qualifiers = qualifiers;
+        
+        while( true )
+        {
+            Node * parameter;
+            
+            if( this->consume( 'E' ) )
+            {
+                break;
+            }
+            
+            if( this->consume( 'v' ) )
+            {
+                continue;
+            }
+            
+            if( this->consume( "RE" ) )
+            {
+                function->reference = ReferenceLValue;
+                
+                break;
+            }
+            
+            if( this->consume( "OE" ) )
+            {
+                function->reference = ReferenceRValue;
+                
+                break;
+            }
+            
+            if( ( parameter = this->type() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            function->nodes.push_back( parameter );
+        }
+        
+        return function;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::arrayType()
+    {
+        Node * dimension( nullptr );
+        Node * element;
+        
+        if( this->consume( 'A' ) == false )
+        {
+            return nullptr;
+        }
+        
+        if( this->look() >= '0' && this->look() <= '9' )
+        {
+            dimension = this->make( Kind::Name, nullptr, nullptr, this->number() );
+            
+            if( this->consume( '_' ) == false )
+            {
+                return nullptr;
+            }
+        }
+        else if( this->consume( '_' ) == false )
+        {
+            if( ( dimension = this->expression() ) == nullptr || this->consume( '_' ) == false )
+            {
+                return nullptr;
+            }
+        }
+        
+        if( ( element = this->type() ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        return this->make( Kind::Array, element, dimension );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::vectorType()
+    {
+        Node * dimension( nullptr );
+        Node * element;
+        
+        if( this->consume( "Dv" ) == false )
+        {
+            return nullptr;
+        }
+        
+        if( this->look() >= '1' && this->look() <= '9' )
+        {
+            dimension = this->make( Kind::Name, nullptr, nullptr, this->number() );
+            
+            if( this->consume( '_' ) == false || this->look() == 'p' )
+            {
+                return nullptr;
+            }
+        }
+        else if( this->consume( '_' ) == false )
+        {
+            if( ( dimension = this->expression() ) == nullptr || this->consume( '_' ) == false )
+            {
+                return nullptr;
+            }
+        }
+        
+        if( ( element = this->type() ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        return this->make( Kind::Vector, element, dimension );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::decltypeType()
+    {
+        Node * expression;
+        
+        if( this->consume( "Dt" ) == false && this->consume( "DT" ) == false )
+        {
+            return nullptr;
+        }
+        
+        if( ( expression = this->expression() ) == nullptr || this->consume( 'E' ) == false )
+        {
+            return nullptr;
+        }
+        
+        expression        = this->make( Kind::Enclosing, expression, nullptr, "decltype(" );
+        expression->extra = ")";
+        
+        return expression;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::classEnumType()
+    {
+        std::string_view elaborated;
+        Node *           name;
+        
+        if( this->consume( "Ts" ) )
+        {
+            elaborated = "struct";
+        }
+        else if( this->consume( "Tu" ) )
+        {
+            elaborated = "union";
+        }
+        else if( this->consume( "Te" ) )
+        {
+            elaborated = "enum";
+        }
+        
+        if( ( name = this->name( nullptr ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        return elaborated.empty() ? name : this->make( Kind::Elaborated, name, nullptr, elaborated );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::expression()
+    {
+        Guard            guard( this->_depth );
+        bool             global( this->consume( "gs" ) );
+        const Operator * op;
+        char             c1( this->look() );
+        char             c2( this->look( 1 ) );
+        auto             enclosing
+        {
+            [ & ]( std::string_view prefix, Node * node, std::string_view suffix ) -> Node *
+            {
+                if( node == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                node        = this->make( Kind::Enclosing, node, nullptr, prefix );
+                node->extra = suffix;
+                
+                return node;
+            }
+        };
+        
+        if( this->_depth > MaxDepth || this->_name.size() - this->_position < 2 )
+        {
+            return nullptr;
+        }
+        
+        if( c1 == 'L' )
+        {
+            return this->primary();
+        }
+        
+        if( c1 == 'T' )
+        {
+            return this->templateParam();
+        }
+        
+        if( c1 == 'f' )
+        {
+            return ( c2 == 'p' || ( c2 == 'L' && this->look( 2 ) >= '0' && this->look( 2 ) <= '9' ) ) ? this->functionParam() : nullptr;
+        }
+        
+        if( ( c1 >= '1' && c1 <= '9' ) || ( c1 == 's' && c2 == 'r' ) || ( c1 == 'd' && c2 == 'n' ) || ( c1 == 'o' && c2 == 'n' ) )
+        {
+            return this->unresolvedName( global );
+        }
+        
+        if( c1 == 's' && c2 == 't' ) { this->_position += 2; return enclosing( "sizeof (",   this->type(),       ")" ); }
+        if( c1 == 's' && c2 == 'z' ) { this->_position += 2; return enclosing( "sizeof (",   this->expression(), ")" ); }
+        if( c1 == 'a' && c2 == 't' ) { this->_position += 2; return enclosing( "alignof (",  this->type(),       ")" ); }
+        if( c1 == 'a' && c2 == 'z' ) { this->_position += 2; return enclosing( "alignof (",  this->expression(), ")" ); }
+        if( c1 == 't' && c2 == 'e' ) { this->_position += 2; return enclosing( "typeid (",   this->expression(), ")" ); }
+        if( c1 == 't' && c2 == 'i' ) { this->_position += 2; return enclosing( "typeid (",   this->type(),       ")" ); }
+        if( c1 == 'n' && c2 == 'x' ) { this->_position += 2; return enclosing( "noexcept (", this->expression(), ")" ); }
+        if( c1 == 't' && c2 == 'w' ) { this->_position += 2; return enclosing( "throw ",     this->expression(), ""  ); }
+        
+        if( c1 == 't' && c2 == 'r' )
+        {
+            this->_position += 2;
+            
+            return this->make( Kind::Name, nullptr, nullptr, "throw" );
+        }
+        
+        if( ( c1 == 'd' || c1 == 's' || c1 == 'c' || c1 == 'r' ) && c2 == 'c' )
+        {
+            static const std::pair< char, std::string_view > casts[] =
+            {
+                { 'd', "dynamic_cast"     },
+                { 's', "static_cast"      },
+                { 'c', "const_cast"       },
+                { 'r', "reinterpret_cast" }
+            };
+            
+            Node * type;
+            Node * expression;
+            
+            this->_position += 2;
+            
+            if( ( type = this->type() ) == nullptr || ( expression = this->expression() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            for( const auto & cast: casts )
+            {
+                if( cast.first == c1 )
+                {
+                    return this->make( Kind::Cast, type, expression, cast.second );
+                }
+            }
+        }
+        
+        if( c1 == 'c' && c2 == 'v' )
+        {
+            bool   tryTemplateArgs( this->_tryTemplateArgs );
+            Node * conversion;
+            Node * type;
+            
+            this->_position       += 2;
+            this->_tryTemplateArgs = false;
+            type                   = this->type();
+            this->_tryTemplateArgs = tryTemplateArgs;
+            
+            if( type == nullptr )
+            {
+                return nullptr;
+            }
+            
+            conversion = this->make( Kind::ConversionExpression, type );
+            
+            if( this->consume( '_' ) )
+            {
+                while( this->consume( 'E' ) == false )
+                {
+                    Node * expression( this->expression() );
+                    
+                    if( expression == nullptr )
+                    {
+                        return nullptr;
+                    }
+                    
+                    conversion->nodes.push_back( expression );
+                }
+            }
+            else
+            {
+                Node * expression( this->expression() );
+                
+                if( expression == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                conversion->nodes.push_back( expression );
+            }
+            
+            return conversion;
+        }
+        
+        if( c1 == 's' && c2 == 'p' )
+        {
+            Node * pattern;
+            
+            this->_position += 2;
+            
+            return ( ( pattern = this->expression() ) == nullptr ) ? nullptr : this->make( Kind::PackExpansion, pattern );
+        }
+        
+        if( c1 == 's' && c2 == 'Z' )
+        {
+            Node * pack;
+            
+            this->_position += 2;
+            
+            if( this->look() == 'T' )
+            {
+                pack = this->templateParam();
+            }
+            else if( this->look() == 'f' )
+            {
+                pack = this->functionParam();
+            }
+            else
+            {
+                return nullptr;
+            }
+            
+            return ( pack == nullptr ) ? nullptr : this->make( Kind::SizeofPack, pack );
+        }
+        
+        if( ( c1 == 'd' || c1 == 'p' ) && c2 == 't' )
+        {
+            Node * object;
+            Node * member;
+            
+            this->_position += 2;
+            
+            if( ( object = this->expression() ) == nullptr || ( member = this->expression() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            return this->make( Kind::Access, object, member, ( c1 == 'd' ) ? "." : "->" );
+        }
+        
+        if( c1 == 'd' && c2 == 's' )
+        {
+            Node * object;
+            Node * member;
+            
+            this->_position += 2;
+            
+            if( ( object = this->expression() ) == nullptr || ( member = this->expression() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            return this->make( Kind::Binary, object, member, ".*" );
+        }
+        
+        if( ( op = FindOperator( c1, c2 ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        this->_position += 2;
+        
+        switch( op->kind )
+        {
+            case OperatorKind::Binary:
+            {
+                Node * lhs;
+                Node * rhs;
+                
+                if( ( lhs = this->expression() ) == nullptr || ( rhs = this->expression() ) == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                return this->make( Kind::Binary, lhs, rhs, op->symbol );
+            }
+            
+            case OperatorKind::Prefix:
+            {
+                Node * operand( this->expression() );
+                
+                return ( operand == nullptr ) ? nullptr : this->make( Kind::Prefix, operand, nullptr, op->symbol );
+            }
+            
+            case OperatorKind::Postfix:
+            {
+                bool   prefix( this->consume( '_' ) );
+                Node * operand( this->expression() );
+                
+                if( operand == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                return this->make( prefix ? Kind::Prefix : Kind::Postfix, operand, nullptr, op->symbol );
+            }
+            
+            case OperatorKind::Array:
+            {
+                Node * array;
+                Node * index;
+                
+                if( ( array = this->expression() ) == nullptr || ( index = this->expression() ) == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                return this->make( Kind::Subscript, array, index );
+            }
+            
+            case OperatorKind::Call:
+            {
+                Node * callee( this->expression() );
+                Node * call;
+                
+                if( callee == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                call = this->make( Kind::Call, callee );
+                
+                while( this->consume( 'E' ) == false )
+                {
+                    Node * argument( this->expression() );
+                    
+                    if( argument == nullptr )
+                    {
+                        return nullptr;
+                    }
+                    
+                    call->nodes.push_back( argument );
+                }
+                
+                return call;
+            }
+            
+            case OperatorKind::Conditional:
+            {
+                Node * conditional( this->make( Kind::Conditional ) );
+                
+                for( int i = 0; i < 3; i++ )
+                {
+                    Node * operand( this->expression() );
+                    
+                    if( operand == nullptr )
+                    {
+                        return nullptr;
+                    }
+                    
+                    conditional->nodes.push_back( operand );
+                }
+                
+                return conditional;
+            }
+            
+            default: return nullptr;
+        }
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::primary()
+    {
+        static const std::pair< char, std::string_view > integers[] =
+        {
+            { 'w', "wchar_t"           },
+            { 'c', "char"              },
+            { 'a', "signed char"       },
+            { 'h', "unsigned char"     },
+            { 's', "short"             },
+            { 't', "unsigned short"    },
+            { 'i', ""                  },
+            { 'j', "u"                 },
+            { 'l', "l"                 },
+            { 'm', "ul"                },
+            { 'x', "ll"                },
+            { 'y', "ull"               },
+            { 'n', "__int128"          },
+            { 'o', "unsigned __int128" }
+        };
+        
+        if( this->consume( 'L' ) == false )
+        {
+            return nullptr;
+        }
+        
+        for( const auto & integer: integers )
+        {
+            if( integer.first == this->look() )
+            {
+                this->_position++;
+                
+                return this->integer( integer.second );
+            }
+        }
+        
+        if( this->consume( "b0E" ) || this->consume( "b1E" ) )
+        {
+            Node * node( this->make( Kind::Bool ) );
+            
+            node->flag = this->_name[ this->_position - 2 ] == '1';
+            
+            return node;
+        }
+        
+        if( this->consume( "DnE" ) )
+        {
+            return this->make( Kind::Name, nullptr, nullptr, "nullptr" );
+        }
+        
+        if( this->consume( "_Z" ) )
+        {
+            Node * encoding( this->encoding() );
+            
+            return ( encoding == nullptr || this->consume( 'E' ) == false ) ? nullptr : encoding;
+        }
+        
+        /* Floating-point, string and lambda literals are left mangled */
+        if( std::string_view( "bfdeDTUA" ).find( this->look() ) != std::string_view::npos )
+        {
+            return nullptr;
+        }
+        
+        {
+            Node *           type( this->type() );
+            std::string_view value;
+            
+            if( type == nullptr || ( value = this->number( true ) ).empty() || this->consume( 'E' ) == false )
+            {
+                return nullptr;
+            }
+            
+            return this->make( Kind::EnumLiteral, type, nullptr, value );
+        }
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::integer( std::string_view type )
+    {
+        std::string_view value( this->number( true ) );
+        Node *           node;
+        
+        if( value.empty() || this->consume( 'E' ) == false )
+        {
+            return nullptr;
+        }
+        
+        node        = this->make( Kind::Integer, nullptr, nullptr, value );
+        node->extra = type;
+        
+        return node;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::functionParam()
+    {
+        std::string_view index;
+        
+        if( this->consume( "fpT" ) )
+        {
+            return this->make( Kind::Name, nullptr, nullptr, "this" );
+        }
+        
+        if( this->consume( "fp" ) )
+        {
+            this->cvQualifiers();
+            
+            index = this->number();
+            
+            return this->consume( '_' ) ? this->make( Kind::FunctionParam, nullptr, nullptr, index ) : nullptr;
+        }
+        
+        if( this->consume( "fL" ) )
+        {
+            if( this->number().empty() || this->consume( 'p' ) == false )
+            {
+                return nullptr;
+            }
+            
+            this->cvQualifiers();
+            
+            index = this->number();
+            
+            return this->consume( '_' ) ? this->make( Kind::FunctionParam, nullptr, nullptr, index ) : nullptr;
+        }
+        
+        return nullptr;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::unresolvedName( bool global )
+    {
+        Node * soFar( nullptr );
+        Node * base;
+        
+        if( this->consume( "srN" ) )
+        {
+            if( ( soFar = this->unresolvedType() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            if( this->look() == 'I' )
+            {
+                Node * args( this->templateArgs() );
+                
+                if( args == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                soFar = this->make( Kind::Template, soFar, args );
+            }
+            
+            while( this->consume( 'E' ) == false )
+            {
+                Node * qualifier( this->simpleID() );
+                
+                if( qualifier == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                soFar = this->make( Kind::Nested, soFar, qualifier );
+            }
+            
+            return ( ( base = this->baseUnresolvedName() ) == nullptr ) ? nullptr : this->make( Kind::Nested, soFar, base );
+        }
+        
+        global = this->consume( "gs" ) || global;
+        
+        if( this->consume( "sr" ) == false )
+        {
+            if( ( soFar = this->baseUnresolvedName() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            if( global )
+            {
+                soFar        = this->make( Kind::Enclosing, soFar, nullptr, "::" );
+                soFar->extra = "";
+            }
+            
+            return soFar;
+        }
+        
+        if( this->look() >= '0' && this->look() <= '9' )
+        {
+            do
+            {
+                Node * qualifier( this->simpleID() );
+                
+                if( qualifier == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                if( soFar != nullptr )
+                {
+                    soFar = this->make( Kind::Nested, soFar, qualifier );
+                }
+                else if( global )
+                {
+                    soFar = this->make( Kind::Enclosing, qualifier, nullptr, "::" );
+                }
+                else
+                {
+                    soFar = qualifier;
+                }
+            }
+            while( this->consume( 'E' ) == false );
+        }
+        else
+        {
+            if( ( soFar = this->unresolvedType() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            if( this->look() == 'I' )
+            {
+                Node * args( this->templateArgs() );
+                
+                if( args == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                soFar = this->make( Kind::Template, soFar, args );
+            }
+        }
+        
+        return ( ( base = this->baseUnresolvedName() ) == nullptr ) ? nullptr : this->make( Kind::Nested, soFar, base );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::unresolvedType()
+    {
+        Node * type;
+        
+        if( this->look() == 'T' )
+        {
+            type = this->templateParam();
+        }
+        else if( this->look() == 'D' )
+        {
+            type = this->decltypeType();
+        }
+        else
+        {
+            return this->substitution();
+        }
+        
+        if( type != nullptr )
+        {
+            this->_substitutions.push_back( type );
+        }
+        
+        return type;
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::simpleID()
+    {
+        Node * name( this->sourceName() );
+        Node * args;
+        
+        if( name == nullptr || this->look() != 'I' )
+        {
+            return name;
+        }
+        
+        return ( ( args = this->templateArgs() ) == nullptr ) ? nullptr : this->make( Kind::Template, name, args );
+    }
+    
+    Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::baseUnresolvedName()
+    {
+        Node * name;
+        Node * args;
+        
+        if( this->look() >= '0' && this->look() <= '9' )
+        {
+            return this->simpleID();
+        }
+        
+        if( this->consume( "dn" ) )
+        {
+            name = ( this->look() >= '0' && this->look() <= '9' ) ? this->simpleID() : this->unresolvedType();
+            
+            if( name == nullptr )
+            {
+                return nullptr;
+            }
+            
+            name        = this->make( Kind::Enclosing, name, nullptr, "~" );
+            name->extra = "";
+            
+            return name;
+        }
+        
+        this->consume( "on" );
+        
+        if( ( name = this->operatorName( nullptr ) ) == nullptr || this->look() != 'I' )
+        {
+            return name;
+        }
+        
+        return ( ( args = this->templateArgs() ) == nullptr ) ? nullptr : this->make( Kind::Template, name, args );
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::Enter( Output & out )
+    {
+        if( out.overflow || out.depth > MaxDepth * 4 || out.text.size() > MaxLength )
+        {
+            out.overflow = true;
+            
+            return false;
+        }
+        
+        return true;
+    }
+    
+    void Demangler::IMPL::ItaniumParser::Print( const Node * node, Output & out )
+    {
+        PrintLeft( node, out );
+        PrintRight( node, out );
+    }
+    
+    void Demangler::IMPL::ItaniumParser::PrintList( const std::vector< Node * > & nodes, Output & out )
+    {
+        bool first( true );
+        
+        for( const Node * node: nodes )
+        {
+            size_t beforeComma( out.text.size() );
+            size_t afterComma;
+            
+            if( first == false )
+            {
+                out.text += ", ";
+            }
+            
+            afterComma = out.text.size();
+            
+            Print( node, out );
+            
+            /* Empty pack expansions print nothing, nor their separator */
+            if( out.text.size() == afterComma )
+            {
+                out.text.resize( beforeComma );
+                
+                continue;
+            }
+            
+            first = false;
+        }
+    }
+    
+    void Demangler::IMPL::ItaniumParser::PrintQualifiers( unsigned qualifiers, Output & out )
+    {
+        if( qualifiers & QualifierConst )    { out.text += " const"; }
+        if( qualifiers & QualifierVolatile ) { out.text += " volatile"; }
+        if( qualifiers & QualifierRestrict ) { out.text += " restrict"; }
+    }
+    
+    void Demangler::IMPL::ItaniumParser::PrintPackExpansion( const Node * node, Output & out )
+    {
+        unsigned packIndex( out.packIndex );
+        unsigned packMax( out.packMax );
+        size_t   position( out.text.size() );
+        
+        out.packIndex = Unbounded;
+        out.packMax   = Unbounded;
+        
+        /* The pattern sets the pack size while printing its first element */
+        Print( node, out );
+        
+        if( out.packMax == Unbounded )
+        {
+            out.text += "...";
+        }
+        else if( out.packMax == 0 )
+        {
+            out.text.resize( position );
+        }
+        else
+        {
+            for( unsigned i = 1, n = out.packMax; i < n && out.overflow == false; i++ )
+            {
+                out.text     += ", ";
+                out.packIndex = i;
+                
+                Print( node, out );
+            }
+        }
+        
+        out.packIndex = packIndex;
+        out.packMax   = packMax;
+    }
+    
+    void Demangler::IMPL::ItaniumParser::InitializePack( const Node * node, Output & out )
+    {
+        if( out.packMax == Unbounded )
+        {
+            out.packMax   = static_cast< unsigned >( node->nodes.size() );
+            out.packIndex = 0;
+        }
+    }
+    
+    const Demangler::IMPL::ItaniumParser::Node * Demangler::IMPL::ItaniumParser::Syntax( const Node * node, Output & out )
+    {
+        for( unsigned i = 0; i < MaxDepth; i++ )
+        {
+            if( node->kind == Kind::ParameterPack )
+            {
+                InitializePack( node, out );
+                
+                if( out.packIndex >= node->nodes.size() )
+                {
+                    return node;
+                }
+                
+                node = node->nodes[ out.packIndex ];
+            }
+            else if( node->kind == Kind::Forward && node->first != nullptr )
+            {
+                node = node->first;
+            }
+            else
+            {
+                return node;
+            }
+        }
+        
+        return node;
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::HasRHS( const Node * node, Output & out )
+    {
+        for( unsigned i = 0; i < MaxDepth; i++ )
+        {
+            node = Syntax( node, out );
+            
+            switch( node->kind )
+            {
+                case Kind::Function:
+                case Kind::Encoding:
+                case Kind::Array:     return true;
+                case Kind::Pointer:
+                case Kind::Reference:
+                case Kind::Qualified: node = node->first;  break;
+                case Kind::Member:    node = node->second; break;
+                default:              return false;
+            }
+        }
+        
+        return false;
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::HasArray( const Node * node, Output & out )
+    {
+        for( unsigned i = 0; i < MaxDepth; i++ )
+        {
+            node = Syntax( node, out );
+            
+            switch( node->kind )
+            {
+                case Kind::Array:     return true;
+                case Kind::Qualified: node = node->first; break;
+                default:              return false;
+            }
+        }
+        
+        return false;
+    }
+    
+    bool Demangler::IMPL::ItaniumParser::HasFunction( const Node * node, Output & out )
+    {
+        for( unsigned i = 0; i < MaxDepth; i++ )
+        {
+            node = Syntax( node, out );
+            
+            switch( node->kind )
+            {
+                case Kind::Function:
+                case Kind::Encoding:  return true;
+                case Kind::Qualified: node = node->first; break;
+                default:              return false;
+            }
+        }
+        
+        return false;
+    }
+    
+    std::string_view Demangler::IMPL::ItaniumParser::BaseName( const Node * node )
+    {
+        for( unsigned i = 0; i < MaxDepth && node != nullptr; i++ )
+        {
+            switch( node->kind )
+            {
+                case Kind::Name:     return node->text;
+                case Kind::Special:  return node->extra;
+                case Kind::Nested:   node = node->second; break;
+                case Kind::Template:
+                case Kind::Std:
+                case Kind::AbiTag:   node = node->first;  break;
+                default:             return {};
+            }
+        }
+        
+        return {};
+    }
+    
+    /* References to references collapse, an lvalue reference winning over an rvalue one */
+    std::pair< unsigned, const Demangler::IMPL::ItaniumParser::Node * > Demangler::IMPL::ItaniumParser::Collapse( const Node * node, Output & out )
+    {
+        unsigned     reference( node->reference );
+        const Node * pointee( node->first );
+        
+        for( unsigned i = 0; i < MaxDepth; i++ )
+        {
+            const Node * syntax( Syntax( pointee, out ) );
+            
+            if( syntax->kind != Kind::Reference )
+            {
+                break;
+            }
+            
+            pointee   = syntax->first;
+            reference = std::min( reference, syntax->reference );
+        }
+        
+        return { reference, pointee };
+    }
+    
+    void Demangler::IMPL::ItaniumParser::PrintLeft( const Node * node, Output & out )
+    {
+        if( Enter( out ) == false )
+        {
+            return;
+        }
+        
+        out.depth++;
+        
+        switch( node->kind )
+        {
+            case Kind::Name:
+            case Kind::Special:
+                
+                out.text += node->text;
+                
+                break;
+            
+            case Kind::Nested:
+            case Kind::Local:
+                
+                Print( node->first, out );
+                
+                out.text += "::";
+                
+                Print( node->second, out );
+                
+                break;
+            
+            case Kind::Template:
+                
+                Print( node->first, out );
+                Print( node->second, out );
+                
+                break;
+            
+            case Kind::Std:
+                
+                out.text += "std::";
+                
+                Print( node->first, out );
+                
+                break;
+            
+            case Kind::CtorDtor:
+                
+                if( node->flag )
+                {
+                    out.text += "~";
+                }
+                
+                out.text += BaseName( node->first );
+                
+                break;
+            
+            case Kind::AbiTag:
+                
+                PrintLeft( node->first, out );
+                
+                out.text += "[abi:";
+                out.text += node->text;
+                out.text += "]";
+                
+                break;
+            
+            case Kind::Conversion:
+                
+                out.text += "operator ";
+                
+                Print( node->first, out );
+                
+                break;
+            
+            case Kind::LiteralOperator:
+                
+                out.text += "operator\"\" ";
+                
+                Print( node->first, out );
+                
+                break;
+            
+            case Kind::Encoding:
+                
+                if( node->first != nullptr )
+                {
+                    PrintLeft( node->first, out );
+                    
+                    if( HasRHS( node->first, out ) == false )
+                    {
+                        out.text += " ";
+                    }
+                }
+                
+                Print( node->second, out );
+                
+                break;
+            
+            case Kind::SpecialName:
+                
+                out.text += node->text;
+                
+                Print( node->first, out );
+                
+                break;
+            
+            case Kind::CtorVtable:
+                
+                out.text += "construction vtable for ";
+                
+                Print( node->first, out );
+                
+                out.text += "-in-";
+                
+                Print( node->second, out );
+                
+                break;
+            
+            case Kind::DotSuffix:
+                
+                Print( node->first, out );
+                
+                out.text += " (";
+                out.text += node->text;
+                out.text += ")";
+                
+                break;
+            
+            case Kind::Qualified:
+                
+                PrintLeft( node->first, out );
+                PrintQualifiers( node->qualifiers, out );
+                
+                break;
+            
+            case Kind::VendorQualified:
+                
+                Print( node->first, out );
+                
+                out.text += " ";
+                out.text += node->text;
+                
+                if( node->second != nullptr )
+                {
+                    Print( node->second, out );
+                }
+                
+                break;
+            
+            case Kind::PostfixQualified:
+                
+                Print( node->first, out );
+                
+                out.text += node->text;
+                
+                break;
+            
+            case Kind::Pointer:
+            case Kind::Reference:
+            {
+                auto pointee( ( node->kind == Kind::Pointer ) ? std::make_pair( ReferenceNone, static_cast< const Node * >( node->first ) ) : Collapse( node, out ) );
+                
+                PrintLeft( pointee.second, out );
+                
+                if( HasArray( pointee.second, out ) )
+                {
+                    out.text += " ";
+                }
+                
+                if( HasArray( pointee.second, out ) || HasFunction( pointee.second, out ) )
+                {
+                    out.text += "(";
+                }
+                
+                out.text += ( node->kind == Kind::Pointer ) ? "*" : ( ( pointee.first == ReferenceLValue ) ? "&" : "&&" );
+                
+                break;
+            }
+            
+            case Kind::Member:
+                
+                PrintLeft( node->second, out );
+                
+                out.text += ( HasArray( node->second, out ) || HasFunction( node->second, out ) ) ? "(" : " ";
+                
+                Print( node->first, out );
+                
+                out.text += "::*";
+                
+                break;
+            
+            case Kind::Function:
+                
+                PrintLeft( node->first, out );
+                
+                out.text += " ";
+                
+                break;
+            
+            case Kind::DynamicException:
+                
+                out.text += "throw(";
+                
+                PrintList( node->nodes, out );
+                
+                out.text += ")";
+                
+                break;
+            
+            case Kind::Array:
+                
+                PrintLeft( node->first, out );
+                
+                break;
+            
+            case Kind::Vector:
+                
+                Print( node->first, out );
+                
+                out.text += " vector[";
+                
+                if( node->second != nullptr )
+                {
+                    Print( node->second, out );
+                }
+                
+                out.text += "]";
+                
+                break;
+            
+            case Kind::TemplateArgs:
+                
+                out.text += "<";
+                
+                PrintList( node->nodes, out );
+                
+                if( out.text.empty() == false && out.text.back() == '>' )
+                {
+                    out.text += " ";
+                }
+                
+                out.text += ">";
+                
+                break;
+            
+            case Kind::ArgumentPack:
+                
+                PrintList( node->nodes, out );
+                
+                break;
+            
+            case Kind::ParameterPack:
+                
+                InitializePack( node, out );
+                
+                if( out.packIndex < node->nodes.size() )
+                {
+                    PrintLeft( node->nodes[ out.packIndex ], out );
+                }
+                
+                break;
+            
+            case Kind::PackExpansion:
+                
+                PrintPackExpansion( node->first, out );
+                
+                break;
+            
+            case Kind::Closure:
+                
+                out.text += "'lambda";
+                out.text += node->text;
+                out.text += "'(";
+                
+                PrintList( node->nodes, out );
+                
+                out.text += ")";
+                
+                break;
+            
+            case Kind::Unnamed:
+                
+                out.text += "'unnamed";
+                out.text += node->text;
+                out.text += "'";
+                
+                break;
+            
+            case Kind::Elaborated:
+                
+                out.text += node->text;
+                out.text += " ";
+                
+                Print( node->first, out );
+                
+                break;
+            
+            case Kind::Forward:
+                
+                if( node->first != nullptr )
+                {
+                    PrintLeft( node->first, out );
+                }
+                
+                break;
+            
+            case Kind::Binary:
+                
+                if( node->text == ">" )
+                {
+                    out.text += "(";
+                }
+                
+                out.text += "(";
+                
+                Print( node->first, out );
+                
+                out.text += ") ";
+                out.text += node->text;
+                out.text += " (";
+                
+                Print( node->second, out );
+                
+                out.text += ")";
+                
+                if( node->text == ">" )
+                {
+                    out.text += ")";
+                }
+                
+                break;
+            
+            case Kind::Prefix:
+                
+                out.text += node->text;
+                out.text += "(";
+                
+                Print( node->first, out );
+                
+                out.text += ")";
+                
+                break;
+            
+            case Kind::Postfix:
+                
+                out.text += "(";
+                
+                Print( node->first, out );
+                
+                out.text += ")";
+                out.text += node->text;
+                
+                break;
+            
+            case Kind::Subscript:
+                
+                out.text += "(";
+                
+                Print( node->first, out );
+                
+                out.text += ")[";
+                
+                Print( node->second, out );
+                
+                out.text += "]";
+                
+                break;
+            
+            case Kind::Access:
+                
+                Print( node->first, out );
+                
+                out.text += node->text;
+                
+                Print( node->second, out );
+                
+                break;
+            
+            case Kind::Conditional:
+                
+                out.text += "(";
+                
+                Print( node->nodes[ 0 ], out );
+                
+                out.text += ") ? (";
+                
+                Print( node->nodes[ 1 ], out );
+                
+                out.text += ") : (";
+                
+                Print( node->nodes[ 2 ], out );
+                
+                out.text += ")";
+                
+                break;
+            
+            case Kind::Cast:
+                
+                out.text += node->text;
+                out.text += "<";
+                
+                Print( node->first, out );
+                
+                out.text += ">(";
+                
+                Print( node->second, out );
+                
+                out.text += ")";
+                
+                break;
+            
+            case Kind::Call:
+                
+                Print( node->first, out );
+                
+                out.text += "(";
+                
+                PrintList( node->nodes, out );
+                
+                out.text += ")";
+                
+                break;
+            
+            case Kind::ConversionExpression:
+                
+                out.text += "(";
+                
+                Print( node->first, out );
+                
+                out.text += ")(";
+                
+                PrintList( node->nodes, out );
+                
+                out.text += ")";
+                
+                break;
+            
+            case Kind::Enclosing:
+                
+                out.text += node->text;
+                
+                Print( node->first, out );
+                
+                out.text += node->extra;
+                
+                break;
+            
+            case Kind::FunctionParam:
+                
+                out.text += "fp";
+                out.text += node->text;
+                
+                break;
+            
+            case Kind::Integer:
+                
+                if( node->extra.size() > 3 )
+                {
+                    out.text += "(";
+                    out.text += node->extra;
+                    out.text += ")";
+                }
+                
+                if( node->text[ 0 ] == 'n' )
+                {
+                    out.text += "-";
+                    out.text += node->text.substr( 1 );
+                }
+                else
+                {
+                    out.text += node->text;
+                }
+                
+                if( node->extra.size() <= 3 )
+                {
+                    out.text += node->extra;
+                }
+                
+                break;
+            
+            case Kind::Bool:
+                
+                out.text += node->flag ? "true" : "false";
+                
+                break;
+            
+            case Kind::EnumLiteral:
+                
+                out.text += "(";
+                
+                Print( node->first, out );
+                
+                out.text += ")";
+                
+                if( node->text[ 0 ] == 'n' )
+                {
+                    out.text += "-";
+                    out.text += node->text.substr( 1 );
+                }
+                else
+                {
+                    out.text += node->text;
+                }
+                
+                break;
+            
+            case Kind::SizeofPack:
+                
+                out.text += "sizeof...(";
+                
+                PrintPackExpansion( node->first, out );
+                
+                out.text += ")";
+                
+                break;
+        }
+        
+        out.depth--;
+    }
+    
+    void Demangler::IMPL::ItaniumParser::PrintRight( const Node * node, Output & out )
+    {
+        if( Enter( out ) == false )
+        {
+            return;
+        }
+        
+        out.depth++;
+        
+        switch( node->kind )
+        {
+            case Kind::Encoding:
+            case Kind::Function:
+                
+                out.text += "(";
+                
+                PrintList( node->nodes, out );
+                
+                out.text += ")";
+                
+                if( node->first != nullptr )
+                {
+                    PrintRight( node->first, out );
+                }
+                
+                PrintQualifiers( node->qualifiers, out );
+                
+                if( node->reference == ReferenceLValue )
+                {
+                    out.text += " &";
+                }
+                else if( node->reference == ReferenceRValue )
+                {
+                    out.text += " &&";
+                }
+                
+                if( node->kind == Kind::Function && node->second != nullptr )
+                {
+                    out.text += " ";
+                    
+                    Print( node->second, out );
+                }
+                
+                break;
+            
+            case Kind::Qualified:
+            case Kind::Forward:
+                
+                if( node->first != nullptr )
+                {
+                    PrintRight( node->first, out );
+                }
+                
+                break;
+            
+            case Kind::Pointer:
+            case Kind::Reference:
+            {
+                auto pointee( ( node->kind == Kind::Pointer ) ? std::make_pair( ReferenceNone, static_cast< const Node * >( node->first ) ) : Collapse( node, out ) );
+                
+                if( HasArray( pointee.second, out ) || HasFunction( pointee.second, out ) )
+                {
+                    out.text += ")";
+                }
+                
+                PrintRight( pointee.second, out );
+                
+                break;
+            }
+            
+            case Kind::Member:
+                
+                if( HasArray( node->second, out ) || HasFunction( node->second, out ) )
+                {
+                    out.text += ")";
+                }
+                
+                PrintRight( node->second, out );
+                
+                break;
+            
+            case Kind::Array:
+                
+                if( out.text.empty() || out.text.back() != ']' )
+                {
+                    out.text += " ";
+                }
+                
+                out.text += "[";
+                
+                if( node->second != nullptr )
+                {
+                    Print( node->second, out );
+                }
+                
+                out.text += "]";
+                
+                PrintRight( node->first, out );
+                
+                break;
+            
+            case Kind::ParameterPack:
+                
+                InitializePack( node, out );
+                
+                if( out.packIndex < node->nodes.size() )
+                {
+                    PrintRight( node->nodes[ out.packIndex ], out );
+                }
+                
+                break;
+            
+            default: break;
+        }
+        
+        out.depth--;
+    }
+    
+    Demangler::IMPL::SwiftParser::SwiftParser( std::string_view name ):
+        _name(     name ),
+        _position( 0 )
+    {}
+    
+    std::optional< std::string > Demangler::IMPL::SwiftParser::demangle()
+    {
+        std::vector< Node * > attributes;
+        Node *                node;
+        Output                out { {}, 0, false };
+        
+        while( this->_position < this->_name.size() )
+        {
+            if( this->_nodes.size() > MaxNodes || ( node = this->parseOperator() ) == nullptr )
+            {
+                return {};
+            }
+            
+            this->push( node );
+        }
+        
+        /* Thunk attributes follow the entity they apply to, and print as prefixes */
+        while( ( node = this->pop( Kind::Attribute ) ) != nullptr )
+        {
+            attributes.push_back( node );
+        }
+        
+        if( this->_stack.size() != 1 )
+        {
+            return {};
+        }
+        
+        for( const Node * attribute: attributes )
+        {
+            out.text += attribute->text;
+        }
+        
+        Print( this->_stack.front(), out );
+        
+        if( out.overflow )
+        {
+            return {};
+        }
+        
+        return out.text;
+    }
+    
+    char Demangler::IMPL::SwiftParser::peek() const
+    {
+        return ( this->_position < this->_name.size() ) ? this->_name[ this->_position ] : '\0';
+    }
+    
+    char Demangler::IMPL::SwiftParser::next()
+    {
+        return ( this->_position < this->_name.size() ) ? this->_name[ this->_position++ ] : '\0';
+    }
+    
+    bool Demangler::IMPL::SwiftParser::next( char c )
+    {
+        if( this->_position >= this->_name.size() || this->_name[ this->_position ] != c )
+        {
+            return false;
+        }
+        
+        this->_position++;
+        
+        return true;
+    }
+    
+    bool Demangler::IMPL::SwiftParser::natural( uint64_t & value )
+    {
+        value = 0;
+        
+        if( this->peek() < '0' || this->peek() > '9' )
+        {
+            return false;
+        }
+        
+        while( this->peek() >= '0' && this->peek() <= '9' )
+        {
+            value = value * 10 + static_cast< uint64_t >( this->next() - '0' );
+            
+            if( value > MaxLength * 16 )
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    /* Indices are mangled as _ for zero, or as N_ for N + 1 */
+    bool Demangler::IMPL::SwiftParser::index( uint64_t & value )
+    {
+        if( this->next( '_' ) )
+        {
+            value = 0;
+            
+            return true;
+        }
+        
+        if( this->natural( value ) && this->next( '_' ) )
+        {
+            value++;
+            
+            return true;
+        }
+        
+        return false;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::make( Kind kind, std::string text )
+    {
+        this->_nodes.push_back( { kind, std::move( text ), {}, 0 } );
+        
+        return &( this->_nodes.back() );
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::make( Kind kind, std::initializer_list< Node * > children )
+    {
+        Node * node( this->make( kind ) );
+        
+        for( Node * child: children )
+        {
+            if( child == nullptr )
+            {
+                return nullptr;
+            }
+            
+            node->children.push_back( child );
+        }
+        
+        return node;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::type( Node * node )
+    {
+        return ( node == nullptr ) ? nullptr : this->make( Kind::Type, { node } );
+    }
+    
+    void Demangler::IMPL::SwiftParser::push( Node * node )
+    {
+        this->_stack.push_back( node );
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::pop()
+    {
+        Node * node;
+        
+        if( this->_stack.empty() )
+        {
+            return nullptr;
+        }
+        
+        node = this->_stack.back();
+        
+        this->_stack.pop_back();
+        
+        return node;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::pop( Kind kind )
+    {
+        return ( this->_stack.empty() || this->_stack.back()->kind != kind ) ? nullptr : this->pop();
+    }
+    
+    /* Module names are mangled as plain identifiers */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::popModule()
+    {
+        Node * node( this->pop( Kind::Identifier ) );
+        
+        if( node != nullptr )
+        {
+            return this->make( Kind::Module, node->text );
+        }
+        
+        return this->pop( Kind::Module );
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::popContext()
+    {
+        Node * node;
+        
+        if( ( node = this->popModule() ) != nullptr )
+        {
+            return node;
+        }
+        
+        if( ( node = this->pop( Kind::Type ) ) != nullptr )
+        {
+            return IsContext( node->children.front()->kind ) ? node->children.front() : nullptr;
+        }
+        
+        return ( this->_stack.empty() == false && IsContext( this->_stack.back()->kind ) ) ? this->pop() : nullptr;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::popDeclName()
+    {
+        return ( this->_stack.empty() == false && IsDeclName( this->_stack.back()->kind ) ) ? this->pop() : nullptr;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::popEntity()
+    {
+        return ( this->_stack.empty() == false && ( this->_stack.back()->kind == Kind::Type || IsContext( this->_stack.back()->kind ) ) ) ? this->pop() : nullptr;
+    }
+    
+    /* Protocols of conformances are mangled as a context and a name, without the P suffix of protocol types */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::popProtocol()
+    {
+        Node * node( this->pop( Kind::Type ) );
+        Node * name;
+        
+        if( node != nullptr )
+        {
+            return ( node->children.front()->kind != Kind::Protocol ) ? nullptr : node;
+        }
+        
+        name = this->popDeclName();
+        
+        return this->type( this->make( Kind::Protocol, { this->popContext(), name } ) );
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::popConformance()
+    {
+        Node * module;
+        Node * protocol;
+        
+        this->pop( Kind::Signature );
+        
+        if( ( module = this->popModule() ) == nullptr || ( protocol = this->popProtocol() ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        return this->make( Kind::Conformance, { this->pop( Kind::Type ), protocol, module } );
+    }
+    
+    /* Argument labels precede the function type, one identifier or _ per parameter, or y when none has a label */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::popLabels( Node * type )
+    {
+        Node * function;
+        Node * parameters;
+        Node * labels;
+        size_t count;
+        
+        if( this->pop( Kind::EmptyList ) != nullptr )
+        {
+            return this->make( Kind::LabelList );
+        }
+        
+        if( type == nullptr )
+        {
+            return nullptr;
+        }
+        
+        function = type->children.front();
+        
+        if( function->kind == Kind::DependentGenericType )
+        {
+            function = function->children[ 1 ]->children.front();
+        }
+        
+        if( function->kind != Kind::FunctionType )
+        {
+            return nullptr;
+        }
+        
+        parameters = function->children.front()->children.front();
+        count      = ( parameters->kind == Kind::Tuple ) ? parameters->children.size() : 1;
+        
+        if( count == 0 )
+        {
+            return nullptr;
+        }
+        
+        labels = this->make( Kind::LabelList );
+        
+        for( size_t i = 0; i < count; i++ )
+        {
+            Node * label( this->pop( Kind::Identifier ) );
+            
+            if( label == nullptr && ( label = this->pop( Kind::FirstElementMarker ) ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            labels->children.insert( labels->children.begin(), label );
+        }
+        
+        return labels;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::parseOperator()
+    {
+        char c( this->next() );
+        
+        if( c >= '0' && c <= '9' )
+        {
+            this->_position--;
+            
+            return this->identifier();
+        }
+        
+        switch( c )
+        {
+            case 'A': return this->multiSubstitution();
+            case 'B': return this->builtin();
+            case 'C': return this->nominal( Kind::Class );
+            case 'E': return this->extension();
+            case 'G': return this->boundGeneric();
+            case 'L': return this->localName();
+            case 'M': return this->metadata();
+            case 'O': return this->nominal( Kind::Enum );
+            case 'P': return this->nominal( Kind::Protocol );
+            case 'Q': return this->associatedType();
+            case 'R': return this->requirement();
+            case 'S': return this->standardSubstitution();
+            case 'T': return this->thunk();
+            case 'V': return this->nominal( Kind::Structure );
+            case 'W': return this->witness();
+            case 'X': return this->special();
+            case 'a': return this->nominal( Kind::TypeAlias );
+            case 'c': return this->functionType( {} );
+            case 'f': return this->functionEntity();
+            case 'i': return this->subscript();
+            case 'l': return this->signature( false );
+            case 'o': return this->operatorName();
+            case 'p': return this->protocolList();
+            case 'q': return this->genericParam();
+            case 'r': return this->signature( true );
+            case 's': return this->make( Kind::Module, "Swift" );
+            case 't': return this->tuple();
+            case 'v': return this->accessor( this->entity( Kind::Variable ) );
+            case 'x': return this->type( this->make( Kind::GenericParam, ParamName( 0, 0 ) ) );
+            case 'y': return this->make( Kind::EmptyList );
+            case '_': return this->make( Kind::FirstElementMarker );
+            case 'd': return this->make( Kind::VariadicMarker );
+            case 'K': return this->make( Kind::Throws );
+            
+            case 'D':
+            {
+                Node * type( this->pop( Kind::Type ) );
+                
+                return ( type == nullptr ) ? nullptr : this->make( Kind::Global, { type } );
+            }
+            
+            case 'N':
+            {
+                Node * node( this->make( Kind::Global, { this->pop( Kind::Type ) } ) );
+                
+                if( node != nullptr )
+                {
+                    node->text = "type metadata for ";
+                }
+                
+                return node;
+            }
+            
+            case 'F':
+            {
+                Node * signature( this->pop( Kind::Signature ) );
+                Node * type( this->functionType( {} ) );
+                Node * labels( this->popLabels( type ) );
+                Node * name;
+                Node * function;
+                
+                if( type != nullptr && signature != nullptr )
+                {
+                    type = this->type( this->make( Kind::DependentGenericType, { signature, type } ) );
+                }
+                
+                name     = this->popDeclName();
+                function = this->make( Kind::Function, { this->popContext(), name, type } );
+                
+                if( function != nullptr && labels != nullptr )
+                {
+                    function->children.push_back( labels );
+                }
+                
+                return function;
+            }
+            
+            case 'Y':
+                
+                switch( this->next() )
+                {
+                    case 'a': return this->make( Kind::Async );
+                    case 'b': return this->make( Kind::Sendable );
+                    default:  return nullptr;
+                }
+            
+            case 'Z':
+            {
+                Node * entity( this->popEntity() );
+                
+                return ( entity == nullptr ) ? nullptr : this->make( Kind::Static, { entity } );
+            }
+            
+            case 'h':
+            case 'n':
+            case 'z':
+            {
+                Node * type( this->pop( Kind::Type ) );
+                Node * node;
+                
+                if( type == nullptr )
+                {
+                    return nullptr;
+                }
+                
+                node = this->make( Kind::Prefixed, ( c == 'h' ) ? "__shared " : ( ( c == 'n' ) ? "__owned " : "inout " ) );
+                
+                node->children.push_back( type );
+                
+                return this->type( node );
+            }
+            
+            case 'm':
+            {
+                Node * type( this->pop( Kind::Type ) );
+                
+                return ( type == nullptr ) ? nullptr : this->type( this->make( Kind::Metatype, { type } ) );
+            }
+            
+            case 'u':
+            {
+                Node * signature( this->pop( Kind::Signature ) );
+                Node * type( this->pop( Kind::Type ) );
+                
+                return this->type( this->make( Kind::DependentGenericType, { signature, type } ) );
+            }
+            
+            default: return nullptr;
+        }
+    }
+    
+    /*
+     * Identifiers may reuse words of earlier identifiers: a 0 prefix introduces word
+     * substitutions, as letters, the last one being uppercase.
+     */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::identifier()
+    {
+        bool        words( false );
+        std::string text;
+        Node *      node;
+        
+        if( this->next( '0' ) )
+        {
+            /* Punycode-encoded identifiers are not supported */
+            if( this->peek() == '0' )
+            {
+                return nullptr;
+            }
+            
+            words = true;
+        }
+        
+        do
+        {
+            uint64_t         length;
+            std::string_view slice;
+            size_t           start( std::string_view::npos );
+            
+            while( words && ( ( this->peek() >= 'a' && this->peek() <= 'z' ) || ( this->peek() >= 'A' && this->peek() <= 'Z' ) ) )
+            {
+                char   c( this->next() );
+                size_t word;
+                
+                if( c >= 'a' )
+                {
+                    word = static_cast< size_t >( c - 'a' );
+                }
+                else
+                {
+                    word  = static_cast< size_t >( c - 'A' );
+                    words = false;
+                }
+                
+                if( word >= this->_words.size() )
+                {
+                    return nullptr;
+                }
+                
+                text += this->_words[ word ];
+            }
+            
+            if( this->next( '0' ) )
+            {
+                break;
+            }
+            
+            if( this->natural( length ) == false || length == 0 || length > this->_name.size() - this->_position )
+            {
+                return nullptr;
+            }
+            
+            slice            = this->_name.substr( this->_position, length );
+            text            += slice;
+            this->_position += length;
+            
+            /* Words start with a non-digit, and end before an underscore or an uppercase letter following a lowercase one */
+            for( size_t i = 0; i <= slice.size(); i++ )
+            {
+                char c( ( i < slice.size() ) ? slice[ i ] : '\0' );
+                
+                if( start != std::string_view::npos && ( c == '_' || c == '\0' || ( ( slice[ i - 1 ] < 'A' || slice[ i - 1 ] > 'Z' ) && c >= 'A' && c <= 'Z' ) ) )
+                {
+                    if( i - start >= 2 && this->_words.size() < MaxWords )
+                    {
+                        this->_words.push_back( slice.substr( start, i - start ) );
+                    }
+                    
+                    start = std::string_view::npos;
+                }
+                
+                if( start == std::string_view::npos && c != '_' && c != '\0' && ( c < '0' || c > '9' ) )
+                {
+                    start = i;
+                }
+            }
+        }
+        while( words );
+        
+        if( text.empty() )
+        {
+            return nullptr;
+        }
+        
+        node = this->make( Kind::Identifier, std::move( text ) );
+        
+        this->_substitutions.push_back( node );
+        
+        return node;
+    }
+    
+    /* Substitutions are letters, optionally preceded by a repeat count. All but the last one are pushed here. */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::multiSubstitution()
+    {
+        uint64_t repeat( 1 );
+        
+        while( true )
+        {
+            char c( this->next() );
+            
+            if( ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) )
+            {
+                size_t index( static_cast< size_t >( c - ( ( c >= 'a' ) ? 'a' : 'A' ) ) );
+                
+                if( index >= this->_substitutions.size() || repeat > MaxRepeat )
+                {
+                    return nullptr;
+                }
+                
+                for( uint64_t i = ( c >= 'a' ) ? 0 : 1; i < repeat; i++ )
+                {
+                    this->push( this->_substitutions[ index ] );
+                }
+                
+                if( c < 'a' )
+                {
+                    return this->_substitutions[ index ];
+                }
+                
+                repeat = 1;
+            }
+            else if( c == '_' )
+            {
+                size_t index( static_cast< size_t >( repeat ) + 27 );
+                
+                return ( index < this->_substitutions.size() ) ? this->_substitutions[ index ] : nullptr;
+            }
+            else if( c >= '0' && c <= '9' )
+            {
+                this->_position--;
+                
+                if( this->natural( repeat ) == false )
+                {
+                    return nullptr;
+                }
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::standardSubstitution()
+    {
+        static const std::tuple< char, Kind, const char * > types[] =
+        {
+            { 'A', Kind::Structure, "AutoreleasingUnsafeMutablePointer" },
+            { 'a', Kind::Structure, "Array"                             },
+            { 'b', Kind::Structure, "Bool"                              },
+            { 'D', Kind::Structure, "Dictionary"                        },
+            { 'd', Kind::Structure, "Double"                            },
+            { 'f', Kind::Structure, "Float"                             },
+            { 'h', Kind::Structure, "Set"                               },
+            { 'I', Kind::Structure, "DefaultIndices"                    },
+            { 'i', Kind::Structure, "Int"                               },
+            { 'J', Kind::Structure, "Character"                         },
+            { 'N', Kind::Structure, "ClosedRange"                       },
+            { 'n', Kind::Structure, "Range"                             },
+            { 'O', Kind::Structure, "ObjectIdentifier"                  },
+            { 'P', Kind::Structure, "UnsafeMutablePointer"              },
+            { 'p', Kind::Structure, "UnsafePointer"                     },
+            { 'R', Kind::Structure, "UnsafeBufferPointer"               },
+            { 'r', Kind::Structure, "UnsafeMutableBufferPointer"        },
+            { 'S', Kind::Structure, "String"                            },
+            { 's', Kind::Structure, "Substring"                         },
+            { 'u', Kind::Structure, "UInt"                              },
+            { 'V', Kind::Structure, "UnsafeRawPointer"                  },
+            { 'v', Kind::Structure, "UnsafeMutableRawPointer"           },
+            { 'W', Kind::Structure, "UnsafeRawBufferPointer"            },
+            { 'w', Kind::Structure, "UnsafeMutableRawBufferPointer"     },
+            { 'q', Kind::Enum,      "Optional"                          },
+            { 'B', Kind::Protocol,  "BinaryFloatingPoint"               },
+            { 'E', Kind::Protocol,  "Encodable"                         },
+            { 'e', Kind::Protocol,  "Decodable"                         },
+            { 'F', Kind::Protocol,  "FloatingPoint"                     },
+            { 'G', Kind::Protocol,  "RandomNumberGenerator"             },
+            { 'H', Kind::Protocol,  "Hashable"                          },
+            { 'j', Kind::Protocol,  "Numeric"                           },
+            { 'K', Kind::Protocol,  "BidirectionalCollection"           },
+            { 'k', Kind::Protocol,  "RandomAccessCollection"            },
+            { 'L', Kind::Protocol,  "Comparable"                        },
+            { 'l', Kind::Protocol,  "Collection"                        },
+            { 'M', Kind::Protocol,  "MutableCollection"                 },
+            { 'm', Kind::Protocol,  "RangeReplaceableCollection"        },
+            { 'Q', Kind::Protocol,  "Equatable"                         },
+            { 'T', Kind::Protocol,  "Sequence"                          },
+            { 't', Kind::Protocol,  "IteratorProtocol"                  },
+            { 'U', Kind::Protocol,  "UnsignedInteger"                   },
+            { 'X', Kind::Protocol,  "RangeExpression"                   },
+            { 'x', Kind::Protocol,  "Strideable"                        },
+            { 'Y', Kind::Protocol,  "RawRepresentable"                  },
+            { 'y', Kind::Protocol,  "StringProtocol"                    },
+            { 'Z', Kind::Protocol,  "SignedInteger"                     },
+            { 'z', Kind::Protocol,  "BinaryInteger"                     }
+        };
+        
+        static const std::tuple< char, Kind, const char * > concurrency[] =
+        {
+            { 'A', Kind::Protocol,  "Actor"                 },
+            { 'C', Kind::Structure, "CheckedContinuation"   },
+            { 'c', Kind::Structure, "UnsafeContinuation"    },
+            { 'E', Kind::Structure, "CancellationError"     },
+            { 'e', Kind::Structure, "UnownedSerialExecutor" },
+            { 'F', Kind::Protocol,  "Executor"              },
+            { 'f', Kind::Protocol,  "SerialExecutor"        },
+            { 'G', Kind::Structure, "TaskGroup"             },
+            { 'g', Kind::Structure, "ThrowingTaskGroup"     },
+            { 'I', Kind::Protocol,  "AsyncIteratorProtocol" },
+            { 'i', Kind::Protocol,  "AsyncSequence"         },
+            { 'J', Kind::Structure, "UnownedJob"            },
+            { 'M', Kind::Class,     "MainActor"             },
+            { 'P', Kind::Structure, "TaskPriority"          },
+            { 'S', Kind::Structure, "AsyncStream"           },
+            { 's', Kind::Structure, "AsyncThrowingStream"   },
+            { 'T', Kind::Structure, "Task"                  },
+            { 't', Kind::Structure, "UnsafeCurrentTask"     }
+        };
+        
+        uint64_t repeat( 1 );
+        bool     secondLevel;
+        char     c;
+        
+        if( this->next( 'o' ) )
+        {
+            return this->make( Kind::Module, "__C" );
+        }
+        
+        if( this->next( 'C' ) )
+        {
+            return this->make( Kind::Module, "__C_Synthesized" );
+        }
+        
+        if( this->next( 'g' ) )
+        {
+            Node * wrapped( this->pop( Kind::Type ) );
+            Node * optional;
+            
+            if( wrapped == nullptr )
+            {
+                return nullptr;
+            }
+            
+            optional = this->type( this->make( Kind::Enum, { this->make( Kind::Module, "Swift" ), this->make( Kind::Identifier, "Optional" ) } ) );
+            optional = this->type( this->make( Kind::BoundGeneric, { optional, this->make( Kind::TypeList, { wrapped } ) } ) );
+            
+            this->_substitutions.push_back( optional );
+            
+            return optional;
+        }
+        
+        if( this->peek() >= '0' && this->peek() <= '9' && ( this->natural( repeat ) == false || repeat > MaxRepeat ) )
+        {
+            return nullptr;
+        }
+        
+        secondLevel = this->next( 'c' );
+        c           = this->next();
+        
+        for( const auto & entry: secondLevel ? std::vector< std::tuple< char, Kind, const char * > >( std::begin( concurrency ), std::end( concurrency ) ) : std::vector< std::tuple< char, Kind, const char * > >( std::begin( types ), std::end( types ) ) )
+        {
+            if( std::get< 0 >( entry ) == c )
+            {
+                Node * node( this->type( this->make( std::get< 1 >( entry ), { this->make( Kind::Module, "Swift" ), this->make( Kind::Identifier, std::get< 2 >( entry ) ) } ) ) );
+                
+                for( uint64_t i = 1; i < repeat; i++ )
+                {
+                    this->push( node );
+                }
+                
+                return node;
+            }
+        }
+        
+        return nullptr;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::nominal( Kind kind )
+    {
+        Node * name( this->popDeclName() );
+        Node * node( this->type( this->make( kind, { this->popContext(), name } ) ) );
+        
+        if( node != nullptr )
+        {
+            this->_substitutions.push_back( node );
+        }
+        
+        return node;
+    }
+    
+    /* Generic arguments follow a y after the nominal type. Arguments of nested generic types are not supported. */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::boundGeneric()
+    {
+        Node * arguments( this->make( Kind::TypeList ) );
+        Node * nominal;
+        Node * node;
+        
+        while( Node * argument = this->pop( Kind::Type ) )
+        {
+            arguments->children.insert( arguments->children.begin(), argument );
+        }
+        
+        if( this->pop( Kind::EmptyList ) == nullptr || ( nominal = this->pop( Kind::Type ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        switch( nominal->children.front()->kind )
+        {
+            case Kind::Class:
+            case Kind::Structure:
+            case Kind::Enum:
+            case Kind::TypeAlias: break;
+            default:              return nullptr;
+        }
+        
+        node = this->type( this->make( Kind::BoundGeneric, { nominal, arguments } ) );
+        
+        this->_substitutions.push_back( node );
+        
+        return node;
+    }
+    
+    /* Elements are mangled as a type and an optional label, the first one being followed by _ */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::tuple()
+    {
+        Node * tuple( this->make( Kind::Tuple ) );
+        bool   first( false );
+        
+        if( this->pop( Kind::EmptyList ) != nullptr )
+        {
+            return this->type( tuple );
+        }
+        
+        do
+        {
+            Node * element( this->make( Kind::TupleElement ) );
+            Node * label;
+            Node * type;
+            
+            first = this->pop( Kind::FirstElementMarker ) != nullptr;
+            
+            if( this->pop( Kind::VariadicMarker ) != nullptr )
+            {
+                element->index = 1;
+            }
+            
+            if( ( label = this->pop( Kind::Identifier ) ) != nullptr )
+            {
+                element->text = label->text;
+            }
+            
+            if( ( type = this->pop( Kind::Type ) ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            element->children.push_back( type );
+            tuple->children.insert( tuple->children.begin(), element );
+        }
+        while( first == false );
+        
+        return this->type( tuple );
+    }
+    
+    /* The parameters are on top of the result type, and the annotations on top of the parameters */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::functionType( std::string prefix )
+    {
+        Node * function( this->make( Kind::FunctionType, std::move( prefix ) ) );
+        Node * parameters;
+        Node * result;
+        
+        if( this->pop( Kind::Throws ) != nullptr )
+        {
+            function->index |= FunctionThrows;
+        }
+        
+        if( this->pop( Kind::Sendable ) != nullptr )
+        {
+            function->index |= FunctionSendable;
+        }
+        
+        if( this->pop( Kind::Async ) != nullptr )
+        {
+            function->index |= FunctionAsync;
+        }
+        
+        parameters = ( this->pop( Kind::EmptyList ) != nullptr ) ? this->type( this->make( Kind::Tuple ) ) : this->pop( Kind::Type );
+        result     = ( this->pop( Kind::EmptyList ) != nullptr ) ? this->type( this->make( Kind::Tuple ) ) : this->pop( Kind::Type );
+        
+        if( parameters == nullptr || result == nullptr )
+        {
+            return nullptr;
+        }
+        
+        function->children.push_back( parameters );
+        function->children.push_back( result );
+        
+        return this->type( function );
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::functionEntity()
+    {
+        char     c( this->next() );
+        Kind     kind;
+        Node *   node;
+        uint64_t index( 0 );
+        
+        switch( c )
+        {
+            case 'C': kind = Kind::Allocator;       break;
+            case 'c': kind = Kind::Constructor;     break;
+            case 'D': kind = Kind::Deallocator;     break;
+            case 'd': kind = Kind::Destructor;      break;
+            case 'i': kind = Kind::Initializer;     break;
+            case 'A': kind = Kind::DefaultArgument; break;
+            case 'U':
+            case 'u': kind = Kind::Closure;         break;
+            default:  return nullptr;
+        }
+        
+        if( kind == Kind::Allocator || kind == Kind::Constructor )
+        {
+            Node * type;
+            Node * labels;
+            
+            this->pop( Kind::PrivateName );
+            
+            type   = this->pop( Kind::Type );
+            labels = this->popLabels( type );
+            node   = this->make( kind, { this->popContext(), type } );
+            
+            if( node != nullptr && labels != nullptr )
+            {
+                node->children.push_back( labels );
+            }
+            
+            return node;
+        }
+        
+        if( kind == Kind::Closure )
+        {
+            Node * type;
+            
+            if( this->index( index ) == false )
+            {
+                return nullptr;
+            }
+            
+            type = this->pop( Kind::Type );
+            node = this->make( kind, { this->popContext(), type } );
+            
+            if( node != nullptr )
+            {
+                node->index = index;
+                node->text  = ( c == 'U' ) ? "closure #" : "implicit closure #";
+            }
+            
+            return node;
+        }
+        
+        if( kind == Kind::DefaultArgument && this->index( index ) == false )
+        {
+            return nullptr;
+        }
+        
+        node = this->make( kind, { this->popContext() } );
+        
+        if( node != nullptr )
+        {
+            node->index = index;
+        }
+        
+        return node;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::entity( Kind kind )
+    {
+        Node * type( this->pop( Kind::Type ) );
+        Node * labels( this->popLabels( type ) );
+        Node * name( this->popDeclName() );
+        Node * node( this->make( kind, { this->popContext(), name, type } ) );
+        
+        if( node != nullptr && labels != nullptr )
+        {
+            node->children.push_back( labels );
+        }
+        
+        return node;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::accessor( Node * storage )
+    {
+        const char * name;
+        Node *       node;
+        
+        if( storage == nullptr )
+        {
+            return nullptr;
+        }
+        
+        switch( this->next() )
+        {
+            case 'p': return storage;
+            case 'g': name = "getter";            break;
+            case 's': name = "setter";            break;
+            case 'm': name = "materializeForSet"; break;
+            case 'w': name = "willset";           break;
+            case 'W': name = "didset";            break;
+            case 'r': name = "read";              break;
+            case 'M': name = "modify";            break;
+            case 'i': name = "init";              break;
+            
+            case 'a':
+                
+                switch( this->next() )
+                {
+                    case 'O': name = "owningMutableAddressor";        break;
+                    case 'o': name = "nativeOwningMutableAddressor";  break;
+                    case 'P': name = "nativePinningMutableAddressor"; break;
+                    case 'u': name = "unsafeMutableAddressor";        break;
+                    default:  return nullptr;
+                }
+                
+                break;
+            
+            case 'l':
+                
+                switch( this->next() )
+                {
+                    case 'O': name = "owningAddressor";        break;
+                    case 'o': name = "nativeOwningAddressor";  break;
+                    case 'p': name = "nativePinningAddressor"; break;
+                    case 'u': name = "unsafeAddressor";        break;
+                    default:  return nullptr;
+                }
+                
+                break;
+            
+            default: return nullptr;
+        }
+        
+        node = this->make( Kind::Accessor, { storage } );
+        
+        node->text = name;
+        
+        return node;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::subscript()
+    {
+        Node * type;
+        Node * labels;
+        Node * node;
+        
+        this->pop( Kind::PrivateName );
+        
+        type   = this->pop( Kind::Type );
+        labels = this->popLabels( type );
+        node   = this->make( Kind::Subscript, { this->popContext(), type } );
+        
+        if( node != nullptr && labels != nullptr )
+        {
+            node->children.push_back( labels );
+        }
+        
+        return this->accessor( node );
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::extension()
+    {
+        Node * module;
+        Node * type;
+        
+        this->pop( Kind::Signature );
+        
+        if( ( module = this->popModule() ) == nullptr || ( type = this->pop( Kind::Type ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        return this->make( Kind::Extension, { module, type->children.front() } );
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::localName()
+    {
+        Node *   node;
+        uint64_t index;
+        
+        if( this->next( 'L' ) || this->next( 'l' ) )
+        {
+            bool   named( this->_name[ this->_position - 1 ] == 'L' );
+            Node * discriminator( this->pop( Kind::Identifier ) );
+            Node * name( named ? this->popDeclName() : nullptr );
+            
+            if( discriminator == nullptr || ( named && name == nullptr ) )
+            {
+                return nullptr;
+            }
+            
+            node       = named ? this->make( Kind::PrivateName, { name } ) : this->make( Kind::PrivateName );
+            node->text = discriminator->text;
+            
+            return node;
+        }
+        
+        if( this->index( index ) == false || ( node = this->make( Kind::LocalName, { this->popDeclName() } ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        node->index = index;
+        
+        return node;
+    }
+    
+    /* Operator characters are mangled as letters */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::operatorName()
+    {
+        static const char characters[] = "& @/= >    <*!|+?%-~   ^ .";
+        
+        Node *      identifier( this->pop( Kind::Identifier ) );
+        std::string text;
+        
+        if( identifier == nullptr )
+        {
+            return nullptr;
+        }
+        
+        for( char c: identifier->text )
+        {
+            if( c & 0x80 )
+            {
+                text += c;
+            }
+            else if( c < 'a' || c > 'z' || characters[ c - 'a' ] == ' ' )
+            {
+                return nullptr;
+            }
+            else
+            {
+                text += characters[ c - 'a' ];
+            }
+        }
+        
+        switch( this->next() )
+        {
+            case 'i': return this->make( Kind::Operator, text + " infix" );
+            case 'p': return this->make( Kind::Operator, text + " prefix" );
+            case 'P': return this->make( Kind::Operator, text + " postfix" );
+            default:  return nullptr;
+        }
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::protocolList()
+    {
+        Node * list( this->make( Kind::ProtocolList, "Any" ) );
+        bool   first( false );
+        
+        if( this->pop( Kind::EmptyList ) != nullptr )
+        {
+            return this->type( list );
+        }
+        
+        do
+        {
+            Node * protocol;
+            
+            first = this->pop( Kind::FirstElementMarker ) != nullptr;
+            
+            if( ( protocol = this->popProtocol() ) == nullptr )
+            {
+                return nullptr;
+            }
+            
+            list->children.insert( list->children.begin(), protocol );
+        }
+        while( first == false );
+        
+        return this->type( list );
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::genericParam()
+    {
+        uint64_t depth( 0 );
+        uint64_t index;
+        
+        if( this->next( 'd' ) )
+        {
+            if( this->index( depth ) == false || this->index( index ) == false )
+            {
+                return nullptr;
+            }
+            
+            depth++;
+        }
+        else if( this->next( 'z' ) )
+        {
+            index = 0;
+        }
+        else if( this->index( index ) )
+        {
+            index++;
+        }
+        else
+        {
+            return nullptr;
+        }
+        
+        return this->type( this->make( Kind::GenericParam, ParamName( depth, index ) ) );
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::signature( bool counts )
+    {
+        Node * signature( this->make( Kind::Signature ) );
+        size_t position;
+        
+        if( counts )
+        {
+            while( this->next( 'l' ) == false )
+            {
+                Node * count( this->make( Kind::ParamCount ) );
+                
+                if( this->next( 'z' ) == false )
+                {
+                    if( this->index( count->index ) == false )
+                    {
+                        return nullptr;
+                    }
+                    
+                    count->index++;
+                }
+                
+                signature->children.push_back( count );
+            }
+        }
+        else
+        {
+            signature->children.push_back( this->make( Kind::ParamCount ) );
+            
+            signature->children.back()->index = 1;
+        }
+        
+        position = signature->children.size();
+        
+        while( Node * requirement = this->pop( Kind::Requirement ) )
+        {
+            signature->children.insert( signature->children.begin() + static_cast< std::ptrdiff_t >( position ), requirement );
+        }
+        
+        return signature;
+    }
+    
+    /* Only requirements on generic parameters are supported */
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::requirement()
+    {
+        const char * relation( ": " );
+        bool         conformance( false );
+        Node *       subject;
+        Node *       constraint;
+        Node *       node;
+        
+        if( this->next( 's' ) )
+        {
+            relation = " == ";
+        }
+        else if( this->next( 'b' ) == false )
+        {
+            conformance = true;
+        }
+        
+        if( ( subject = this->genericParam() ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        /* Conformances name the protocol as a context, same-type and base class requirements a type */
+        constraint = ( conformance ) ? this->popProtocol() : this->pop( Kind::Type );
+        
+        if( constraint == nullptr || ( node = this->make( Kind::Requirement, { subject, constraint } ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        node->text = relation;
+        
+        return node;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::associatedType()
+    {
+        Node * base;
+        Node * name;
+        Node * node;
+        
+        switch( this->next() )
+        {
+            case 'z': base = this->type( this->make( Kind::GenericParam, ParamName( 0, 0 ) ) ); break;
+            case 'y': base = this->genericParam();                                             break;
+            case 'x': base = nullptr;                                                          break;
+            default:  return nullptr;
+        }
+        
+        this->popProtocol();
+        
+        if( ( name = this->pop( Kind::Identifier ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        if( base == nullptr && ( base = this->pop( Kind::Type ) ) == nullptr )
+        {
+            return nullptr;
+        }
+        
+        node       = this->make( Kind::DependentMember, { base } );
+        node->text = name->text;
+        node       = this->type( node );
+        
+        this->_substitutions.push_back( node );
+        
+        return node;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::metadata()
+    {
+        const char * prefix;
+        Node *       child;
+        Node *       node;
+        
+        switch( this->next() )
+        {
+            case 'a': prefix = "type metadata accessor for ";                          break;
+            case 'n': prefix = "nominal type descriptor for ";                         break;
+            case 'f': prefix = "full type metadata for ";                              break;
+            case 'm': prefix = "metaclass for ";                                       break;
+            case 'L': prefix = "lazy cache variable for type metadata for ";           break;
+            case 'o': prefix = "class metadata base offset for ";                      break;
+            case 'r': prefix = "type metadata completion function for ";               break;
+            case 'i': prefix = "type metadata instantiation function for ";            break;
+            case 'I': prefix = "type metadata instantiation cache for ";               break;
+            case 'l': prefix = "type metadata singleton initialization cache for ";    break;
+            case 'u': prefix = "method lookup function for ";                          break;
+            case 'F': prefix = "reflection metadata field descriptor ";                break;
+            case 'p': prefix = "protocol descriptor for ";                             break;
+            case 'c': prefix = "protocol conformance descriptor for ";                 break;
+            default:  return nullptr;
+        }
+        
+        switch( this->_name[ this->_position - 1 ] )
+        {
+            case 'p': child = this->popProtocol();    break;
+            case 'c': child = this->popConformance(); break;
+            default:  child = this->pop( Kind::Type ); break;
+        }
+        
+        if( ( node = this->make( Kind::Global, { child } ) ) != nullptr )
+        {
+            node->text = prefix;
+        }
+        
+        return node;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::witness()
+    {
+        const char * prefix;
+        Node *       child;
+        Node *       node;
+        
+        switch( this->next() )
+        {
+            case 'P': prefix = "protocol witness table for ";          child = this->popConformance(); break;
+            case 'a': prefix = "protocol witness table accessor for "; child = this->popConformance(); break;
+            case 'p': prefix = "protocol witness table pattern for ";  child = this->popConformance(); break;
+            case 'G': prefix = "generic protocol witness table for ";  child = this->popConformance(); break;
+            
+            case 'v':
+                
+                switch( this->next() )
+                {
+                    case 'd': prefix = "direct field offset for ";   break;
+                    case 'i': prefix = "indirect field offset for "; break;
+                    default:  return nullptr;
+                }
+                
+                child = this->popEntity();
+                
+                break;
+            
+            default: return nullptr;
+        }
+        
+        if( ( node = this->make( Kind::Global, { child } ) ) != nullptr )
+        {
+            node->text = prefix;
+        }
+        
+        return node;
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::thunk()
+    {
+        switch( this->next() )
+        {
+            case 'A': return this->make( Kind::Attribute, "partial apply forwarder for " );
+            case 'j': return this->make( Kind::Attribute, "dispatch thunk of " );
+            case 'q': return this->make( Kind::Attribute, "method descriptor for " );
+            case 'm': return this->make( Kind::Attribute, "merged " );
+            case 'o': return this->make( Kind::Attribute, "@objc " );
+            case 'O': return this->make( Kind::Attribute, "@nonobjc " );
+            case 'D': return this->make( Kind::Attribute, "dynamic " );
+            
+            case 'W':
+            {
+                Node * entity( this->popEntity() );
+                
+                return this->make( Kind::Witness, { entity, this->popConformance() } );
+            }
+            
+            default: return nullptr;
+        }
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::special()
+    {
+        switch( this->next() )
+        {
+            case 'E': return this->functionType( {} );
+            case 'B': return this->functionType( "@convention(block) " );
+            case 'C': return this->functionType( "@convention(c) " );
+            case 'f': return this->functionType( "@convention(thin) " );
+            
+            case 'l':
+            {
+                Node * list( this->make( Kind::ProtocolList, "Swift.AnyObject" ) );
+                
+                return this->type( list );
+            }
+            
+            case 'p':
+            {
+                Node * type( this->pop( Kind::Type ) );
+                
+                return ( type == nullptr ) ? nullptr : this->type( this->make( Kind::Metatype, { type } ) );
+            }
+            
+            case 'S':
+            {
+                char   c( this->next() );
+                Node * value( this->pop( Kind::Type ) );
+                Node * key( ( c == 'D' ) ? this->pop( Kind::Type ) : nullptr );
+                Node * sugar;
+                
+                if( value == nullptr || ( c == 'D' && key == nullptr ) )
+                {
+                    return nullptr;
+                }
+                
+                switch( c )
+                {
+                    case 'q': sugar = this->make( Kind::Enum,      { this->make( Kind::Module, "Swift" ), this->make( Kind::Identifier, "Optional"   ) } ); break;
+                    case 'a': sugar = this->make( Kind::Structure, { this->make( Kind::Module, "Swift" ), this->make( Kind::Identifier, "Array"      ) } ); break;
+                    case 'D': sugar = this->make( Kind::Structure, { this->make( Kind::Module, "Swift" ), this->make( Kind::Identifier, "Dictionary" ) } ); break;
+                    default:  return nullptr;
+                }
+                
+                return this->type( this->make( Kind::BoundGeneric, { this->type( sugar ), ( key != nullptr ) ? this->make( Kind::TypeList, { key, value } ) : this->make( Kind::TypeList, { value } ) } ) );
+            }
+            
+            default: return nullptr;
+        }
+    }
+    
+    Demangler::IMPL::SwiftParser::Node * Demangler::IMPL::SwiftParser::builtin()
+    {
+        uint64_t bits;
+        
+        switch( this->next() )
+        {
+            case 'b': return this->type( this->make( Kind::Builtin, "Builtin.BridgeObject" ) );
+            case 'B': return this->type( this->make( Kind::Builtin, "Builtin.UnsafeValueBuffer" ) );
+            case 'e': return this->type( this->make( Kind::Builtin, "Builtin.Executor" ) );
+            case 'I': return this->type( this->make( Kind::Builtin, "Builtin.IntLiteral" ) );
+            case 'j': return this->type( this->make( Kind::Builtin, "Builtin.Job" ) );
+            case 'o': return this->type( this->make( Kind::Builtin, "Builtin.NativeObject" ) );
+            case 'O': return this->type( this->make( Kind::Builtin, "Builtin.UnknownObject" ) );
+            case 'p': return this->type( this->make( Kind::Builtin, "Builtin.RawPointer" ) );
+            case 'w': return this->type( this->make( Kind::Builtin, "Builtin.Word" ) );
+            
+            case 'i':
+                
+                return ( this->natural( bits ) && this->next( '_' ) ) ? this->type( this->make( Kind::Builtin, "Builtin.Int" + std::to_string( bits ) ) ) : nullptr;
+            
+            case 'f':
+                
+                return ( this->natural( bits ) && this->next( '_' ) ) ? this->type( this->make( Kind::Builtin, "Builtin.FPIEEE" + std::to_string( bits ) ) ) : nullptr;
+            
+            default: return nullptr;
+        }
+    }
+    
+    bool Demangler::IMPL::SwiftParser::IsContext( Kind kind )
+    {
+        switch( kind )
+        {
+            case Kind::Module:
+            case Kind::Class:
+            case Kind::Structure:
+            case Kind::Enum:
+            case Kind::Protocol:
+            case Kind::TypeAlias:
+            case Kind::Extension:
+            case Kind::Function:
+            case Kind::Variable:
+            case Kind::Subscript:
+            case Kind::Accessor:
+            case Kind::Allocator:
+            case Kind::Constructor:
+            case Kind::Deallocator:
+            case Kind::Destructor:
+            case Kind::Closure:
+            case Kind::Initializer:
+            case Kind::DefaultArgument:
+            case Kind::Static:          return true;
+            default:                    return false;
+        }
+    }
+    
+    bool Demangler::IMPL::SwiftParser::IsDeclName( Kind kind )
+    {
+        return kind == Kind::Identifier || kind == Kind::Operator || kind == Kind::LocalName || kind == Kind::PrivateName;
+    }
+    
+    /* Generic parameters are named A to Z, then BA, BB... with the depth as a suffix */
+    std::string Demangler::IMPL::SwiftParser::ParamName( uint64_t depth, uint64_t index )
+    {
+        std::string name;
+        
+        do
+        {
+            name  += static_cast< char >( 'A' + ( index % 26 ) );
+            index /= 26;
+        }
+        while( index != 0 );
+        
+        if( depth != 0 )
+        {
+            name += std::to_string( depth );
+        }
+        
+        return name;
+    }
+    
+    void Demangler::IMPL::SwiftParser::PrintList( const std::vector< Node * > & nodes, const char * separator, Output & out )
+    {
+        for( size_t i = 0; i < nodes.size(); i++ )
+        {
+            if( i > 0 )
+            {
+                out.text += separator;
+            }
+            
+            Print( nodes[ i ], out );
+        }
+    }
+    
+    void Demangler::IMPL::SwiftParser::PrintParameters( const Node * parameters, const Node * labels, Output & out )
+    {
+        const Node *                parameter( parameters->children.front() );
+        std::vector< const Node * > elements;
+        
+        if( parameter->kind == Kind::Tuple )
+        {
+            elements.assign( parameter->children.begin(), parameter->children.end() );
+        }
+        else
+        {
+            elements.push_back( parameters );
+        }
+        
+        out.text += "(";
+        
+        for( size_t i = 0; i < elements.size(); i++ )
+        {
+            if( i > 0 )
+            {
+                out.text += ", ";
+            }
+            
+            if( labels != nullptr && i < labels->children.size() )
+            {
+                out.text += ( labels->children[ i ]->kind == Kind::Identifier ) ? labels->children[ i ]->text : "_";
+                out.text += ": ";
+            }
+            
+            if( elements[ i ]->kind == Kind::TupleElement )
+            {
+                Print( elements[ i ]->children.front(), out );
+                
+                if( elements[ i ]->index != 0 )
+                {
+                    out.text += "...";
+                }
+            }
+            else
+            {
+                Print( elements[ i ], out );
+            }
+        }
+        
+        out.text += ")";
+    }
+    
+    /* Prints a function type, preceded by its generic signature, with the argument labels of the declaration */
+    void Demangler::IMPL::SwiftParser::PrintFunction( const Node * type, const Node * labels, Output & out )
+    {
+        const Node * function( type->children.front() );
+        
+        if( function->kind == Kind::DependentGenericType )
+        {
+            Print( function->children[ 0 ], out );
+            
+            function = function->children[ 1 ]->children.front();
+        }
+        
+        if( function->kind != Kind::FunctionType )
+        {
+            out.text += " : ";
+            
+            Print( function, out );
+            
+            return;
+        }
+        
+        out.text += function->text;
+        
+        PrintParameters( function->children[ 0 ], labels, out );
+        
+        if( function->index & FunctionAsync )  { out.text += " async"; }
+        if( function->index & FunctionThrows ) { out.text += " throws"; }
+        
+        out.text += " -> ";
+        
+        Print( function->children[ 1 ], out );
+    }
+    
+    void Demangler::IMPL::SwiftParser::Print( const Node * node, Output & out )
+    {
+        auto labels
+        {
+            [ & ]( size_t index ) -> const Node *
+            {
+                return ( node->children.size() > index ) ? node->children[ index ] : nullptr;
+            }
+        };
+        
+        if( out.overflow || out.depth > MaxDepth || out.text.size() > MaxLength )
+        {
+            out.overflow = true;
+            
+            return;
+        }
+        
+        out.depth++;
+        
+        switch( node->kind )
+        {
+            case Kind::Module:
+            case Kind::Identifier:
+            case Kind::Operator:
+            case Kind::Builtin:
+            case Kind::GenericParam:
+                
+                out.text += node->text;
+                
+                break;
+            
+            case Kind::LocalName:
+                
+                Print( node->children.front(), out );
+                
+                out.text += " #" + std::to_string( node->index + 1 );
+                
+                break;
+            
+            case Kind::PrivateName:
+                
+                out.text += "(";
+                
+                if( node->children.empty() == false )
+                {
+                    Print( node->children.front(), out );
+                    
+                    out.text += " ";
+                }
+                
+                out.text += "in " + node->text + ")";
+                
+                break;
+            
+            case Kind::Class:
+            case Kind::Structure:
+            case Kind::Enum:
+            case Kind::Protocol:
+            case Kind::TypeAlias:
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += ".";
+                
+                Print( node->children[ 1 ], out );
+                
+                break;
+            
+            case Kind::Extension:
+                
+                out.text += "(extension in ";
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += "):";
+                
+                Print( node->children[ 1 ], out );
+                
+                break;
+            
+            case Kind::BoundGeneric:
+            {
+                const Node * nominal( node->children[ 0 ]->children.front() );
+                const Node * arguments( node->children[ 1 ] );
+                std::string  name;
+                
+                if( nominal->children[ 0 ]->kind == Kind::Module && nominal->children[ 0 ]->text == "Swift" && nominal->children[ 1 ]->kind == Kind::Identifier )
+                {
+                    name = nominal->children[ 1 ]->text;
+                }
+                
+                /* Optional, Array and Dictionary use the sugared syntax */
+                if( name == "Optional" && arguments->children.size() == 1 )
+                {
+                    bool function( arguments->children[ 0 ]->children.front()->kind == Kind::FunctionType );
+                    
+                    out.text += function ? "(" : "";
+                    
+                    Print( arguments->children[ 0 ], out );
+                    
+                    out.text += function ? ")?" : "?";
+                }
+                else if( name == "Array" && arguments->children.size() == 1 )
+                {
+                    out.text += "[";
+                    
+                    Print( arguments->children[ 0 ], out );
+                    
+                    out.text += "]";
+                }
+                else if( name == "Dictionary" && arguments->children.size() == 2 )
+                {
+                    out.text += "[";
+                    
+                    Print( arguments->children[ 0 ], out );
+                    
+                    out.text += " : ";
+                    
+                    Print( arguments->children[ 1 ], out );
+                    
+                    out.text += "]";
+                }
+                else
+                {
+                    Print( node->children[ 0 ], out );
+                    
+                    out.text += "<";
+                    
+                    PrintList( arguments->children, ", ", out );
+                    
+                    out.text += ">";
+                }
+                
+                break;
+            }
+            
+            case Kind::Type:
+            case Kind::TypeList:
+                
+                PrintList( node->children, ", ", out );
+                
+                break;
+            
+            case Kind::Tuple:
+                
+                out.text += "(";
+                
+                PrintList( node->children, ", ", out );
+                
+                out.text += ")";
+                
+                break;
+            
+            case Kind::TupleElement:
+                
+                if( node->text.empty() == false )
+                {
+                    out.text += node->text + ": ";
+                }
+                
+                Print( node->children.front(), out );
+                
+                if( node->index != 0 )
+                {
+                    out.text += "...";
+                }
+                
+                break;
+            
+            case Kind::FunctionType:
+                
+                out.text += node->text;
+                
+                if( node->index & FunctionSendable )
+                {
+                    out.text += "@Sendable ";
+                }
+                
+                PrintParameters( node->children[ 0 ], nullptr, out );
+                
+                if( node->index & FunctionAsync )  { out.text += " async"; }
+                if( node->index & FunctionThrows ) { out.text += " throws"; }
+                
+                out.text += " -> ";
+                
+                Print( node->children[ 1 ], out );
+                
+                break;
+            
+            case Kind::Metatype:
+                
+                Print( node->children.front(), out );
+                
+                out.text += ".Type";
+                
+                break;
+            
+            case Kind::ProtocolList:
+                
+                if( node->children.empty() )
+                {
+                    out.text += node->text;
+                }
+                
+                PrintList( node->children, " & ", out );
+                
+                break;
+            
+            case Kind::Prefixed:
+                
+                out.text += node->text;
+                
+                Print( node->children.front(), out );
+                
+                break;
+            
+            case Kind::DependentMember:
+                
+                Print( node->children.front(), out );
+                
+                out.text += "." + node->text;
+                
+                break;
+            
+            case Kind::DependentGenericType:
+                
+                Print( node->children[ 0 ], out );
+                
+                if( node->children[ 1 ]->children.front()->kind != Kind::FunctionType )
+                {
+                    out.text += " ";
+                }
+                
+                Print( node->children[ 1 ], out );
+                
+                break;
+            
+            case Kind::Signature:
+            {
+                size_t depth( 0 );
+                
+                out.text += "<";
+                
+                for( const Node * child: node->children )
+                {
+                    if( child->kind != Kind::ParamCount )
+                    {
+                        continue;
+                    }
+                    
+                    if( depth > 0 )
+                    {
+                        out.text += "><";
+                    }
+                    
+                    for( uint64_t i = 0; i < child->index; i++ )
+                    {
+                        out.text += ( i > 0 ) ? ", " : "";
+                        out.text += ParamName( depth, i );
+                    }
+                    
+                    depth++;
+                }
+                
+                for( size_t i = depth; i < node->children.size(); i++ )
+                {
+                    out.text += ( i == depth ) ? " where " : ", ";
+                    
+                    Print( node->children[ i ], out );
+                }
+                
+                out.text += ">";
+                
+                break;
+            }
+            
+            case Kind::Requirement:
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += node->text;
+                
+                Print( node->children[ 1 ], out );
+                
+                break;
+            
+            case Kind::Function:
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += ".";
+                
+                Print( node->children[ 1 ], out );
+                PrintFunction( node->children[ 2 ], labels( 3 ), out );
+                
+                break;
+            
+            case Kind::Variable:
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += ".";
+                
+                Print( node->children[ 1 ], out );
+                
+                out.text += " : ";
+                
+                Print( node->children[ 2 ], out );
+                
+                break;
+            
+            case Kind::Subscript:
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += ".subscript";
+                
+                PrintFunction( node->children[ 1 ], labels( 2 ), out );
+                
+                break;
+            
+            case Kind::Accessor:
+            {
+                const Node * storage( node->children.front() );
+                
+                Print( storage->children[ 0 ], out );
+                
+                if( storage->kind == Kind::Subscript )
+                {
+                    out.text += ".subscript." + node->text + " : ";
+                    
+                    Print( storage->children[ 1 ], out );
+                }
+                else
+                {
+                    out.text += ".";
+                    
+                    Print( storage->children[ 1 ], out );
+                    
+                    out.text += "." + node->text + " : ";
+                    
+                    Print( storage->children[ 2 ], out );
+                }
+                
+                break;
+            }
+            
+            case Kind::Allocator:
+            case Kind::Constructor:
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += ( node->kind == Kind::Allocator ) ? ".__allocating_init" : ".init";
+                
+                PrintFunction( node->children[ 1 ], labels( 2 ), out );
+                
+                break;
+            
+            case Kind::Deallocator:
+            case Kind::Destructor:
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += ( node->kind == Kind::Deallocator ) ? ".__deallocating_deinit" : ".deinit";
+                
+                break;
+            
+            case Kind::Closure:
+                
+                out.text += node->text + std::to_string( node->index + 1 ) + " ";
+                
+                Print( node->children[ 1 ], out );
+                
+                out.text += " in ";
+                
+                Print( node->children[ 0 ], out );
+                
+                break;
+            
+            case Kind::Initializer:
+                
+                out.text += "variable initialization expression of ";
+                
+                Print( node->children[ 0 ], out );
+                
+                break;
+            
+            case Kind::DefaultArgument:
+                
+                out.text += "default argument " + std::to_string( node->index ) + " of ";
+                
+                Print( node->children[ 0 ], out );
+                
+                break;
+            
+            case Kind::Static:
+                
+                out.text += "static ";
+                
+                Print( node->children.front(), out );
+                
+                break;
+            
+            case Kind::Global:
+            case Kind::Attribute:
+                
+                out.text += node->text;
+                
+                PrintList( node->children, "", out );
+                
+                break;
+            
+            case Kind::Conformance:
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += " : ";
+                
+                Print( node->children[ 1 ], out );
+                
+                out.text += " in ";
+                
+                Print( node->children[ 2 ], out );
+                
+                break;
+            
+            case Kind::Witness:
+                
+                out.text += "protocol witness for ";
+                
+                Print( node->children[ 0 ], out );
+                
+                out.text += " in conformance ";
+                
+                Print( node->children[ 1 ], out );
+                
+                break;
+            
+            default:
+                
+                out.overflow = true;
+                
+                break;
+        }
+        
+        out.depth--;
+    }
+}
@@ -0,0 +1,666 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Digest.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/Digest.hpp>
+#include <stdexcept>
+#include <cstring>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#define MACHO_DIGEST_SHA_NI
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined( __aarch64__ ) && defined( __ARM_FEATURE_SHA2 )
+#define MACHO_DIGEST_ARM_SHA
+#include <arm_neon.h>
+#endif
+
+/* The SIMD round loops only schedule well once the register indices are constants */
+#if defined( __clang__ )
+#define MACHO_DIGEST_UNROLL _Pragma( "unroll" )
+#else
+#define MACHO_DIGEST_UNROLL _Pragma( "GCC unroll 20" )
+#endif
+
+namespace MachO
+{
+    namespace Digest
+    {
+        using Transform32 = void ( * )( uint32_t * state, const uint8_t * data, size_t blocks );
+        
+        static const uint32_t SHA256K[ 64 ] =
+        {
+            0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+            0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+            0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+            0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+            0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+            0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+            0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+            0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+        };
+        
+        static const uint64_t SHA512K[ 80 ] =
+        {
+            0x428A2F98D728AE22, 0x7137449123EF65CD, 0xB5C0FBCFEC4D3B2F, 0xE9B5DBA58189DBBC, 0x3956C25BF348B538,
+            0x59F111F1B605D019, 0x923F82A4AF194F9B, 0xAB1C5ED5DA6D8118, 0xD807AA98A3030242, 0x12835B0145706FBE,
+            0x243185BE4EE4B28C, 0x550C7DC3D5FFB4E2, 0x72BE5D74F27B896F, 0x80DEB1FE3B1696B1, 0x9BDC06A725C71235,
+            0xC19BF174CF692694, 0xE49B69C19EF14AD2, 0xEFBE4786384F25E3, 0x0FC19DC68B8CD5B5, 0x240CA1CC77AC9C65,
+            0x2DE92C6F592B0275, 0x4A7484AA6EA6E483, 0x5CB0A9DCBD41FBD4, 0x76F988DA831153B5, 0x983E5152EE66DFAB,
+            0xA831C66D2DB43210, 0xB00327C898FB213F, 0xBF597FC7BEEF0EE4, 0xC6E00BF33DA88FC2, 0xD5A79147930AA725,
+            0x06CA6351E003826F, 0x142929670A0E6E70, 0x27B70A8546D22FFC, 0x2E1B21385C26C926, 0x4D2C6DFC5AC42AED,
+            0x53380D139D95B3DF, 0x650A73548BAF63DE, 0x766A0ABB3C77B2A8, 0x81C2C92E47EDAEE6, 0x92722C851482353B,
+            0xA2BFE8A14CF10364, 0xA81A664BBC423001, 0xC24B8B70D0F89791, 0xC76C51A30654BE30, 0xD192E819D6EF5218,
+            0xD69906245565A910, 0xF40E35855771202A, 0x106AA07032BBD1B8, 0x19A4C116B8D2D0C8, 0x1E376C085141AB53,
+            0x2748774CDF8EEB99, 0x34B0BCB5E19B48A8, 0x391C0CB3C5C95A63, 0x4ED8AA4AE3418ACB, 0x5B9CCA4F7763E373,
+            0x682E6FF3D6B2B8A3, 0x748F82EE5DEFB2FC, 0x78A5636F43172F60, 0x84C87814A1F0AB72, 0x8CC702081A6439EC,
+            0x90BEFFFA23631E28, 0xA4506CEBDE82BDE9, 0xBEF9A3F7B2C67915, 0xC67178F2E372532B, 0xCA273ECEEA26619C,
+            0xD186B8C721C0C207, 0xEADA7DD6CDE0EB1E, 0xF57D4F7FEE6ED178, 0x06F067AA72176FBA, 0x0A637DC5A2C898A6,
+            0x113F9804BEF90DAE, 0x1B710B35131C471B, 0x28DB77F523047D84, 0x32CAAB7B40C72493, 0x3C9EBE0A15C9BEBC,
+            0x431D67C49C100D4C, 0x4CC5D4BECB3E42B6, 0x597F299CFC657E2A, 0x5FCB6FAB3AD6FAEC, 0x6C44198C4A475817
+        };
+        
+        static inline uint32_t ROTL32( uint32_t value, unsigned int bits )
+        {
+            return ( value << bits ) | ( value >> ( 32 - bits ) );
+        }
+        
+        static inline uint32_t ROTR32( uint32_t value, unsigned int bits )
+        {
+            return ( value >> bits ) | ( value << ( 32 - bits ) );
+        }
+        
+        static inline uint64_t ROTR64( uint64_t value, unsigned int bits )
+        {
+            return ( value >> bits ) | ( value << ( 64 - bits ) );
+        }
+        
+        static inline uint32_t Load32( const uint8_t * p )
+        {
+            return ( static_cast< uint32_t >( p[ 0 ] ) << 24 ) | ( static_cast< uint32_t >( p[ 1 ] ) << 16 ) | ( static_cast< uint32_t >( p[ 2 ] ) << 8 ) | p[ 3 ];
+        }
+        
+        static inline uint64_t Load64( const uint8_t * p )
+        {
+            return ( static_cast< uint64_t >( Load32( p ) ) << 32 ) | Load32( p + 4 );
+        }
+        
+        static void SHA1Portable( uint32_t * state, const uint8_t * data, size_t blocks )
+        {
+            for( ; blocks > 0; blocks--, data += 64 )
+            {
+                uint32_t w[ 80 ];
+                uint32_t a( state[ 0 ] );
+                uint32_t b( state[ 1 ] );
+                uint32_t c( state[ 2 ] );
+                uint32_t d( state[ 3 ] );
+                uint32_t e( state[ 4 ] );
+                
+                for( size_t i = 0; i < 16; i++ )
+                {
+                    w[ i ] = Load32( data + i * 4 );
+                }
+                
+                for( size_t i = 16; i < 80; i++ )
+                {
+                    w[ i ] = ROTL32( w[ i - 3 ] ^ w[ i - 8 ] ^ w[ i - 14 ] ^ w[ i - 16 ], 1 );
+                }
+                
+                for( size_t i = 0; i < 80; i++ )
+                {
+                    uint32_t f;
+                    uint32_t k;
+                    
+                    if( i < 20 )
+                    {
+                        f = ( b & c ) | ( ~b & d );
+                        k = 0x5A827999;
+                    }
+                    else if( i < 40 )
+                    {
+                        f = b ^ c ^ d;
+                        k = 0x6ED9EBA1;
+                    }
+                    else if( i < 60 )
+                    {
+                        f = ( b & c ) | ( b & d ) | ( c & d );
+                        k = 0x8F1BBCDC;
+                    }
+                    else
+                    {
+                        f = b ^ c ^ d;
+                        k = 0xCA62C1D6;
+                    }
+                    
+                    {
+                        uint32_t t( ROTL32( a, 5 ) + f + e + k + w[ i ] );
+                        
+                        e = d;
+                        d = c;
+                        c = ROTL32( b, 30 );
+                        b = a;
+                        a = t;
+                    }
+                }
+                
+                state[ 0 ] += a;
+                state[ 1 ] += b;
+                state[ 2 ] += c;
+                state[ 3 ] += d;
+                state[ 4 ] += e;
+            }
+        }
+        
+        static void SHA256Portable( uint32_t * state, const uint8_t * data, size_t blocks )
+        {
+            for( ; blocks > 0; blocks--, data += 64 )
+            {
+                uint32_t w[ 64 ];
+                uint32_t s[ 8 ];
+                
+                for( size_t i = 0; i < 16; i++ )
+                {
+                    w[ i ] = Load32( data + i * 4 );
+                }
+                
+                for( size_t i = 16; i < 64; i++ )
+                {
+                    uint32_t s0( ROTR32( w[ i - 15 ], 7 ) ^ ROTR32( w[ i - 15 ], 18 ) ^ ( w[ i - 15 ] >> 3 ) );
+                    uint32_t s1( ROTR32( w[ i - 2 ], 17 ) ^ ROTR32( w[ i - 2 ], 19 ) ^ ( w[ i - 2 ] >> 10 ) );
+                    
+                    w[ i ] = w[ i - 16 ] + s0 + w[ i - 7 ] + s1;
+                }
+                
+                std::memcpy( s, state, sizeof( s ) );
+                
+                for( size_t i = 0; i < 64; i++ )
+                {
+                    uint32_t s1( ROTR32( s[ 4 ], 6 ) ^ ROTR32( s[ 4 ], 11 ) ^ ROTR32( s[ 4 ], 25 ) );
+                    uint32_t ch( ( s[ 4 ] & s[ 5 ] ) ^ ( ~s[ 4 ] & s[ 6 ] ) );
+                    uint32_t t1( s[ 7 ] + s1 + ch + SHA256K[ i ] + w[ i ] );
+                    uint32_t s0( ROTR32( s[ 0 ], 2 ) ^ ROTR32( s[ 0 ], 13 ) ^ ROTR32( s[ 0 ], 22 ) );
+                    uint32_t maj( ( s[ 0 ] & s[ 1 ] ) ^ ( s[ 0 ] & s[ 2 ] ) ^ ( s[ 1 ] & s[ 2 ] ) );
+                    
+                    s[ 7 ] = s[ 6 ];
+                    s[ 6 ] = s[ 5 ];
+                    s[ 5 ] = s[ 4 ];
+                    s[ 4 ] = s[ 3 ] + t1;
+                    s[ 3 ] = s[ 2 ];
+                    s[ 2 ] = s[ 1 ];
+                    s[ 1 ] = s[ 0 ];
+                    s[ 0 ] = t1 + s0 + maj;
+                }
+                
+                for( size_t i = 0; i < 8; i++ )
+                {
+                    state[ i ] += s[ i ];
+                }
+            }
+        }
+        
+        static void SHA512Portable( uint64_t * state, const uint8_t * data, size_t blocks )
+        {
+            for( ; blocks > 0; blocks--, data += 128 )
+            {
+                uint64_t w[ 80 ];
+                uint64_t s[ 8 ];
+                
+                for( size_t i = 0; i < 16; i++ )
+                {
+                    w[ i ] = Load64( data + i * 8 );
+                }
+                
+                for( size_t i = 16; i < 80; i++ )
+                {
+                    uint64_t s0( ROTR64( w[ i - 15 ], 1 ) ^ ROTR64( w[ i - 15 ], 8 ) ^ ( w[ i - 15 ] >> 7 ) );
+                    uint64_t s1( ROTR64( w[ i - 2 ], 19 ) ^ ROTR64( w[ i - 2 ], 61 ) ^ ( w[ i - 2 ] >> 6 ) );
+                    
+                    w[ i ] = w[ i - 16 ] + s0 + w[ i - 7 ] + s1;
+                }
+                
+                std::memcpy( s, state, sizeof( s ) );
+                
+                for( size_t i = 0; i < 80; i++ )
+                {
+                    uint64_t s1( ROTR64( s[ 4 ], 14 ) ^ ROTR64( s[ 4 ], 18 ) ^ ROTR64( s[ 4 ], 41 ) );
+                    uint64_t ch( ( s[ 4 ] & s[ 5 ] ) ^ ( ~s[ 4 ] & s[ 6 ] ) );
+                    uint64_t t1( s[ 7 ] + s1 + ch + SHA512K[ i ] + w[ i ] );
+                    uint64_t s0( ROTR64( s[ 0 ], 28 ) ^ ROTR64( s[ 0 ], 34 ) ^ ROTR64( s[ 0 ], 39 ) );
+                    uint64_t maj( ( s[ 0 ] & s[ 1 ] ) ^ ( s[ 0 ] & s[ 2 ] ) ^ ( s[ 1 ] & s[ 2 ] ) );
+                    
+                    s[ 7 ] = s[ 6 ];
+                    s[ 6 ] = s[ 5 ];
+                    s[ 5 ] = s[ 4 ];
+                    s[ 4 ] = s[ 3 ] + t1;
+                    s[ 3 ] = s[ 2 ];
+                    s[ 2 ] = s[ 1 ];
+                    s[ 1 ] = s[ 0 ];
+                    s[ 0 ] = t1 + s0 + maj;
+                }
+                
+                for( size_t i = 0; i < 8; i++ )
+                {
+                    state[ i ] += s[ i ];
+                }
+            }
+        }
+        
+        #if defined( MACHO_DIGEST_SHA_NI )
+        
+        static bool HasSHANI()
+        {
+            static const bool supported
+            (
+                []
+                {
+                    unsigned int eax;
+                    unsigned int ebx;
+                    unsigned int ecx;
+                    unsigned int edx;
+                    bool         sha;
+                    
+                    if( __get_cpuid_count( 7, 0, &eax, &ebx, &ecx, &edx ) == 0 )
+                    {
+                        return false;
+                    }
+                    
+                    sha = ( ebx & ( 1u << 29 ) ) != 0;
+                    
+                    if( __get_cpuid( 1, &eax, &ebx, &ecx, &edx ) == 0 )
+                    {
+                        return false;
+                    }
+                    
+                    /* SSSE3 and SSE4.1 are needed for the byte shuffles and blends */
+                    return sha && ( ecx & ( 1u << 9 ) ) != 0 && ( ecx & ( 1u << 19 ) ) != 0;
+                }
+                ()
+            );
+            
+            return supported;
+        }
+        
+        __attribute__( ( target( "sha,sse4.1" ) ) )
+        static __m128i SHA1Rounds( __m128i abcd, __m128i e, size_t group )
+        {
+            switch( group / 5 )
+            {
+                case 0:  return _mm_sha1rnds4_epu32( abcd, e, 0 );
+                case 1:  return _mm_sha1rnds4_epu32( abcd, e, 1 );
+                case 2:  return _mm_sha1rnds4_epu32( abcd, e, 2 );
+                default: return _mm_sha1rnds4_epu32( abcd, e, 3 );
+            }
+        }
+        
+        __attribute__( ( target( "sha,sse4.1" ) ) )
+        static void SHA1SHANI( uint32_t * state, const uint8_t * data, size_t blocks )
+        {
+            const __m128i mask( _mm_set_epi64x( 0x0001020304050607, 0x08090A0B0C0D0E0F ) );
+            __m128i       abcd( _mm_shuffle_epi32( _mm_loadu_si128( reinterpret_cast< const __m128i * >( state ) ), 0x1B ) );
+            __m128i       e0( _mm_set_epi32( static_cast< int >( state[ 4 ] ), 0, 0, 0 ) );
+            
+            for( ; blocks > 0; blocks--, data += 64 )
+            {
+                __m128i abcdSave( abcd );
+                __m128i e0Save( e0 );
+                __m128i e[ 2 ];
+                __m128i w[ 4 ];
+                
+                for( size_t i = 0; i < 4; i++ )
+                {
+                    w[ i ] = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + i * 16 ) ), mask );
+                }
+                
+                e[ 0 ] = _mm_add_epi32( e0, w[ 0 ] );
+                
+                /* Four rounds per group; the schedule for group g + 4 is spread over the three groups before it */
+                MACHO_DIGEST_UNROLL
+                for( size_t g = 0; g < 20; g++ )
+                {
+                    if( g > 0 )
+                    {
+                        e[ g & 1 ] = _mm_sha1nexte_epu32( e[ g & 1 ], w[ g & 3 ] );
+                    }
+                    
+                    e[ ( g + 1 ) & 1 ] = abcd;
+                    
+                    if( g >= 3 && g <= 18 )
+                    {
+                        w[ ( g + 1 ) & 3 ] = _mm_sha1msg2_epu32( w[ ( g + 1 ) & 3 ], w[ g & 3 ] );
+                    }
+                    
+                    abcd = SHA1Rounds( abcd, e[ g & 1 ], g );
+                    
+                    if( g >= 1 && g <= 16 )
+                    {
+                        w[ ( g + 3 ) & 3 ] = _mm_sha1msg1_epu32( w[ ( g + 3 ) & 3 ], w[ g & 3 ] );
+                    }
+                    
+                    if( g >= 2 && g <= 17 )
+                    {
+                        w[ ( g + 2 ) & 3 ] = _mm_xor_si128( w[ ( g + 2 ) & 3 ], w[ g & 3 ] );
+                    }
+                }
+                
+                e0   = _mm_sha1nexte_epu32( e[ 0 ], e0Save );
+                abcd = _mm_add_epi32( abcd, abcdSave );
+            }
+            
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( state ), _mm_shuffle_epi32( abcd, 0x1B ) );
+            
+            state[ 4 ] = static_cast< uint32_t >( _mm_extract_epi32( e0, 3 ) );
+        }
+        
+        __attribute__( ( target( "sha,sse4.1" ) ) )
+        static void SHA256SHANI( uint32_t * state, const uint8_t * data, size_t blocks )
+        {
+            const __m128i mask( _mm_set_epi64x( 0x0C0D0E0F08090A0B, 0x0405060700010203 ) );
+            __m128i       tmp( _mm_shuffle_epi32( _mm_loadu_si128( reinterpret_cast< const __m128i * >( state ) ), 0xB1 ) );
+            __m128i       state1( _mm_shuffle_epi32( _mm_loadu_si128( reinterpret_cast< const __m128i * >( state + 4 ) ), 0x1B ) );
+            __m128i       state0( _mm_alignr_epi8( tmp, state1, 8 ) );
+            
+            state1 = _mm_blend_epi16( state1, tmp, 0xF0 );
+            
+            for( ; blocks > 0; blocks--, data += 64 )
+            {
+                __m128i abefSave( state0 );
+                __m128i cdghSave( state1 );
+                __m128i w[ 4 ];
+                
+                for( size_t i = 0; i < 4; i++ )
+                {
+                    w[ i ] = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + i * 16 ) ), mask );
+                }
+                
+                MACHO_DIGEST_UNROLL
+                for( size_t g = 0; g < 16; g++ )
+                {
+                    __m128i msg( _mm_add_epi32( w[ g & 3 ], _mm_loadu_si128( reinterpret_cast< const __m128i * >( SHA256K + g * 4 ) ) ) );
+                    
+                    state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+                    
+                    if( g >= 3 && g <= 14 )
+                    {
+                        w[ ( g + 1 ) & 3 ] = _mm_add_epi32( w[ ( g + 1 ) & 3 ], _mm_alignr_epi8( w[ g & 3 ], w[ ( g + 3 ) & 3 ], 4 ) );
+                        w[ ( g + 1 ) & 3 ] = _mm_sha256msg2_epu32( w[ ( g + 1 ) & 3 ], w[ g & 3 ] );
+                    }
+                    
+                    state0 = _mm_sha256rnds2_epu32( state0, state1, _mm_shuffle_epi32( msg, 0x0E ) );
+                    
+                    if( g >= 1 && g <= 12 )
+                    {
+                        w[ ( g + 3 ) & 3 ] = _mm_sha256msg1_epu32( w[ ( g + 3 ) & 3 ], w[ g & 3 ] );
+                    }
+                }
+                
+                state0 = _mm_add_epi32( state0, abefSave );
+                state1 = _mm_add_epi32( state1, cdghSave );
+            }
+            
+            tmp    = _mm_shuffle_epi32( state0, 0x1B );
+            state1 = _mm_shuffle_epi32( state1, 0xB1 );
+            
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( state ),     _mm_blend_epi16( tmp, state1, 0xF0 ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( state + 4 ), _mm_alignr_epi8( state1, tmp, 8 ) );
+        }
+        
+        #elif defined( MACHO_DIGEST_ARM_SHA )
+        
+        static void SHA1ARM( uint32_t * state, const uint8_t * data, size_t blocks )
+        {
+            const uint32x4_t k[ 4 ] = { vdupq_n_u32( 0x5A827999 ), vdupq_n_u32( 0x6ED9EBA1 ), vdupq_n_u32( 0x8F1BBCDC ), vdupq_n_u32( 0xCA62C1D6 ) };
+            uint32x4_t       abcd( vld1q_u32( state ) );
+            uint32_t         e0( state[ 4 ] );
+            
+            for( ; blocks > 0; blocks--, data += 64 )
+            {
+                uint32x4_t abcdSave( abcd );
+                uint32_t   e0Save( e0 );
+                uint32x4_t w[ 4 ];
+                
+                for( size_t i = 0; i < 4; i++ )
+                {
+                    w[ i ] = vreinterpretq_u32_u8( vrev32q_u8( vld1q_u8( data + i * 16 ) ) );
+                }
+                
+                MACHO_DIGEST_UNROLL
+                for( size_t g = 0; g < 20; g++ )
+                {
+                    uint32x4_t tmp( vaddq_u32( w[ g & 3 ], k[ g / 5 ] ) );
+                    uint32_t   e1( vsha1h_u32( vgetq_lane_u32( abcd, 0 ) ) );
+                    
+                    if( g < 16 )
+                    {
+                        w[ g & 3 ] = vsha1su1q_u32( vsha1su0q_u32( w[ g & 3 ], w[ ( g + 1 ) & 3 ], w[ ( g + 2 ) & 3 ] ), w[ ( g + 3 ) & 3 ] );
+                    }
+                    
+                    if( g < 5 )
+                    {
+                        abcd = vsha1cq_u32( abcd, e0, tmp );
+                    }
+                    else if( g >= 10 && g < 15 )
+                    {
+                        abcd = vsha1mq_u32( abcd, e0, tmp );
+                    }
+                    else
+                    {
+                        abcd = vsha1pq_u32( abcd, e0, tmp );
+                    }
+                    
+                    e0 = e1;
+                }
+                
+                abcd  = vaddq_u32( abcd, abcdSave );
+                e0   += e0Save;
+            }
+            
+            vst1q_u32( state, abcd );
+            
+            state[ 4 ] = e0;
+        }
+        
+        static void SHA256ARM( uint32_t * state, const uint8_t * data, size_t blocks )
+        {
+            uint32x4_t state0( vld1q_u32( state ) );
+            uint32x4_t state1( vld1q_u32( state + 4 ) );
+            
+            for( ; blocks > 0; blocks--, data += 64 )
+            {
+                uint32x4_t abcdSave( state0 );
+                uint32x4_t efghSave( state1 );
+                uint32x4_t w[ 4 ];
+                
+                for( size_t i = 0; i < 4; i++ )
+                {
+                    w[ i ] = vreinterpretq_u32_u8( vrev32q_u8( vld1q_u8( data + i * 16 ) ) );
+                }
+                
+                MACHO_DIGEST_UNROLL
+                for( size_t g = 0; g < 16; g++ )
+                {
+                    uint32x4_t tmp( vaddq_u32( w[ g & 3 ], vld1q_u32( SHA256K + g * 4 ) ) );
+                    uint32x4_t save( state0 );
+                    
+                    if( g < 12 )
+                    {
+                        w[ g & 3 ] = vsha256su1q_u32( vsha256su0q_u32( w[ g & 3 ], w[ ( g + 1 ) & 3 ] ), w[ ( g + 2 ) & 3 ], w[ ( g + 3 ) & 3 ] );
+                    }
+                    
+                    state0 = vsha256hq_u32( state0, state1, tmp );
+                    state1 = vsha256h2q_u32( state1, save, tmp );
+                }
+                
+                state0 = vaddq_u32( state0, abcdSave );
+                state1 = vaddq_u32( state1, efghSave );
+            }
+            
+            vst1q_u32( state,     state0 );
+            vst1q_u32( state + 4, state1 );
+        }
+        
+        #endif
+        
+        static Transform32 SHA1Transform()
+        {
+            #if defined( MACHO_DIGEST_SHA_NI )
+            return ( HasSHANI() ) ? SHA1SHANI : SHA1Portable;
+            #elif defined( MACHO_DIGEST_ARM_SHA )
+            return SHA1ARM;
+            #else
+            return SHA1Portable;
+            #endif
+        }
+        
+        static Transform32 SHA256Transform()
+        {
+            #if defined( MACHO_DIGEST_SHA_NI )
+            return ( HasSHANI() ) ? SHA256SHANI : SHA256Portable;
+            #elif defined( MACHO_DIGEST_ARM_SHA )
+            return SHA256ARM;
+            #else
+            return SHA256Portable;
+            #endif
+        }
+        
+        /* Merkle-Damgard padding: full blocks are hashed in place, only the tail is copied */
+        template< typename Word, size_t BlockSize, typename Transform >
+        static void Hash( Word * state, const uint8_t * data, size_t size, Transform transform, uint8_t * digest, size_t digestSize )
+        {
+            uint8_t tail[ BlockSize * 2 ] = {};
+            size_t  blocks( size / BlockSize );
+            size_t  rest( size % BlockSize );
+            size_t  count( ( rest + 1 + BlockSize / 8 <= BlockSize ) ? 1 : 2 );
+            
+            transform( state, data, blocks );
+            
+            if( rest > 0 )
+            {
+                std::memcpy( tail, data + blocks * BlockSize, rest );
+            }
+            
+            tail[ rest ] = 0x80;
+            
+            for( size_t i = 0; i < 8; i++ )
+            {
+                tail[ count * BlockSize - 1 - i ] = static_cast< uint8_t >( ( static_cast< uint64_t >( size ) << 3 ) >> ( i * 8 ) );
+            }
+            
+            transform( state, tail, count );
+            
+            for( size_t i = 0; i < digestSize; i++ )
+            {
+                digest[ i ] = static_cast< uint8_t >( state[ i / sizeof( Word ) ] >> ( ( sizeof( Word ) - 1 - i % sizeof( Word ) ) * 8 ) );
+            }
+        }
+        
+        size_t Size( Type type )
+        {
+            switch( type )
+            {
+                case Type::SHA1:   return 20;
+                case Type::SHA256: return 32;
+                case Type::SHA384: return 48;
+            }
+            
+            return 0;
+        }
+        
+        std::string Name( Type type )
+        {
+            switch( type )
+            {
+                case Type::SHA1:   return "SHA-1";
+                case Type::SHA256: return "SHA-256";
+                case Type::SHA384: return "SHA-384";
+            }
+            
+            return "Unknown";
+        }
+        
+        bool HasHardwareSupport()
+        {
+            #if defined( MACHO_DIGEST_SHA_NI )
+            return HasSHANI();
+            #elif defined( MACHO_DIGEST_ARM_SHA )
+            return true;
+            #else
+            return false;
+            #endif
+        }
+        
+        void Compute( Type type, const void * data, size_t size, uint8_t * digest )
+        {
+            const uint8_t * bytes( static_cast< const uint8_t * >( data ) );
+            
+            switch( type )
+            {
+                case Type::SHA1:
+                {
+                    uint32_t state[ 5 ] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+                    
+                    Hash< uint32_t, 64 >( state, bytes, size, SHA1Transform(), digest, 20 );
+                    
+                    return;
+                }
+                
+                case Type::SHA256:
+                {
+                    uint32_t state[ 8 ] = { 0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19 };
+                    
+                    Hash< uint32_t, 64 >( state, bytes, size, SHA256Transform(), digest, 32 );
+                    
+                    return;
+                }
+                
+                case Type::SHA384:
+                {
+                    uint64_t state[ 8 ] =
+                    {
+                        0xCBBB9D5DC1059ED8, 0x629A292A367CD507, 0x9159015A3070DD17, 0x152FECD8F70E5939,
+                        0x67332667FFC00B31, 0x8EB44A8768581511, 0xDB0C2E0D64F98FA7, 0x47B5481DBEFA4FA4
+                    };
+                    
+                    Hash< uint64_t, 128 >( state, bytes, size, SHA512Portable, digest, 48 );
+                    
+                    return;
+                }
+            }
+            
+            throw std::runtime_error( "Unsupported digest type" );
+        }
+        
+        std::vector< uint8_t > Compute( Type type, const void * data, size_t size )
+        {
+            std::vector< uint8_t > digest( Size( type ) );
+            
+            Compute( type, data, size, digest.data() );
+            
+            return digest;
+        }
+    }
+}
@@ -101,11 +101,19 @@ namespace MachO
     }
     
     FatArch::IMPL::IMPL( XS::IO::BinaryStream & stream ):
-        _cpu(    stream.readBigEndianUInt32(), stream.readBigEndianUInt32() ),
-        _offset( stream.readBigEndianUInt32() ),
-        _size(   stream.readBigEndianUInt32() ),
-        _align(  stream.readBigEndianUInt32() )
-    {}
+        _offset( 0 ),
+        _size(   0 ),
+        _align(  0 )
+    {
+        /* Function arguments have no defined evaluation order, so the CPU fields are read first */
+        uint32_t type(    stream.readBigEndianUInt32() );
+        uint32_t subType( stream.readBigEndianUInt32() );
+        
+        this->_cpu    = CPU( type, subType );
+        this->_offset = stream.readBigEndianUInt32();
+        this->_size   = stream.readBigEndianUInt32();
+        this->_align  = stream.readBigEndianUInt32();
+    }
     
     FatArch::IMPL::IMPL( const IMPL & o ):
         _cpu(    o._cpu ),
@@ -28,8 +28,10 @@
  */
 
 #include <MachO/FatFile.hpp>
+#include <MachO/FileCopy.hpp>
 #include <MachO/ToString.hpp>
 #include <XS.hpp>
+#include <unistd.h>
 
 namespace MachO
 {
@@ -39,13 +41,28 @@ namespace MachO
             
             IMPL( const std::string & path );
             IMPL( XS::IO::BinaryStream & stream );
+            IMPL( const MappedFile & data );
             IMPL( const IMPL & o );
             ~IMPL();
             
+            struct Slice
+            {
+                std::string path;
+                CPU         cpu;
+                uint64_t    offset;
+                uint64_t    size;
+                uint32_t    align;
+            };
+            
             void parse( XS::IO::BinaryStream & stream );
             
-            std::optional< std::string >              _path;
-            std::vector< std::pair< FatArch, File > > _archs;
+            static std::vector< Slice > Slices( const std::string & path );
+            static uint32_t             Alignment( const CPU & cpu );
+            
+            std::optional< std::string >                     _path;
+            std::optional< MappedFile >                      _data;
+            std::vector< std::pair< FatArch, File > >        _archs;
+            std::vector< std::pair< FatArch, ArchiveFile > > _archives;
     };
 
     FatFile::FatFile( const std::string & path ):
@@ -56,6 +73,10 @@ namespace MachO
         impl( std::make_unique< IMPL >( stream ) )
     {}
     
+    FatFile::FatFile( const MappedFile & data ):
+        impl( std::make_unique< IMPL >( data ) )
+    {}
+    
     FatFile::FatFile( const FatFile & o ):
         impl( std::make_unique< IMPL >( *( o.impl ) ) )
     {}
@@ -89,6 +110,11 @@ namespace MachO
             archs.addChild( p.first );
         }
         
+        for( const auto & p: this->impl->_archives )
+        {
+            archs.addChild( p.first );
+        }
+        
         i.addChild( archs );
         
         for( const auto & p: this->impl->_archs )
@@ -96,6 +122,11 @@ namespace MachO
             i.addChild( p.second );
         }
         
+        for( const auto & p: this->impl->_archives )
+        {
+            i.addChild( p.second );
+        }
+        
         return i;
     }
 
@@ -109,6 +140,169 @@ namespace MachO
         return this->impl->_archs;
     }
     
+    std::vector< std::pair< FatArch, ArchiveFile > > FatFile::archives() const
+    {
+        return this->impl->_archives;
+    }
+    
+    void FatFile::extract( const std::string & arch, const std::string & output ) const
+    {
+        std::optional< FatArch > slice;
+        int                      out;
+        
+        for( const auto & p: this->impl->_archs )
+        {
+            if( p.first.cpu().name() == arch )
+            {
+                slice = p.first;
+            }
+        }
+        
+        for( const auto & p: this->impl->_archives )
+        {
+            if( p.first.cpu().name() == arch )
+            {
+                slice = p.first;
+            }
+        }
+        
+        if( slice.has_value() == false )
+        {
+            throw std::runtime_error( "No such architecture: " + arch );
+        }
+        
+        if( this->impl->_data.has_value() == false )
+        {
+            throw std::runtime_error( "Cannot extract architectures from a stream" );
+        }
+        
+        out = FileCopy::Create( output );
+        
+        try
+        {
+            MappedFile data( this->impl->_data->slice( slice->offset(), slice->size() ) );
+            
+            /* Data inflated from archives has no backing file and is written from memory */
+            if( data.path().has_value() )
+            {
+                FileCopy::Range( *( data.path() ), data.offset(), data.size(), out, 0 );
+            }
+            else
+            {
+                FileCopy::Write( out, 0, data.data(), data.size() );
+            }
+        }
+        catch( ... )
+        {
+            close( out );
+            
+            throw;
+        }
+        
+        close( out );
+    }
+    
+    void FatFile::Create( const std::vector< std::string > & inputs, const std::string & output )
+    {
+        std::vector< IMPL::Slice > slices;
+        std::vector< uint64_t >    destinations;
+        std::vector< uint8_t >     header;
+        uint64_t                   offset;
+        int                        out;
+        
+        for( const auto & input: inputs )
+        {
+            for( const auto & slice: IMPL::Slices( input ) )
+            {
+                for( const auto & other: slices )
+                {
+                    if( other.cpu.type() == slice.cpu.type() && other.cpu.subType() == slice.cpu.subType() )
+                    {
+                        throw std::runtime_error( "Duplicate architecture: " + slice.cpu.name() );
+                    }
+                }
+                
+                slices.push_back( slice );
+            }
+        }
+        
+        if( slices.size() == 0 )
+        {
+            throw std::runtime_error( "No architectures to write" );
+        }
+        
+        /* Like lipo, slices with the largest alignment are placed last to limit padding */
+        std::stable_sort
+        (
+            slices.begin(),
+            slices.end(),
+            []( const IMPL::Slice & s1, const IMPL::Slice & s2 )
+            {
+                return s1.align < s2.align;
+            }
+        );
+        
+        offset = 8 + slices.size() * 20;
+        
+        for( const auto & slice: slices )
+        {
+            uint64_t alignment( static_cast< uint64_t >( 1 ) << slice.align );
+            
+            offset = ( offset + alignment - 1 ) & ~( alignment - 1 );
+            
+            if( offset + slice.size > 0xFFFFFFFF )
+            {
+                throw std::runtime_error( "Fat file exceeds 4GB with architecture: " + slice.cpu.name() );
+            }
+            
+            destinations.push_back( offset );
+            
+            offset += slice.size;
+        }
+        
+        {
+            auto append = [ & ]( uint64_t value )
+            {
+                header.push_back( static_cast< uint8_t >( value >> 24 ) );
+                header.push_back( static_cast< uint8_t >( value >> 16 ) );
+                header.push_back( static_cast< uint8_t >( value >>  8 ) );
+                header.push_back( static_cast< uint8_t >( value ) );
+            };
+            
+            append( 0xCAFEBABE );
+            append( slices.size() );
+            
+            for( size_t i = 0; i < slices.size(); i++ )
+            {
+                append( slices[ i ].cpu.type() );
+                append( slices[ i ].cpu.subType() );
+                append( destinations[ i ] );
+                append( slices[ i ].size );
+                append( slices[ i ].align );
+            }
+        }
+        
+        out = FileCopy::Create( output );
+        
+        try
+        {
+            FileCopy::Write( out, 0, header.data(), header.size() );
+            
+            for( size_t i = 0; i < slices.size(); i++ )
+            {
+                FileCopy::Range( slices[ i ].path, slices[ i ].offset, slices[ i ].size, out, destinations[ i ] );
+            }
+        }
+        catch( ... )
+        {
+            close( out );
+            
+            throw;
+        }
+        
+        close( out );
+    }
+    
     void swap( FatFile & o1, FatFile & o2 )
     {
         using std::swap;
@@ -117,21 +311,32 @@ namespace MachO
     }
     
     FatFile::IMPL::IMPL( const std::string & path ):
-        _path( path )
+        IMPL( MappedFile( path ) )
     {
-        XS::IO::BinaryFileStream stream( path );
-        
-        this->parse( stream );
+        this->_path = path;
     }
     
     FatFile::IMPL::IMPL( XS::IO::BinaryStream & stream )
     {
         this->parse( stream );
     }
+    
+    FatFile::IMPL::IMPL( const MappedFile & data ):
+        _data( data )
+    {
+        XS::IO::BinaryMemoryStream stream( data.data() );
+        
+        /* The stream has no end, so the whole fat_arch table must lie within the mapping */
+        data.pointer( 8, static_cast< size_t >( data.read< uint32_t >( 4, true ) ) * 20 );
+        
+        this->parse( stream );
+    }
 
     FatFile::IMPL::IMPL( const IMPL & o ):
-        _path(  o._path ),
-        _archs( o._archs )
+        _path(     o._path ),
+        _data(     o._data ),
+        _archs(    o._archs ),
+        _archives( o._archives )
     {}
 
     FatFile::IMPL::~IMPL()
@@ -151,15 +356,79 @@ namespace MachO
             FatArch arch( stream );
             size_t  pos(  stream.tell() );
             
+            if( this->_data.has_value() )
+            {
+                MappedFile slice( this->_data->slice( arch.offset(), arch.size() ) );
+                
+                /* Universal static libraries hold one archive per architecture */
+                if( ArchiveFile::IsArchive( slice ) )
+                {
+                    this->_archives.push_back( { arch, slice } );
+                }
+                else
+                {
+                    this->_archs.push_back( { arch, File( slice, 0 ) } );
+                }
+                
+                continue;
+            }
+            
             stream.seek( arch.offset(), XS::IO::BinaryStream::SeekDirection::Begin );
             
             {
-                XS::IO::BinaryDataStream data( stream.read( arch.size() ) );
+                MappedFile data( stream.read( arch.size() ) );
                 
-                this->_archs.push_back( { arch, data } );
+                if( ArchiveFile::IsArchive( data ) )
+                {
+                    this->_archives.push_back( { arch, data } );
+                }
+                else
+                {
+                    this->_archs.push_back( { arch, File( data, 0 ) } );
+                }
             }
             
             stream.seek( pos, XS::IO::BinaryStream::SeekDirection::Begin );
         }
     }
+    
+    std::vector< FatFile::IMPL::Slice > FatFile::IMPL::Slices( const std::string & path )
+    {
+        MappedFile data( path );
+        uint32_t   magic( data.read< uint32_t >( 0, true ) );
+        
+        if( magic == 0xCAFEBABE )
+        {
+            FatFile              fat( data );
+            std::vector< Slice > slices;
+            
+            for( const auto & p: fat.architectures() )
+            {
+                slices.push_back( { path, p.first.cpu(), p.first.offset(), p.first.size(), p.first.align() } );
+            }
+            
+            for( const auto & p: fat.archives() )
+            {
+                slices.push_back( { path, p.first.cpu(), p.first.offset(), p.first.size(), p.first.align() } );
+            }
+            
+            return slices;
+        }
+        
+        if( magic == 0xFEEDFACE || magic == 0xFEEDFACF || magic == 0xCEFAEDFE || magic == 0xCFFAEDFE )
+        {
+            bool bigEndian( magic == 0xFEEDFACE || magic == 0xFEEDFACF );
+            CPU  cpu( data.read< uint32_t >( 4, bigEndian ), data.read< uint32_t >( 8, bigEndian ) );
+            
+            return { { path, cpu, 0, data.size(), Alignment( cpu ) } };
+        }
+        
+        throw std::runtime_error( "Not a Mach-O file: " + path );
+    }
+    
+    uint32_t FatFile::IMPL::Alignment( const CPU & cpu )
+    {
+        /* Arm targets use 16KB pages, others 4KB */
+        return ( ( cpu.type() & ~0xFF000000 ) == 12 ) ? 14 : 12;
+    }
 }
@@ -28,8 +28,18 @@
  */
 
 #include <MachO/File.hpp>
+#include <MachO/AddressSpace.hpp>
+#include <MachO/CodeSignature.hpp>
+#include <MachO/FileSummary.hpp>
+#include <MachO/IndirectSymbolTable.hpp>
+#include <MachO/ObjCMetadata.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/SwiftMetadata.hpp>
+#include <MachO/Section.hpp>
+#include <MachO/Section64.hpp>
 #include <MachO/ToString.hpp>
 #include <XS.hpp>
+#include <mutex>
 #include <set>
 
 #include <MachO/LoadCommands/BuildVersion.hpp>
@@ -78,13 +88,42 @@ namespace MachO
     {
         public:
             
+            class Filesets
+            {
+                public:
+                    
+                    std::mutex                           _mutex;
+                    std::vector< std::optional< File > > _entries;
+            };
+            
+            class Summary
+            {
+                public:
+                    
+                    Summary( const FileSummary & summary ):
+                        _summary( summary )
+                    {}
+                    
+                    FileSummary                                   _summary;
+                    std::once_flag                                _once;
+                    std::vector< std::shared_ptr< LoadCommand > > _loadCommands;
+            };
+            
             IMPL( const std::string & path );
             IMPL( XS::IO::BinaryStream & stream );
+            IMPL( const MappedFile & data );
+            IMPL( const MappedFile & data, size_t offset, const DataResolver & resolver );
+            IMPL( const std::string & path, const FileSummary & summary );
             IMPL( const IMPL & o );
             ~IMPL();
             
-            void parse( XS::IO::BinaryStream & stream );
-            void parseLoadCommands( uint32_t count, XS::IO::BinaryStream & stream );
+            void                           parse( XS::IO::BinaryStream & stream );
+            void                           parseLoadCommands( uint32_t count, uint32_t sizeofcmds, XS::IO::BinaryStream & stream );
+            std::shared_ptr< LoadCommand > parseInPlace( uint32_t command, uint32_t size, size_t offset, XS::IO::BinaryStream & stream );
+            
+            const std::vector< std::shared_ptr< LoadCommand > > & commands() const;
+            
+            RelocationList relocations( uint32_t offset, uint32_t count ) const;
             
             std::optional< std::string > _path;
             Kind                         _kind;
@@ -92,6 +131,11 @@ namespace MachO
             CPU                          _cpu;
             FileType                     _type;
             FileFlags                    _flags;
+            std::optional< MappedFile >  _data;
+            DataResolver                 _resolver;
+            std::optional< MappedFile >  _linkEdit;
+            std::shared_ptr< Filesets >  _filesets;
+            std::shared_ptr< Summary >   _summary;
             
             std::vector< std::shared_ptr< LoadCommand > > _loadCommands;
     };
@@ -137,6 +181,22 @@ namespace MachO
         impl( std::make_unique< IMPL >( stream ) )
     {}
     
+    File::File( const MappedFile & data ):
+        impl( std::make_unique< IMPL >( data ) )
+    {}
+    
+    File::File( const MappedFile & data, size_t offset ):
+        impl( std::make_unique< IMPL >( data, offset, nullptr ) )
+    {}
+    
+    File::File( const MappedFile & data, size_t offset, const DataResolver & resolver ):
+        impl( std::make_unique< IMPL >( data, offset, resolver ) )
+    {}
+    
+    File::File( const std::string & path, const FileSummary & summary ):
+        impl( std::make_unique< IMPL >( path, summary ) )
+    {}
+    
     File::File( const File & o ):
         impl( std::make_unique< IMPL >( *( o.impl ) ) )
     {}
@@ -165,12 +225,22 @@ namespace MachO
             i.value( XS::ToString::Filename( *( this->impl->_path ) ) );
         }
         
-        commands.value( std::to_string( this->loadCommands().size() ) );
-        
-        for( const auto & command: this->loadCommands() )
+        if( this->impl->_summary != nullptr )
         {
-            commands.addChild( command.get() );
+            for( const auto & command: this->impl->_summary->_summary.loadCommands() )
+            {
+                commands.addChild( command.info );
+            }
         }
+        else
+        {
+            for( const auto & command: this->loadCommands() )
+            {
+                commands.addChild( command.get() );
+            }
+        }
+        
+        commands.value( std::to_string( commands.children().size() ) );
         
         i.addChild( this->cpu() );
         i.addChild( this->type() );
@@ -210,11 +280,21 @@ namespace MachO
         return this->impl->_flags;
     }
     
+    std::optional< MappedFile > File::mappedFile() const
+    {
+        return this->impl->_data;
+    }
+    
+    AddressSpace File::addressSpace() const
+    {
+        return { *( this ) };
+    }
+    
     std::vector< std::reference_wrapper< LoadCommand > > File::loadCommands() const
     {
         std::vector< std::reference_wrapper< LoadCommand > > commands;
         
-        for( const auto & command: this->impl->_loadCommands )
+        for( const auto & command: this->impl->commands() )
         {
             commands.push_back( *( command ) );
         }
@@ -224,6 +304,11 @@ namespace MachO
     
     std::vector< std::string > File::linkedLibraries() const
     {
+        if( this->impl->_summary != nullptr )
+        {
+            return this->impl->_summary->_summary.linkedLibraries();
+        }
+        
         std::vector< std::string > libs;
         
         for( const auto & lib: this->loadCommands< LoadCommands::Dylib >() )
@@ -236,6 +321,11 @@ namespace MachO
     
     std::vector< Symbol > File::symbols() const
     {
+        if( this->impl->_summary != nullptr )
+        {
+            return this->impl->_summary->_summary.symbols();
+        }
+        
         std::vector< Symbol > syms;
 
         for( const auto & symTab: this->loadCommands< LoadCommands::SymTab >() )
@@ -251,6 +341,11 @@ namespace MachO
     
     std::vector< std::string > File::strings() const
     {
+        if( this->impl->_summary != nullptr )
+        {
+            return this->impl->_summary->_summary.strings();
+        }
+        
         std::vector< std::vector< uint8_t > > cstrings;
         std::vector< std::vector< uint8_t > > ustrings;
         
@@ -320,6 +415,11 @@ namespace MachO
     
     std::vector< std::string > File::objcClasses() const
     {
+        if( this->impl->_summary != nullptr )
+        {
+            return this->impl->_summary->_summary.objcClasses();
+        }
+        
         std::vector< std::vector< uint8_t > > sections;
         
         for( const auto & command: this->loadCommands< LoadCommands::Segment >() )
@@ -379,6 +479,11 @@ namespace MachO
     
     std::vector< std::string > File::objcMethods() const
     {
+        if( this->impl->_summary != nullptr )
+        {
+            return this->impl->_summary->_summary.objcMethods();
+        }
+        
         std::vector< std::vector< uint8_t > > sections;
         
         for( const auto & command: this->loadCommands< LoadCommands::Segment >() )
@@ -436,6 +541,125 @@ namespace MachO
         }
     }
     
+    IndirectSymbolTable File::indirectSymbolTable() const
+    {
+        return { *( this ) };
+    }
+    
+    ObjCMetadata File::objcMetadata() const
+    {
+        return { *( this ) };
+    }
+    
+    SwiftMetadata File::swiftMetadata() const
+    {
+        return { *( this ) };
+    }
+    
+    CodeSignature File::codeSignature() const
+    {
+        return { *( this ) };
+    }
+    
+    RelocationList File::relocations( const Section & section ) const
+    {
+        return this->impl->relocations( section.relocationOffset(), section.relocationCount() );
+    }
+    
+    RelocationList File::relocations( const Section64 & section ) const
+    {
+        return this->impl->relocations( section.relocationOffset(), section.relocationCount() );
+    }
+    
+    RelocationList File::externalRelocations() const
+    {
+        for( const auto & dysymTab: this->loadCommands< LoadCommands::DysymTab >() )
+        {
+            return this->impl->relocations( dysymTab.externalRelocationOffset(), dysymTab.externalRelocationCount() );
+        }
+        
+        return this->impl->relocations( 0, 0 );
+    }
+    
+    RelocationList File::localRelocations() const
+    {
+        for( const auto & dysymTab: this->loadCommands< LoadCommands::DysymTab >() )
+        {
+            return this->impl->relocations( dysymTab.localRelocationOffset(), dysymTab.localRelocationCount() );
+        }
+        
+        return this->impl->relocations( 0, 0 );
+    }
+    
+    File File::filesetEntry( size_t index ) const
+    {
+        std::vector< LoadCommands::FilesetEntry > entries( this->loadCommands< LoadCommands::FilesetEntry >() );
+        
+        if( index >= entries.size() )
+        {
+            throw std::out_of_range( "Invalid fileset entry index: " + std::to_string( index ) );
+        }
+        
+        if( this->impl->_data.has_value() == false )
+        {
+            throw std::runtime_error( "Fileset entries are only available for Mach-O files backed by a mapped file" );
+        }
+        
+        {
+            std::lock_guard< std::mutex > lock( this->impl->_filesets->_mutex );
+            
+            this->impl->_filesets->_entries.resize( entries.size() );
+            
+            if( this->impl->_filesets->_entries[ index ].has_value() )
+            {
+                return *( this->impl->_filesets->_entries[ index ] );
+            }
+        }
+        
+        {
+            /* Segment file offsets of fileset entries are relative to the whole fileset, so the entry shares its mapping */
+            File file( *( this->impl->_data ), entries[ index ].fileOffset() );
+            
+            std::lock_guard< std::mutex > lock( this->impl->_filesets->_mutex );
+            
+            if( this->impl->_filesets->_entries[ index ].has_value() == false )
+            {
+                this->impl->_filesets->_entries[ index ] = file;
+            }
+            
+            return *( this->impl->_filesets->_entries[ index ] );
+        }
+    }
+    
+    std::vector< File > File::filesetEntries() const
+    {
+        std::vector< File > files;
+        size_t              count( this->loadCommands< LoadCommands::FilesetEntry >().size() );
+        
+        for( size_t i = 0; i < count; i++ )
+        {
+            files.push_back( this->filesetEntry( i ) );
+        }
+        
+        return files;
+    }
+    
+    std::vector< File > File::parseFilesetEntries() const
+    {
+        size_t count( this->loadCommands< LoadCommands::FilesetEntry >().size() );
+        
+        Parallel::For
+        (
+            count,
+            [ & ]( size_t i )
+            {
+                this->filesetEntry( i );
+            }
+        );
+        
+        return this->filesetEntries();
+    }
+    
     void swap( File & o1, File & o2 )
     {
         using std::swap;
@@ -443,19 +667,58 @@ namespace MachO
         swap( o1.impl, o2.impl );
     }
     
+    /* Parsed from the mapping, so the file is only read once */
     File::IMPL::IMPL( const std::string & path ):
-        _path( path )
+        IMPL( MappedFile( path ), 0, nullptr )
+    {
+        this->_path = path;
+    }
+    
+    File::IMPL::IMPL( XS::IO::BinaryStream & stream ):
+        _filesets( std::make_shared< Filesets >() )
     {
-        XS::IO::BinaryFileStream stream( path );
-        
         this->parse( stream );
     }
     
-    File::IMPL::IMPL( XS::IO::BinaryStream & stream )
+    File::IMPL::IMPL( const MappedFile & data ):
+        IMPL( data, 0, nullptr )
+    {}
+    
+    File::IMPL::IMPL( const MappedFile & data, size_t offset, const DataResolver & resolver ):
+        _data(     data ),
+        _resolver( resolver ),
+        _filesets( std::make_shared< Filesets >() )
     {
+        /* Load commands are read in place; anything they point to is decoded on demand */
+        XS::IO::BinaryMemoryStream stream( data.data() );
+        
+        data.pointer( offset, 32 );
+        
+        if( this->_resolver == nullptr )
+        {
+            this->_resolver = [ data ]( uint64_t ) { return data; };
+        }
+        
+        stream.seek( static_cast< ssize_t >( offset ), XS::IO::BinaryStream::SeekDirection::Begin );
+        
         this->parse( stream );
+        
+        this->_resolver = nullptr;
+        this->_linkEdit = {};
     }
-
+    
+    File::IMPL::IMPL( const std::string & path, const FileSummary & summary ):
+        _path(       path ),
+        _kind(       summary.kind() ),
+        _endianness( summary.endianness() ),
+        _cpu(        summary.cpu() ),
+        _type(       summary.type() ),
+        _flags(      summary.flags() ),
+        _data(       MappedFile( path ) ),
+        _filesets(   std::make_shared< Filesets >() ),
+        _summary(    std::make_shared< Summary >( summary ) )
+    {}
+    
     File::IMPL::IMPL( const IMPL & o ):
         _path(         o._path ),
         _kind(         o._kind ),
@@ -463,12 +726,68 @@ namespace MachO
         _cpu(          o._cpu ),
         _type(         o._type ),
         _flags(        o._flags ),
+        _data(         o._data ),
+        _filesets(     o._filesets ),
+        _summary(      o._summary ),
         _loadCommands( o._loadCommands )
     {}
 
     File::IMPL::~IMPL()
     {}
     
+    const std::vector< std::shared_ptr< LoadCommand > > & File::IMPL::commands() const
+    {
+        if( this->_summary == nullptr )
+        {
+            return this->_loadCommands;
+        }
+        
+        /* Shared by copies, so the file is parsed at most once */
+        std::call_once
+        (
+            this->_summary->_once,
+            [ & ]
+            {
+                File file( *( this->_path ) );
+                
+                this->_summary->_loadCommands = file.impl->_loadCommands;
+            }
+        );
+        
+        return this->_summary->_loadCommands;
+    }
+    
+    RelocationList File::IMPL::relocations( uint32_t offset, uint32_t count ) const
+    {
+        std::optional< RelocationList::SymbolTable > symbols;
+        
+        if( this->_data.has_value() == false )
+        {
+            throw std::runtime_error( "Relocations are only available for Mach-O files backed by a mapped file" );
+        }
+        
+        for( const auto & command: this->commands() )
+        {
+            const LoadCommands::SymTab * symTab( dynamic_cast< const LoadCommands::SymTab * >( command.get() ) );
+            
+            if( symTab != nullptr )
+            {
+                symbols = RelocationList::SymbolTable
+                {
+                    symTab->symbolOffset(),
+                    symTab->symbolCount(),
+                    symTab->stringOffset(),
+                    symTab->stringSize(),
+                    this->_kind == Kind::MachO64
+                };
+                
+                break;
+            }
+        }
+        
+        return { *( this->_data ), offset, count, this->_endianness == Endianness::BigEndian, symbols };
+    }
+    
     void File::IMPL::parse( XS::IO::BinaryStream & stream )
     {
         uint32_t magic( stream.readUInt32() );
@@ -511,8 +830,7 @@ namespace MachO
         
         {
             uint32_t ncmd( stream.readUInt32() );
-            
-            stream.readUInt32();
+            uint32_t sizeofcmds( stream.readUInt32() );
             
             this->_flags = stream.readUInt32();
             
@@ -521,90 +839,172 @@ namespace MachO
                 stream.readUInt32();
             }
             
-            this->parseLoadCommands( ncmd, stream );
+            this->parseLoadCommands( ncmd, sizeofcmds, stream );
         }
     }
     
-    void File::IMPL::parseLoadCommands( uint32_t count, XS::IO::BinaryStream & stream )
+    void File::IMPL::parseLoadCommands( uint32_t count, uint32_t sizeofcmds, XS::IO::BinaryStream & stream )
     {
+        size_t end( stream.tell() + sizeofcmds );
+        
+        /* Mapped data is read without bounds, so all load commands must lie within the mapping */
+        if( this->_resolver != nullptr )
+        {
+            this->_data->pointer( stream.tell(), sizeofcmds );
+        }
+        
         for( uint32_t i = 0; i < count; i++ )
         {
-            size_t   pos(     stream.tell() );
-            uint32_t command( stream.readUInt32() );
-            uint32_t size(    stream.readUInt32() );
+            size_t                                    pos( stream.tell() );
+            uint32_t                                  command;
+            uint32_t                                  size;
+            std::optional< XS::IO::BinaryDataStream > bounded;
+            
+            if( end - pos < 8 )
+            {
+                throw std::runtime_error( "Load commands extend past sizeofcmds" );
+            }
+            
+            command = stream.readUInt32();
+            size    = stream.readUInt32();
             
             if( size < 8 )
             {
                 throw std::runtime_error( "Invalid load command size" );
             }
             
+            if( size > end - pos )
+            {
+                throw std::runtime_error( "Load commands extend past sizeofcmds" );
+            }
+            
+            /* In place, each command is decoded from a copy of its own bytes, so it cannot read past its size */
+            if( this->_resolver != nullptr )
+            {
+                bounded.emplace( std::vector< uint8_t >( this->_data->data() + pos, this->_data->data() + pos + size ) );
+                
+                bounded->setPreferredEndianness( ( this->_endianness == Endianness::BigEndian ) ? XS::IO::BinaryStream::Endianness::BigEndian : XS::IO::BinaryStream::Endianness::LittleEndian );
+                bounded->seek( 8, XS::IO::BinaryStream::SeekDirection::Begin );
+            }
+            
             {
-                std::shared_ptr< LoadCommand > cmd;
+                XS::IO::BinaryStream & source( ( bounded.has_value() ) ? *( bounded ) : stream );
+                
+                if( this->_resolver != nullptr )
+                {
+                    std::shared_ptr< LoadCommand > cmd( this->parseInPlace( command, size, pos, source ) );
+                    
+                    if( cmd != nullptr )
+                    {
+                        this->_loadCommands.push_back( cmd );
+                        stream.seek( pos + size, XS::IO::BinaryStream::SeekDirection::Begin );
+                        
+                        continue;
+                    }
+                }
                 
                 switch( command )
                 {
-                    case 0x01: this->_loadCommands.push_back( std::make_shared< LoadCommands::Segment          >( command, size, this->_kind, stream ) ); break;
-                    case 0x02: this->_loadCommands.push_back( std::make_shared< LoadCommands::SymTab           >( command, size, this->_kind, stream ) ); break;
-                    case 0x03: this->_loadCommands.push_back( std::make_shared< LoadCommands::SymSeg           >( command, size, this->_kind, stream ) ); break;
-                    case 0x04: this->_loadCommands.push_back( std::make_shared< LoadCommands::Thread           >( command, size, this->_kind, stream ) ); break;
-                    case 0x05: this->_loadCommands.push_back( std::make_shared< LoadCommands::Thread           >( command, size, this->_kind, stream ) ); break;
-                    case 0x06: this->_loadCommands.push_back( std::make_shared< LoadCommands::FVMLib           >( command, size, this->_kind, stream ) ); break;
-                    case 0x07: this->_loadCommands.push_back( std::make_shared< LoadCommands::FVMLib           >( command, size, this->_kind, stream ) ); break;
-                    case 0x08: this->_loadCommands.push_back( std::make_shared< LoadCommands::Ident            >( command, size, this->_kind, stream ) ); break;
-                    case 0x09: this->_loadCommands.push_back( std::make_shared< LoadCommands::FVMFile          >( command, size, this->_kind, stream ) ); break;
-                    case 0x0A: this->_loadCommands.push_back( std::make_shared< LoadCommands::PrePage          >( command, size, this->_kind, stream ) ); break;
-                    case 0x0B: this->_loadCommands.push_back( std::make_shared< LoadCommands::DysymTab         >( command, size, this->_kind, stream ) ); break;
-                    case 0x0C: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib            >( command, size, this->_kind, stream ) ); break;
-                    case 0x0D: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib            >( command, size, this->_kind, stream ) ); break;
-                    case 0x0E: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylinker         >( command, size, this->_kind, stream ) ); break;
-                    case 0x0F: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylinker         >( command, size, this->_kind, stream ) ); break;
-                    case 0x10: this->_loadCommands.push_back( std::make_shared< LoadCommands::PreboundDylib    >( command, size, this->_kind, stream ) ); break;
-                    case 0x11: this->_loadCommands.push_back( std::make_shared< LoadCommands::Routines         >( command, size, this->_kind, stream ) ); break;
-                    case 0x12: this->_loadCommands.push_back( std::make_shared< LoadCommands::SubFramework     >( command, size, this->_kind, stream ) ); break;
-                    case 0x13: this->_loadCommands.push_back( std::make_shared< LoadCommands::SubUmbrella      >( command, size, this->_kind, stream ) ); break;
-                    case 0x14: this->_loadCommands.push_back( std::make_shared< LoadCommands::SubClient        >( command, size, this->_kind, stream ) ); break;
-                    case 0x15: this->_loadCommands.push_back( std::make_shared< LoadCommands::SubLibrary       >( command, size, this->_kind, stream ) ); break;
-                    case 0x16: this->_loadCommands.push_back( std::make_shared< LoadCommands::TwoLevelHints    >( command, size, this->_kind, stream ) ); break;
-                    case 0x17: this->_loadCommands.push_back( std::make_shared< LoadCommands::PrebindChecksum  >( command, size, this->_kind, stream ) ); break;
-                    case 0x19: this->_loadCommands.push_back( std::make_shared< LoadCommands::Segment64        >( command, size, this->_kind, stream ) ); break;
-                    case 0x1A: this->_loadCommands.push_back( std::make_shared< LoadCommands::Routines64       >( command, size, this->_kind, stream ) ); break;
-                    case 0x1B: this->_loadCommands.push_back( std::make_shared< LoadCommands::UUID             >( command, size, this->_kind, stream ) ); break;
-                    case 0x1D: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, stream ) ); break;
-                    case 0x1E: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, stream ) ); break;
-                    case 0x20: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib            >( command, size, this->_kind, stream ) ); break;
-                    case 0x21: this->_loadCommands.push_back( std::make_shared< LoadCommands::EncryptionInfo   >( command, size, this->_kind, stream ) ); break;
-                    case 0x22: this->_loadCommands.push_back( std::make_shared< LoadCommands::DyldInfo         >( command, size, this->_kind, stream ) ); break;
-                    case 0x24: this->_loadCommands.push_back( std::make_shared< LoadCommands::VersionMin       >( command, size, this->_kind, stream ) ); break;
-                    case 0x25: this->_loadCommands.push_back( std::make_shared< LoadCommands::VersionMin       >( command, size, this->_kind, stream ) ); break;
-                    case 0x26: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, stream ) ); break;
-                    case 0x27: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylinker         >( command, size, this->_kind, stream ) ); break;
-                    case 0x29: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, stream ) ); break;
-                    case 0x2A: this->_loadCommands.push_back( std::make_shared< LoadCommands::SourceVersion    >( command, size, this->_kind, stream ) ); break;
-                    case 0x2B: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, stream ) ); break;
-                    case 0x2C: this->_loadCommands.push_back( std::make_shared< LoadCommands::EncryptionInfo64 >( command, size, this->_kind, stream ) ); break;
-                    case 0x2D: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkerOption     >( command, size, this->_kind, stream ) ); break;
-                    case 0x2E: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, stream ) ); break;
-                    case 0x2F: this->_loadCommands.push_back( std::make_shared< LoadCommands::VersionMin       >( command, size, this->_kind, stream ) ); break;
-                    case 0x30: this->_loadCommands.push_back( std::make_shared< LoadCommands::VersionMin       >( command, size, this->_kind, stream ) ); break;
-                    case 0x31: this->_loadCommands.push_back( std::make_shared< LoadCommands::Note             >( command, size, this->_kind, stream ) ); break;
-                    case 0x32: this->_loadCommands.push_back( std::make_shared< LoadCommands::BuildVersion     >( command, size, this->_kind, stream ) ); break;
+                    case 0x01: this->_loadCommands.push_back( std::make_shared< LoadCommands::Segment          >( command, size, this->_kind, source ) ); break;
+                    case 0x02: this->_loadCommands.push_back( std::make_shared< LoadCommands::SymTab           >( command, size, this->_kind, source ) ); break;
+                    case 0x03: this->_loadCommands.push_back( std::make_shared< LoadCommands::SymSeg           >( command, size, this->_kind, source ) ); break;
+                    case 0x04: this->_loadCommands.push_back( std::make_shared< LoadCommands::Thread           >( command, size, this->_kind, source ) ); break;
+                    case 0x05: this->_loadCommands.push_back( std::make_shared< LoadCommands::Thread           >( command, size, this->_kind, source ) ); break;
+                    case 0x06: this->_loadCommands.push_back( std::make_shared< LoadCommands::FVMLib           >( command, size, this->_kind, source ) ); break;
+                    case 0x07: this->_loadCommands.push_back( std::make_shared< LoadCommands::FVMLib           >( command, size, this->_kind, source ) ); break;
+                    case 0x08: this->_loadCommands.push_back( std::make_shared< LoadCommands::Ident            >( command, size, this->_kind, source ) ); break;
+                    case 0x09: this->_loadCommands.push_back( std::make_shared< LoadCommands::FVMFile          >( command, size, this->_kind, source ) ); break;
+                    case 0x0A: this->_loadCommands.push_back( std::make_shared< LoadCommands::PrePage          >( command, size, this->_kind, source ) ); break;
+                    case 0x0B: this->_loadCommands.push_back( std::make_shared< LoadCommands::DysymTab         >( command, size, this->_kind, source ) ); break;
+                    case 0x0C: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib            >( command, size, this->_kind, source ) ); break;
+                    case 0x0D: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib            >( command, size, this->_kind, source ) ); break;
+                    case 0x0E: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylinker         >( command, size, this->_kind, source ) ); break;
+                    case 0x0F: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylinker         >( command, size, this->_kind, source ) ); break;
+                    case 0x10: this->_loadCommands.push_back( std::make_shared< LoadCommands::PreboundDylib    >( command, size, this->_kind, source ) ); break;
+                    case 0x11: this->_loadCommands.push_back( std::make_shared< LoadCommands::Routines         >( command, size, this->_kind, source ) ); break;
+                    case 0x12: this->_loadCommands.push_back( std::make_shared< LoadCommands::SubFramework     >( command, size, this->_kind, source ) ); break;
+                    case 0x13: this->_loadCommands.push_back( std::make_shared< LoadCommands::SubUmbrella      >( command, size, this->_kind, source ) ); break;
+                    case 0x14: this->_loadCommands.push_back( std::make_shared< LoadCommands::SubClient        >( command, size, this->_kind, source ) ); break;
+                    case 0x15: this->_loadCommands.push_back( std::make_shared< LoadCommands::SubLibrary       >( command, size, this->_kind, source ) ); break;
+                    case 0x16: this->_loadCommands.push_back( std::make_shared< LoadCommands::TwoLevelHints    >( command, size, this->_kind, source ) ); break;
+                    case 0x17: this->_loadCommands.push_back( std::make_shared< LoadCommands::PrebindChecksum  >( command, size, this->_kind, source ) ); break;
+                    case 0x19: this->_loadCommands.push_back( std::make_shared< LoadCommands::Segment64        >( command, size, this->_kind, source ) ); break;
+                    case 0x1A: this->_loadCommands.push_back( std::make_shared< LoadCommands::Routines64       >( command, size, this->_kind, source ) ); break;
+                    case 0x1B: this->_loadCommands.push_back( std::make_shared< LoadCommands::UUID             >( command, size, this->_kind, source ) ); break;
+                    case 0x1D: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, source ) ); break;
+                    case 0x1E: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, source ) ); break;
+                    case 0x20: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib            >( command, size, this->_kind, source ) ); break;
+                    case 0x21: this->_loadCommands.push_back( std::make_shared< LoadCommands::EncryptionInfo   >( command, size, this->_kind, source ) ); break;
+                    case 0x22: this->_loadCommands.push_back( std::make_shared< LoadCommands::DyldInfo         >( command, size, this->_kind, source ) ); break;
+                    case 0x24: this->_loadCommands.push_back( std::make_shared< LoadCommands::VersionMin       >( command, size, this->_kind, source ) ); break;
+                    case 0x25: this->_loadCommands.push_back( std::make_shared< LoadCommands::VersionMin       >( command, size, this->_kind, source ) ); break;
+                    case 0x26: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, source ) ); break;
+                    case 0x27: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylinker         >( command, size, this->_kind, source ) ); break;
+                    case 0x29: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, source ) ); break;
+                    case 0x2A: this->_loadCommands.push_back( std::make_shared< LoadCommands::SourceVersion    >( command, size, this->_kind, source ) ); break;
+                    case 0x2B: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, source ) ); break;
+                    case 0x2C: this->_loadCommands.push_back( std::make_shared< LoadCommands::EncryptionInfo64 >( command, size, this->_kind, source ) ); break;
+                    case 0x2D: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkerOption     >( command, size, this->_kind, source ) ); break;
+                    case 0x2E: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData     >( command, size, this->_kind, source ) ); break;
+                    case 0x2F: this->_loadCommands.push_back( std::make_shared< LoadCommands::VersionMin       >( command, size, this->_kind, source ) ); break;
+                    case 0x30: this->_loadCommands.push_back( std::make_shared< LoadCommands::VersionMin       >( command, size, this->_kind, source ) ); break;
+                    case 0x31: this->_loadCommands.push_back( std::make_shared< LoadCommands::Note             >( command, size, this->_kind, source ) ); break;
+                    case 0x32: this->_loadCommands.push_back( std::make_shared< LoadCommands::BuildVersion     >( command, size, this->_kind, source ) ); break;
                     
-                    case 0x18 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib        >( command, size, this->_kind, stream ) ); break;
-                    case 0x1C | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::RPath        >( command, size, this->_kind, stream ) ); break;
-                    case 0x1F | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib        >( command, size, this->_kind, stream ) ); break;
-                    case 0x22 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::DyldInfo     >( command, size, this->_kind, stream ) ); break;
-                    case 0x23 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib        >( command, size, this->_kind, stream ) ); break;
-                    case 0x28 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::EntryPoint   >( command, size, this->_kind, stream ) ); break;
-                    case 0x33 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData >( command, size, this->_kind, stream ) ); break;
-                    case 0x34 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData >( command, size, this->_kind, stream ) ); break;
-                    case 0x35 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::FilesetEntry >( command, size, this->_kind, stream ) ); break;
+                    case 0x18 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib        >( command, size, this->_kind, source ) ); break;
+                    case 0x1C | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::RPath        >( command, size, this->_kind, source ) ); break;
+                    case 0x1F | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib        >( command, size, this->_kind, source ) ); break;
+                    case 0x22 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::DyldInfo     >( command, size, this->_kind, source ) ); break;
+                    case 0x23 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::Dylib        >( command, size, this->_kind, source ) ); break;
+                    case 0x28 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::EntryPoint   >( command, size, this->_kind, source ) ); break;
+                    case 0x33 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData >( command, size, this->_kind, source ) ); break;
+                    case 0x34 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::LinkEditData >( command, size, this->_kind, source ) ); break;
+                    case 0x35 | 0x80000000: this->_loadCommands.push_back( std::make_shared< LoadCommands::FilesetEntry >( command, size, this->_kind, source ) ); break;
                     
-                    default: this->_loadCommands.push_back( std::make_shared< LoadCommands::Unknown >( command, size, this->_kind, stream ) ); break;
+                    default: this->_loadCommands.push_back( std::make_shared< LoadCommands::Unknown >( command, size, this->_kind, source ) ); break;
                 }
             }
             
             stream.seek( pos + size, XS::IO::BinaryStream::SeekDirection::Begin );
         }
     }
+    
+    std::shared_ptr< LoadCommand > File::IMPL::parseInPlace( uint32_t command, uint32_t size, size_t offset, XS::IO::BinaryStream & stream )
+    {
+        bool bigEndian( this->_endianness == Endianness::BigEndian );
+        
+        if( command == 0x01 || command == 0x19 )
+        {
+            /* Segments may live in a different file than the header, e.g. in split dyld caches */
+            std::string name( reinterpret_cast< const char * >( this->_data->pointer( offset + 8, 16 ) ), 16 );
+            uint64_t    address( ( command == 0x19 ) ? this->_data->read< uint64_t >( offset + 24, bigEndian ) : this->_data->read< uint32_t >( offset + 24, bigEndian ) );
+            MappedFile  data( this->_resolver( address ) );
+            
+            if( name.substr( 0, name.find( '\0' ) ) == "__LINKEDIT" )
+            {
+                this->_linkEdit = data;
+            }
+            
+            if( command == 0x19 )
+            {
+                return std::make_shared< LoadCommands::Segment64 >( command, size, this->_kind, stream, data );
+            }
+            
+            return std::make_shared< LoadCommands::Segment >( command, size, this->_kind, stream, data );
+        }
+        
+        {
+            MappedFile linkEdit( this->_linkEdit.value_or( *( this->_data ) ) );
+            
+            switch( command )
+            {
+                case 0x02:              return std::make_shared< LoadCommands::SymTab   >( command, size, this->_kind, stream, linkEdit, this->_endianness );
+                case 0x0B:              return std::make_shared< LoadCommands::DysymTab >( command, size, this->_kind, stream, linkEdit, this->_endianness );
+                case 0x22:              return std::make_shared< LoadCommands::DyldInfo >( command, size, this->_kind, stream, linkEdit );
+                case 0x22 | 0x80000000: return std::make_shared< LoadCommands::DyldInfo >( command, size, this->_kind, stream, linkEdit );
+                
+                default: return nullptr;
+            }
+        }
+    }
 }
-
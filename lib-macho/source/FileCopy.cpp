@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        FileCopy.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/FileCopy.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace MachO
+{
+    namespace FileCopy
+    {
+        static void Map( int from, uint64_t offset, uint64_t size, int to, uint64_t destination );
+        
+        void Range( int from, uint64_t offset, uint64_t size, int to, uint64_t destination )
+        {
+            #if defined( __linux__ )
+            
+            while( size > 0 )
+            {
+                off_t   in(  static_cast< off_t >( offset ) );
+                off_t   out( static_cast< off_t >( destination ) );
+                ssize_t copied( copy_file_range( from, &in, to, &out, static_cast< size_t >( std::min< uint64_t >( size, 0x40000000 ) ), 0 ) );
+                
+                if( copied < 0 && errno == EINTR )
+                {
+                    continue;
+                }
+                
+                /* Cross-device copies and older kernels fall back to the mapping */
+                if( copied < 0 && ( errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP ) )
+                {
+                    break;
+                }
+                
+                if( copied <= 0 )
+                {
+                    throw std::runtime_error( "Cannot copy file range at offset: " + std::to_string( offset ) );
+                }
+                
+                offset      += static_cast< uint64_t >( copied );
+                destination += static_cast< uint64_t >( copied );
+                size        -= static_cast< uint64_t >( copied );
+            }
+            
+            #endif
+            
+            if( size > 0 )
+            {
+                Map( from, offset, size, to, destination );
+            }
+        }
+        
+        void Range( const std::string & from, uint64_t offset, uint64_t size, int to, uint64_t destination )
+        {
+            int in( Open( from ) );
+            
+            try
+            {
+                Range( in, offset, size, to, destination );
+            }
+            catch( ... )
+            {
+                close( in );
+                
+                throw;
+            }
+            
+            close( in );
+        }
+        
+        void Write( int to, uint64_t destination, const uint8_t * data, size_t size )
+        {
+            size_t offset( 0 );
+            
+            while( offset < size )
+            {
+                ssize_t written( pwrite( to, data + offset, size - offset, static_cast< off_t >( destination + offset ) ) );
+                
+                if( written < 0 && errno == EINTR )
+                {
+                    continue;
+                }
+                
+                if( written <= 0 )
+                {
+                    throw std::runtime_error( "Cannot write file at offset: " + std::to_string( destination + offset ) );
+                }
+                
+                offset += static_cast< size_t >( written );
+            }
+        }
+        
+        void Read( int from, uint64_t offset, uint8_t * data, size_t size )
+        {
+            size_t done( 0 );
+            
+            while( done < size )
+            {
+                ssize_t n( pread( from, data + done, size - done, static_cast< off_t >( offset + done ) ) );
+                
+                if( n < 0 && errno == EINTR )
+                {
+                    continue;
+                }
+                
+                if( n <= 0 )
+                {
+                    throw std::runtime_error( "Cannot read file at offset: " + std::to_string( offset + done ) );
+                }
+                
+                done += static_cast< size_t >( n );
+            }
+        }
+        
+        void File( const std::string & from, const std::string & to )
+        {
+            struct stat st;
+            int         out;
+            
+            if( stat( from.c_str(), &st ) != 0 )
+            {
+                throw std::runtime_error( "Cannot stat file: " + from );
+            }
+            
+            out = Create( to );
+            
+            try
+            {
+                Range( from, 0, static_cast< uint64_t >( st.st_size ), out, 0 );
+            }
+            catch( ... )
+            {
+                close( out );
+                
+                throw;
+            }
+            
+            close( out );
+        }
+        
+        int Create( const std::string & path, int mode )
+        {
+            int fd( open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, mode ) );
+            
+            if( fd < 0 )
+            {
+                throw std::runtime_error( "Cannot create file: " + path );
+            }
+            
+            return fd;
+        }
+        
+        int Open( const std::string & path )
+        {
+            int fd( open( path.c_str(), O_RDONLY ) );
+            
+            if( fd < 0 )
+            {
+                throw std::runtime_error( "Cannot open file: " + path );
+            }
+            
+            return fd;
+        }
+        
+        static void Map( int from, uint64_t offset, uint64_t size, int to, uint64_t destination )
+        {
+            /* Mappings must start on a page boundary, so the leading bytes are skipped */
+            uint64_t page(    static_cast< uint64_t >( sysconf( _SC_PAGESIZE ) ) );
+            uint64_t start(   offset - ( offset % page ) );
+            uint64_t skip(    offset - start );
+            void   * mapping( mmap( nullptr, static_cast< size_t >( size + skip ), PROT_READ, MAP_PRIVATE, from, static_cast< off_t >( start ) ) );
+            
+            if( mapping == MAP_FAILED )
+            {
+                throw std::runtime_error( "Cannot map file range at offset: " + std::to_string( offset ) );
+            }
+            
+            try
+            {
+                Write( to, destination, static_cast< const uint8_t * >( mapping ) + skip, static_cast< size_t >( size ) );
+            }
+            catch( ... )
+            {
+                munmap( mapping, static_cast< size_t >( size + skip ) );
+                
+                throw;
+            }
+            
+            munmap( mapping, static_cast< size_t >( size + skip ) );
+        }
+    }
+}
@@ -0,0 +1,493 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        FileSummary.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/FileSummary.hpp>
+#include <MachO/Symbol.hpp>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace MachO
+{
+    class FileSummary::IMPL
+    {
+        public:
+            
+            enum Table: uint32_t
+            {
+                Commands,
+                InfoNodes,
+                Libraries,
+                SymbolNames,
+                SymbolIndexes,
+                SymbolTypes,
+                SymbolSections,
+                SymbolDescriptions,
+                SymbolValues,
+                Strings,
+                ObjCClasses,
+                ObjCMethods,
+                Pool,
+                Count
+            };
+            
+            class Writer
+            {
+                public:
+                    
+                    uint32_t intern( const std::string & string );
+                    
+                    template< typename T >
+                    void append( Table table, T value );
+                    
+                    void append( Table table, const std::vector< std::string > & strings );
+                    void append( const XS::Info & info );
+                    
+                    std::vector< uint8_t > serialize( const Identity & identity, const File & file ) const;
+                    
+                    std::array< std::vector< uint8_t >, Count > _tables;
+                    std::array< uint32_t, Count >               _counts{};
+                    std::unordered_map< std::string, uint32_t > _interned;
+            };
+            
+            static constexpr uint32_t Magic      = 0x4D4F5346;
+            static constexpr uint32_t Version    = 1;
+            static constexpr size_t   HeaderSize = 88;
+            
+            IMPL( const MappedFile & data );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            template< typename T >
+            T read( size_t offset ) const;
+            
+            template< typename T >
+            T column( Table table, size_t index ) const;
+            
+            std::string                string( Table table, size_t index ) const;
+            std::vector< std::string > strings( Table table )              const;
+            XS::Info                   info( size_t & node )               const;
+            
+            MappedFile                    _data;
+            std::array< uint32_t, Count > _offsets;
+            std::array< uint32_t, Count > _counts;
+    };
+    
+    bool FileSummary::Identity::operator ==( const Identity & o ) const
+    {
+        return this->device  == o.device
+            && this->inode   == o.inode
+            && this->size    == o.size
+            && this->mtime   == o.mtime
+            && this->hasUUID == o.hasUUID
+            && ( this->hasUUID == false || this->uuid == o.uuid );
+    }
+    
+    bool FileSummary::Identity::operator !=( const Identity & o ) const
+    {
+        return ( *( this ) == o ) == false;
+    }
+    
+    std::vector< uint8_t > FileSummary::Serialize( const File & file, const Identity & identity )
+    {
+        IMPL::Writer writer;
+        
+        for( const auto & ref: file.loadCommands() )
+        {
+            /* Command details are kept as their info tree, so the file's info needs no parsing */
+            writer.append< uint32_t >( IMPL::Commands, ref.get().command() );
+            writer.append< uint32_t >( IMPL::Commands, ref.get().size() );
+            writer.append< uint32_t >( IMPL::Commands, writer._counts[ IMPL::InfoNodes ] / 3 );
+            writer.append( ref.get().getInfo() );
+        }
+        
+        for( const auto & symbol: file.symbols() )
+        {
+            writer.append< uint32_t >( IMPL::SymbolNames,        writer.intern( symbol.name() ) );
+            writer.append< uint32_t >( IMPL::SymbolIndexes,      symbol.nameIndex() );
+            writer.append< uint8_t  >( IMPL::SymbolTypes,        symbol.type() );
+            writer.append< uint8_t  >( IMPL::SymbolSections,     symbol.section() );
+            writer.append< uint16_t >( IMPL::SymbolDescriptions, symbol.description() );
+            writer.append< uint64_t >( IMPL::SymbolValues,       symbol.value() );
+        }
+        
+        writer.append( IMPL::Libraries,   file.linkedLibraries() );
+        writer.append( IMPL::Strings,     file.strings() );
+        writer.append( IMPL::ObjCClasses, file.objcClasses() );
+        writer.append( IMPL::ObjCMethods, file.objcMethods() );
+        
+        return writer.serialize( identity, file );
+    }
+    
+    FileSummary::FileSummary( const MappedFile & data ):
+        impl( std::make_unique< IMPL >( data ) )
+    {}
+    
+    FileSummary::FileSummary( const FileSummary & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    FileSummary::FileSummary( FileSummary && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    FileSummary::~FileSummary( void )
+    {}
+    
+    FileSummary & FileSummary::operator =( FileSummary o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    FileSummary::Identity FileSummary::identity() const
+    {
+        Identity identity;
+        
+        identity.device  = this->impl->read< uint64_t >(  8 );
+        identity.inode   = this->impl->read< uint64_t >( 16 );
+        identity.size    = this->impl->read< uint64_t >( 24 );
+        identity.mtime   = this->impl->read< uint64_t >( 32 );
+        identity.hasUUID = this->impl->read< uint32_t >( 40 ) != 0;
+        
+        std::memcpy( identity.uuid.data(), this->impl->_data.pointer( 48, 16 ), 16 );
+        
+        return identity;
+    }
+    
+    File::Kind FileSummary::kind() const
+    {
+        return ( this->impl->read< uint32_t >( 44 ) == 0 ) ? File::Kind::MachO32 : File::Kind::MachO64;
+    }
+    
+    File::Endianness FileSummary::endianness() const
+    {
+        return ( this->impl->read< uint32_t >( 64 ) == 0 ) ? File::Endianness::LittleEndian : File::Endianness::BigEndian;
+    }
+    
+    CPU FileSummary::cpu() const
+    {
+        return { this->impl->read< uint32_t >( 68 ), this->impl->read< uint32_t >( 72 ) };
+    }
+    
+    FileType FileSummary::type() const
+    {
+        return this->impl->read< uint32_t >( 76 );
+    }
+    
+    FileFlags FileSummary::flags() const
+    {
+        return this->impl->read< uint32_t >( 80 );
+    }
+    
+    std::vector< FileSummary::Command > FileSummary::loadCommands() const
+    {
+        std::vector< Command > commands;
+        
+        /* Commands and info nodes have three columns per entry */
+        for( size_t i = 0; i + 2 < this->impl->_counts[ IMPL::Commands ]; i += 3 )
+        {
+            size_t node( this->impl->column< uint32_t >( IMPL::Commands, i + 2 ) );
+            
+            commands.push_back
+            (
+                {
+                    this->impl->column< uint32_t >( IMPL::Commands, i ),
+                    this->impl->column< uint32_t >( IMPL::Commands, i + 1 ),
+                    this->impl->info( node )
+                }
+            );
+        }
+        
+        return commands;
+    }
+    
+    std::vector< std::string > FileSummary::linkedLibraries() const
+    {
+        return this->impl->strings( IMPL::Libraries );
+    }
+    
+    std::vector< Symbol > FileSummary::symbols() const
+    {
+        std::vector< Symbol > symbols;
+        
+        symbols.reserve( this->impl->_counts[ IMPL::SymbolNames ] );
+        
+        for( size_t i = 0; i < this->impl->_counts[ IMPL::SymbolNames ]; i++ )
+        {
+            symbols.push_back
+            (
+                {
+                    this->impl->string( IMPL::SymbolNames, i ),
+                    this->impl->column< uint32_t >( IMPL::SymbolIndexes,      i ),
+                    this->impl->column< uint8_t  >( IMPL::SymbolTypes,        i ),
+                    this->impl->column< uint8_t  >( IMPL::SymbolSections,     i ),
+                    this->impl->column< uint16_t >( IMPL::SymbolDescriptions, i ),
+                    this->impl->column< uint64_t >( IMPL::SymbolValues,       i )
+                }
+            );
+        }
+        
+        return symbols;
+    }
+    
+    std::vector< std::string > FileSummary::strings() const
+    {
+        return this->impl->strings( IMPL::Strings );
+    }
+    
+    std::vector< std::string > FileSummary::objcClasses() const
+    {
+        return this->impl->strings( IMPL::ObjCClasses );
+    }
+    
+    std::vector< std::string > FileSummary::objcMethods() const
+    {
+        return this->impl->strings( IMPL::ObjCMethods );
+    }
+    
+    void swap( FileSummary & o1, FileSummary & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    FileSummary::IMPL::IMPL( const MappedFile & data ):
+        _data( data )
+    {
+        uint32_t magic(   this->read< uint32_t >( 0 ) );
+        uint32_t version( this->read< uint32_t >( 4 ) );
+        size_t   sizes[ Count ] = { 4, 4, 4, 4, 4, 1, 1, 2, 8, 4, 4, 4, 1 };
+        
+        if( magic != Magic )
+        {
+            throw std::runtime_error( "Invalid file summary magic: " + XS::ToString::Hex( magic ) );
+        }
+        
+        if( version != Version || this->read< uint32_t >( 84 ) != Count )
+        {
+            throw std::runtime_error( "Unsupported file summary version: " + XS::ToString::Hex( version ) );
+        }
+        
+        /* Validates every column once, so accessors can read without further checks */
+        for( uint32_t i = 0; i < Count; i++ )
+        {
+            this->_offsets[ i ] = this->read< uint32_t >( HeaderSize + i * 8 );
+            this->_counts[ i ]  = this->read< uint32_t >( HeaderSize + i * 8 + 4 );
+            
+            data.pointer( this->_offsets[ i ], this->_counts[ i ] * sizes[ i ] );
+        }
+        
+        this->_data = data.slice( 0, this->_offsets[ Pool ] + this->_counts[ Pool ] );
+    }
+    
+    FileSummary::IMPL::IMPL( const IMPL & o ):
+        _data(    o._data ),
+        _offsets( o._offsets ),
+        _counts(  o._counts )
+    {}
+    
+    FileSummary::IMPL::~IMPL()
+    {}
+    
+    template< typename T >
+    T FileSummary::IMPL::read( size_t offset ) const
+    {
+        return this->_data.read< T >( offset, MappedFile::IsBigEndianHost() );
+    }
+    
+    template< typename T >
+    T FileSummary::IMPL::column( Table table, size_t index ) const
+    {
+        return this->read< T >( this->_offsets[ table ] + index * sizeof( T ) );
+    }
+    
+    std::string FileSummary::IMPL::string( Table table, size_t index ) const
+    {
+        /* Pool strings are length-prefixed, as section and segment names may hold NUL bytes */
+        uint32_t offset( this->column< uint32_t >( table, index ) );
+        uint32_t length;
+        
+        if( static_cast< uint64_t >( offset ) + 4 > this->_counts[ Pool ] )
+        {
+            throw std::runtime_error( "Invalid file summary string offset: " + XS::ToString::Hex( offset ) );
+        }
+        
+        length = this->read< uint32_t >( this->_offsets[ Pool ] + offset );
+        
+        if( static_cast< uint64_t >( offset ) + 4 + length > this->_counts[ Pool ] )
+        {
+            throw std::runtime_error( "Invalid file summary string length: " + XS::ToString::Hex( length ) );
+        }
+        
+        return std::string( reinterpret_cast< const char * >( this->_data.pointer( this->_offsets[ Pool ] + offset + 4, length ) ), length );
+    }
+    
+    std::vector< std::string > FileSummary::IMPL::strings( Table table ) const
+    {
+        std::vector< std::string > strings;
+        
+        strings.reserve( this->_counts[ table ] );
+        
+        for( size_t i = 0; i < this->_counts[ table ]; i++ )
+        {
+            strings.push_back( this->string( table, i ) );
+        }
+        
+        return strings;
+    }
+    
+    XS::Info FileSummary::IMPL::info( size_t & node ) const
+    {
+        if( node * 3 + 2 >= this->_counts[ InfoNodes ] )
+        {
+            throw std::runtime_error( "Invalid file summary info node: " + std::to_string( node ) );
+        }
+        
+        {
+            XS::Info info( this->string( InfoNodes, node * 3 ), this->string( InfoNodes, node * 3 + 1 ) );
+            uint32_t children( this->column< uint32_t >( InfoNodes, node * 3 + 2 ) );
+            
+            node++;
+            
+            for( uint32_t i = 0; i < children; i++ )
+            {
+                info.addChild( this->info( node ) );
+            }
+            
+            return info;
+        }
+    }
+    
+    uint32_t FileSummary::IMPL::Writer::intern( const std::string & string )
+    {
+        auto it( this->_interned.find( string ) );
+        
+        if( it != this->_interned.end() )
+        {
+            return it->second;
+        }
+        
+        {
+            uint32_t offset( static_cast< uint32_t >( this->_tables[ Pool ].size() ) );
+            uint32_t length( static_cast< uint32_t >( string.size() ) );
+            uint8_t  bytes[ 4 ];
+            
+            std::memcpy( bytes, &length, 4 );
+            
+            this->_tables[ Pool ].insert( this->_tables[ Pool ].end(), bytes, bytes + 4 );
+            this->_tables[ Pool ].insert( this->_tables[ Pool ].end(), string.begin(), string.end() );
+            
+            this->_interned[ string ] = offset;
+            
+            return offset;
+        }
+    }
+    
+    template< typename T >
+    void FileSummary::IMPL::Writer::append( Table table, T value )
+    {
+        uint8_t bytes[ sizeof( T ) ];
+        
+        std::memcpy( bytes, &value, sizeof( T ) );
+        
+        this->_tables[ table ].insert( this->_tables[ table ].end(), bytes, bytes + sizeof( T ) );
+        this->_counts[ table ]++;
+    }
+    
+    void FileSummary::IMPL::Writer::append( Table table, const std::vector< std::string > & strings )
+    {
+        for( const auto & string: strings )
+        {
+            this->append< uint32_t >( table, this->intern( string ) );
+        }
+    }
+    
+    void FileSummary::IMPL::Writer::append( const XS::Info & info )
+    {
+        std::vector< XS::Info > children( info.children() );
+        
+        this->append< uint32_t >( InfoNodes, this->intern( info.label() ) );
+        this->append< uint32_t >( InfoNodes, this->intern( info.value() ) );
+        this->append< uint32_t >( InfoNodes, static_cast< uint32_t >( children.size() ) );
+        
+        for( const auto & child: children )
+        {
+            this->append( child );
+        }
+    }
+    
+    std::vector< uint8_t > FileSummary::IMPL::Writer::serialize( const Identity & identity, const File & file ) const
+    {
+        std::vector< uint8_t >        data( HeaderSize + Count * 8 );
+        std::array< uint32_t, Count > counts( this->_counts );
+        
+        auto write = [ & ]( size_t offset, auto value )
+        {
+            std::memcpy( data.data() + offset, &value, sizeof( value ) );
+        };
+        
+        /* The pool is counted in bytes rather than entries */
+        counts[ Pool ] = static_cast< uint32_t >( this->_tables[ Pool ].size() );
+        
+        write(  0, Magic );
+        write(  4, Version );
+        write(  8, identity.device );
+        write( 16, identity.inode );
+        write( 24, identity.size );
+        write( 32, identity.mtime );
+        write( 40, static_cast< uint32_t >( identity.hasUUID ) );
+        write( 44, static_cast< uint32_t >( ( file.kind() == File::Kind::MachO64 ) ? 1 : 0 ) );
+        write( 64, static_cast< uint32_t >( ( file.endianness() == File::Endianness::BigEndian ) ? 1 : 0 ) );
+        write( 68, file.cpu().type() );
+        write( 72, file.cpu().subType() );
+        write( 76, file.type().value() );
+        write( 80, file.flags().value() );
+        write( 84, static_cast< uint32_t >( Count ) );
+        
+        std::memcpy( data.data() + 48, identity.uuid.data(), 16 );
+        
+        /* Columns are 8-byte aligned so they can be read in place from a mapping */
+        for( uint32_t i = 0; i < Count; i++ )
+        {
+            const std::vector< uint8_t > & table( this->_tables[ i ] );
+            
+            data.resize( ( data.size() + 7 ) & ~static_cast< size_t >( 7 ) );
+            
+            write( HeaderSize + i * 8,     static_cast< uint32_t >( data.size() ) );
+            write( HeaderSize + i * 8 + 4, counts[ i ] );
+            
+            data.insert( data.end(), table.begin(), table.end() );
+        }
+        
+        return data;
+    }
+}
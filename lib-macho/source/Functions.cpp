@@ -32,7 +32,7 @@
 
 namespace MachO
 {
-    std::variant< File, FatFile, CacheFile > Parse( const std::string & path )
+    std::variant< File, FatFile, CacheFile, ArchiveFile, ZipFile > Parse( const std::string & path )
     {
         uint32_t magic( 0 );
         
@@ -50,7 +50,49 @@ namespace MachO
         {
             return FatFile( path );
         }
+        else if( magic == 0x213C6172 )
+        {
+            return ArchiveFile( path );
+        }
+        else if( magic == 0x504B0304 || magic == 0x504B0506 )
+        {
+            return ZipFile( path );
+        }
         
         return File( path );
     }
+    
+    std::variant< File, FatFile, CacheFile, ArchiveFile, ZipFile > Parse( const MappedFile & data )
+    {
+        uint32_t magic( ( data.size() >= 4 ) ? data.read< uint32_t >( 0, true ) : 0 );
+        
+        if( magic == 0x64796C64 )
+        {
+            return CacheFile( data );
+        }
+        else if( magic == 0xCAFEBABE )
+        {
+            return FatFile( data );
+        }
+        else if( ArchiveFile::IsArchive( data ) )
+        {
+            return ArchiveFile( data );
+        }
+        else if( ZipFile::IsZip( data ) )
+        {
+            return ZipFile( data );
+        }
+        
+        return File( data, 0 );
+    }
+    
+    std::variant< File, FatFile, CacheFile, ArchiveFile, ZipFile > Parse( const std::string & path, const ParseCache & cache )
+    {
+        if( ParseCache::Identify( path ).has_value() )
+        {
+            return cache.parse( path );
+        }
+        
+        return Parse( path );
+    }
 }
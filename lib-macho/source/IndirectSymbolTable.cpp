@@ -0,0 +1,262 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        IndirectSymbolTable.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/IndirectSymbolTable.hpp>
+#include <MachO/LoadCommands/DysymTab.hpp>
+#include <MachO/LoadCommands/Segment.hpp>
+#include <MachO/LoadCommands/Segment64.hpp>
+#include <MachO/LoadCommands/SymTab.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    class IndirectSymbolTable::IMPL
+    {
+        public:
+
+            struct Range
+            {
+                uint64_t begin;
+                uint64_t end;
+                uint32_t index;
+                uint32_t stride;
+            };
+
+            IMPL( const File & file );
+            IMPL( const IMPL & o );
+            ~IMPL();
+
+            template< typename T >
+            void addSection( const T & section, uint32_t pointerSize );
+
+            std::vector< Range >                  _ranges;
+            std::vector< uint32_t >               _entries;
+            std::optional< LoadCommands::SymTab > _symTab;
+    };
+
+    IndirectSymbolTable::IndirectSymbolTable( const File & file ):
+        impl( std::make_unique< IMPL >( file ) )
+    {}
+
+    IndirectSymbolTable::IndirectSymbolTable( const IndirectSymbolTable & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+
+    IndirectSymbolTable::IndirectSymbolTable( IndirectSymbolTable && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+
+    IndirectSymbolTable::~IndirectSymbolTable()
+    {}
+
+    IndirectSymbolTable & IndirectSymbolTable::operator =( IndirectSymbolTable o )
+    {
+        swap( *( this ), o );
+
+        return *( this );
+    }
+
+    XS::Info IndirectSymbolTable::getInfo() const
+    {
+        XS::Info i( "Indirect symbols", std::to_string( this->count() ) );
+
+        for( const auto & range: this->impl->_ranges )
+        {
+            for( uint64_t address = range.begin; address < range.end; address += range.stride )
+            {
+                std::optional< Symbol > sym( this->symbol( address ) );
+
+                i.addChild( { XS::ToString::Hex( address ), ( sym.has_value() ) ? sym->name() : "--" } );
+            }
+        }
+
+        return i;
+    }
+
+    size_t IndirectSymbolTable::count() const
+    {
+        return this->impl->_entries.size();
+    }
+
+    std::vector< uint32_t > IndirectSymbolTable::entries() const
+    {
+        return this->impl->_entries;
+    }
+
+    std::optional< uint32_t > IndirectSymbolTable::symbolIndex( uint64_t address ) const
+    {
+        const auto & ranges( this->impl->_ranges );
+
+        auto it = std::upper_bound
+        (
+            ranges.begin(),
+            ranges.end(),
+            address,
+            []( uint64_t value, const IMPL::Range & range )
+            {
+                return value < range.begin;
+            }
+        );
+
+        if( it == ranges.begin() )
+        {
+            return {};
+        }
+
+        --it;
+
+        if( address >= it->end )
+        {
+            return {};
+        }
+
+        {
+            uint64_t index( it->index + ( address - it->begin ) / it->stride );
+
+            if( index >= this->impl->_entries.size() )
+            {
+                return {};
+            }
+
+            {
+                uint32_t entry( this->impl->_entries[ index ] );
+
+                /* INDIRECT_SYMBOL_LOCAL / INDIRECT_SYMBOL_ABS */
+                if( ( entry & 0xC0000000 ) != 0 )
+                {
+                    return {};
+                }
+
+                return entry;
+            }
+        }
+    }
+
+    std::optional< Symbol > IndirectSymbolTable::symbol( uint64_t address ) const
+    {
+        std::optional< uint32_t > index( this->symbolIndex( address ) );
+
+        if( index.has_value() == false || this->impl->_symTab.has_value() == false )
+        {
+            return {};
+        }
+
+        return this->impl->_symTab->symbol( *( index ) );
+    }
+
+    void swap( IndirectSymbolTable & o1, IndirectSymbolTable & o2 )
+    {
+        using std::swap;
+
+        swap( o1.impl, o2.impl );
+    }
+
+    IndirectSymbolTable::IMPL::IMPL( const File & file )
+    {
+        uint32_t pointerSize( ( file.kind() == File::Kind::MachO32 ) ? 4 : 8 );
+
+        for( const auto & dysymTab: file.loadCommands< LoadCommands::DysymTab >() )
+        {
+            this->_entries = dysymTab.indirectSymbols();
+
+            break;
+        }
+
+        if( this->_entries.size() == 0 )
+        {
+            return;
+        }
+
+        /* Names are only decoded for the entries that are looked up */
+        for( const auto & symTab: file.loadCommands< LoadCommands::SymTab >() )
+        {
+            this->_symTab = symTab;
+
+            break;
+        }
+
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment >() )
+        {
+            for( const auto & section: segment.sections() )
+            {
+                this->addSection( section, pointerSize );
+            }
+        }
+
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment64 >() )
+        {
+            for( const auto & section: segment.sections() )
+            {
+                this->addSection( section, pointerSize );
+            }
+        }
+
+        std::sort
+        (
+            this->_ranges.begin(),
+            this->_ranges.end(),
+            []( const Range & r1, const Range & r2 )
+            {
+                return r1.begin < r2.begin;
+            }
+        );
+    }
+
+    IndirectSymbolTable::IMPL::IMPL( const IMPL & o ):
+        _ranges(  o._ranges ),
+        _entries( o._entries ),
+        _symTab(  o._symTab )
+    {}
+
+    IndirectSymbolTable::IMPL::~IMPL()
+    {}
+
+    template< typename T >
+    void IndirectSymbolTable::IMPL::addSection( const T & section, uint32_t pointerSize )
+    {
+        uint32_t stride( 0 );
+
+        switch( section.flags() & 0xFF )
+        {
+            case 0x06: stride = pointerSize;          break; /* S_NON_LAZY_SYMBOL_POINTERS */
+            case 0x07: stride = pointerSize;          break; /* S_LAZY_SYMBOL_POINTERS */
+            case 0x08: stride = section.reserved2();  break; /* S_SYMBOL_STUBS */
+            case 0x10: stride = pointerSize;          break; /* S_LAZY_DYLIB_SYMBOL_POINTERS */
+            case 0x14: stride = pointerSize;          break; /* S_THREAD_LOCAL_VARIABLE_POINTERS */
+            default:                                  return;
+        }
+
+        if( stride == 0 || section.size() == 0 )
+        {
+            return;
+        }
+
+        this->_ranges.push_back( { section.address(), static_cast< uint64_t >( section.address() ) + section.size(), section.reserved1(), stride } );
+    }
+}
@@ -0,0 +1,586 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Inflater.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/Inflater.hpp>
+#include <XS.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace MachO
+{
+    class Inflater::IMPL
+    {
+        public:
+            
+            enum class State
+            {
+                Header,
+                Stored,
+                Compressed,
+                Done
+            };
+            
+            class Huffman
+            {
+                public:
+                    
+                    Huffman( void );
+                    
+                    void build( const uint8_t * lengths, size_t count );
+                    
+                    std::array< uint16_t, 16 >  _counts;
+                    std::vector< uint16_t >     _symbols;
+                    std::array< uint16_t, 512 > _fast;
+            };
+            
+            IMPL( const uint8_t * data, size_t size );
+            IMPL( const IMPL & o );
+            ~IMPL( void );
+            
+            size_t   read( uint8_t * buffer, size_t size );
+            void     readHeader();
+            void     readDynamicTables();
+            void     fill( unsigned int count );
+            uint32_t bits( unsigned int count );
+            uint16_t decode( const Huffman & huffman );
+            void     endBlock();
+            
+            const uint8_t          * _data;
+            size_t                   _size;
+            size_t                   _position;
+            uint64_t                 _bitBuffer;
+            unsigned int             _bitCount;
+            State                    _state;
+            bool                     _last;
+            size_t                   _stored;
+            Huffman                  _literals;
+            Huffman                  _distances;
+            size_t                   _copyLength;
+            size_t                   _copyDistance;
+            std::vector< uint8_t >   _window;
+            size_t                   _total;
+    };
+    
+    Inflater::Inflater( const uint8_t * data, size_t size ):
+        impl( std::make_unique< IMPL >( data, size ) )
+    {}
+    
+    Inflater::Inflater( const Inflater & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    Inflater::Inflater( Inflater && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    Inflater::~Inflater( void )
+    {}
+    
+    Inflater & Inflater::operator =( Inflater o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    size_t Inflater::read( uint8_t * buffer, size_t size )
+    {
+        return this->impl->read( buffer, size );
+    }
+    
+    bool Inflater::finished() const
+    {
+        return this->impl->_state == IMPL::State::Done && this->impl->_copyLength == 0;
+    }
+    
+    std::vector< uint8_t > Inflater::Inflate( const uint8_t * data, size_t size, size_t expectedSize )
+    {
+        Inflater               inflater( data, size );
+        std::vector< uint8_t > buffer;
+        std::vector< uint8_t > chunk( 65536 );
+        
+        /* The expected size comes from the archive, so the buffer only grows with the data actually inflated */
+        buffer.reserve( std::min( expectedSize, chunk.size() ) );
+        
+        while( true )
+        {
+            size_t length( inflater.read( chunk.data(), chunk.size() ) );
+            
+            if( length == 0 )
+            {
+                break;
+            }
+            
+            if( length > expectedSize - buffer.size() )
+            {
+                throw std::runtime_error( "Invalid inflated size, expected: " + std::to_string( expectedSize ) );
+            }
+            
+            buffer.insert( buffer.end(), chunk.begin(), chunk.begin() + static_cast< std::ptrdiff_t >( length ) );
+        }
+        
+        if( buffer.size() != expectedSize )
+        {
+            throw std::runtime_error( "Invalid inflated size, expected: " + std::to_string( expectedSize ) );
+        }
+        
+        return buffer;
+    }
+    
+    void swap( Inflater & o1, Inflater & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    Inflater::IMPL::IMPL( const uint8_t * data, size_t size ):
+        _data(         data ),
+        _size(         size ),
+        _position(     0 ),
+        _bitBuffer(    0 ),
+        _bitCount(     0 ),
+        _state(        State::Header ),
+        _last(         false ),
+        _stored(       0 ),
+        _copyLength(   0 ),
+        _copyDistance( 0 ),
+        _window(       32768 ),
+        _total(        0 )
+    {}
+    
+    Inflater::IMPL::IMPL( const IMPL & o ):
+        _data(         o._data ),
+        _size(         o._size ),
+        _position(     o._position ),
+        _bitBuffer(    o._bitBuffer ),
+        _bitCount(     o._bitCount ),
+        _state(        o._state ),
+        _last(         o._last ),
+        _stored(       o._stored ),
+        _literals(     o._literals ),
+        _distances(    o._distances ),
+        _copyLength(   o._copyLength ),
+        _copyDistance( o._copyDistance ),
+        _window(       o._window ),
+        _total(        o._total )
+    {}
+    
+    Inflater::IMPL::~IMPL( void )
+    {}
+    
+    size_t Inflater::IMPL::read( uint8_t * buffer, size_t size )
+    {
+        static const uint16_t lengthBase[]    = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+        static const uint8_t  lengthExtra[]   = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+        static const uint16_t distanceBase[]  = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+        static const uint8_t  distanceExtra[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+        
+        size_t count( 0 );
+        
+        while( count < size )
+        {
+            if( this->_copyLength > 0 )
+            {
+                uint8_t byte( this->_window[ ( this->_total - this->_copyDistance ) & 0x7FFF ] );
+                
+                buffer[ count++ ]                        = byte;
+                this->_window[ this->_total++ & 0x7FFF ] = byte;
+                
+                this->_copyLength--;
+                
+                continue;
+            }
+            
+            if( this->_state == State::Done )
+            {
+                break;
+            }
+            else if( this->_state == State::Header )
+            {
+                this->readHeader();
+            }
+            else if( this->_state == State::Stored )
+            {
+                size_t length( std::min( this->_stored, size - count ) );
+                
+                if( this->_stored == 0 )
+                {
+                    this->endBlock();
+                    
+                    continue;
+                }
+                
+                if( length > this->_size - this->_position )
+                {
+                    throw std::runtime_error( "Truncated deflate stream" );
+                }
+                
+                std::memcpy( buffer + count, this->_data + this->_position, length );
+                
+                for( size_t i = 0; i < length; i++ )
+                {
+                    this->_window[ this->_total++ & 0x7FFF ] = buffer[ count + i ];
+                }
+                
+                count           += length;
+                this->_position += length;
+                this->_stored   -= length;
+            }
+            else
+            {
+                uint16_t symbol( this->decode( this->_literals ) );
+                
+                if( symbol < 256 )
+                {
+                    buffer[ count++ ]                        = static_cast< uint8_t >( symbol );
+                    this->_window[ this->_total++ & 0x7FFF ] = static_cast< uint8_t >( symbol );
+                }
+                else if( symbol == 256 )
+                {
+                    this->endBlock();
+                }
+                else if( symbol - 257U < sizeof( lengthBase ) / sizeof( lengthBase[ 0 ] ) )
+                {
+                    size_t   length( lengthBase[ symbol - 257 ] + this->bits( lengthExtra[ symbol - 257 ] ) );
+                    uint16_t code( this->decode( this->_distances ) );
+                    
+                    if( code >= sizeof( distanceBase ) / sizeof( distanceBase[ 0 ] ) )
+                    {
+                        throw std::runtime_error( "Invalid deflate distance code: " + std::to_string( code ) );
+                    }
+                    
+                    {
+                        size_t distance( distanceBase[ code ] + this->bits( distanceExtra[ code ] ) );
+                        
+                        if( distance > this->_total )
+                        {
+                            throw std::runtime_error( "Invalid deflate distance: " + std::to_string( distance ) );
+                        }
+                        
+                        this->_copyLength   = length;
+                        this->_copyDistance = distance;
+                    }
+                }
+                else
+                {
+                    throw std::runtime_error( "Invalid deflate literal/length code: " + std::to_string( symbol ) );
+                }
+            }
+        }
+        
+        return count;
+    }
+    
+    void Inflater::IMPL::readHeader()
+    {
+        uint32_t type( 0 );
+        
+        this->_last = this->bits( 1 ) != 0;
+        type        = this->bits( 2 );
+        
+        if( type == 0 )
+        {
+            uint32_t length( 0 );
+            uint32_t complement( 0 );
+            
+            this->bits( this->_bitCount & 7 );
+            
+            length     = this->bits( 16 );
+            complement = this->bits( 16 );
+            
+            if( ( length ^ 0xFFFF ) != complement )
+            {
+                throw std::runtime_error( "Invalid stored deflate block length" );
+            }
+            
+            /* Whole bytes still buffered are handed back, as stored data is copied straight from the input */
+            this->_position -= this->_bitCount / 8;
+            this->_bitBuffer = 0;
+            this->_bitCount  = 0;
+            this->_stored    = length;
+            this->_state     = State::Stored;
+        }
+        else if( type == 1 )
+        {
+            std::array< uint8_t, 288 > literals;
+            std::array< uint8_t, 30 >  distances;
+            
+            std::fill( literals.begin(),       literals.begin() + 144, 8 );
+            std::fill( literals.begin() + 144, literals.begin() + 256, 9 );
+            std::fill( literals.begin() + 256, literals.begin() + 280, 7 );
+            std::fill( literals.begin() + 280, literals.end(),         8 );
+            std::fill( distances.begin(),      distances.end(),        5 );
+            
+            this->_literals.build( literals.data(), literals.size() );
+            this->_distances.build( distances.data(), distances.size() );
+            
+            this->_state = State::Compressed;
+        }
+        else if( type == 2 )
+        {
+            this->readDynamicTables();
+            
+            this->_state = State::Compressed;
+        }
+        else
+        {
+            throw std::runtime_error( "Invalid deflate block type: " + std::to_string( type ) );
+        }
+    }
+    
+    void Inflater::IMPL::readDynamicTables()
+    {
+        static const uint8_t order[] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+        
+        uint32_t                   literalCount( this->bits( 5 ) + 257 );
+        uint32_t                   distanceCount( this->bits( 5 ) + 1 );
+        uint32_t                   codeCount( this->bits( 4 ) + 4 );
+        std::array< uint8_t, 19 >  codeLengths {};
+        std::array< uint8_t, 320 > lengths {};
+        Huffman                    codes;
+        
+        if( literalCount > 286 || distanceCount > 30 )
+        {
+            throw std::runtime_error( "Invalid deflate code counts" );
+        }
+        
+        for( uint32_t i = 0; i < codeCount; i++ )
+        {
+            codeLengths[ order[ i ] ] = static_cast< uint8_t >( this->bits( 3 ) );
+        }
+        
+        codes.build( codeLengths.data(), codeLengths.size() );
+        
+        for( uint32_t i = 0; i < literalCount + distanceCount; )
+        {
+            uint16_t symbol( this->decode( codes ) );
+            uint8_t  length( 0 );
+            uint32_t repeat( 0 );
+            
+            if( symbol < 16 )
+            {
+                lengths[ i++ ] = static_cast< uint8_t >( symbol );
+                
+                continue;
+            }
+            
+            if( symbol == 16 )
+            {
+                if( i == 0 )
+                {
+                    throw std::runtime_error( "Invalid deflate code length repeat" );
+                }
+                
+                length = lengths[ i - 1 ];
+                repeat = 3 + this->bits( 2 );
+            }
+            else if( symbol == 17 )
+            {
+                repeat = 3 + this->bits( 3 );
+            }
+            else
+            {
+                repeat = 11 + this->bits( 7 );
+            }
+            
+            if( i + repeat > literalCount + distanceCount )
+            {
+                throw std::runtime_error( "Invalid deflate code length repeat" );
+            }
+            
+            while( repeat-- > 0 )
+            {
+                lengths[ i++ ] = length;
+            }
+        }
+        
+        if( lengths[ 256 ] == 0 )
+        {
+            throw std::runtime_error( "Missing deflate end of block code" );
+        }
+        
+        this->_literals.build( lengths.data(), literalCount );
+        this->_distances.build( lengths.data() + literalCount, distanceCount );
+    }
+    
+    void Inflater::IMPL::fill( unsigned int count )
+    {
+        /* Past the end of the input, zero bytes are buffered so codes can be peeked; consuming them is an error */
+        while( this->_bitCount < count )
+        {
+            uint64_t byte( ( this->_position < this->_size ) ? this->_data[ this->_position ] : 0 );
+            
+            this->_bitBuffer |= byte << this->_bitCount;
+            this->_bitCount  += 8;
+            this->_position++;
+        }
+    }
+    
+    uint32_t Inflater::IMPL::bits( unsigned int count )
+    {
+        uint32_t value( 0 );
+        
+        if( count == 0 )
+        {
+            return 0;
+        }
+        
+        this->fill( count );
+        
+        if( this->_position > this->_size && this->_bitCount - count < ( this->_position - this->_size ) * 8 )
+        {
+            throw std::runtime_error( "Truncated deflate stream" );
+        }
+        
+        value             = static_cast< uint32_t >( this->_bitBuffer & ( ( 1ULL << count ) - 1 ) );
+        this->_bitBuffer >>= count;
+        this->_bitCount   -= count;
+        
+        return value;
+    }
+    
+    uint16_t Inflater::IMPL::decode( const Huffman & huffman )
+    {
+        this->fill( 9 );
+        
+        {
+            uint16_t entry( huffman._fast[ this->_bitBuffer & 0x1FF ] );
+            
+            if( entry != 0 )
+            {
+                this->bits( entry >> 9 );
+                
+                return entry & 0x1FF;
+            }
+        }
+        
+        {
+            int code( 0 );
+            int first( 0 );
+            int index( 0 );
+            
+            for( size_t length = 1; length < 16; length++ )
+            {
+                int count( huffman._counts[ length ] );
+                
+                code |= static_cast< int >( this->bits( 1 ) );
+                
+                if( code - count < first )
+                {
+                    return huffman._symbols[ static_cast< size_t >( index + ( code - first ) ) ];
+                }
+                
+                index  += count;
+                first  += count;
+                first <<= 1;
+                code  <<= 1;
+            }
+        }
+        
+        throw std::runtime_error( "Invalid deflate Huffman code" );
+    }
+    
+    void Inflater::IMPL::endBlock()
+    {
+        this->_state = ( this->_last ) ? State::Done : State::Header;
+    }
+    
+    Inflater::IMPL::Huffman::Huffman( void ):
+        _counts{},
+        _fast{}
+    {}
+    
+    void Inflater::IMPL::Huffman::build( const uint8_t * lengths, size_t count )
+    {
+        std::array< uint16_t, 16 > offsets {};
+        std::array< uint32_t, 16 > next {};
+        int                        left( 1 );
+        
+        this->_counts.fill( 0 );
+        this->_fast.fill( 0 );
+        this->_symbols.assign( count, 0 );
+        
+        for( size_t i = 0; i < count; i++ )
+        {
+            this->_counts[ lengths[ i ] ]++;
+        }
+        
+        this->_counts[ 0 ] = 0;
+        
+        for( size_t length = 1; length < 16; length++ )
+        {
+            left <<= 1;
+            left  -= this->_counts[ length ];
+            
+            if( left < 0 )
+            {
+                throw std::runtime_error( "Over-subscribed deflate Huffman code" );
+            }
+            
+            offsets[ length ] = static_cast< uint16_t >( ( length == 1 ) ? 0 : offsets[ length - 1 ] + this->_counts[ length - 1 ] );
+            next[ length ]    = ( length == 1 ) ? 0 : ( next[ length - 1 ] + this->_counts[ length - 1 ] ) << 1;
+        }
+        
+        for( size_t i = 0; i < count; i++ )
+        {
+            uint8_t length( lengths[ i ] );
+            
+            if( length == 0 )
+            {
+                continue;
+            }
+            
+            this->_symbols[ offsets[ length ]++ ] = static_cast< uint16_t >( i );
+            
+            if( length <= 9 )
+            {
+                /* Codes are stored MSB-first but read LSB-first, so the lookup index is bit-reversed */
+                uint32_t code( next[ length ]++ );
+                uint32_t reversed( 0 );
+                
+                for( uint8_t bit = 0; bit < length; bit++ )
+                {
+                    reversed |= ( ( code >> bit ) & 1 ) << ( length - 1 - bit );
+                }
+                
+                for( uint32_t index = reversed; index < 512; index += 1U << length )
+                {
+                    this->_fast[ index ] = static_cast< uint16_t >( ( length << 9 ) | i );
+                }
+            }
+            else
+            {
+                next[ length ]++;
+            }
+        }
+    }
+}
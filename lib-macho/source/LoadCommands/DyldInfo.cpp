@@ -39,7 +39,7 @@ namespace MachO
         {
             public:
                 
-                IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream );
+                IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data );
                 IMPL( const IMPL & o );
                 ~IMPL();
                 
@@ -56,10 +56,16 @@ namespace MachO
                 uint32_t _exportOffset;
                 uint32_t _exportSize;
                 DataList _data;
+                
+                std::optional< MappedFile > _mapped;
         };
 
         DyldInfo::DyldInfo( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream ):
-            impl( std::make_unique< IMPL >( command, size, kind, stream ) )
+            impl( std::make_unique< IMPL >( command, size, kind, stream, std::nullopt ) )
+        {}
+        
+        DyldInfo::DyldInfo( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const MappedFile & data ):
+            impl( std::make_unique< IMPL >( command, size, kind, stream, data ) )
         {}
         
         DyldInfo::DyldInfo( const DyldInfo & o ):
@@ -160,6 +166,27 @@ namespace MachO
         
         LoadCommand::DataList DyldInfo::data() const
         {
+            if( this->impl->_mapped.has_value() )
+            {
+                const MappedFile & data( *( this->impl->_mapped ) );
+                DataList           list;
+                
+                auto bytes = [ & ]( uint32_t offset, uint32_t size ) -> std::vector< uint8_t >
+                {
+                    const uint8_t * p( data.pointer( offset, size ) );
+                    
+                    return { p, p + size };
+                };
+                
+                list.push_back( { "Rebase",       bytes( this->impl->_rebaseOffset,      this->impl->_rebaseSize ) } );
+                list.push_back( { "Binding",      bytes( this->impl->_bindingOffset,     this->impl->_bindingSize ) } );
+                list.push_back( { "Weak binding", bytes( this->impl->_weakBindingOffset, this->impl->_weakBindingSize ) } );
+                list.push_back( { "Lazy binding", bytes( this->impl->_lazyBindingOffset, this->impl->_lazyBindingSize ) } );
+                list.push_back( { "Export",       bytes( this->impl->_exportOffset,      this->impl->_exportSize ) } );
+                
+                return list;
+            }
+            
             return this->impl->_data;
         }
         
@@ -170,7 +197,7 @@ namespace MachO
             swap( o1.impl, o2.impl );
         }
         
-        DyldInfo::IMPL::IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream ):
+        DyldInfo::IMPL::IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data ):
             _command(           command ),
             _size(              size ),
             _rebaseOffset(      stream.readUInt32() ),
@@ -182,12 +209,19 @@ namespace MachO
             _lazyBindingOffset( stream.readUInt32() ),
             _lazyBindingSize(   stream.readUInt32() ),
             _exportOffset(      stream.readUInt32() ),
-            _exportSize(        stream.readUInt32() )
+            _exportSize(        stream.readUInt32() ),
+            _mapped(            data )
         {
             size_t pos( stream.tell() );
             
             ( void )kind;
             
+            /* Opcode streams are copied on demand when backed by a mapped file */
+            if( data.has_value() )
+            {
+                return;
+            }
+            
             stream.seek( this->_rebaseOffset, XS::IO::BinaryStream::SeekDirection::Begin );
             this->_data.push_back( { "Rebase", stream.read( this->_rebaseSize ) } );
             
@@ -219,7 +253,8 @@ namespace MachO
             _lazyBindingSize(   o._lazyBindingSize ),
             _exportOffset(      o._exportOffset ),
             _exportSize(        o._exportSize ),
-            _data(              o._data )
+            _data(              o._data ),
+            _mapped(            o._mapped )
         {}
 
         DyldInfo::IMPL::~IMPL()
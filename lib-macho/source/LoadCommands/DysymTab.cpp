@@ -39,7 +39,7 @@ namespace MachO
         {
             public:
                 
-                IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream );
+                IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data, File::Endianness endianness );
                 IMPL( const IMPL & o );
                 ~IMPL();
                 
@@ -63,10 +63,18 @@ namespace MachO
                 uint32_t _externalRelocationCount;
                 uint32_t _localRelocationOffset;
                 uint32_t _localRelocationCount;
+                
+                std::shared_ptr< const std::vector< uint32_t > > _indirectSymbols;
+                std::optional< MappedFile >                      _mapped;
+                bool                                             _bigEndian;
         };
 
         DysymTab::DysymTab( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream ):
-            impl( std::make_unique< IMPL >( command, size, kind, stream ) )
+            impl( std::make_unique< IMPL >( command, size, kind, stream, std::nullopt, File::Endianness::LittleEndian ) )
+        {}
+        
+        DysymTab::DysymTab( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const MappedFile & data, File::Endianness endianness ):
+            impl( std::make_unique< IMPL >( command, size, kind, stream, data, endianness ) )
         {}
         
         DysymTab::DysymTab( const DysymTab & o ):
@@ -212,6 +220,31 @@ namespace MachO
         {
             return this->impl->_localRelocationCount;
         }
+        
+        std::vector< uint32_t > DysymTab::indirectSymbols() const
+        {
+            if( this->impl->_mapped.has_value() )
+            {
+                std::vector< uint32_t > symbols;
+                
+                this->impl->_mapped->pointer( this->impl->_indirectSymbolTableOffset, static_cast< size_t >( this->impl->_indirectSymbolTableCount ) * 4 );
+                symbols.reserve( this->impl->_indirectSymbolTableCount );
+                
+                for( uint32_t i = 0; i < this->impl->_indirectSymbolTableCount; i++ )
+                {
+                    symbols.push_back( this->impl->_mapped->read< uint32_t >( this->impl->_indirectSymbolTableOffset + static_cast< size_t >( i ) * 4, this->impl->_bigEndian ) );
+                }
+                
+                return symbols;
+            }
+            
+            if( this->impl->_indirectSymbols == nullptr )
+            {
+                return {};
+            }
+            
+            return *( this->impl->_indirectSymbols );
+        }
 
         void swap( DysymTab & o1, DysymTab & o2 )
         {
@@ -220,7 +253,7 @@ namespace MachO
             swap( o1.impl, o2.impl );
         }
         
-        DysymTab::IMPL::IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream ):
+        DysymTab::IMPL::IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data, File::Endianness endianness ):
             _command(                     command ),
             _size(                        size ),
             _localSymbolIndex(            stream.readUInt32() ),
@@ -240,9 +273,32 @@ namespace MachO
             _externalRelocationOffset(    stream.readUInt32() ),
             _externalRelocationCount(     stream.readUInt32() ),
             _localRelocationOffset(       stream.readUInt32() ),
-            _localRelocationCount(        stream.readUInt32() )
+            _localRelocationCount(        stream.readUInt32() ),
+            _mapped(                      data ),
+            _bigEndian(                   endianness == File::Endianness::BigEndian )
         {
             ( void )kind;
+            
+            /* The indirect symbol table is decoded on demand when backed by a mapped file */
+            if( this->_indirectSymbolTableCount > 0 && data.has_value() == false )
+            {
+                size_t                  pos( stream.tell() );
+                std::vector< uint32_t > symbols;
+                
+                stream.seek( this->_indirectSymbolTableOffset, XS::IO::BinaryStream::SeekDirection::Begin );
+                
+                symbols.reserve( this->_indirectSymbolTableCount );
+                
+                for( uint32_t i = 0; i < this->_indirectSymbolTableCount; i++ )
+                {
+                    symbols.push_back( stream.readUInt32() );
+                }
+                
+                stream.seek( pos, XS::IO::BinaryStream::SeekDirection::Begin );
+                
+                /* Shared between copies, as loadCommands() returns the commands by value */
+                this->_indirectSymbols = std::make_shared< const std::vector< uint32_t > >( std::move( symbols ) );
+            }
         }
         
         DysymTab::IMPL::IMPL( const IMPL & o ):
@@ -265,7 +321,10 @@ namespace MachO
             _externalRelocationOffset(    o._externalRelocationOffset ),
             _externalRelocationCount(     o._externalRelocationCount ),
             _localRelocationOffset(       o._localRelocationOffset ),
-            _localRelocationCount(        o._localRelocationCount )
+            _localRelocationCount(        o._localRelocationCount ),
+            _indirectSymbols(             o._indirectSymbols ),
+            _mapped(                      o._mapped ),
+            _bigEndian(                   o._bigEndian )
         {}
 
         DysymTab::IMPL::~IMPL()
@@ -39,25 +39,30 @@ namespace MachO
         {
             public:
                 
-                IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream );
+                IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data );
                 IMPL( const IMPL & o );
                 ~IMPL();
                 
-                uint32_t               _command;
-                uint32_t               _size;
-                std::string            _name;
-                uint32_t               _vmAddress;
-                uint32_t               _vmSize;
-                uint32_t               _fileOffset;
-                uint32_t               _fileSize;
-                uint32_t               _maxProtection;
-                uint32_t               _initProtection;
-                uint32_t               _flags;
-                std::vector< Section > _sections;
+                uint32_t                    _command;
+                uint32_t                    _size;
+                std::string                 _name;
+                uint32_t                    _vmAddress;
+                uint32_t                    _vmSize;
+                uint32_t                    _fileOffset;
+                uint32_t                    _fileSize;
+                uint32_t                    _maxProtection;
+                uint32_t                    _initProtection;
+                uint32_t                    _flags;
+                std::vector< Section >      _sections;
+                std::optional< MappedFile > _data;
         };
 
         Segment::Segment( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream ):
-            impl( std::make_unique< IMPL >( command, size, kind, stream ) )
+            impl( std::make_unique< IMPL >( command, size, kind, stream, std::nullopt ) )
+        {}
+        
+        Segment::Segment( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const MappedFile & data ):
+            impl( std::make_unique< IMPL >( command, size, kind, stream, data ) )
         {}
         
         Segment::Segment( const Segment & o ):
@@ -186,6 +191,11 @@ namespace MachO
             return sections;
         }
         
+        std::optional< MappedFile > Segment::mappedFile() const
+        {
+            return this->impl->_data;
+        }
+        
         void swap( Segment & o1, Segment & o2 )
         {
             using std::swap;
@@ -193,7 +203,7 @@ namespace MachO
             swap( o1.impl, o2.impl );
         }
         
-        Segment::IMPL::IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream ):
+        Segment::IMPL::IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data ):
             _command(          command ),
             _size(             size ),
             _name(             stream.readString( 16 ) ),
@@ -202,7 +212,8 @@ namespace MachO
             _fileOffset(       stream.readUInt32() ),
             _fileSize(         stream.readUInt32() ),
             _maxProtection(    stream.readUInt32() ),
-            _initProtection(   stream.readUInt32() )
+            _initProtection(   stream.readUInt32() ),
+            _data(             data )
         {
             uint32_t sections( stream.readUInt32() );
             
@@ -212,7 +223,14 @@ namespace MachO
             
             for( uint32_t i = 0; i < sections; i++ )
             {
-                this->_sections.push_back( stream );
+                if( data.has_value() )
+                {
+                    this->_sections.push_back( { stream, *( data ) } );
+                }
+                else
+                {
+                    this->_sections.push_back( stream );
+                }
             }
         }
         
@@ -227,7 +245,8 @@ namespace MachO
             _maxProtection(  o._maxProtection ),
             _initProtection( o._initProtection ),
             _flags(          o._flags ),
-            _sections(       o._sections )
+            _sections(       o._sections ),
+            _data(           o._data )
         {}
 
         Segment::IMPL::~IMPL()
@@ -30,6 +30,7 @@
 #include <MachO/LoadCommands/SymTab.hpp>
 #include <MachO/ToString.hpp>
 #include <XS.hpp>
+#include <cstring>
 
 namespace MachO
 {
@@ -39,10 +40,13 @@ namespace MachO
         {
             public:
                 
-                IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream );
+                IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data, File::Endianness endianness );
                 IMPL( const IMPL & o );
                 ~IMPL();
                 
+                std::string_view stringTable() const;
+                Symbol           symbol( uint32_t index, std::string_view strings ) const;
+                
                 uint32_t _command;
                 uint32_t _size;
                 uint32_t _symbolOffset;
@@ -52,10 +56,17 @@ namespace MachO
 
                 std::vector< std::string >  _strings;
                 std::vector< Symbol >       _symbols;
+                File::Kind                  _kind;
+                File::Endianness            _endianness;
+                std::optional< MappedFile > _mapped;
         };
 
         SymTab::SymTab( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream ):
-            impl( std::make_unique< IMPL >( command, size, kind, stream ) )
+            impl( std::make_unique< IMPL >( command, size, kind, stream, std::nullopt, File::Endianness::LittleEndian ) )
+        {}
+        
+        SymTab::SymTab( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const MappedFile & data, File::Endianness endianness ):
+            impl( std::make_unique< IMPL >( command, size, kind, stream, data, endianness ) )
         {}
         
         SymTab::SymTab( const SymTab & o ):
@@ -120,14 +131,121 @@ namespace MachO
 
         std::vector< std::string > SymTab::strings() const
         {
+            if( this->impl->_mapped.has_value() )
+            {
+                std::vector< std::string > strings;
+                const char               * table( reinterpret_cast< const char * >( this->impl->_mapped->pointer( this->impl->_stringOffset, this->impl->_stringSize ) ) );
+                size_t                     pos( 0 );
+                
+                while( pos < this->impl->_stringSize )
+                {
+                    const void * end( memchr( table + pos, 0, this->impl->_stringSize - pos ) );
+                    size_t       length( ( end == nullptr ) ? this->impl->_stringSize - pos : static_cast< size_t >( static_cast< const char * >( end ) - ( table + pos ) ) );
+                    
+                    strings.push_back( std::string( table + pos, length ) );
+                    
+                    pos += length + 1;
+                }
+                
+                return strings;
+            }
+            
             return this->impl->_strings;
         }
 
         std::vector< Symbol > SymTab::symbols() const
         {
+            if( this->impl->_mapped.has_value() )
+            {
+                std::vector< Symbol > symbols;
+                size_t                size( ( this->impl->_kind == File::Kind::MachO64 ) ? 16 : 12 );
+                std::string_view      strings;
+                
+                this->impl->_mapped->pointer( this->impl->_symbolOffset, static_cast< size_t >( this->impl->_symbolCount ) * size );
+                
+                strings = this->impl->stringTable();
+                
+                symbols.reserve( this->impl->_symbolCount );
+                
+                for( uint32_t i = 0; i < this->impl->_symbolCount; i++ )
+                {
+                    symbols.push_back( this->impl->symbol( i, strings ) );
+                }
+                
+                return symbols;
+            }
+            
             return this->impl->_symbols;
         }
-
+        
+        std::optional< Symbol > SymTab::symbol( uint32_t index ) const
+        {
+            if( this->impl->_mapped.has_value() )
+            {
+                if( index >= this->impl->_symbolCount )
+                {
+                    return {};
+                }
+                
+                return this->impl->symbol( index, this->impl->stringTable() );
+            }
+            
+            if( index >= this->impl->_symbols.size() )
+            {
+                return {};
+            }
+            
+            return this->impl->_symbols[ index ];
+        }
+        
+        std::optional< std::vector< SymTab::Entry > > SymTab::entries() const
+        {
+            std::vector< Entry > entries;
+            bool                 bigEndian( this->impl->_endianness == File::Endianness::BigEndian );
+            bool                 is64( this->impl->_kind == File::Kind::MachO64 );
+            size_t               size( is64 ? 16 : 12 );
+            const MappedFile   * data( this->impl->_mapped.has_value() ? &( *( this->impl->_mapped ) ) : nullptr );
+            std::string_view     strings;
+            
+            if( data == nullptr )
+            {
+                return {};
+            }
+            
+            data->pointer( this->impl->_symbolOffset, static_cast< size_t >( this->impl->_symbolCount ) * size );
+            
+            strings = { reinterpret_cast< const char * >( data->pointer( this->impl->_stringOffset, this->impl->_stringSize ) ), this->impl->_stringSize };
+            
+            entries.reserve( this->impl->_symbolCount );
+            
+            for( uint32_t i = 0; i < this->impl->_symbolCount; i++ )
+            {
+                size_t           offset( this->impl->_symbolOffset + static_cast< size_t >( i ) * size );
+                uint32_t         index( data->read< uint32_t >( offset, bigEndian ) );
+                std::string_view name;
+                
+                /* Names are bounded by the string table */
+                if( index != 0 && index < strings.size() )
+                {
+                    name = strings.substr( index );
+                    name = name.substr( 0, std::min( name.find( '\0' ), name.size() ) );
+                }
+                
+                entries.push_back
+                (
+                    {
+                        name,
+                        data->read< uint8_t >( offset + 4 ),
+                        data->read< uint8_t >( offset + 5 ),
+                        data->read< uint16_t >( offset + 6, bigEndian ),
+                        is64 ? data->read< uint64_t >( offset + 8, bigEndian ) : data->read< uint32_t >( offset + 8, bigEndian )
+                    }
+                );
+            }
+            
+            return entries;
+        }
+        
         void swap( SymTab & o1, SymTab & o2 )
         {
             using std::swap;
@@ -135,14 +253,23 @@ namespace MachO
             swap( o1.impl, o2.impl );
         }
         
-        SymTab::IMPL::IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream ):
+        SymTab::IMPL::IMPL( uint32_t command, uint32_t size, File::Kind kind, XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data, File::Endianness endianness ):
             _command(      command ),
             _size(         size ),
             _symbolOffset( stream.readUInt32() ),
             _symbolCount(  stream.readUInt32() ),
             _stringOffset( stream.readUInt32() ),
-            _stringSize(   stream.readUInt32() )
+            _stringSize(   stream.readUInt32() ),
+            _kind(         kind ),
+            _endianness(   endianness ),
+            _mapped(       data )
         {
+            /* Strings and symbols are decoded on demand when backed by a mapped file */
+            if( data.has_value() )
+            {
+                return;
+            }
+            
             stream.seek( this->_stringOffset, XS::IO::BinaryStream::SeekDirection::Begin );
 
             while( stream.tell() < this->_stringOffset + this->_stringSize )
@@ -166,10 +293,45 @@ namespace MachO
             _stringOffset( o._stringOffset ),
             _stringSize(   o._stringSize ),
             _strings(      o._strings ),
-            _symbols(      o._symbols )
+            _symbols(      o._symbols ),
+            _kind(         o._kind ),
+            _endianness(   o._endianness ),
+            _mapped(       o._mapped )
         {}
 
         SymTab::IMPL::~IMPL()
         {}
+        
+        std::string_view SymTab::IMPL::stringTable() const
+        {
+            return { reinterpret_cast< const char * >( this->_mapped->pointer( this->_stringOffset, this->_stringSize ) ), this->_stringSize };
+        }
+        
+        Symbol SymTab::IMPL::symbol( uint32_t index, std::string_view strings ) const
+        {
+            const MappedFile & data( *( this->_mapped ) );
+            bool               bigEndian( this->_endianness == File::Endianness::BigEndian );
+            bool               is64( this->_kind == File::Kind::MachO64 );
+            size_t             offset( this->_symbolOffset + static_cast< size_t >( index ) * ( is64 ? 16 : 12 ) );
+            uint32_t           nameIndex( data.read< uint32_t >( offset, bigEndian ) );
+            std::string_view   name;
+            
+            /* Names are bounded by the string table */
+            if( nameIndex != 0 && nameIndex < strings.size() )
+            {
+                name = strings.substr( nameIndex );
+                name = name.substr( 0, std::min( name.find( '\0' ), name.size() ) );
+            }
+            
+            return
+            {
+                std::string( name ),
+                nameIndex,
+                data.read< uint8_t >( offset + 4 ),
+                data.read< uint8_t >( offset + 5 ),
+                data.read< uint16_t >( offset + 6, bigEndian ),
+                is64 ? data.read< uint64_t >( offset + 8, bigEndian ) : data.read< uint32_t >( offset + 8, bigEndian )
+            };
+        }
     }
 }
@@ -0,0 +1,256 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        MappedFile.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/MappedFile.hpp>
+#include <XS.hpp>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace MachO
+{
+    class MappedFile::IMPL
+    {
+        public:
+
+            class Region
+            {
+                public:
+
+                    Region( const std::string & path );
+                    Region( std::vector< uint8_t > data );
+                    Region( const Region & o ) = delete;
+                    ~Region();
+
+                    Region & operator =( const Region & o ) = delete;
+
+                    std::optional< std::string > _path;
+                    std::vector< uint8_t >       _buffer;
+                    void                       * _map;
+                    size_t                       _mapSize;
+                    const uint8_t              * _data;
+                    size_t                       _size;
+            };
+
+            IMPL( const std::string & path );
+            IMPL( std::vector< uint8_t > data );
+            IMPL( const IMPL & o );
+            IMPL( const IMPL & o, size_t offset, size_t size );
+            ~IMPL();
+
+            std::shared_ptr< Region > _region;
+            const uint8_t           * _data;
+            size_t                    _offset;
+            size_t                    _size;
+    };
+
+    MappedFile::MappedFile( const std::string & path ):
+        impl( std::make_unique< IMPL >( path ) )
+    {}
+
+    MappedFile::MappedFile( std::vector< uint8_t > data ):
+        impl( std::make_unique< IMPL >( std::move( data ) ) )
+    {}
+
+    MappedFile::MappedFile( const MappedFile & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+
+    MappedFile::MappedFile( MappedFile && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+
+    MappedFile::~MappedFile()
+    {}
+
+    MappedFile & MappedFile::operator =( MappedFile o )
+    {
+        swap( *( this ), o );
+
+        return *( this );
+    }
+
+    std::optional< std::string > MappedFile::path() const
+    {
+        return this->impl->_region->_path;
+    }
+
+    const uint8_t * MappedFile::data() const
+    {
+        return this->impl->_data;
+    }
+
+    size_t MappedFile::size() const
+    {
+        return this->impl->_size;
+    }
+
+    size_t MappedFile::offset() const
+    {
+        return this->impl->_offset;
+    }
+
+    MappedFile MappedFile::slice( size_t offset, size_t size ) const
+    {
+        if( this->contains( offset, size ) == false )
+        {
+            throw std::runtime_error( "Invalid mapped file range: " + XS::ToString::Hex( offset ) + " - " + XS::ToString::Hex( size ) );
+        }
+
+        {
+            MappedFile slice( *( this ) );
+
+            slice.impl = std::make_unique< IMPL >( *( this->impl ), offset, size );
+
+            return slice;
+        }
+    }
+
+    bool MappedFile::contains( size_t offset, size_t size ) const
+    {
+        return offset <= this->impl->_size && size <= this->impl->_size - offset;
+    }
+
+    const uint8_t * MappedFile::pointer( size_t offset, size_t size ) const
+    {
+        if( this->contains( offset, size ) == false )
+        {
+            throw std::runtime_error( "Invalid mapped file offset: " + XS::ToString::Hex( offset ) );
+        }
+
+        return this->impl->_data + offset;
+    }
+
+    std::string_view MappedFile::cString( size_t offset ) const
+    {
+        const uint8_t * p( this->pointer( offset, 0 ) );
+        const void    * end( std::memchr( p, 0, this->impl->_size - offset ) );
+        size_t          length( ( end == nullptr ) ? this->impl->_size - offset : static_cast< size_t >( static_cast< const uint8_t * >( end ) - p ) );
+
+        return { reinterpret_cast< const char * >( p ), length };
+    }
+
+    void swap( MappedFile & o1, MappedFile & o2 )
+    {
+        using std::swap;
+
+        swap( o1.impl, o2.impl );
+    }
+
+    MappedFile::IMPL::IMPL( const std::string & path ):
+        _region( std::make_shared< Region >( path ) ),
+        _data(   this->_region->_data ),
+        _offset( 0 ),
+        _size(   this->_region->_size )
+    {}
+
+    MappedFile::IMPL::IMPL( std::vector< uint8_t > data ):
+        _region( std::make_shared< Region >( std::move( data ) ) ),
+        _data(   this->_region->_data ),
+        _offset( 0 ),
+        _size(   this->_region->_size )
+    {}
+
+    MappedFile::IMPL::IMPL( const IMPL & o ):
+        _region( o._region ),
+        _data(   o._data ),
+        _offset( o._offset ),
+        _size(   o._size )
+    {}
+
+    MappedFile::IMPL::IMPL( const IMPL & o, size_t offset, size_t size ):
+        _region( o._region ),
+        _data(   o._data + offset ),
+        _offset( o._offset + offset ),
+        _size(   size )
+    {}
+
+    MappedFile::IMPL::~IMPL()
+    {}
+
+    MappedFile::IMPL::Region::Region( const std::string & path ):
+        _path(    path ),
+        _map(     nullptr ),
+        _mapSize( 0 ),
+        _data(    nullptr ),
+        _size(    0 )
+    {
+        int         fd( open( path.c_str(), O_RDONLY ) );
+        struct stat st;
+
+        if( fd < 0 )
+        {
+            throw std::runtime_error( "Cannot open file: " + path );
+        }
+
+        if( fstat( fd, &st ) != 0 || st.st_size < 0 )
+        {
+            close( fd );
+
+            throw std::runtime_error( "Cannot stat file: " + path );
+        }
+
+        if( st.st_size > 0 )
+        {
+            void * map( mmap( nullptr, static_cast< size_t >( st.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 ) );
+
+            if( map == MAP_FAILED )
+            {
+                close( fd );
+
+                throw std::runtime_error( "Cannot map file: " + path );
+            }
+
+            this->_map     = map;
+            this->_mapSize = static_cast< size_t >( st.st_size );
+            this->_data    = static_cast< const uint8_t * >( map );
+            this->_size    = this->_mapSize;
+        }
+
+        close( fd );
+    }
+
+    MappedFile::IMPL::Region::Region( std::vector< uint8_t > data ):
+        _buffer(  std::move( data ) ),
+        _map(     nullptr ),
+        _mapSize( 0 ),
+        _data(    this->_buffer.data() ),
+        _size(    this->_buffer.size() )
+    {}
+
+    MappedFile::IMPL::Region::~Region()
+    {
+        if( this->_map != nullptr )
+        {
+            munmap( this->_map, this->_mapSize );
+        }
+    }
+}
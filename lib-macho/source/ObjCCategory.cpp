@@ -0,0 +1,206 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ObjCCategory.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ObjCCategory.hpp>
+#include <MachO/ObjCClass.hpp>
+#include <MachO/ObjCMetadata.hpp>
+#include <MachO/ObjCProtocol.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    class ObjCCategory::IMPL
+    {
+        public:
+            
+            IMPL( const ObjCMetadata & metadata, uint64_t address );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            uint64_t pointer( size_t index ) const;
+            
+            ObjCMetadata _metadata;
+            uint64_t     _address;
+    };
+    
+    ObjCCategory::ObjCCategory( const ObjCMetadata & metadata, uint64_t address ):
+        impl( std::make_unique< IMPL >( metadata, address ) )
+    {}
+    
+    ObjCCategory::ObjCCategory( const ObjCCategory & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ObjCCategory::ObjCCategory( ObjCCategory && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ObjCCategory::~ObjCCategory()
+    {}
+    
+    ObjCCategory & ObjCCategory::operator =( ObjCCategory o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info ObjCCategory::getInfo() const
+    {
+        XS::Info                     i( "Category", this->name() );
+        XS::Info                     instanceMethods( "Instance methods" );
+        XS::Info                     classMethods( "Class methods" );
+        XS::Info                     protocols( "Protocols" );
+        std::optional< std::string > cls( this->className() );
+        
+        i.addChild( { "Address", XS::ToString::Hex( this->address() ) } );
+        i.addChild( { "Class",   ( cls.has_value() ) ? *( cls ) : "--" } );
+        
+        for( const auto & method: this->instanceMethods() )
+        {
+            instanceMethods.addChild( method );
+        }
+        
+        for( const auto & method: this->classMethods() )
+        {
+            classMethods.addChild( method );
+        }
+        
+        for( const auto & protocol: this->protocols() )
+        {
+            protocols.addChild( { protocol.name() } );
+        }
+        
+        if( instanceMethods.children().size() > 0 )
+        {
+            instanceMethods.value( std::to_string( instanceMethods.children().size() ) );
+            i.addChild( instanceMethods );
+        }
+        
+        if( classMethods.children().size() > 0 )
+        {
+            classMethods.value( std::to_string( classMethods.children().size() ) );
+            i.addChild( classMethods );
+        }
+        
+        if( protocols.children().size() > 0 )
+        {
+            protocols.value( std::to_string( protocols.children().size() ) );
+            i.addChild( protocols );
+        }
+        
+        return i;
+    }
+    
+    uint64_t ObjCCategory::address() const
+    {
+        return this->impl->_address;
+    }
+    
+    std::string ObjCCategory::name() const
+    {
+        return std::string( this->impl->_metadata.readCString( this->impl->pointer( 0 ) ) );
+    }
+    
+    std::optional< ObjCClass > ObjCCategory::cls() const
+    {
+        uint64_t address( this->impl->pointer( 1 ) );
+        
+        if( this->impl->_metadata.contains( address ) == false )
+        {
+            return {};
+        }
+        
+        return ObjCClass( this->impl->_metadata, address );
+    }
+    
+    std::optional< std::string > ObjCCategory::className() const
+    {
+        std::optional< ObjCClass > cls( this->cls() );
+        
+        if( cls.has_value() )
+        {
+            return cls->name();
+        }
+        
+        {
+            std::optional< std::string > symbol( this->impl->_metadata.readBinding( this->impl->_address + this->impl->_metadata.pointerSize() ) );
+            std::string                  prefix( "_OBJC_CLASS_$_" );
+            
+            if( symbol.has_value() && symbol->compare( 0, prefix.length(), prefix ) == 0 )
+            {
+                return symbol->substr( prefix.length() );
+            }
+            
+            return symbol;
+        }
+    }
+    
+    std::vector< ObjCMethod > ObjCCategory::instanceMethods() const
+    {
+        return this->impl->_metadata.readMethodList( this->impl->pointer( 2 ) );
+    }
+    
+    std::vector< ObjCMethod > ObjCCategory::classMethods() const
+    {
+        return this->impl->_metadata.readMethodList( this->impl->pointer( 3 ) );
+    }
+    
+    std::vector< ObjCProtocol > ObjCCategory::protocols() const
+    {
+        return this->impl->_metadata.readProtocolList( this->impl->pointer( 4 ) );
+    }
+    
+    void swap( ObjCCategory & o1, ObjCCategory & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ObjCCategory::IMPL::IMPL( const ObjCMetadata & metadata, uint64_t address ):
+        _metadata( metadata ),
+        _address(  address )
+    {}
+    
+    ObjCCategory::IMPL::IMPL( const IMPL & o ):
+        _metadata( o._metadata ),
+        _address(  o._address )
+    {}
+    
+    ObjCCategory::IMPL::~IMPL()
+    {}
+    
+    uint64_t ObjCCategory::IMPL::pointer( size_t index ) const
+    {
+        /* name, cls, instanceMethods, classMethods, protocols */
+        return this->_metadata.readPointer( this->_address + index * this->_metadata.pointerSize() );
+    }
+}
@@ -0,0 +1,293 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ObjCClass.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ObjCClass.hpp>
+#include <MachO/ObjCMetadata.hpp>
+#include <MachO/ObjCProtocol.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    class ObjCClass::IMPL
+    {
+        public:
+            
+            IMPL( const ObjCMetadata & metadata, uint64_t address );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            uint64_t bits()                  const;
+            uint64_t ro()                    const;
+            uint64_t roPointer( size_t index ) const;
+            
+            ObjCMetadata _metadata;
+            uint64_t     _address;
+    };
+    
+    ObjCClass::ObjCClass( const ObjCMetadata & metadata, uint64_t address ):
+        impl( std::make_unique< IMPL >( metadata, address ) )
+    {}
+    
+    ObjCClass::ObjCClass( const ObjCClass & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ObjCClass::ObjCClass( ObjCClass && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ObjCClass::~ObjCClass()
+    {}
+    
+    ObjCClass & ObjCClass::operator =( ObjCClass o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info ObjCClass::getInfo() const
+    {
+        XS::Info                     i( "Class", this->name() );
+        XS::Info                     methods( "Methods" );
+        XS::Info                     classMethods( "Class methods" );
+        XS::Info                     ivars( "Ivars" );
+        XS::Info                     protocols( "Protocols" );
+        std::optional< std::string > superclass( this->superclassName() );
+        
+        i.addChild( { "Address",       XS::ToString::Hex( this->address() ) } );
+        i.addChild( { "Superclass",    ( superclass.has_value() ) ? *( superclass ) : "--" } );
+        i.addChild( { "Flags",         XS::ToString::Hex( this->flags() ) } );
+        i.addChild( { "Instance size", std::to_string( this->instanceSize() ) } );
+        i.addChild( { "Swift",         std::to_string( this->isSwift() ) } );
+        
+        for( const auto & method: this->methods() )
+        {
+            methods.addChild( method );
+        }
+        
+        for( const auto & method: this->classMethods() )
+        {
+            classMethods.addChild( method );
+        }
+        
+        for( const auto & ivar: this->ivars() )
+        {
+            ivars.addChild( ivar );
+        }
+        
+        for( const auto & protocol: this->protocols() )
+        {
+            protocols.addChild( { protocol.name() } );
+        }
+        
+        if( methods.children().size() > 0 )
+        {
+            methods.value( std::to_string( methods.children().size() ) );
+            i.addChild( methods );
+        }
+        
+        if( classMethods.children().size() > 0 )
+        {
+            classMethods.value( std::to_string( classMethods.children().size() ) );
+            i.addChild( classMethods );
+        }
+        
+        if( ivars.children().size() > 0 )
+        {
+            ivars.value( std::to_string( ivars.children().size() ) );
+            i.addChild( ivars );
+        }
+        
+        if( protocols.children().size() > 0 )
+        {
+            protocols.value( std::to_string( protocols.children().size() ) );
+            i.addChild( protocols );
+        }
+        
+        return i;
+    }
+    
+    uint64_t ObjCClass::address() const
+    {
+        return this->impl->_address;
+    }
+    
+    std::string ObjCClass::name() const
+    {
+        return std::string( this->impl->_metadata.readCString( this->impl->roPointer( 1 ) ) );
+    }
+    
+    bool ObjCClass::isMetaClass() const
+    {
+        /* RO_META */
+        return ( this->flags() & 1 ) != 0;
+    }
+    
+    bool ObjCClass::isSwift() const
+    {
+        /* FAST_IS_SWIFT_LEGACY / FAST_IS_SWIFT_STABLE */
+        return ( this->impl->bits() & 3 ) != 0;
+    }
+    
+    uint32_t ObjCClass::flags() const
+    {
+        return this->impl->_metadata.readUInt32( this->impl->ro() );
+    }
+    
+    uint32_t ObjCClass::instanceStart() const
+    {
+        return this->impl->_metadata.readUInt32( this->impl->ro() + 4 );
+    }
+    
+    uint32_t ObjCClass::instanceSize() const
+    {
+        return this->impl->_metadata.readUInt32( this->impl->ro() + 8 );
+    }
+    
+    std::optional< ObjCClass > ObjCClass::superclass() const
+    {
+        uint64_t address( this->impl->_metadata.readPointer( this->impl->_address + this->impl->_metadata.pointerSize() ) );
+        
+        if( this->impl->_metadata.contains( address ) == false )
+        {
+            return {};
+        }
+        
+        return ObjCClass( this->impl->_metadata, address );
+    }
+    
+    std::optional< std::string > ObjCClass::superclassName() const
+    {
+        std::optional< ObjCClass > superclass( this->superclass() );
+        
+        if( superclass.has_value() )
+        {
+            return superclass->name();
+        }
+        
+        {
+            std::optional< std::string > symbol( this->impl->_metadata.readBinding( this->impl->_address + this->impl->_metadata.pointerSize() ) );
+            
+            if( symbol.has_value() == false )
+            {
+                return {};
+            }
+            
+            for( const std::string & prefix: { std::string( "_OBJC_CLASS_$_" ), std::string( "_OBJC_METACLASS_$_" ) } )
+            {
+                if( symbol->compare( 0, prefix.length(), prefix ) == 0 )
+                {
+                    return symbol->substr( prefix.length() );
+                }
+            }
+            
+            return symbol;
+        }
+    }
+    
+    std::optional< ObjCClass > ObjCClass::metaClass() const
+    {
+        uint64_t address( this->impl->_metadata.readPointer( this->impl->_address ) );
+        
+        if( this->impl->_metadata.contains( address ) == false || this->isMetaClass() )
+        {
+            return {};
+        }
+        
+        return ObjCClass( this->impl->_metadata, address );
+    }
+    
+    std::vector< ObjCMethod > ObjCClass::methods() const
+    {
+        return this->impl->_metadata.readMethodList( this->impl->roPointer( 2 ) );
+    }
+    
+    std::vector< ObjCMethod > ObjCClass::classMethods() const
+    {
+        std::optional< ObjCClass > meta( this->metaClass() );
+        
+        if( meta.has_value() == false )
+        {
+            return {};
+        }
+        
+        return meta->methods();
+    }
+    
+    std::vector< ObjCIvar > ObjCClass::ivars() const
+    {
+        return this->impl->_metadata.readIvarList( this->impl->roPointer( 4 ) );
+    }
+    
+    std::vector< ObjCProtocol > ObjCClass::protocols() const
+    {
+        return this->impl->_metadata.readProtocolList( this->impl->roPointer( 3 ) );
+    }
+    
+    void swap( ObjCClass & o1, ObjCClass & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ObjCClass::IMPL::IMPL( const ObjCMetadata & metadata, uint64_t address ):
+        _metadata( metadata ),
+        _address(  address )
+    {}
+    
+    ObjCClass::IMPL::IMPL( const IMPL & o ):
+        _metadata( o._metadata ),
+        _address(  o._address )
+    {}
+    
+    ObjCClass::IMPL::~IMPL()
+    {}
+    
+    uint64_t ObjCClass::IMPL::bits() const
+    {
+        /* isa, superclass, cache, vtable, bits */
+        return this->_metadata.readPointer( this->_address + 4 * this->_metadata.pointerSize() );
+    }
+    
+    uint64_t ObjCClass::IMPL::ro() const
+    {
+        return this->bits() & ~static_cast< uint64_t >( ( this->_metadata.pointerSize() == 8 ) ? 7 : 3 );
+    }
+    
+    uint64_t ObjCClass::IMPL::roPointer( size_t index ) const
+    {
+        /* flags, instanceStart, instanceSize, reserved (64 bits only), then ivarLayout, name, baseMethods, baseProtocols, ivars */
+        size_t ps( this->_metadata.pointerSize() );
+        
+        return this->_metadata.readPointer( this->ro() + ( ( ps == 8 ) ? 16 : 12 ) + index * ps );
+    }
+}
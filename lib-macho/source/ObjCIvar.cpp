@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ObjCIvar.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ObjCIvar.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    ObjCIvar::ObjCIvar( const std::string & name, const std::string & type, uint32_t offset, uint32_t size, uint32_t alignment ):
+        _name(      name ),
+        _type(      type ),
+        _offset(    offset ),
+        _size(      size ),
+        _alignment( alignment )
+    {}
+    
+    ObjCIvar::ObjCIvar( const ObjCIvar & o ):
+        XS::Info::Object(),
+        _name(      o._name ),
+        _type(      o._type ),
+        _offset(    o._offset ),
+        _size(      o._size ),
+        _alignment( o._alignment )
+    {}
+    
+    ObjCIvar::~ObjCIvar()
+    {}
+    
+    ObjCIvar & ObjCIvar::operator =( const ObjCIvar & o )
+    {
+        this->_name      = o._name;
+        this->_type      = o._type;
+        this->_offset    = o._offset;
+        this->_size      = o._size;
+        this->_alignment = o._alignment;
+        
+        return *( this );
+    }
+    
+    XS::Info ObjCIvar::getInfo() const
+    {
+        XS::Info i( "Ivar", this->name() );
+        
+        i.addChild( { "Type",      this->type() } );
+        i.addChild( { "Offset",    XS::ToString::Hex( this->offset() ) } );
+        i.addChild( { "Size",      std::to_string( this->size() ) } );
+        i.addChild( { "Alignment", std::to_string( this->alignment() ) } );
+        
+        return i;
+    }
+    
+    std::string ObjCIvar::name() const
+    {
+        return this->_name;
+    }
+    
+    std::string ObjCIvar::type() const
+    {
+        return this->_type;
+    }
+    
+    uint32_t ObjCIvar::offset() const
+    {
+        return this->_offset;
+    }
+    
+    uint32_t ObjCIvar::size() const
+    {
+        return this->_size;
+    }
+    
+    uint32_t ObjCIvar::alignment() const
+    {
+        return this->_alignment;
+    }
+}
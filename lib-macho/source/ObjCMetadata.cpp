@@ -0,0 +1,490 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ObjCMetadata.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ObjCMetadata.hpp>
+#include <MachO/AddressSpace.hpp>
+#include <MachO/CacheFile.hpp>
+#include <MachO/ChainedFixups.hpp>
+#include <MachO/Section.hpp>
+#include <MachO/Section64.hpp>
+#include <MachO/ToString.hpp>
+#include <MachO/LoadCommands/Segment.hpp>
+#include <MachO/LoadCommands/Segment64.hpp>
+
+namespace MachO
+{
+    class ObjCMetadata::IMPL
+    {
+        public:
+            
+            struct Range
+            {
+                uint64_t address;
+                uint64_t size;
+            };
+            
+            class Data
+            {
+                public:
+                    
+                    Data( const File & file );
+                    Data( const File & file, const CacheFile & cache );
+                    Data( const File & file, const AddressSpace & space );
+                    
+                    template< typename T >
+                    void addSections( const std::vector< T > & sections );
+                    
+                    AddressSpace              _space;
+                    ChainedFixups             _fixups;
+                    size_t                    _pointerSize;
+                    std::vector< Range >      _classes;
+                    std::vector< Range >      _categories;
+                    std::vector< Range >      _protocols;
+                    std::optional< uint64_t > _selectorBase;
+            };
+            
+            IMPL( const File & file );
+            IMPL( const File & image, const CacheFile & cache );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            ChainedFixups::Pointer pointer( uint64_t address ) const;
+            
+            std::shared_ptr< const Data > _data;
+    };
+    
+    ObjCMetadata::ObjCMetadata( const File & file ):
+        impl( std::make_unique< IMPL >( file ) )
+    {}
+    
+    ObjCMetadata::ObjCMetadata( const File & image, const CacheFile & cache ):
+        impl( std::make_unique< IMPL >( image, cache ) )
+    {}
+    
+    ObjCMetadata::ObjCMetadata( const ObjCMetadata & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ObjCMetadata::ObjCMetadata( ObjCMetadata && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ObjCMetadata::~ObjCMetadata()
+    {}
+    
+    ObjCMetadata & ObjCMetadata::operator =( ObjCMetadata o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info ObjCMetadata::getInfo() const
+    {
+        XS::Info                    i( "Objective-C" );
+        XS::Info                    classes( "Classes" );
+        XS::Info                    categories( "Categories" );
+        XS::Info                    protocols( "Protocols" );
+        std::vector< ObjCClass >    classList( this->classes() );
+        std::vector< ObjCCategory > categoryList( this->categories() );
+        std::vector< ObjCProtocol > protocolList( this->protocols() );
+        
+        for( const auto & cls: classList )
+        {
+            classes.addChild( cls );
+        }
+        
+        for( const auto & category: categoryList )
+        {
+            categories.addChild( category );
+        }
+        
+        for( const auto & protocol: protocolList )
+        {
+            protocols.addChild( protocol );
+        }
+        
+        classes.value( std::to_string( classList.size() ) );
+        categories.value( std::to_string( categoryList.size() ) );
+        protocols.value( std::to_string( protocolList.size() ) );
+        
+        i.addChild( classes );
+        i.addChild( categories );
+        i.addChild( protocols );
+        
+        return i;
+    }
+    
+    std::vector< ObjCClass > ObjCMetadata::classes() const
+    {
+        std::vector< ObjCClass > classes;
+        size_t                   size( this->impl->_data->_pointerSize );
+        
+        for( const auto & range: this->impl->_data->_classes )
+        {
+            classes.reserve( classes.size() + static_cast< size_t >( range.size / size ) );
+            
+            for( uint64_t offset = 0; offset + size <= range.size; offset += size )
+            {
+                uint64_t address( this->readPointer( range.address + offset ) );
+                
+                if( address != 0 )
+                {
+                    classes.push_back( { *( this ), address } );
+                }
+            }
+        }
+        
+        return classes;
+    }
+    
+    std::vector< ObjCCategory > ObjCMetadata::categories() const
+    {
+        std::vector< ObjCCategory > categories;
+        size_t                      size( this->impl->_data->_pointerSize );
+        
+        for( const auto & range: this->impl->_data->_categories )
+        {
+            for( uint64_t offset = 0; offset + size <= range.size; offset += size )
+            {
+                uint64_t address( this->readPointer( range.address + offset ) );
+                
+                if( address != 0 )
+                {
+                    categories.push_back( { *( this ), address } );
+                }
+            }
+        }
+        
+        return categories;
+    }
+    
+    std::vector< ObjCProtocol > ObjCMetadata::protocols() const
+    {
+        std::vector< ObjCProtocol > protocols;
+        size_t                      size( this->impl->_data->_pointerSize );
+        
+        for( const auto & range: this->impl->_data->_protocols )
+        {
+            for( uint64_t offset = 0; offset + size <= range.size; offset += size )
+            {
+                uint64_t address( this->readPointer( range.address + offset ) );
+                
+                if( address != 0 )
+                {
+                    protocols.push_back( { *( this ), address } );
+                }
+            }
+        }
+        
+        return protocols;
+    }
+    
+    std::optional< ObjCClass > ObjCMetadata::classNamed( const std::string & name ) const
+    {
+        for( const auto & cls: this->classes() )
+        {
+            if( cls.name() == name )
+            {
+                return cls;
+            }
+        }
+        
+        return {};
+    }
+    
+    size_t ObjCMetadata::pointerSize() const
+    {
+        return this->impl->_data->_pointerSize;
+    }
+    
+    bool ObjCMetadata::contains( uint64_t address ) const
+    {
+        return address != 0 && this->impl->_data->_space.contains( address );
+    }
+    
+    uint64_t ObjCMetadata::readPointer( uint64_t address ) const
+    {
+        ChainedFixups::Pointer p( this->impl->pointer( address ) );
+        
+        return ( p.ordinal.has_value() ) ? 0 : p.target;
+    }
+    
+    std::optional< std::string > ObjCMetadata::readBinding( uint64_t address ) const
+    {
+        ChainedFixups::Pointer p( this->impl->pointer( address ) );
+        
+        if( p.ordinal.has_value() == false )
+        {
+            return {};
+        }
+        
+        return this->impl->_data->_fixups.import( *( p.ordinal ) );
+    }
+    
+    uint32_t ObjCMetadata::readUInt32( uint64_t address ) const
+    {
+        return this->impl->_data->_space.read< uint32_t >( address );
+    }
+    
+    std::string_view ObjCMetadata::readCString( uint64_t address ) const
+    {
+        if( address == 0 )
+        {
+            return {};
+        }
+        
+        return this->impl->_data->_space.readCString( address );
+    }
+    
+    std::vector< ObjCMethod > ObjCMetadata::readMethodList( uint64_t address ) const
+    {
+        std::vector< ObjCMethod > methods;
+        
+        if( address == 0 )
+        {
+            return methods;
+        }
+        
+        {
+            uint32_t flags( this->readUInt32( address ) );
+            uint32_t count( this->readUInt32( address + 4 ) );
+            uint64_t size( flags & 0xFFFC );
+            bool     relative( ( flags & 0x80000000 ) != 0 );
+            
+            if( size == 0 )
+            {
+                size = ( relative ) ? 12 : 3 * this->pointerSize();
+            }
+            
+            methods.reserve( count );
+            
+            for( uint32_t i = 0; i < count; i++ )
+            {
+                uint64_t entry( address + 8 + i * size );
+                
+                if( relative )
+                {
+                    int32_t  name(  static_cast< int32_t >( this->readUInt32( entry ) ) );
+                    int32_t  types( static_cast< int32_t >( this->readUInt32( entry + 4 ) ) );
+                    int32_t  imp(   static_cast< int32_t >( this->readUInt32( entry + 8 ) ) );
+                    uint64_t selector( 0 );
+                    
+                    /*
+                     * Lists optimized by the shared cache builder hold direct selector
+                     * offsets from the cache's relative method selector base, which is
+                     * only known when the metadata was created with the cache.
+                     */
+                    if( ( flags & 0x40000000 ) == 0 )
+                    {
+                        selector = this->readPointer( entry + static_cast< uint64_t >( static_cast< int64_t >( name ) ) );
+                    }
+                    else if( this->impl->_data->_selectorBase.has_value() )
+                    {
+                        selector = *( this->impl->_data->_selectorBase ) + static_cast< uint64_t >( static_cast< int64_t >( name ) );
+                    }
+                    
+                    methods.push_back
+                    (
+                        {
+                            std::string( this->readCString( selector ) ),
+                            std::string( this->readCString( entry + 4 + static_cast< uint64_t >( static_cast< int64_t >( types ) ) ) ),
+                            ( imp == 0 ) ? 0 : entry + 8 + static_cast< uint64_t >( static_cast< int64_t >( imp ) )
+                        }
+                    );
+                }
+                else
+                {
+                    methods.push_back
+                    (
+                        {
+                            std::string( this->readCString( this->readPointer( entry ) ) ),
+                            std::string( this->readCString( this->readPointer( entry + this->pointerSize() ) ) ),
+                            this->readPointer( entry + 2 * this->pointerSize() )
+                        }
+                    );
+                }
+            }
+        }
+        
+        return methods;
+    }
+    
+    std::vector< ObjCIvar > ObjCMetadata::readIvarList( uint64_t address ) const
+    {
+        std::vector< ObjCIvar > ivars;
+        
+        if( address == 0 )
+        {
+            return ivars;
+        }
+        
+        {
+            size_t   ps( this->pointerSize() );
+            uint32_t count( this->readUInt32( address + 4 ) );
+            uint64_t size( this->readUInt32( address ) & 0xFFFC );
+            
+            if( size == 0 )
+            {
+                size = 3 * ps + 8;
+            }
+            
+            ivars.reserve( count );
+            
+            for( uint32_t i = 0; i < count; i++ )
+            {
+                uint64_t entry( address + 8 + i * size );
+                uint64_t offset( this->readPointer( entry ) );
+                uint32_t alignment( this->readUInt32( entry + 3 * ps ) );
+                
+                ivars.push_back
+                (
+                    {
+                        std::string( this->readCString( this->readPointer( entry + ps ) ) ),
+                        std::string( this->readCString( this->readPointer( entry + 2 * ps ) ) ),
+                        ( this->contains( offset ) ) ? this->readUInt32( offset ) : 0,
+                        this->readUInt32( entry + 3 * ps + 4 ),
+                        ( alignment == 0xFFFFFFFF ) ? static_cast< uint32_t >( ps ) : 1U << alignment
+                    }
+                );
+            }
+        }
+        
+        return ivars;
+    }
+    
+    std::vector< ObjCProtocol > ObjCMetadata::readProtocolList( uint64_t address ) const
+    {
+        std::vector< ObjCProtocol > protocols;
+        
+        if( address == 0 )
+        {
+            return protocols;
+        }
+        
+        {
+            size_t   ps( this->pointerSize() );
+            uint64_t count( ( ps == 8 ) ? this->impl->_data->_space.read< uint64_t >( address ) : this->readUInt32( address ) );
+            
+            for( uint64_t i = 0; i < count; i++ )
+            {
+                uint64_t protocol( this->readPointer( address + ps + i * ps ) );
+                
+                if( protocol != 0 )
+                {
+                    protocols.push_back( { *( this ), protocol } );
+                }
+            }
+        }
+        
+        return protocols;
+    }
+    
+    void swap( ObjCMetadata & o1, ObjCMetadata & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ObjCMetadata::IMPL::IMPL( const File & file ):
+        _data( std::make_shared< Data >( file ) )
+    {}
+    
+    ObjCMetadata::IMPL::IMPL( const File & image, const CacheFile & cache ):
+        _data( std::make_shared< Data >( image, cache ) )
+    {}
+    
+    ObjCMetadata::IMPL::IMPL( const IMPL & o ):
+        _data( o._data )
+    {}
+    
+    ObjCMetadata::IMPL::~IMPL()
+    {}
+    
+    ChainedFixups::Pointer ObjCMetadata::IMPL::pointer( uint64_t address ) const
+    {
+        if( this->_data->_pointerSize == 8 )
+        {
+            return this->_data->_fixups.decode( this->_data->_space.read< uint64_t >( address ) );
+        }
+        
+        return this->_data->_fixups.decode( this->_data->_space.read< uint32_t >( address ) );
+    }
+    
+    ObjCMetadata::IMPL::Data::Data( const File & file ):
+        Data( file, file.addressSpace() )
+    {}
+    
+    /* Cache images point into other images and into libobjc's selectors, so the whole cache is addressable */
+    ObjCMetadata::IMPL::Data::Data( const File & file, const CacheFile & cache ):
+        Data( file, cache.addressSpace() )
+    {
+        this->_selectorBase = cache.relativeMethodSelectorBase();
+    }
+    
+    ObjCMetadata::IMPL::Data::Data( const File & file, const AddressSpace & space ):
+        _space(       space ),
+        _fixups(      file ),
+        _pointerSize( ( file.kind() == File::Kind::MachO64 ) ? 8 : 4 )
+    {
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment >() )
+        {
+            this->addSections( segment.sections() );
+        }
+        
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment64 >() )
+        {
+            this->addSections( segment.sections() );
+        }
+    }
+    
+    template< typename T >
+    void ObjCMetadata::IMPL::Data::addSections( const std::vector< T > & sections )
+    {
+        for( const auto & section: sections )
+        {
+            std::string name( section.section() );
+            
+            if( name == "__objc_classlist" )
+            {
+                this->_classes.push_back( { section.address(), section.size() } );
+            }
+            else if( name == "__objc_catlist" || name == "__objc_catlist2" )
+            {
+                this->_categories.push_back( { section.address(), section.size() } );
+            }
+            else if( name == "__objc_protolist" )
+            {
+                this->_protocols.push_back( { section.address(), section.size() } );
+            }
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ObjCMethod.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ObjCMethod.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    ObjCMethod::ObjCMethod( const std::string & name, const std::string & types, uint64_t implementation ):
+        _name(           name ),
+        _types(          types ),
+        _implementation( implementation )
+    {}
+    
+    ObjCMethod::ObjCMethod( const ObjCMethod & o ):
+        XS::Info::Object(),
+        _name(           o._name ),
+        _types(          o._types ),
+        _implementation( o._implementation )
+    {}
+    
+    ObjCMethod::~ObjCMethod()
+    {}
+    
+    ObjCMethod & ObjCMethod::operator =( const ObjCMethod & o )
+    {
+        this->_name           = o._name;
+        this->_types          = o._types;
+        this->_implementation = o._implementation;
+        
+        return *( this );
+    }
+    
+    XS::Info ObjCMethod::getInfo() const
+    {
+        XS::Info i( "Method", this->name() );
+        
+        i.addChild( { "Types",          this->types() } );
+        i.addChild( { "Implementation", XS::ToString::Hex( this->implementation() ) } );
+        
+        return i;
+    }
+    
+    std::string ObjCMethod::name() const
+    {
+        return this->_name;
+    }
+    
+    std::string ObjCMethod::types() const
+    {
+        return this->_types;
+    }
+    
+    uint64_t ObjCMethod::implementation() const
+    {
+        return this->_implementation;
+    }
+}
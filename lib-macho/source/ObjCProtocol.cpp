@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ObjCProtocol.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ObjCProtocol.hpp>
+#include <MachO/ObjCMetadata.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    class ObjCProtocol::IMPL
+    {
+        public:
+            
+            IMPL( const ObjCMetadata & metadata, uint64_t address );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            uint64_t pointer( size_t index ) const;
+            
+            ObjCMetadata _metadata;
+            uint64_t     _address;
+    };
+    
+    ObjCProtocol::ObjCProtocol( const ObjCMetadata & metadata, uint64_t address ):
+        impl( std::make_unique< IMPL >( metadata, address ) )
+    {}
+    
+    ObjCProtocol::ObjCProtocol( const ObjCProtocol & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ObjCProtocol::ObjCProtocol( ObjCProtocol && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ObjCProtocol::~ObjCProtocol()
+    {}
+    
+    ObjCProtocol & ObjCProtocol::operator =( ObjCProtocol o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info ObjCProtocol::getInfo() const
+    {
+        XS::Info i( "Protocol", this->name() );
+        XS::Info protocols( "Protocols" );
+        
+        i.addChild( { "Address", XS::ToString::Hex( this->address() ) } );
+        
+        for( const auto & protocol: this->protocols() )
+        {
+            protocols.addChild( { protocol.name() } );
+        }
+        
+        if( protocols.children().size() > 0 )
+        {
+            protocols.value( std::to_string( protocols.children().size() ) );
+            i.addChild( protocols );
+        }
+        
+        for
+        (
+            const auto & list:
+            {
+                std::make_pair( std::string( "Instance methods" ),          this->instanceMethods() ),
+                std::make_pair( std::string( "Class methods" ),             this->classMethods() ),
+                std::make_pair( std::string( "Optional instance methods" ), this->optionalInstanceMethods() ),
+                std::make_pair( std::string( "Optional class methods" ),    this->optionalClassMethods() )
+            }
+        )
+        {
+            XS::Info methods( list.first );
+            
+            if( list.second.size() == 0 )
+            {
+                continue;
+            }
+            
+            for( const auto & method: list.second )
+            {
+                methods.addChild( method );
+            }
+            
+            methods.value( std::to_string( list.second.size() ) );
+            i.addChild( methods );
+        }
+        
+        return i;
+    }
+    
+    uint64_t ObjCProtocol::address() const
+    {
+        return this->impl->_address;
+    }
+    
+    std::string ObjCProtocol::name() const
+    {
+        return std::string( this->impl->_metadata.readCString( this->impl->pointer( 1 ) ) );
+    }
+    
+    std::vector< ObjCProtocol > ObjCProtocol::protocols() const
+    {
+        return this->impl->_metadata.readProtocolList( this->impl->pointer( 2 ) );
+    }
+    
+    std::vector< ObjCMethod > ObjCProtocol::instanceMethods() const
+    {
+        return this->impl->_metadata.readMethodList( this->impl->pointer( 3 ) );
+    }
+    
+    std::vector< ObjCMethod > ObjCProtocol::classMethods() const
+    {
+        return this->impl->_metadata.readMethodList( this->impl->pointer( 4 ) );
+    }
+    
+    std::vector< ObjCMethod > ObjCProtocol::optionalInstanceMethods() const
+    {
+        return this->impl->_metadata.readMethodList( this->impl->pointer( 5 ) );
+    }
+    
+    std::vector< ObjCMethod > ObjCProtocol::optionalClassMethods() const
+    {
+        return this->impl->_metadata.readMethodList( this->impl->pointer( 6 ) );
+    }
+    
+    void swap( ObjCProtocol & o1, ObjCProtocol & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ObjCProtocol::IMPL::IMPL( const ObjCMetadata & metadata, uint64_t address ):
+        _metadata( metadata ),
+        _address(  address )
+    {}
+    
+    ObjCProtocol::IMPL::IMPL( const IMPL & o ):
+        _metadata( o._metadata ),
+        _address(  o._address )
+    {}
+    
+    ObjCProtocol::IMPL::~IMPL()
+    {}
+    
+    uint64_t ObjCProtocol::IMPL::pointer( size_t index ) const
+    {
+        /* isa, name, protocols, instanceMethods, classMethods, optionalInstanceMethods, optionalClassMethods */
+        return this->_metadata.readPointer( this->_address + index * this->_metadata.pointerSize() );
+    }
+}
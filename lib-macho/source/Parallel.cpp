@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Parallel.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/Parallel.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MachO
+{
+    namespace Parallel
+    {
+        size_t ThreadCount()
+        {
+            unsigned int count( std::thread::hardware_concurrency() );
+            
+            return ( count == 0 ) ? 1 : count;
+        }
+        
+        void For( size_t count, const std::function< void( size_t ) > & body )
+        {
+            size_t threads( std::min( count, ThreadCount() ) );
+            
+            if( threads <= 1 )
+            {
+                for( size_t i = 0; i < count; i++ )
+                {
+                    body( i );
+                }
+                
+                return;
+            }
+            
+            {
+                std::atomic< size_t >      next( 0 );
+                std::mutex                 mutex;
+                std::exception_ptr         error;
+                std::vector< std::thread > workers;
+                
+                auto work = [ & ]
+                {
+                    for( size_t i = next++; i < count; i = next++ )
+                    {
+                        try
+                        {
+                            body( i );
+                        }
+                        catch( ... )
+                        {
+                            std::lock_guard< std::mutex > lock( mutex );
+                            
+                            if( error == nullptr )
+                            {
+                                error = std::current_exception();
+                            }
+                            
+                            next = count;
+                        }
+                    }
+                };
+                
+                for( size_t i = 1; i < threads; i++ )
+                {
+                    workers.emplace_back( work );
+                }
+                
+                work();
+                
+                for( auto & worker: workers )
+                {
+                    worker.join();
+                }
+                
+                if( error != nullptr )
+                {
+                    std::rethrow_exception( error );
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,325 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ParseCache.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ParseCache.hpp>
+#include <MachO/FileCopy.hpp>
+#include <MachO/MappedFile.hpp>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace MachO
+{
+    class ParseCache::IMPL
+    {
+        public:
+            
+            IMPL( const std::string & directory );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            std::string entry( const FileSummary::Identity & identity ) const;
+            void        store( const File & file, const FileSummary::Identity & identity ) const;
+            
+            std::string _directory;
+    };
+    
+    ParseCache::ParseCache( const std::string & directory ):
+        impl( std::make_unique< IMPL >( directory ) )
+    {}
+    
+    ParseCache::ParseCache( const ParseCache & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ParseCache::ParseCache( ParseCache && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ParseCache::~ParseCache( void )
+    {}
+    
+    ParseCache & ParseCache::operator =( ParseCache o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    std::string ParseCache::directory() const
+    {
+        return this->impl->_directory;
+    }
+    
+    std::optional< File > ParseCache::lookup( const std::string & path ) const
+    {
+        std::optional< FileSummary::Identity > identity( Identify( path ) );
+        struct stat                            st;
+        
+        if( identity.has_value() == false )
+        {
+            return {};
+        }
+        
+        {
+            std::string entry( this->impl->entry( *( identity ) ) );
+            
+            if( stat( entry.c_str(), &st ) != 0 )
+            {
+                return {};
+            }
+            
+            /* Unreadable or stale entries are misses; they are replaced on the next store */
+            try
+            {
+                FileSummary summary( ( MappedFile( entry ) ) );
+                
+                if( summary.identity() != *( identity ) )
+                {
+                    return {};
+                }
+                
+                return File( path, summary );
+            }
+            catch( const std::exception & )
+            {
+                return {};
+            }
+        }
+    }
+    
+    File ParseCache::parse( const std::string & path ) const
+    {
+        std::optional< File > cached( this->lookup( path ) );
+        
+        if( cached.has_value() )
+        {
+            return *( cached );
+        }
+        
+        {
+            std::optional< FileSummary::Identity > before( Identify( path ) );
+            File                                   file( path );
+            std::optional< FileSummary::Identity > after( Identify( path ) );
+            
+            /* A file modified while being parsed is not cached */
+            if( before.has_value() && after.has_value() && *( before ) == *( after ) )
+            {
+                this->impl->store( file, *( after ) );
+            }
+            
+            return file;
+        }
+    }
+    
+    std::optional< FileSummary::Identity > ParseCache::Identify( const std::string & path )
+    {
+        FileSummary::Identity identity {};
+        struct stat           st;
+        uint8_t               header[ 32 ];
+        int                   fd( open( path.c_str(), O_RDONLY ) );
+        
+        if( fd < 0 )
+        {
+            return {};
+        }
+        
+        try
+        {
+            if( fstat( fd, &st ) != 0 )
+            {
+                throw std::runtime_error( "Cannot stat file: " + path );
+            }
+            
+            FileCopy::Read( fd, 0, header, sizeof( header ) );
+        }
+        catch( const std::exception & )
+        {
+            close( fd );
+            
+            return {};
+        }
+        
+        identity.device = static_cast< uint64_t >( st.st_dev );
+        identity.inode  = static_cast< uint64_t >( st.st_ino );
+        identity.size   = static_cast< uint64_t >( st.st_size );
+        
+        #ifdef __APPLE__
+        identity.mtime = static_cast< uint64_t >( st.st_mtimespec.tv_sec ) * 1000000000 + static_cast< uint64_t >( st.st_mtimespec.tv_nsec );
+        #else
+        identity.mtime = static_cast< uint64_t >( st.st_mtim.tv_sec ) * 1000000000 + static_cast< uint64_t >( st.st_mtim.tv_nsec );
+        #endif
+        
+        {
+            uint32_t magic;
+            bool     swapped;
+            bool     is64;
+            
+            std::memcpy( &magic, header, 4 );
+            
+            swapped = magic == 0xCEFAEDFE || magic == 0xCFFAEDFE;
+            is64    = magic == 0xFEEDFACF || magic == 0xCFFAEDFE;
+            magic   = ( swapped ) ? MappedFile::Swap( magic ) : magic;
+            
+            if( magic != 0xFEEDFACE && magic != 0xFEEDFACF )
+            {
+                close( fd );
+                
+                return {};
+            }
+            
+            {
+                MappedFile             fields( std::vector< uint8_t >( header, header + sizeof( header ) ) );
+                bool                   bigEndian( MappedFile::IsBigEndianHost() != swapped );
+                uint32_t               count( fields.read< uint32_t >( 16, bigEndian ) );
+                uint32_t               size(  fields.read< uint32_t >( 20, bigEndian ) );
+                size_t                 offset( ( is64 ) ? 32 : 28 );
+                std::vector< uint8_t > commands;
+                
+                if( offset + size > identity.size )
+                {
+                    close( fd );
+                    
+                    return {};
+                }
+                
+                commands.resize( size );
+                
+                try
+                {
+                    FileCopy::Read( fd, offset, commands.data(), size );
+                }
+                catch( const std::exception & )
+                {
+                    close( fd );
+                    
+                    return {};
+                }
+                
+                close( fd );
+                
+                {
+                    MappedFile data( commands );
+                    size_t     position( 0 );
+                    
+                    for( uint32_t i = 0; i < count && position + 8 <= data.size(); i++ )
+                    {
+                        uint32_t command(     data.read< uint32_t >( position,     bigEndian ) );
+                        uint32_t commandSize( data.read< uint32_t >( position + 4, bigEndian ) );
+                        
+                        if( commandSize < 8 )
+                        {
+                            break;
+                        }
+                        
+                        if( command == 0x1B && commandSize >= 24 && data.contains( position + 8, 16 ) )
+                        {
+                            identity.hasUUID = true;
+                            
+                            std::memcpy( identity.uuid.data(), data.pointer( position + 8, 16 ), 16 );
+                        }
+                        
+                        position += commandSize;
+                    }
+                }
+            }
+        }
+        
+        return identity;
+    }
+    
+    void swap( ParseCache & o1, ParseCache & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ParseCache::IMPL::IMPL( const std::string & directory ):
+        _directory( directory )
+    {
+        struct stat st;
+        
+        if( stat( directory.c_str(), &st ) != 0 && mkdir( directory.c_str(), 0755 ) != 0 )
+        {
+            throw std::runtime_error( "Cannot create cache directory: " + directory );
+        }
+    }
+    
+    ParseCache::IMPL::IMPL( const IMPL & o ):
+        _directory( o._directory )
+    {}
+    
+    ParseCache::IMPL::~IMPL()
+    {}
+    
+    std::string ParseCache::IMPL::entry( const FileSummary::Identity & identity ) const
+    {
+        return this->_directory + "/" + XS::ToString::Hex( identity.device, false ) + "-" + XS::ToString::Hex( identity.inode, false ) + ".summary";
+    }
+    
+    void ParseCache::IMPL::store( const File & file, const FileSummary::Identity & identity ) const
+    {
+        std::string entry( this->entry( identity ) );
+        std::string temporary( entry + "." + std::to_string( getpid() ) );
+        
+        /* Entries are replaced atomically, so concurrent readers never see a partial summary */
+        try
+        {
+            std::vector< uint8_t > data( FileSummary::Serialize( file, identity ) );
+            int                    fd( FileCopy::Create( temporary, 0644 ) );
+            
+            try
+            {
+                FileCopy::Write( fd, 0, data.data(), data.size() );
+            }
+            catch( ... )
+            {
+                close( fd );
+                
+                throw;
+            }
+            
+            close( fd );
+            
+            if( rename( temporary.c_str(), entry.c_str() ) != 0 )
+            {
+                throw std::runtime_error( "Cannot store cache entry: " + entry );
+            }
+        }
+        catch( const std::exception & )
+        {
+            /* The cache is an optimization; a failed store leaves the parsed file usable */
+            unlink( temporary.c_str() );
+        }
+    }
+}
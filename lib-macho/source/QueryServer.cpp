@@ -0,0 +1,1029 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        QueryServer.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/QueryServer.hpp>
+#include <MachO/Functions.hpp>
+#include <MachO/MappedFile.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/Symbol.hpp>
+#include <MachO/Symbolicator.hpp>
+#include <MachO/LoadCommands/UUID.hpp>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace MachO
+{
+    class QueryServer::IMPL
+    {
+        public:
+            
+            /* Larger frames are rejected before allocating, so a bad client cannot exhaust memory */
+            static constexpr uint32_t MaxFrameSize = 64 * 1024 * 1024;
+            
+            struct Connection
+            {
+                std::vector< uint8_t > buffer;
+                bool                   busy;
+            };
+            
+            class Entry
+            {
+                public:
+                    
+                    /* Images and symbolicators are created once per name, and then only read */
+                    class Slot
+                    {
+                        public:
+                            
+                            std::once_flag                _imageOnce;
+                            std::optional< File >         _image;
+                            std::once_flag                _symbolicatorOnce;
+                            std::optional< Symbolicator > _symbolicator;
+                    };
+                    
+                    Entry( const struct stat & st, const std::string & path );
+                    
+                    bool matches( const struct stat & st ) const;
+                    
+                    const File         & image( const std::string & name );
+                    const Symbolicator & symbolicator( const std::string & name );
+                    Slot               & slot( const std::string & name );
+                    File                 load( const std::string & name ) const;
+                    
+                    uint64_t                                                       _device;
+                    uint64_t                                                       _inode;
+                    uint64_t                                                       _size;
+                    uint64_t                                                       _mtime;
+                    std::variant< File, FatFile, CacheFile, ArchiveFile, ZipFile > _file;
+                    std::mutex                                                     _mutex;
+                    std::map< std::string, Slot >                                  _slots;
+            };
+            
+            IMPL( const std::string & socket, size_t capacity );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            std::shared_ptr< Entry > entry( const std::string & path );
+            Reply                    answer( const Query & query );
+            bool                     serve( int client, const std::vector< uint8_t > & payload );
+            
+            static uint64_t                                Time( const struct stat & st );
+            static bool                                    Receive( int fd, uint8_t * data, size_t size );
+            static bool                                    Receive( int fd, std::vector< uint8_t > & buffer );
+            static void                                    Transmit( int fd, const std::vector< uint8_t > & payload );
+            static void                                    Wake( int fd );
+            static std::vector< uint8_t >                  Frame( int fd );
+            static std::optional< std::vector< uint8_t > > Frame( std::vector< uint8_t > & buffer );
+            static std::vector< uint8_t >                  Encode( const std::vector< Query > & queries );
+            static std::vector< uint8_t >                  Encode( const std::vector< Reply > & replies );
+            static std::vector< Query >                    Queries( const std::vector< uint8_t > & payload );
+            static std::vector< Reply >                    Replies( const std::vector< uint8_t > & payload );
+            static void                                    Append( std::vector< uint8_t > & data, uint64_t value, size_t size );
+            static void                                    Append( std::vector< uint8_t > & data, const std::string & string );
+            static std::string                             String( const MappedFile & data, size_t & position );
+            
+            std::string                                                      _socket;
+            size_t                                                           _capacity;
+            std::mutex                                                       _mutex;
+            std::list< std::pair< std::string, std::shared_ptr< Entry > > >  _recent;
+            std::unordered_map< std::string, decltype( _recent )::iterator > _entries;
+            std::atomic< int >                                               _wake;
+            std::atomic< bool >                                              _stopping;
+    };
+    
+    QueryServer::QueryServer( const std::string & socket, size_t capacity ):
+        impl( std::make_unique< IMPL >( socket, capacity ) )
+    {}
+    
+    QueryServer::QueryServer( const QueryServer & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    QueryServer::QueryServer( QueryServer && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    QueryServer::~QueryServer( void )
+    {}
+    
+    QueryServer & QueryServer::operator =( QueryServer o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    std::string QueryServer::socket() const
+    {
+        return this->impl->_socket;
+    }
+    
+    size_t QueryServer::capacity() const
+    {
+        return this->impl->_capacity;
+    }
+    
+    void QueryServer::run()
+    {
+        struct sockaddr_un                                     address {};
+        int                                                    listener( ::socket( AF_UNIX, SOCK_STREAM, 0 ) );
+        int                                                    wake[ 2 ];
+        std::mutex                                             mutex;
+        std::condition_variable                                condition;
+        std::deque< std::pair< int, std::vector< uint8_t > > > batches;
+        std::vector< std::pair< int, bool > >                  served;
+        std::map< int, IMPL::Connection >                      connections;
+        std::vector< std::thread >                             workers;
+        
+        if( listener < 0 )
+        {
+            throw std::runtime_error( "Cannot create socket: " + this->impl->_socket );
+        }
+        
+        if( this->impl->_socket.size() >= sizeof( address.sun_path ) )
+        {
+            close( listener );
+            
+            throw std::runtime_error( "Socket path is too long: " + this->impl->_socket );
+        }
+        
+        address.sun_family = AF_UNIX;
+        
+        std::memcpy( address.sun_path, this->impl->_socket.c_str(), this->impl->_socket.size() );
+        unlink( this->impl->_socket.c_str() );
+        
+        if( bind( listener, reinterpret_cast< struct sockaddr * >( &address ), sizeof( address ) ) != 0 || listen( listener, 64 ) != 0 )
+        {
+            close( listener );
+            
+            throw std::runtime_error( "Cannot listen on socket: " + this->impl->_socket );
+        }
+        
+        if( pipe( wake ) != 0 )
+        {
+            close( listener );
+            
+            throw std::runtime_error( "Cannot create pipe" );
+        }
+        
+        this->impl->_stopping = false;
+        this->impl->_wake     = wake[ 1 ];
+        
+        /* Workers answer one batch at a time, so idle or slow clients never hold a thread */
+        for( size_t i = 0; i < Parallel::ThreadCount(); i++ )
+        {
+            workers.emplace_back
+            (
+                [ & ]
+                {
+                    while( true )
+                    {
+                        std::pair< int, std::vector< uint8_t > > batch;
+                        
+                        {
+                            std::unique_lock< std::mutex > lock( mutex );
+                            
+                            condition.wait( lock, [ & ] { return batches.size() > 0 || this->impl->_stopping; } );
+                            
+                            if( this->impl->_stopping )
+                            {
+                                return;
+                            }
+                            
+                            batch = std::move( batches.front() );
+                            
+                            batches.pop_front();
+                        }
+                        
+                        {
+                            bool keep( this->impl->serve( batch.first, batch.second ) );
+                            
+                            {
+                                std::lock_guard< std::mutex > lock( mutex );
+                                
+                                served.emplace_back( batch.first, keep );
+                            }
+                            
+                            IMPL::Wake( wake[ 1 ] );
+                        }
+                    }
+                }
+            );
+        }
+        
+        {
+            /* A connection is only polled while none of its batches is being answered, so replies keep their order */
+            auto dispatch = [ & ]( int client )
+            {
+                IMPL::Connection                      & connection( connections[ client ] );
+                std::optional< std::vector< uint8_t > > payload;
+                
+                try
+                {
+                    payload = IMPL::Frame( connection.buffer );
+                }
+                catch( const std::exception & )
+                {
+                    close( client );
+                    connections.erase( client );
+                    
+                    return;
+                }
+                
+                if( payload.has_value() )
+                {
+                    connection.busy = true;
+                    
+                    {
+                        std::lock_guard< std::mutex > lock( mutex );
+                        
+                        batches.emplace_back( client, std::move( *( payload ) ) );
+                    }
+                    
+                    condition.notify_one();
+                }
+            };
+            
+            while( this->impl->_stopping == false )
+            {
+                std::vector< struct pollfd > fds( { { listener, POLLIN, 0 }, { wake[ 0 ], POLLIN, 0 } } );
+                
+                for( const auto & connection: connections )
+                {
+                    if( connection.second.busy == false )
+                    {
+                        fds.push_back( { connection.first, POLLIN, 0 } );
+                    }
+                }
+                
+                if( poll( fds.data(), static_cast< nfds_t >( fds.size() ), -1 ) < 0 )
+                {
+                    if( errno == EINTR )
+                    {
+                        continue;
+                    }
+                    
+                    break;
+                }
+                
+                if( fds[ 1 ].revents != 0 )
+                {
+                    std::vector< std::pair< int, bool > > done;
+                    uint8_t                               data[ 64 ];
+                    
+                    if( read( wake[ 0 ], data, sizeof( data ) ) < 0 && errno != EINTR )
+                    {
+                        break;
+                    }
+                    
+                    {
+                        std::lock_guard< std::mutex > lock( mutex );
+                        
+                        done.swap( served );
+                    }
+                    
+                    for( const auto & client: done )
+                    {
+                        if( client.second )
+                        {
+                            connections[ client.first ].busy = false;
+                            
+                            /* Clients may send their next batch before reading a reply */
+                            dispatch( client.first );
+                        }
+                        else
+                        {
+                            close( client.first );
+                            connections.erase( client.first );
+                        }
+                    }
+                }
+                
+                for( size_t i = 2; i < fds.size(); i++ )
+                {
+                    if( fds[ i ].revents == 0 )
+                    {
+                        continue;
+                    }
+                    
+                    if( IMPL::Receive( fds[ i ].fd, connections[ fds[ i ].fd ].buffer ) == false )
+                    {
+                        close( fds[ i ].fd );
+                        connections.erase( fds[ i ].fd );
+                        
+                        continue;
+                    }
+                    
+                    dispatch( fds[ i ].fd );
+                }
+                
+                if( ( fds[ 0 ].revents & POLLIN ) != 0 )
+                {
+                    int client( accept( listener, nullptr, nullptr ) );
+                    
+                    if( client < 0 )
+                    {
+                        if( errno == EINTR || errno == ECONNABORTED || errno == EAGAIN )
+                        {
+                            continue;
+                        }
+                        
+                        break;
+                    }
+                    
+                    #ifdef SO_NOSIGPIPE
+                    {
+                        int on( 1 );
+                        
+                        setsockopt( client, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof( on ) );
+                    }
+                    #endif
+                    
+                    connections[ client ] = { {}, false };
+                }
+                else if( fds[ 0 ].revents != 0 )
+                {
+                    break;
+                }
+            }
+        }
+        
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            
+            this->impl->_stopping = true;
+            
+            /* Workers may be blocked writing a reply to a client that stopped reading */
+            for( const auto & connection: connections )
+            {
+                if( connection.second.busy )
+                {
+                    shutdown( connection.first, SHUT_RDWR );
+                }
+            }
+        }
+        
+        condition.notify_all();
+        
+        for( auto & worker: workers )
+        {
+            worker.join();
+        }
+        
+        for( const auto & connection: connections )
+        {
+            close( connection.first );
+        }
+        
+        this->impl->_wake = -1;
+        
+        close( wake[ 0 ] );
+        close( wake[ 1 ] );
+        close( listener );
+        unlink( this->impl->_socket.c_str() );
+    }
+    
+    void QueryServer::stop()
+    {
+        int wake( this->impl->_wake );
+        
+        this->impl->_stopping = true;
+        
+        /* Wakes up the poll loop */
+        if( wake >= 0 )
+        {
+            IMPL::Wake( wake );
+        }
+    }
+    
+    std::vector< QueryServer::Reply > QueryServer::answer( const std::vector< Query > & queries ) const
+    {
+        std::vector< Reply > replies;
+        
+        for( const auto & query: queries )
+        {
+            replies.push_back( this->impl->answer( query ) );
+        }
+        
+        return replies;
+    }
+    
+    std::vector< QueryServer::Reply > QueryServer::Send( const std::string & socket, const std::vector< Query > & queries )
+    {
+        struct sockaddr_un     address {};
+        int                    fd( ::socket( AF_UNIX, SOCK_STREAM, 0 ) );
+        std::vector< uint8_t > payload;
+        
+        if( fd < 0 )
+        {
+            throw std::runtime_error( "Cannot create socket: " + socket );
+        }
+        
+        if( socket.size() >= sizeof( address.sun_path ) )
+        {
+            close( fd );
+            
+            throw std::runtime_error( "Socket path is too long: " + socket );
+        }
+        
+        address.sun_family = AF_UNIX;
+        
+        std::memcpy( address.sun_path, socket.c_str(), socket.size() );
+        
+        if( connect( fd, reinterpret_cast< struct sockaddr * >( &address ), sizeof( address ) ) != 0 )
+        {
+            close( fd );
+            
+            throw std::runtime_error( "Cannot connect to socket: " + socket );
+        }
+        
+        try
+        {
+            IMPL::Transmit( fd, IMPL::Encode( queries ) );
+            
+            payload = IMPL::Frame( fd );
+        }
+        catch( ... )
+        {
+            close( fd );
+            
+            throw;
+        }
+        
+        close( fd );
+        
+        {
+            std::vector< Reply > replies( IMPL::Replies( payload ) );
+            
+            if( replies.size() != queries.size() )
+            {
+                throw std::runtime_error( "Invalid reply count: " + std::to_string( replies.size() ) );
+            }
+            
+            return replies;
+        }
+    }
+    
+    void swap( QueryServer & o1, QueryServer & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    QueryServer::IMPL::IMPL( const std::string & socket, size_t capacity ):
+        _socket(   socket ),
+        _capacity( std::max< size_t >( capacity, 1 ) ),
+        _wake(     -1 ),
+        _stopping( false )
+    {}
+    
+    /* Copies share the configuration, but not the cached files */
+    QueryServer::IMPL::IMPL( const IMPL & o ):
+        _socket(   o._socket ),
+        _capacity( o._capacity ),
+        _wake(     -1 ),
+        _stopping( false )
+    {}
+    
+    QueryServer::IMPL::~IMPL()
+    {}
+    
+    std::shared_ptr< QueryServer::IMPL::Entry > QueryServer::IMPL::entry( const std::string & path )
+    {
+        struct stat              st;
+        std::shared_ptr< Entry > entry;
+        
+        if( stat( path.c_str(), &st ) != 0 )
+        {
+            throw std::runtime_error( "Cannot stat file: " + path );
+        }
+        
+        {
+            std::lock_guard< std::mutex > lock( this->_mutex );
+            auto                          it( this->_entries.find( path ) );
+            
+            if( it != this->_entries.end() && it->second->second->matches( st ) )
+            {
+                this->_recent.splice( this->_recent.begin(), this->_recent, it->second );
+                
+                return it->second->second;
+            }
+        }
+        
+        /* Parsing happens outside of the lock, so other clients are not blocked by large files */
+        entry = std::make_shared< Entry >( st, path );
+        
+        {
+            std::lock_guard< std::mutex > lock( this->_mutex );
+            auto                          it( this->_entries.find( path ) );
+            
+            if( it != this->_entries.end() )
+            {
+                this->_recent.erase( it->second );
+            }
+            
+            this->_recent.emplace_front( path, entry );
+            
+            this->_entries[ path ] = this->_recent.begin();
+            
+            while( this->_recent.size() > this->_capacity )
+            {
+                this->_entries.erase( this->_recent.back().first );
+                this->_recent.pop_back();
+            }
+        }
+        
+        return entry;
+    }
+    
+    QueryServer::Reply QueryServer::IMPL::answer( const Query & query )
+    {
+        try
+        {
+            std::shared_ptr< Entry > entry( this->entry( query.path ) );
+            Reply                    reply;
+            
+            reply.success = true;
+            
+            if( query.request == Request::UUID && query.image.size() == 0 && std::holds_alternative< CacheFile >( entry->_file ) )
+            {
+                reply.values.push_back( std::get< CacheFile >( entry->_file ).uuid() );
+                
+                return reply;
+            }
+            
+            switch( query.request )
+            {
+                case Request::Libraries:
+                    
+                    reply.values = entry->image( query.image ).linkedLibraries();
+                    break;
+                
+                case Request::Symbols:
+                    
+                    for( const auto & symbol: entry->image( query.image ).symbols() )
+                    {
+                        reply.values.push_back( symbol.name() );
+                    }
+                    
+                    break;
+                
+                case Request::Symbolicate:
+                {
+                    Symbolicator::Location location( entry->symbolicator( query.image ).symbolicate( query.address ) );
+                    
+                    if( location.resolved == false )
+                    {
+                        throw std::runtime_error( "No symbol for address: " + XS::ToString::Hex( query.address ) );
+                    }
+                    
+                    reply.values.push_back( location.symbol.value_or( XS::ToString::Hex( location.start ) ) + " + " + std::to_string( location.offset ) );
+                    
+                    break;
+                }
+                
+                case Request::UUID:
+                    
+                    for( const auto & command: entry->image( query.image ).loadCommands< LoadCommands::UUID >() )
+                    {
+                        reply.values.push_back( command.uuid() );
+                        
+                        break;
+                    }
+                    
+                    if( reply.values.size() == 0 )
+                    {
+                        throw std::runtime_error( "No UUID in file: " + query.path );
+                    }
+                    
+                    break;
+                
+                default: throw std::runtime_error( "Unknown request: " + std::to_string( static_cast< int >( query.request ) ) );
+            }
+            
+            return reply;
+        }
+        catch( const std::exception & e )
+        {
+            return { false, { e.what() } };
+        }
+    }
+    
+    /* Protocol errors and disconnections simply end the connection */
+    bool QueryServer::IMPL::serve( int client, const std::vector< uint8_t > & payload )
+    {
+        try
+        {
+            std::vector< Query > queries( Queries( payload ) );
+            std::vector< Reply > replies;
+            
+            for( const auto & query: queries )
+            {
+                replies.push_back( this->answer( query ) );
+            }
+            
+            Transmit( client, Encode( replies ) );
+        }
+        catch( const std::exception & )
+        {
+            return false;
+        }
+        
+        return true;
+    }
+    
+    QueryServer::IMPL::Entry::Entry( const struct stat & st, const std::string & path ):
+        _device( static_cast< uint64_t >( st.st_dev ) ),
+        _inode(  static_cast< uint64_t >( st.st_ino ) ),
+        _size(   static_cast< uint64_t >( st.st_size ) ),
+        _mtime(  Time( st ) ),
+        _file(   Parse( path ) )
+    {}
+    
+    bool QueryServer::IMPL::Entry::matches( const struct stat & st ) const
+    {
+        return this->_device == static_cast< uint64_t >( st.st_dev )
+            && this->_inode  == static_cast< uint64_t >( st.st_ino )
+            && this->_size   == static_cast< uint64_t >( st.st_size )
+            && this->_mtime  == Time( st );
+    }
+    
+    const File & QueryServer::IMPL::Entry::image( const std::string & name )
+    {
+        Slot & slot( this->slot( name ) );
+        
+        std::call_once( slot._imageOnce, [ & ] { slot._image.emplace( this->load( name ) ); } );
+        
+        return *( slot._image );
+    }
+    
+    const Symbolicator & QueryServer::IMPL::Entry::symbolicator( const std::string & name )
+    {
+        Slot & slot( this->slot( name ) );
+        
+        std::call_once( slot._symbolicatorOnce, [ & ] { slot._symbolicator.emplace( this->image( name ) ); } );
+        
+        return *( slot._symbolicator );
+    }
+    
+    /* Only the slot lookup is locked, so queries on the same file are answered concurrently */
+    QueryServer::IMPL::Entry::Slot & QueryServer::IMPL::Entry::slot( const std::string & name )
+    {
+        std::lock_guard< std::mutex > lock( this->_mutex );
+        
+        return this->_slots[ name ];
+    }
+    
+    File QueryServer::IMPL::Entry::load( const std::string & name ) const
+    {
+        if( const File * file = std::get_if< File >( &( this->_file ) ) )
+        {
+            if( name.size() > 0 && name != file->cpu().name() )
+            {
+                throw std::runtime_error( "No such architecture: " + name );
+            }
+            
+            return *( file );
+        }
+        
+        if( const FatFile * fat = std::get_if< FatFile >( &( this->_file ) ) )
+        {
+            for( const auto & arch: fat->architectures() )
+            {
+                if( name.size() == 0 || name == arch.first.cpu().name() )
+                {
+                    return arch.second;
+                }
+            }
+            
+            throw std::runtime_error( "No such architecture: " + name );
+        }
+        
+        if( const CacheFile * cache = std::get_if< CacheFile >( &( this->_file ) ) )
+        {
+            std::optional< size_t > index( cache->imageIndex( name ) );
+            
+            if( index.has_value() == false )
+            {
+                throw std::runtime_error( "No such image in cache: " + name );
+            }
+            
+            return cache->image( *( index ) );
+        }
+        
+        throw std::runtime_error( "Unsupported file type for queries" );
+    }
+    
+    uint64_t QueryServer::IMPL::Time( const struct stat & st )
+    {
+        #ifdef __APPLE__
+        return static_cast< uint64_t >( st.st_mtimespec.tv_sec ) * 1000000000 + static_cast< uint64_t >( st.st_mtimespec.tv_nsec );
+        #else
+        return static_cast< uint64_t >( st.st_mtim.tv_sec ) * 1000000000 + static_cast< uint64_t >( st.st_mtim.tv_nsec );
+        #endif
+    }
+    
+    bool QueryServer::IMPL::Receive( int fd, uint8_t * data, size_t size )
+    {
+        size_t done( 0 );
+        
+        while( done < size )
+        {
+            ssize_t n( recv( fd, data + done, size - done, 0 ) );
+            
+            if( n < 0 && errno == EINTR )
+            {
+                continue;
+            }
+            
+            if( n <= 0 )
+            {
+                return false;
+            }
+            
+            done += static_cast< size_t >( n );
+        }
+        
+        return true;
+    }
+    
+    /* Reads whatever is available without blocking, and returns false once the peer is gone */
+    bool QueryServer::IMPL::Receive( int fd, std::vector< uint8_t > & buffer )
+    {
+        uint8_t data[ 65536 ];
+        
+        while( buffer.size() <= MaxFrameSize + 4 )
+        {
+            ssize_t n( recv( fd, data, sizeof( data ), MSG_DONTWAIT ) );
+            
+            if( n < 0 && errno == EINTR )
+            {
+                continue;
+            }
+            
+            if( n < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) )
+            {
+                break;
+            }
+            
+            if( n <= 0 )
+            {
+                return false;
+            }
+            
+            buffer.insert( buffer.end(), data, data + n );
+        }
+        
+        return true;
+    }
+    
+    void QueryServer::IMPL::Transmit( int fd, const std::vector< uint8_t > & payload )
+    {
+        std::vector< uint8_t > frame;
+        size_t                 done( 0 );
+        int                    flags( 0 );
+        
+        #ifdef MSG_NOSIGNAL
+        flags = MSG_NOSIGNAL;
+        #endif
+        
+        Append( frame, payload.size(), 4 );
+        frame.insert( frame.end(), payload.begin(), payload.end() );
+        
+        while( done < frame.size() )
+        {
+            ssize_t n( send( fd, frame.data() + done, frame.size() - done, flags ) );
+            
+            if( n < 0 && errno == EINTR )
+            {
+                continue;
+            }
+            
+            if( n <= 0 )
+            {
+                throw std::runtime_error( "Cannot write to socket" );
+            }
+            
+            done += static_cast< size_t >( n );
+        }
+    }
+    
+    void QueryServer::IMPL::Wake( int fd )
+    {
+        uint8_t byte( 0 );
+        
+        while( write( fd, &byte, 1 ) < 0 && errno == EINTR )
+        {}
+    }
+    
+    std::vector< uint8_t > QueryServer::IMPL::Frame( int fd )
+    {
+        uint8_t                header[ 4 ];
+        uint32_t               size;
+        std::vector< uint8_t > payload;
+        
+        if( Receive( fd, header, sizeof( header ) ) == false )
+        {
+            throw std::runtime_error( "Connection closed" );
+        }
+        
+        size = MappedFile( std::vector< uint8_t >( header, header + sizeof( header ) ) ).read< uint32_t >( 0, true );
+        
+        if( size > MaxFrameSize )
+        {
+            throw std::runtime_error( "Frame is too large: " + std::to_string( size ) );
+        }
+        
+        payload.resize( size );
+        
+        if( Receive( fd, payload.data(), payload.size() ) == false )
+        {
+            throw std::runtime_error( "Connection closed" );
+        }
+        
+        return payload;
+    }
+    
+    /* Removes the first complete frame from a connection buffer, if any */
+    std::optional< std::vector< uint8_t > > QueryServer::IMPL::Frame( std::vector< uint8_t > & buffer )
+    {
+        uint32_t               size;
+        std::vector< uint8_t > payload;
+        
+        if( buffer.size() < 4 )
+        {
+            return {};
+        }
+        
+        size = MappedFile( std::vector< uint8_t >( buffer.begin(), buffer.begin() + 4 ) ).read< uint32_t >( 0, true );
+        
+        if( size > MaxFrameSize )
+        {
+            throw std::runtime_error( "Frame is too large: " + std::to_string( size ) );
+        }
+        
+        if( buffer.size() - 4 < size )
+        {
+            return {};
+        }
+        
+        payload.assign( buffer.begin() + 4, buffer.begin() + 4 + size );
+        buffer.erase( buffer.begin(), buffer.begin() + 4 + size );
+        
+        return payload;
+    }
+    
+    std::vector< uint8_t > QueryServer::IMPL::Encode( const std::vector< Query > & queries )
+    {
+        std::vector< uint8_t > data;
+        
+        Append( data, queries.size(), 4 );
+        
+        for( const auto & query: queries )
+        {
+            Append( data, static_cast< uint8_t >( query.request ), 1 );
+            Append( data, query.path );
+            Append( data, query.image );
+            Append( data, query.address, 8 );
+        }
+        
+        return data;
+    }
+    
+    std::vector< uint8_t > QueryServer::IMPL::Encode( const std::vector< Reply > & replies )
+    {
+        std::vector< uint8_t > data;
+        
+        Append( data, replies.size(), 4 );
+        
+        for( const auto & reply: replies )
+        {
+            Append( data, ( reply.success ) ? 0 : 1, 1 );
+            Append( data, reply.values.size(), 4 );
+            
+            for( const auto & value: reply.values )
+            {
+                Append( data, value );
+            }
+        }
+        
+        return data;
+    }
+    
+    std::vector< QueryServer::Query > QueryServer::IMPL::Queries( const std::vector< uint8_t > & payload )
+    {
+        MappedFile           data( payload );
+        size_t               position( 4 );
+        uint32_t             count( data.read< uint32_t >( 0, true ) );
+        std::vector< Query > queries;
+        
+        for( uint32_t i = 0; i < count; i++ )
+        {
+            Query query;
+            
+            query.request = static_cast< Request >( data.read< uint8_t >( position ) );
+            position     += 1;
+            query.path    = String( data, position );
+            query.image   = String( data, position );
+            query.address = data.read< uint64_t >( position, true );
+            position     += 8;
+            
+            queries.push_back( query );
+        }
+        
+        return queries;
+    }
+    
+    std::vector< QueryServer::Reply > QueryServer::IMPL::Replies( const std::vector< uint8_t > & payload )
+    {
+        MappedFile           data( payload );
+        size_t               position( 4 );
+        uint32_t             count( data.read< uint32_t >( 0, true ) );
+        std::vector< Reply > replies;
+        
+        for( uint32_t i = 0; i < count; i++ )
+        {
+            Reply    reply;
+            uint32_t values;
+            
+            reply.success = data.read< uint8_t >( position ) == 0;
+            values        = data.read< uint32_t >( position + 1, true );
+            position     += 5;
+            
+            for( uint32_t j = 0; j < values; j++ )
+            {
+                reply.values.push_back( String( data, position ) );
+            }
+            
+            replies.push_back( reply );
+        }
+        
+        return replies;
+    }
+    
+    void QueryServer::IMPL::Append( std::vector< uint8_t > & data, uint64_t value, size_t size )
+    {
+        for( size_t i = size; i > 0; i-- )
+        {
+            data.push_back( static_cast< uint8_t >( value >> ( ( i - 1 ) * 8 ) ) );
+        }
+    }
+    
+    void QueryServer::IMPL::Append( std::vector< uint8_t > & data, const std::string & string )
+    {
+        Append( data, string.size(), 4 );
+        data.insert( data.end(), string.begin(), string.end() );
+    }
+    
+    std::string QueryServer::IMPL::String( const MappedFile & data, size_t & position )
+    {
+        uint32_t        length( data.read< uint32_t >( position, true ) );
+        const uint8_t * p( data.pointer( position + 4, length ) );
+        
+        position += 4 + length;
+        
+        return std::string( reinterpret_cast< const char * >( p ), length );
+    }
+}
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Relocation.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/Relocation.hpp>
+#include <MachO/MappedFile.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    Relocation::Relocation( const uint8_t * entry, bool bigEndian ):
+        _bigEndian( bigEndian )
+    {
+        std::memcpy( &( this->_word0 ), entry,     4 );
+        std::memcpy( &( this->_word1 ), entry + 4, 4 );
+
+        if( bigEndian != MappedFile::IsBigEndianHost() )
+        {
+            this->_word0 = MappedFile::Swap( this->_word0 );
+            this->_word1 = MappedFile::Swap( this->_word1 );
+        }
+    }
+
+    Relocation::Relocation( const Relocation & o ):
+        XS::Info::Object(),
+        _word0(     o._word0 ),
+        _word1(     o._word1 ),
+        _bigEndian( o._bigEndian )
+    {}
+
+    Relocation::~Relocation()
+    {}
+
+    Relocation & Relocation::operator =( const Relocation & o )
+    {
+        this->_word0     = o._word0;
+        this->_word1     = o._word1;
+        this->_bigEndian = o._bigEndian;
+
+        return *( this );
+    }
+
+    XS::Info Relocation::getInfo() const
+    {
+        XS::Info i( "Relocation", XS::ToString::Hex( this->address() ) );
+
+        i.addChild( { "Type",        XS::ToString::Hex( this->type() ) } );
+        i.addChild( { "Length",      std::to_string( 1 << this->length() ) } );
+        i.addChild( { "PC relative", std::to_string( this->isPCRelative() ) } );
+
+        if( this->isScattered() )
+        {
+            i.addChild( { "Scattered", std::to_string( true ) } );
+            i.addChild( { "Value",     XS::ToString::Hex( this->value() ) } );
+        }
+        else
+        {
+            i.addChild( { "Extern",        std::to_string( this->isExtern() ) } );
+            i.addChild( { "Symbol number", XS::ToString::Hex( this->symbolNumber() ) } );
+        }
+
+        return i;
+    }
+
+    int32_t Relocation::address() const
+    {
+        if( this->isScattered() )
+        {
+            return static_cast< int32_t >( this->_word0 & 0x00FFFFFF );
+        }
+
+        return static_cast< int32_t >( this->_word0 );
+    }
+
+    bool Relocation::isScattered() const
+    {
+        return ( this->_word0 & 0x80000000 ) != 0;
+    }
+
+    bool Relocation::isPCRelative() const
+    {
+        if( this->isScattered() )
+        {
+            return ( ( this->_word0 >> 30 ) & 1 ) != 0;
+        }
+
+        return ( ( this->_bigEndian ) ? ( this->_word1 >> 7 ) & 1 : ( this->_word1 >> 24 ) & 1 ) != 0;
+    }
+
+    bool Relocation::isExtern() const
+    {
+        if( this->isScattered() )
+        {
+            return false;
+        }
+
+        return ( ( this->_bigEndian ) ? ( this->_word1 >> 4 ) & 1 : ( this->_word1 >> 27 ) & 1 ) != 0;
+    }
+
+    uint8_t Relocation::length() const
+    {
+        if( this->isScattered() )
+        {
+            return static_cast< uint8_t >( ( this->_word0 >> 28 ) & 3 );
+        }
+
+        return static_cast< uint8_t >( ( this->_bigEndian ) ? ( this->_word1 >> 5 ) & 3 : ( this->_word1 >> 25 ) & 3 );
+    }
+
+    uint8_t Relocation::type() const
+    {
+        if( this->isScattered() )
+        {
+            return static_cast< uint8_t >( ( this->_word0 >> 24 ) & 0xF );
+        }
+
+        return static_cast< uint8_t >( ( this->_bigEndian ) ? this->_word1 & 0xF : this->_word1 >> 28 );
+    }
+
+    uint32_t Relocation::symbolNumber() const
+    {
+        if( this->isScattered() )
+        {
+            return 0;
+        }
+
+        return ( this->_bigEndian ) ? this->_word1 >> 8 : this->_word1 & 0x00FFFFFF;
+    }
+
+    int32_t Relocation::value() const
+    {
+        if( this->isScattered() )
+        {
+            return static_cast< int32_t >( this->_word1 );
+        }
+
+        return 0;
+    }
+}
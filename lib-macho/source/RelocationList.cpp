@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        RelocationList.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/RelocationList.hpp>
+#include <MachO/ToString.hpp>
+#include <stdexcept>
+
+namespace MachO
+{
+    class RelocationList::IMPL
+    {
+        public:
+
+            IMPL( const MappedFile & data, uint32_t offset, uint32_t count, bool bigEndian, std::optional< SymbolTable > symbols );
+            IMPL( const IMPL & o );
+            ~IMPL();
+
+            MappedFile                   _data;
+            const uint8_t              * _entries;
+            size_t                       _count;
+            bool                         _bigEndian;
+            std::optional< SymbolTable > _symbols;
+    };
+
+    RelocationList::RelocationList( const MappedFile & data, uint32_t offset, uint32_t count, bool bigEndian, std::optional< SymbolTable > symbols ):
+        impl( std::make_unique< IMPL >( data, offset, count, bigEndian, symbols ) )
+    {}
+
+    RelocationList::RelocationList( const RelocationList & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+
+    RelocationList::RelocationList( RelocationList && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+
+    RelocationList::~RelocationList()
+    {}
+
+    RelocationList & RelocationList::operator =( RelocationList o )
+    {
+        swap( *( this ), o );
+
+        return *( this );
+    }
+
+    XS::Info RelocationList::getInfo() const
+    {
+        XS::Info i( "Relocations", std::to_string( this->size() ) );
+
+        for( const auto & relocation: *( this ) )
+        {
+            XS::Info                          info( relocation.getInfo() );
+            std::optional< std::string_view > name( this->symbolName( relocation ) );
+
+            if( name.has_value() )
+            {
+                info.addChild( { "Symbol", std::string( *( name ) ) } );
+            }
+
+            i.addChild( info );
+        }
+
+        return i;
+    }
+
+    size_t RelocationList::size() const
+    {
+        return this->impl->_count;
+    }
+
+    RelocationList::Iterator RelocationList::begin() const
+    {
+        return { this->impl->_entries, this->impl->_bigEndian };
+    }
+
+    RelocationList::Iterator RelocationList::end() const
+    {
+        return { this->impl->_entries + this->impl->_count * 8, this->impl->_bigEndian };
+    }
+
+    Relocation RelocationList::operator []( size_t i ) const
+    {
+        if( i >= this->impl->_count )
+        {
+            throw std::out_of_range( "Invalid relocation index: " + std::to_string( i ) );
+        }
+
+        return { this->impl->_entries + i * 8, this->impl->_bigEndian };
+    }
+
+    std::optional< std::string_view > RelocationList::symbolName( const Relocation & relocation ) const
+    {
+        if( this->impl->_symbols.has_value() == false || relocation.isExtern() == false )
+        {
+            return {};
+        }
+
+        {
+            const SymbolTable & symbols( *( this->impl->_symbols ) );
+            uint32_t            index( relocation.symbolNumber() );
+            size_t              size( ( symbols.is64 ) ? 16 : 12 );
+
+            if( index >= symbols.symbolCount )
+            {
+                return {};
+            }
+
+            {
+                uint32_t strx( this->impl->_data.read< uint32_t >( symbols.symbolOffset + index * size, this->impl->_bigEndian ) );
+
+                if( strx == 0 || strx >= symbols.stringSize )
+                {
+                    return {};
+                }
+
+                return this->impl->_data.cString( static_cast< size_t >( symbols.stringOffset ) + strx );
+            }
+        }
+    }
+
+    void swap( RelocationList & o1, RelocationList & o2 )
+    {
+        using std::swap;
+
+        swap( o1.impl, o2.impl );
+    }
+
+    RelocationList::IMPL::IMPL( const MappedFile & data, uint32_t offset, uint32_t count, bool bigEndian, std::optional< SymbolTable > symbols ):
+        _data(      data ),
+        _entries(   data.pointer( offset, static_cast< size_t >( count ) * 8 ) ),
+        _count(     count ),
+        _bigEndian( bigEndian ),
+        _symbols(   symbols )
+    {}
+
+    RelocationList::IMPL::IMPL( const IMPL & o ):
+        _data(      o._data ),
+        _entries(   o._entries ),
+        _count(     o._count ),
+        _bigEndian( o._bigEndian ),
+        _symbols(   o._symbols )
+    {}
+
+    RelocationList::IMPL::~IMPL()
+    {}
+}
@@ -0,0 +1,760 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ScanManifest.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ScanManifest.hpp>
+#include <MachO/Digest.hpp>
+#include <MachO/FileCopy.hpp>
+#include <MachO/Functions.hpp>
+#include <MachO/MappedFile.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/Symbol.hpp>
+#include <MachO/LoadCommands/UUID.hpp>
+#include <atomic>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace MachO
+{
+    class ScanManifest::IMPL
+    {
+        public:
+            
+            static constexpr uint32_t Magic   = 0x4D4F534D;
+            static constexpr uint32_t Version = 1;
+            
+            IMPL( void );
+            IMPL( const std::string & path );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            static void                                    Walk( const std::string & path, bool explicitPath, std::vector< std::string > & files );
+            static std::shared_ptr< const Entry >          Scan( const std::string & path, const std::shared_ptr< const Entry > & previous, std::atomic< size_t > & parsed );
+            static std::optional< std::vector< uint8_t > > Headers( int fd, uint64_t size );
+            static bool                                    Headers( int fd, uint64_t offset, uint64_t size, std::vector< uint8_t > & headers );
+            static std::vector< Image >                    Images( const std::string & path );
+            static Image                                   Describe( const File & file );
+            static bool                                    Identified( const std::vector< Image > & images );
+            static Change                                  Difference( Change::Kind kind, const std::string & path, const Image * before, const Image * after );
+            
+            template< typename T >
+            static void Append( std::vector< uint8_t > & data, T value );
+            static void Append( std::vector< uint8_t > & data, const std::string & string );
+            static void Append( std::vector< uint8_t > & data, const std::vector< std::string > & strings );
+            
+            template< typename T >
+            static T Read( const MappedFile & data, size_t & position );
+            static std::string                Read( const MappedFile & data, size_t & position );
+            static std::vector< std::string > Strings( const MappedFile & data, size_t & position );
+            
+            std::vector< std::shared_ptr< const Entry > > _entries;
+            size_t                                        _parsed;
+    };
+    
+    bool ScanManifest::Image::operator ==( const Image & o ) const
+    {
+        return this->architecture == o.architecture
+            && this->uuid         == o.uuid
+            && this->libraries    == o.libraries
+            && this->symbols      == o.symbols;
+    }
+    
+    bool ScanManifest::Image::operator !=( const Image & o ) const
+    {
+        return ( *( this ) == o ) == false;
+    }
+    
+    ScanManifest::ScanManifest( void ):
+        impl( std::make_unique< IMPL >() )
+    {}
+    
+    ScanManifest::ScanManifest( const std::string & path ):
+        impl( std::make_unique< IMPL >( path ) )
+    {}
+    
+    ScanManifest::ScanManifest( const ScanManifest & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ScanManifest::ScanManifest( ScanManifest && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ScanManifest::~ScanManifest( void )
+    {}
+    
+    ScanManifest & ScanManifest::operator =( ScanManifest o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    std::vector< ScanManifest::Entry > ScanManifest::entries() const
+    {
+        std::vector< Entry > entries;
+        
+        for( const auto & entry: this->impl->_entries )
+        {
+            entries.push_back( *( entry ) );
+        }
+        
+        return entries;
+    }
+    
+    size_t ScanManifest::parsed() const
+    {
+        return this->impl->_parsed;
+    }
+    
+    void ScanManifest::write( const std::string & path ) const
+    {
+        std::vector< uint8_t > data;
+        std::string            temporary( path + "." + std::to_string( getpid() ) );
+        int                    fd;
+        
+        IMPL::Append< uint32_t >( data, IMPL::Magic );
+        IMPL::Append< uint32_t >( data, IMPL::Version );
+        IMPL::Append< uint64_t >( data, this->impl->_entries.size() );
+        
+        for( const auto & entry: this->impl->_entries )
+        {
+            IMPL::Append( data, entry->path );
+            IMPL::Append< uint64_t >( data, entry->device );
+            IMPL::Append< uint64_t >( data, entry->inode );
+            IMPL::Append< uint64_t >( data, entry->size );
+            IMPL::Append< uint64_t >( data, entry->mtime );
+            IMPL::Append( data, std::string( entry->hash.begin(), entry->hash.end() ) );
+            IMPL::Append< uint32_t >( data, static_cast< uint32_t >( entry->images.size() ) );
+            
+            for( const auto & image: entry->images )
+            {
+                IMPL::Append( data, image.architecture );
+                IMPL::Append< uint8_t >( data, ( image.uuid.has_value() ) ? 1 : 0 );
+                IMPL::Append( data, image.uuid.value_or( "" ) );
+                IMPL::Append( data, image.libraries );
+                IMPL::Append( data, image.symbols );
+            }
+        }
+        
+        /* The previous manifest stays valid until the new one is complete */
+        fd = FileCopy::Create( temporary, 0644 );
+        
+        try
+        {
+            FileCopy::Write( fd, 0, data.data(), data.size() );
+        }
+        catch( ... )
+        {
+            close( fd );
+            unlink( temporary.c_str() );
+            
+            throw;
+        }
+        
+        close( fd );
+        
+        if( rename( temporary.c_str(), path.c_str() ) != 0 )
+        {
+            unlink( temporary.c_str() );
+            
+            throw std::runtime_error( "Cannot write manifest: " + path );
+        }
+    }
+    
+    ScanManifest ScanManifest::rescan( const std::vector< std::string > & paths ) const
+    {
+        ScanManifest                                                      manifest;
+        std::vector< std::string >                                        files;
+        std::unordered_map< std::string, std::shared_ptr< const Entry > > previous;
+        std::vector< std::shared_ptr< const Entry > >                     entries;
+        std::atomic< size_t >                                             parsed( 0 );
+        
+        for( const auto & path: paths )
+        {
+            IMPL::Walk( path, true, files );
+        }
+        
+        std::sort( files.begin(), files.end() );
+        files.erase( std::unique( files.begin(), files.end() ), files.end() );
+        
+        for( const auto & entry: this->impl->_entries )
+        {
+            previous[ entry->path ] = entry;
+        }
+        
+        entries.resize( files.size() );
+        
+        Parallel::For
+        (
+            files.size(),
+            [ & ]( size_t i )
+            {
+                auto it( previous.find( files[ i ] ) );
+                
+                entries[ i ] = IMPL::Scan( files[ i ], ( it == previous.end() ) ? nullptr : it->second, parsed );
+            }
+        );
+        
+        for( const auto & entry: entries )
+        {
+            if( entry != nullptr )
+            {
+                manifest.impl->_entries.push_back( entry );
+            }
+        }
+        
+        manifest.impl->_parsed = parsed;
+        
+        return manifest;
+    }
+    
+    std::vector< ScanManifest::Change > ScanManifest::Compare( const ScanManifest & before, const ScanManifest & after )
+    {
+        std::vector< Change > changes;
+        const auto          & b( before.impl->_entries );
+        const auto          & a( after.impl->_entries );
+        size_t                i( 0 );
+        size_t                j( 0 );
+        
+        /* Both manifests are sorted by path */
+        while( i < b.size() || j < a.size() )
+        {
+            if( j == a.size() || ( i < b.size() && b[ i ]->path < a[ j ]->path ) )
+            {
+                for( const auto & image: b[ i ]->images )
+                {
+                    changes.push_back( IMPL::Difference( Change::Kind::Removed, b[ i ]->path, &image, nullptr ) );
+                }
+                
+                i++;
+            }
+            else if( i == b.size() || a[ j ]->path < b[ i ]->path )
+            {
+                for( const auto & image: a[ j ]->images )
+                {
+                    changes.push_back( IMPL::Difference( Change::Kind::Added, a[ j ]->path, nullptr, &image ) );
+                }
+                
+                j++;
+            }
+            else
+            {
+                /* Reused entries are shared between manifests, so unchanged files are skipped without comparing */
+                if( b[ i ] != a[ j ] )
+                {
+                    for( const auto & image: a[ j ]->images )
+                    {
+                        auto old = std::find_if( b[ i ]->images.begin(), b[ i ]->images.end(), [ & ]( const Image & o ) { return o.architecture == image.architecture; } );
+                        
+                        if( old == b[ i ]->images.end() )
+                        {
+                            changes.push_back( IMPL::Difference( Change::Kind::Added, a[ j ]->path, nullptr, &image ) );
+                        }
+                        else if( *( old ) != image )
+                        {
+                            changes.push_back( IMPL::Difference( Change::Kind::Changed, a[ j ]->path, &( *( old ) ), &image ) );
+                        }
+                    }
+                    
+                    for( const auto & image: b[ i ]->images )
+                    {
+                        auto current = std::find_if( a[ j ]->images.begin(), a[ j ]->images.end(), [ & ]( const Image & o ) { return o.architecture == image.architecture; } );
+                        
+                        if( current == a[ j ]->images.end() )
+                        {
+                            changes.push_back( IMPL::Difference( Change::Kind::Removed, b[ i ]->path, &image, nullptr ) );
+                        }
+                    }
+                }
+                
+                i++;
+                j++;
+            }
+        }
+        
+        return changes;
+    }
+    
+    void swap( ScanManifest & o1, ScanManifest & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ScanManifest::IMPL::IMPL( void ):
+        _parsed( 0 )
+    {}
+    
+    ScanManifest::IMPL::IMPL( const std::string & path ):
+        _parsed( 0 )
+    {
+        MappedFile data( path );
+        size_t     position( 0 );
+        uint32_t   magic( Read< uint32_t >( data, position ) );
+        uint32_t   version( Read< uint32_t >( data, position ) );
+        uint64_t   count( Read< uint64_t >( data, position ) );
+        
+        if( magic != Magic )
+        {
+            throw std::runtime_error( "Invalid manifest magic: " + XS::ToString::Hex( magic ) );
+        }
+        
+        if( version != Version )
+        {
+            throw std::runtime_error( "Unsupported manifest version: " + XS::ToString::Hex( version ) );
+        }
+        
+        for( uint64_t i = 0; i < count; i++ )
+        {
+            Entry       entry;
+            uint32_t    images;
+            std::string hash;
+            
+            entry.path   = Read( data, position );
+            entry.device = Read< uint64_t >( data, position );
+            entry.inode  = Read< uint64_t >( data, position );
+            entry.size   = Read< uint64_t >( data, position );
+            entry.mtime  = Read< uint64_t >( data, position );
+            hash         = Read( data, position );
+            entry.hash   = std::vector< uint8_t >( hash.begin(), hash.end() );
+            images       = Read< uint32_t >( data, position );
+            
+            for( uint32_t j = 0; j < images; j++ )
+            {
+                Image       image;
+                bool        hasUUID;
+                std::string uuid;
+                
+                image.architecture = Read( data, position );
+                hasUUID            = Read< uint8_t >( data, position ) != 0;
+                uuid               = Read( data, position );
+                image.uuid         = ( hasUUID ) ? std::optional< std::string >( uuid ) : std::nullopt;
+                image.libraries    = Strings( data, position );
+                image.symbols      = Strings( data, position );
+                
+                entry.images.push_back( std::move( image ) );
+            }
+            
+            this->_entries.push_back( std::make_shared< const Entry >( std::move( entry ) ) );
+        }
+        
+        if( std::is_sorted( this->_entries.begin(), this->_entries.end(), []( const auto & e1, const auto & e2 ) { return e1->path < e2->path; } ) == false )
+        {
+            throw std::runtime_error( "Invalid manifest order: " + path );
+        }
+    }
+    
+    ScanManifest::IMPL::IMPL( const IMPL & o ):
+        _entries( o._entries ),
+        _parsed(  o._parsed )
+    {}
+    
+    ScanManifest::IMPL::~IMPL()
+    {}
+    
+    void ScanManifest::IMPL::Walk( const std::string & path, bool explicitPath, std::vector< std::string > & files )
+    {
+        struct stat st;
+        
+        /* Symbolic links are only followed when given explicitly, so walks cannot loop */
+        if( ( ( explicitPath ) ? stat( path.c_str(), &st ) : lstat( path.c_str(), &st ) ) != 0 )
+        {
+            if( explicitPath )
+            {
+                throw std::runtime_error( "Cannot stat file: " + path );
+            }
+            
+            return;
+        }
+        
+        if( S_ISREG( st.st_mode ) )
+        {
+            files.push_back( path );
+        }
+        else if( S_ISDIR( st.st_mode ) )
+        {
+            DIR                      * dir( opendir( path.c_str() ) );
+            std::vector< std::string > names;
+            
+            if( dir == nullptr )
+            {
+                if( explicitPath )
+                {
+                    throw std::runtime_error( "Cannot read directory: " + path );
+                }
+                
+                return;
+            }
+            
+            while( struct dirent * e = readdir( dir ) )
+            {
+                if( std::strcmp( e->d_name, "." ) != 0 && std::strcmp( e->d_name, ".." ) != 0 )
+                {
+                    names.push_back( e->d_name );
+                }
+            }
+            
+            closedir( dir );
+            std::sort( names.begin(), names.end() );
+            
+            for( const auto & name: names )
+            {
+                Walk( ( path.size() > 0 && path.back() == '/' ) ? path + name : path + "/" + name, false, files );
+            }
+        }
+    }
+    
+    std::shared_ptr< const ScanManifest::Entry > ScanManifest::IMPL::Scan( const std::string & path, const std::shared_ptr< const Entry > & previous, std::atomic< size_t > & parsed )
+    {
+        Entry                                   entry;
+        struct stat                             st;
+        int                                     fd;
+        std::optional< std::vector< uint8_t > > headers;
+        
+        if( stat( path.c_str(), &st ) != 0 )
+        {
+            return nullptr;
+        }
+        
+        entry.path   = path;
+        entry.device = static_cast< uint64_t >( st.st_dev );
+        entry.inode  = static_cast< uint64_t >( st.st_ino );
+        entry.size   = static_cast< uint64_t >( st.st_size );
+        
+        #ifdef __APPLE__
+        entry.mtime = static_cast< uint64_t >( st.st_mtimespec.tv_sec ) * 1000000000 + static_cast< uint64_t >( st.st_mtimespec.tv_nsec );
+        #else
+        entry.mtime = static_cast< uint64_t >( st.st_mtim.tv_sec ) * 1000000000 + static_cast< uint64_t >( st.st_mtim.tv_nsec );
+        #endif
+        
+        if
+        (
+               previous         != nullptr
+            && previous->device == entry.device
+            && previous->inode  == entry.inode
+            && previous->size   == entry.size
+            && previous->mtime  == entry.mtime
+        )
+        {
+            return previous;
+        }
+        
+        if( ( fd = open( path.c_str(), O_RDONLY ) ) < 0 )
+        {
+            return nullptr;
+        }
+        
+        try
+        {
+            headers = Headers( fd, entry.size );
+        }
+        catch( const std::exception & )
+        {}
+        
+        close( fd );
+        
+        if( headers.has_value() == false )
+        {
+            return nullptr;
+        }
+        
+        entry.hash = Digest::Compute( Digest::Type::SHA256, headers->data(), headers->size() );
+        
+        /* The linker derives LC_UUID from the file contents, so an identical UUID and header means identical contents */
+        if( previous != nullptr && previous->hash == entry.hash && Identified( previous->images ) )
+        {
+            entry.images = previous->images;
+            
+            return std::make_shared< const Entry >( std::move( entry ) );
+        }
+        
+        /* Invalid files are kept without images, so they are only parsed again once changed */
+        try
+        {
+            entry.images = Images( path );
+        }
+        catch( const std::exception & )
+        {}
+        
+        parsed++;
+        
+        return std::make_shared< const Entry >( std::move( entry ) );
+    }
+    
+    std::optional< std::vector< uint8_t > > ScanManifest::IMPL::Headers( int fd, uint64_t size )
+    {
+        std::vector< uint8_t > headers;
+        uint8_t                header[ 8 ];
+        uint32_t               magic;
+        
+        if( size < sizeof( header ) )
+        {
+            return {};
+        }
+        
+        FileCopy::Read( fd, 0, header, sizeof( header ) );
+        
+        magic = MappedFile( std::vector< uint8_t >( header, header + sizeof( header ) ) ).read< uint32_t >( 0, true );
+        
+        if( magic == 0xCAFEBABE || magic == 0xCAFEBABF )
+        {
+            bool                   is64( magic == 0xCAFEBABF );
+            uint32_t               count( MappedFile( std::vector< uint8_t >( header, header + sizeof( header ) ) ).read< uint32_t >( 4, true ) );
+            size_t                 stride( ( is64 ) ? 32 : 20 );
+            std::vector< uint8_t > table;
+            
+            /* Java class files share the Fat magic, but their version numbers make for large counts */
+            if( count == 0 || count > 32 || sizeof( header ) + count * stride > size )
+            {
+                return {};
+            }
+            
+            table.resize( count * stride );
+            FileCopy::Read( fd, sizeof( header ), table.data(), table.size() );
+            headers.insert( headers.end(), header, header + sizeof( header ) );
+            headers.insert( headers.end(), table.begin(), table.end() );
+            
+            {
+                MappedFile archs( table );
+                
+                for( uint32_t i = 0; i < count; i++ )
+                {
+                    uint64_t offset( ( is64 ) ? archs.read< uint64_t >( i * stride + 8, true ) : archs.read< uint32_t >( i * stride + 8, true ) );
+                    
+                    /* Static library slices have no load commands; their offset and size are in the table */
+                    Headers( fd, offset, size, headers );
+                }
+            }
+            
+            return headers;
+        }
+        
+        if( Headers( fd, 0, size, headers ) == false )
+        {
+            return {};
+        }
+        
+        return headers;
+    }
+    
+    bool ScanManifest::IMPL::Headers( int fd, uint64_t offset, uint64_t size, std::vector< uint8_t > & headers )
+    {
+        uint8_t  header[ 32 ];
+        uint32_t magic;
+        bool     swapped;
+        bool     is64;
+        
+        if( offset + sizeof( header ) > size )
+        {
+            return false;
+        }
+        
+        FileCopy::Read( fd, offset, header, sizeof( header ) );
+        std::memcpy( &magic, header, 4 );
+        
+        swapped = magic == 0xCEFAEDFE || magic == 0xCFFAEDFE;
+        is64    = magic == 0xFEEDFACF || magic == 0xCFFAEDFE;
+        magic   = ( swapped ) ? MappedFile::Swap( magic ) : magic;
+        
+        if( magic != 0xFEEDFACE && magic != 0xFEEDFACF )
+        {
+            return false;
+        }
+        
+        {
+            MappedFile fields( std::vector< uint8_t >( header, header + sizeof( header ) ) );
+            bool       bigEndian( MappedFile::IsBigEndianHost() != swapped );
+            uint32_t   commands( fields.read< uint32_t >( 20, bigEndian ) );
+            size_t     length( ( is64 ) ? 32 : 28 );
+            size_t     start( headers.size() );
+            
+            if( offset + length + commands > size )
+            {
+                return false;
+            }
+            
+            headers.insert( headers.end(), header, header + length );
+            headers.resize( start + length + commands );
+            FileCopy::Read( fd, offset + length, headers.data() + start + length, commands );
+        }
+        
+        return true;
+    }
+    
+    std::vector< ScanManifest::Image > ScanManifest::IMPL::Images( const std::string & path )
+    {
+        std::vector< Image > images;
+        auto                 file( Parse( path ) );
+        
+        if( const File * thin = std::get_if< File >( &file ) )
+        {
+            images.push_back( Describe( *( thin ) ) );
+        }
+        else if( const FatFile * fat = std::get_if< FatFile >( &file ) )
+        {
+            for( const auto & arch: fat->architectures() )
+            {
+                images.push_back( Describe( arch.second ) );
+            }
+        }
+        
+        return images;
+    }
+    
+    ScanManifest::Image ScanManifest::IMPL::Describe( const File & file )
+    {
+        Image image;
+        
+        image.architecture = file.cpu().name();
+        image.libraries    = file.linkedLibraries();
+        
+        for( const auto & command: file.loadCommands< LoadCommands::UUID >() )
+        {
+            image.uuid = command.uuid();
+            
+            break;
+        }
+        
+        for( const auto & symbol: file.symbols() )
+        {
+            image.symbols.push_back( symbol.name() );
+        }
+        
+        /* Sorted and unique, so deltas are plain set differences */
+        std::sort( image.libraries.begin(), image.libraries.end() );
+        std::sort( image.symbols.begin(),   image.symbols.end() );
+        image.libraries.erase( std::unique( image.libraries.begin(), image.libraries.end() ), image.libraries.end() );
+        image.symbols.erase(   std::unique( image.symbols.begin(),   image.symbols.end() ),   image.symbols.end() );
+        
+        return image;
+    }
+    
+    bool ScanManifest::IMPL::Identified( const std::vector< Image > & images )
+    {
+        return images.size() > 0 && std::all_of( images.begin(), images.end(), []( const Image & image ) { return image.uuid.has_value(); } );
+    }
+    
+    ScanManifest::Change ScanManifest::IMPL::Difference( Change::Kind kind, const std::string & path, const Image * before, const Image * after )
+    {
+        Change                     change;
+        std::vector< std::string > none;
+        
+        change.kind         = kind;
+        change.path         = path;
+        change.architecture = ( after != nullptr ) ? after->architecture : before->architecture;
+        change.oldUUID      = ( before != nullptr ) ? before->uuid : std::nullopt;
+        change.newUUID      = ( after  != nullptr ) ? after->uuid  : std::nullopt;
+        
+        {
+            const auto & oldLibraries( ( before != nullptr ) ? before->libraries : none );
+            const auto & newLibraries( ( after  != nullptr ) ? after->libraries  : none );
+            const auto & oldSymbols(   ( before != nullptr ) ? before->symbols   : none );
+            const auto & newSymbols(   ( after  != nullptr ) ? after->symbols    : none );
+            
+            std::set_difference( newLibraries.begin(), newLibraries.end(), oldLibraries.begin(), oldLibraries.end(), std::back_inserter( change.addedLibraries ) );
+            std::set_difference( oldLibraries.begin(), oldLibraries.end(), newLibraries.begin(), newLibraries.end(), std::back_inserter( change.removedLibraries ) );
+            std::set_difference( newSymbols.begin(),   newSymbols.end(),   oldSymbols.begin(),   oldSymbols.end(),   std::back_inserter( change.addedSymbols ) );
+            std::set_difference( oldSymbols.begin(),   oldSymbols.end(),   newSymbols.begin(),   newSymbols.end(),   std::back_inserter( change.removedSymbols ) );
+        }
+        
+        return change;
+    }
+    
+    template< typename T >
+    void ScanManifest::IMPL::Append( std::vector< uint8_t > & data, T value )
+    {
+        const uint8_t * p( reinterpret_cast< const uint8_t * >( &value ) );
+        
+        data.insert( data.end(), p, p + sizeof( T ) );
+    }
+    
+    void ScanManifest::IMPL::Append( std::vector< uint8_t > & data, const std::string & string )
+    {
+        Append< uint32_t >( data, static_cast< uint32_t >( string.size() ) );
+        data.insert( data.end(), string.begin(), string.end() );
+    }
+    
+    void ScanManifest::IMPL::Append( std::vector< uint8_t > & data, const std::vector< std::string > & strings )
+    {
+        Append< uint32_t >( data, static_cast< uint32_t >( strings.size() ) );
+        
+        for( const auto & string: strings )
+        {
+            Append( data, string );
+        }
+    }
+    
+    template< typename T >
+    T ScanManifest::IMPL::Read( const MappedFile & data, size_t & position )
+    {
+        T value( data.read< T >( position, MappedFile::IsBigEndianHost() ) );
+        
+        position += sizeof( T );
+        
+        return value;
+    }
+    
+    std::string ScanManifest::IMPL::Read( const MappedFile & data, size_t & position )
+    {
+        uint32_t        length( Read< uint32_t >( data, position ) );
+        const uint8_t * p( data.pointer( position, length ) );
+        
+        position += length;
+        
+        return std::string( reinterpret_cast< const char * >( p ), length );
+    }
+    
+    std::vector< std::string > ScanManifest::IMPL::Strings( const MappedFile & data, size_t & position )
+    {
+        uint32_t                   count( Read< uint32_t >( data, position ) );
+        std::vector< std::string > strings;
+        
+        /* Every string takes at least its length, so corrupted counts fail before allocating */
+        if( count > ( data.size() - position ) / 4 )
+        {
+            throw std::runtime_error( "Invalid manifest string count: " + XS::ToString::Hex( count ) );
+        }
+        
+        strings.reserve( count );
+        
+        for( uint32_t i = 0; i < count; i++ )
+        {
+            strings.push_back( Read( data, position ) );
+        }
+        
+        return strings;
+    }
+}
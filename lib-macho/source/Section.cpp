@@ -36,24 +36,31 @@ namespace MachO
     {
         public:
             
-            IMPL( XS::IO::BinaryStream & stream );
+            IMPL( XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data );
             IMPL( const IMPL & o );
             ~IMPL( void );
             
-            std::string            _section;
-            std::string            _segment;
-            uint32_t               _address;
-            uint32_t               _size;
-            uint32_t               _offset;
-            uint32_t               _alignment;
-            uint32_t               _relocationOffset;
-            uint32_t               _relocationCount;
-            SectionFlags           _flags;
-            std::vector< uint8_t > _data;
+            std::string                 _section;
+            std::string                 _segment;
+            uint32_t                    _address;
+            uint32_t                    _size;
+            uint32_t                    _offset;
+            uint32_t                    _alignment;
+            uint32_t                    _relocationOffset;
+            uint32_t                    _relocationCount;
+            SectionFlags                _flags;
+            uint32_t                    _reserved1;
+            uint32_t                    _reserved2;
+            std::vector< uint8_t >      _data;
+            std::optional< MappedFile > _mapped;
     };
 
     Section::Section( XS::IO::BinaryStream & stream ):
-        impl( std::make_unique< IMPL >( stream ) )
+        impl( std::make_unique< IMPL >( stream, std::nullopt ) )
+    {}
+    
+    Section::Section( XS::IO::BinaryStream & stream, const MappedFile & data ):
+        impl( std::make_unique< IMPL >( stream, data ) )
     {}
 
     Section::Section( const Section & o ):
@@ -86,6 +93,8 @@ namespace MachO
         i.addChild( { "Alignment",         XS::ToString::Hex( this->alignment() ) } );
         i.addChild( { "Relocation offset", XS::ToString::Hex( this->relocationOffset() ) } );
         i.addChild( { "Relocation count",  XS::ToString::Hex( this->relocationCount() ) } );
+        i.addChild( { "Reserved 1",        XS::ToString::Hex( this->reserved1() ) } );
+        i.addChild( { "Reserved 2",        XS::ToString::Hex( this->reserved2() ) } );
         i.addChild( this->flags() );
         
         return i;
@@ -136,8 +145,30 @@ namespace MachO
         return this->impl->_flags;
     }
     
+    uint32_t Section::reserved1() const
+    {
+        return this->impl->_reserved1;
+    }
+    
+    uint32_t Section::reserved2() const
+    {
+        return this->impl->_reserved2;
+    }
+    
     std::vector< uint8_t > Section::data() const
     {
+        if( this->impl->_mapped.has_value() )
+        {
+            const MappedFile & data( *( this->impl->_mapped ) );
+            
+            if( data.contains( this->impl->_offset, this->impl->_size ) == false )
+            {
+                return {};
+            }
+            
+            return { data.data() + this->impl->_offset, data.data() + this->impl->_offset + this->impl->_size };
+        }
+        
         return this->impl->_data;
     }
     
@@ -148,7 +179,7 @@ namespace MachO
         swap( o1.impl, o2.impl );
     }
 
-    Section::IMPL::IMPL( XS::IO::BinaryStream & stream ):
+    Section::IMPL::IMPL( XS::IO::BinaryStream & stream, const std::optional< MappedFile > & data ):
         _section(          stream.readString( 16 ) ),
         _segment(          stream.readString( 16 ) ),
         _address(          stream.readUInt32() ),
@@ -157,11 +188,13 @@ namespace MachO
         _alignment(        stream.readUInt32() ),
         _relocationOffset( stream.readUInt32() ),
         _relocationCount(  stream.readUInt32() ),
-        _flags(            stream.readUInt32() )
+        _flags(            stream.readUInt32() ),
+        _reserved1(        stream.readUInt32() ),
+        _reserved2(        stream.readUInt32() ),
+        _mapped(           data )
     {
-        stream.readUInt32();
-        stream.readUInt32();
-        
+        /* Section data is read on demand when backed by a mapped file */
+        if( data.has_value() == false )
         {
             size_t pos( stream.tell() );
             
@@ -183,7 +216,10 @@ namespace MachO
         _relocationOffset( o._relocationOffset ),
         _relocationCount(  o._relocationCount ),
         _flags(            o._flags ),
-        _data(             o._data )
+        _reserved1(        o._reserved1 ),
+        _reserved2(        o._reserved2 ),
+        _data(             o._data ),
+        _mapped(           o._mapped )
     {}
 
     Section::IMPL::~IMPL( void )
@@ -0,0 +1,215 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        SwiftConformance.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/SwiftConformance.hpp>
+#include <MachO/SwiftDescriptor.hpp>
+#include <MachO/SwiftMetadata.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    class SwiftConformance::IMPL
+    {
+        public:
+            
+            IMPL( const SwiftMetadata & metadata, uint64_t address );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            uint32_t typeReferenceKind() const;
+            
+            SwiftMetadata _metadata;
+            uint64_t      _address;
+    };
+    
+    SwiftConformance::SwiftConformance( const SwiftMetadata & metadata, uint64_t address ):
+        impl( std::make_unique< IMPL >( metadata, address ) )
+    {}
+    
+    SwiftConformance::SwiftConformance( const SwiftConformance & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    SwiftConformance::SwiftConformance( SwiftConformance && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    SwiftConformance::~SwiftConformance()
+    {}
+    
+    SwiftConformance & SwiftConformance::operator =( SwiftConformance o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info SwiftConformance::getInfo() const
+    {
+        XS::Info i( "Conformance", this->typeName() + ": " + this->protocolName() );
+        
+        i.addChild( { "Address",       XS::ToString::Hex( this->address() ) } );
+        i.addChild( { "Flags",         XS::ToString::Hex( this->flags() ) } );
+        i.addChild( { "Retroactive",   std::to_string( this->isRetroactive() ) } );
+        i.addChild( { "Witness table", XS::ToString::Hex( this->witnessTable() ) } );
+        
+        return i;
+    }
+    
+    uint64_t SwiftConformance::address() const
+    {
+        return this->impl->_address;
+    }
+    
+    uint32_t SwiftConformance::flags() const
+    {
+        /* protocol, typeRef, witnessTablePattern, flags */
+        return this->impl->_metadata.readUInt32( this->impl->_address + 12 );
+    }
+    
+    bool SwiftConformance::isRetroactive() const
+    {
+        return ( this->flags() & 0x40 ) != 0;
+    }
+    
+    std::optional< SwiftDescriptor > SwiftConformance::protocol() const
+    {
+        std::optional< uint64_t > address( this->impl->_metadata.readIndirectablePointer( this->impl->_address ) );
+        
+        if( address.has_value() == false || this->impl->_metadata.contains( *( address ) ) == false )
+        {
+            return {};
+        }
+        
+        return SwiftDescriptor( this->impl->_metadata, *( address ) );
+    }
+    
+    std::string SwiftConformance::protocolName() const
+    {
+        std::optional< SwiftDescriptor > protocol( this->protocol() );
+        
+        if( protocol.has_value() )
+        {
+            return protocol->fullName();
+        }
+        
+        {
+            std::optional< std::string > symbol( this->impl->_metadata.readIndirectableBinding( this->impl->_address ) );
+            
+            return ( symbol.has_value() ) ? *( symbol ) : "";
+        }
+    }
+    
+    std::optional< SwiftDescriptor > SwiftConformance::type() const
+    {
+        uint64_t address( this->impl->_metadata.readRelativePointer( this->impl->_address + 4 ) );
+        
+        switch( this->impl->typeReferenceKind() )
+        {
+            /* DirectTypeDescriptor */
+            case 0: break;
+            
+            /* IndirectTypeDescriptor */
+            case 1: address = ( this->impl->_metadata.contains( address ) ) ? this->impl->_metadata.readPointer( address ) : 0; break;
+            
+            default: return {};
+        }
+        
+        if( this->impl->_metadata.contains( address ) == false )
+        {
+            return {};
+        }
+        
+        return SwiftDescriptor( this->impl->_metadata, address );
+    }
+    
+    std::string SwiftConformance::typeName() const
+    {
+        std::optional< SwiftDescriptor > type( this->type() );
+        uint64_t                         address( this->impl->_metadata.readRelativePointer( this->impl->_address + 4 ) );
+        
+        if( type.has_value() )
+        {
+            return type->fullName();
+        }
+        
+        if( this->impl->_metadata.contains( address ) == false )
+        {
+            return "";
+        }
+        
+        switch( this->impl->typeReferenceKind() )
+        {
+            /* DirectObjCClassName */
+            case 2: return std::string( this->impl->_metadata.readCString( address ) );
+            
+            /* IndirectTypeDescriptor / IndirectObjCClass */
+            case 1:
+            case 3:
+            {
+                std::optional< std::string > symbol( this->impl->_metadata.readBinding( address ) );
+                
+                return ( symbol.has_value() ) ? *( symbol ) : "";
+            }
+            
+            default: return "";
+        }
+    }
+    
+    uint64_t SwiftConformance::witnessTable() const
+    {
+        return this->impl->_metadata.readRelativePointer( this->impl->_address + 8 );
+    }
+    
+    void swap( SwiftConformance & o1, SwiftConformance & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    SwiftConformance::IMPL::IMPL( const SwiftMetadata & metadata, uint64_t address ):
+        _metadata( metadata ),
+        _address(  address )
+    {}
+    
+    SwiftConformance::IMPL::IMPL( const IMPL & o ):
+        _metadata( o._metadata ),
+        _address(  o._address )
+    {}
+    
+    SwiftConformance::IMPL::~IMPL()
+    {}
+    
+    uint32_t SwiftConformance::IMPL::typeReferenceKind() const
+    {
+        return ( this->_metadata.readUInt32( this->_address + 12 ) >> 3 ) & 7;
+    }
+}
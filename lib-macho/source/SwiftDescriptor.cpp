@@ -0,0 +1,262 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        SwiftDescriptor.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/SwiftDescriptor.hpp>
+#include <MachO/SwiftFieldDescriptor.hpp>
+#include <MachO/SwiftMetadata.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    class SwiftDescriptor::IMPL
+    {
+        public:
+            
+            IMPL( const SwiftMetadata & metadata, uint64_t address );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            SwiftMetadata _metadata;
+            uint64_t      _address;
+    };
+    
+    std::string SwiftDescriptor::KindToString( Kind kind )
+    {
+        switch( kind )
+        {
+            case Kind::Module:     return "Module";
+            case Kind::Extension:  return "Extension";
+            case Kind::Anonymous:  return "Anonymous";
+            case Kind::Protocol:   return "Protocol";
+            case Kind::OpaqueType: return "Opaque type";
+            case Kind::Class:      return "Class";
+            case Kind::Struct:     return "Struct";
+            case Kind::Enum:       return "Enum";
+        }
+        
+        return "Unknown";
+    }
+    
+    SwiftDescriptor::SwiftDescriptor( const SwiftMetadata & metadata, uint64_t address ):
+        impl( std::make_unique< IMPL >( metadata, address ) )
+    {}
+    
+    SwiftDescriptor::SwiftDescriptor( const SwiftDescriptor & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    SwiftDescriptor::SwiftDescriptor( SwiftDescriptor && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    SwiftDescriptor::~SwiftDescriptor()
+    {}
+    
+    SwiftDescriptor & SwiftDescriptor::operator =( SwiftDescriptor o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info SwiftDescriptor::getInfo() const
+    {
+        XS::Info i( KindToString( this->kind() ), this->fullName() );
+        
+        i.addChild( { "Address", XS::ToString::Hex( this->address() ) } );
+        i.addChild( { "Flags",   XS::ToString::Hex( this->flags() ) } );
+        i.addChild( { "Generic", std::to_string( this->isGeneric() ) } );
+        
+        if( this->kind() == Kind::Class )
+        {
+            std::optional< std::string > superclass( this->superclassName() );
+            
+            i.addChild( { "Superclass", ( superclass.has_value() ) ? *( superclass ) : "--" } );
+        }
+        
+        if( this->isType() )
+        {
+            i.addChild( { "Fields", std::to_string( this->numberOfFields() ) } );
+        }
+        
+        return i;
+    }
+    
+    uint64_t SwiftDescriptor::address() const
+    {
+        return this->impl->_address;
+    }
+    
+    uint32_t SwiftDescriptor::flags() const
+    {
+        return this->impl->_metadata.readUInt32( this->impl->_address );
+    }
+    
+    SwiftDescriptor::Kind SwiftDescriptor::kind() const
+    {
+        return static_cast< Kind >( this->flags() & 0x1F );
+    }
+    
+    bool SwiftDescriptor::isGeneric() const
+    {
+        return ( this->flags() & 0x80 ) != 0;
+    }
+    
+    bool SwiftDescriptor::isType() const
+    {
+        Kind kind( this->kind() );
+        
+        return kind == Kind::Class || kind == Kind::Struct || kind == Kind::Enum;
+    }
+    
+    std::string SwiftDescriptor::name() const
+    {
+        Kind kind( this->kind() );
+        
+        /* flags, parent, name */
+        if( kind == Kind::Module || kind == Kind::Protocol || this->isType() )
+        {
+            return std::string( this->impl->_metadata.readCString( this->impl->_metadata.readRelativePointer( this->impl->_address + 8 ) ) );
+        }
+        
+        return "";
+    }
+    
+    std::string SwiftDescriptor::fullName() const
+    {
+        std::string                      name( this->name() );
+        std::optional< SwiftDescriptor > parent( this->parent() );
+        
+        for( size_t depth = 0; parent.has_value() && depth < 32; depth++ )
+        {
+            std::string component( parent->name() );
+            
+            if( component.length() > 0 )
+            {
+                name = component + "." + name;
+            }
+            
+            parent = parent->parent();
+        }
+        
+        return name;
+    }
+    
+    std::optional< SwiftDescriptor > SwiftDescriptor::parent() const
+    {
+        std::optional< uint64_t > address( this->impl->_metadata.readIndirectablePointer( this->impl->_address + 4 ) );
+        
+        if( address.has_value() == false || this->impl->_metadata.contains( *( address ) ) == false )
+        {
+            return {};
+        }
+        
+        return SwiftDescriptor( this->impl->_metadata, *( address ) );
+    }
+    
+    std::optional< std::string > SwiftDescriptor::superclassName() const
+    {
+        /* flags, parent, name, accessFunction, fields, superclassType */
+        if( this->kind() != Kind::Class )
+        {
+            return {};
+        }
+        
+        {
+            uint64_t address( this->impl->_metadata.readRelativePointer( this->impl->_address + 20 ) );
+            
+            if( address == 0 )
+            {
+                return {};
+            }
+            
+            return this->impl->_metadata.readMangledName( address );
+        }
+    }
+    
+    std::optional< SwiftFieldDescriptor > SwiftDescriptor::fieldDescriptor() const
+    {
+        if( this->isType() == false )
+        {
+            return {};
+        }
+        
+        {
+            uint64_t address( this->impl->_metadata.readRelativePointer( this->impl->_address + 16 ) );
+            
+            if( this->impl->_metadata.contains( address ) == false )
+            {
+                return {};
+            }
+            
+            return SwiftFieldDescriptor( this->impl->_metadata, address );
+        }
+    }
+    
+    uint32_t SwiftDescriptor::numberOfFields() const
+    {
+        switch( this->kind() )
+        {
+            /* superclassType, negative size, positive size, immediate members, numFields */
+            case Kind::Class:  return this->impl->_metadata.readUInt32( this->impl->_address + 36 );
+            case Kind::Struct: return this->impl->_metadata.readUInt32( this->impl->_address + 20 );
+            
+            /* numPayloadCasesAndPayloadSizeOffset, numEmptyCases */
+            case Kind::Enum:
+                
+                return ( this->impl->_metadata.readUInt32( this->impl->_address + 20 ) & 0x00FFFFFF )
+                     + this->impl->_metadata.readUInt32( this->impl->_address + 24 );
+            
+            default:
+                
+                return 0;
+        }
+    }
+    
+    void swap( SwiftDescriptor & o1, SwiftDescriptor & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    SwiftDescriptor::IMPL::IMPL( const SwiftMetadata & metadata, uint64_t address ):
+        _metadata( metadata ),
+        _address(  address )
+    {}
+    
+    SwiftDescriptor::IMPL::IMPL( const IMPL & o ):
+        _metadata( o._metadata ),
+        _address(  o._address )
+    {}
+    
+    SwiftDescriptor::IMPL::~IMPL()
+    {}
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        SwiftField.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/SwiftField.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    SwiftField::SwiftField( const std::string & name, const std::string & typeName, uint32_t flags ):
+        _name(     name ),
+        _typeName( typeName ),
+        _flags(    flags )
+    {}
+    
+    SwiftField::SwiftField( const SwiftField & o ):
+        XS::Info::Object(),
+        _name(     o._name ),
+        _typeName( o._typeName ),
+        _flags(    o._flags )
+    {}
+    
+    SwiftField::~SwiftField()
+    {}
+    
+    SwiftField & SwiftField::operator =( const SwiftField & o )
+    {
+        this->_name     = o._name;
+        this->_typeName = o._typeName;
+        this->_flags    = o._flags;
+        
+        return *( this );
+    }
+    
+    XS::Info SwiftField::getInfo() const
+    {
+        XS::Info i( "Field", this->name() );
+        
+        i.addChild( { "Type",     this->typeName() } );
+        i.addChild( { "Variable", std::to_string( this->isVariable() ) } );
+        
+        if( this->isIndirectCase() )
+        {
+            i.addChild( { "Indirect", std::to_string( true ) } );
+        }
+        
+        return i;
+    }
+    
+    std::string SwiftField::name() const
+    {
+        return this->_name;
+    }
+    
+    std::string SwiftField::typeName() const
+    {
+        return this->_typeName;
+    }
+    
+    uint32_t SwiftField::flags() const
+    {
+        return this->_flags;
+    }
+    
+    bool SwiftField::isIndirectCase() const
+    {
+        return ( this->_flags & 1 ) != 0;
+    }
+    
+    bool SwiftField::isVariable() const
+    {
+        return ( this->_flags & 2 ) != 0;
+    }
+}
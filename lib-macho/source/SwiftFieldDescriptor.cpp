@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        SwiftFieldDescriptor.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/SwiftFieldDescriptor.hpp>
+#include <MachO/SwiftMetadata.hpp>
+#include <MachO/ToString.hpp>
+
+namespace MachO
+{
+    class SwiftFieldDescriptor::IMPL
+    {
+        public:
+            
+            IMPL( const SwiftMetadata & metadata, uint64_t address );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            SwiftMetadata _metadata;
+            uint64_t      _address;
+    };
+    
+    std::string SwiftFieldDescriptor::KindToString( Kind kind )
+    {
+        switch( kind )
+        {
+            case Kind::Struct:           return "Struct";
+            case Kind::Class:            return "Class";
+            case Kind::Enum:             return "Enum";
+            case Kind::MultiPayloadEnum: return "Multi-payload enum";
+            case Kind::Protocol:         return "Protocol";
+            case Kind::ClassProtocol:    return "Class protocol";
+            case Kind::ObjCProtocol:     return "Objective-C protocol";
+            case Kind::ObjCClass:        return "Objective-C class";
+        }
+        
+        return "Unknown";
+    }
+    
+    SwiftFieldDescriptor::SwiftFieldDescriptor( const SwiftMetadata & metadata, uint64_t address ):
+        impl( std::make_unique< IMPL >( metadata, address ) )
+    {}
+    
+    SwiftFieldDescriptor::SwiftFieldDescriptor( const SwiftFieldDescriptor & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    SwiftFieldDescriptor::SwiftFieldDescriptor( SwiftFieldDescriptor && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    SwiftFieldDescriptor::~SwiftFieldDescriptor()
+    {}
+    
+    SwiftFieldDescriptor & SwiftFieldDescriptor::operator =( SwiftFieldDescriptor o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info SwiftFieldDescriptor::getInfo() const
+    {
+        XS::Info    i( "Field descriptor", this->typeName() );
+        XS::Info    fields( "Fields", std::to_string( this->numberOfFields() ) );
+        std::string superclass( this->superclassName() );
+        
+        i.addChild( { "Address", XS::ToString::Hex( this->address() ) } );
+        i.addChild( { "Kind",    KindToString( this->kind() ) } );
+        
+        if( superclass.length() > 0 )
+        {
+            i.addChild( { "Superclass", superclass } );
+        }
+        
+        for( const auto & field: this->fields() )
+        {
+            fields.addChild( field );
+        }
+        
+        i.addChild( fields );
+        
+        return i;
+    }
+    
+    uint64_t SwiftFieldDescriptor::address() const
+    {
+        return this->impl->_address;
+    }
+    
+    SwiftFieldDescriptor::Kind SwiftFieldDescriptor::kind() const
+    {
+        return static_cast< Kind >( this->impl->_metadata.readUInt16( this->impl->_address + 8 ) );
+    }
+    
+    std::string SwiftFieldDescriptor::typeName() const
+    {
+        return this->impl->_metadata.readMangledName( this->impl->_metadata.readRelativePointer( this->impl->_address ) );
+    }
+    
+    std::string SwiftFieldDescriptor::superclassName() const
+    {
+        return this->impl->_metadata.readMangledName( this->impl->_metadata.readRelativePointer( this->impl->_address + 4 ) );
+    }
+    
+    uint32_t SwiftFieldDescriptor::numberOfFields() const
+    {
+        return this->impl->_metadata.readUInt32( this->impl->_address + 12 );
+    }
+    
+    std::vector< SwiftField > SwiftFieldDescriptor::fields() const
+    {
+        std::vector< SwiftField > fields;
+        uint64_t                  size( this->impl->_metadata.readUInt16( this->impl->_address + 10 ) );
+        uint32_t                  count( this->numberOfFields() );
+        
+        fields.reserve( count );
+        
+        for( uint32_t i = 0; i < count; i++ )
+        {
+            /* flags, mangledTypeName, fieldName */
+            uint64_t record( this->impl->_address + 16 + i * size );
+            
+            fields.push_back
+            (
+                {
+                    std::string( this->impl->_metadata.readCString( this->impl->_metadata.readRelativePointer( record + 8 ) ) ),
+                    this->impl->_metadata.readMangledName( this->impl->_metadata.readRelativePointer( record + 4 ) ),
+                    this->impl->_metadata.readUInt32( record )
+                }
+            );
+        }
+        
+        return fields;
+    }
+    
+    void swap( SwiftFieldDescriptor & o1, SwiftFieldDescriptor & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    SwiftFieldDescriptor::IMPL::IMPL( const SwiftMetadata & metadata, uint64_t address ):
+        _metadata( metadata ),
+        _address(  address )
+    {}
+    
+    SwiftFieldDescriptor::IMPL::IMPL( const IMPL & o ):
+        _metadata( o._metadata ),
+        _address(  o._address )
+    {}
+    
+    SwiftFieldDescriptor::IMPL::~IMPL()
+    {}
+}
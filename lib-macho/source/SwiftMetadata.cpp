@@ -0,0 +1,460 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        SwiftMetadata.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/SwiftMetadata.hpp>
+#include <MachO/AddressSpace.hpp>
+#include <MachO/ChainedFixups.hpp>
+#include <MachO/Section.hpp>
+#include <MachO/Section64.hpp>
+#include <MachO/ToString.hpp>
+#include <MachO/LoadCommands/Segment.hpp>
+#include <MachO/LoadCommands/Segment64.hpp>
+
+namespace MachO
+{
+    class SwiftMetadata::IMPL
+    {
+        public:
+            
+            struct Range
+            {
+                uint64_t address;
+                uint64_t size;
+            };
+            
+            class Data
+            {
+                public:
+                    
+                    Data( const File & file );
+                    
+                    template< typename T >
+                    void addSections( const std::vector< T > & sections );
+                    
+                    AddressSpace  _space;
+                    ChainedFixups _fixups;
+                    size_t        _pointerSize;
+                    Range         _types;
+                    Range         _protocols;
+                    Range         _conformances;
+                    Range         _fieldDescriptors;
+            };
+            
+            IMPL( const File & file );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            ChainedFixups::Pointer pointer( uint64_t address ) const;
+            
+            std::shared_ptr< const Data > _data;
+    };
+    
+    SwiftMetadata::SwiftMetadata( const File & file ):
+        impl( std::make_unique< IMPL >( file ) )
+    {}
+    
+    SwiftMetadata::SwiftMetadata( const SwiftMetadata & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    SwiftMetadata::SwiftMetadata( SwiftMetadata && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    SwiftMetadata::~SwiftMetadata()
+    {}
+    
+    SwiftMetadata & SwiftMetadata::operator =( SwiftMetadata o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info SwiftMetadata::getInfo() const
+    {
+        XS::Info i( "Swift" );
+        XS::Info types( "Types" );
+        XS::Info protocols( "Protocols" );
+        XS::Info conformances( "Conformances" );
+        XS::Info fieldDescriptors( "Field descriptors" );
+        
+        for( const auto & type: this->types() )
+        {
+            types.addChild( type );
+        }
+        
+        for( const auto & protocol: this->protocols() )
+        {
+            protocols.addChild( protocol );
+        }
+        
+        for( const auto & conformance: this->conformances() )
+        {
+            conformances.addChild( conformance );
+        }
+        
+        for( const auto & descriptor: this->fieldDescriptors() )
+        {
+            fieldDescriptors.addChild( descriptor );
+        }
+        
+        types.value( std::to_string( types.children().size() ) );
+        protocols.value( std::to_string( protocols.children().size() ) );
+        conformances.value( std::to_string( conformances.children().size() ) );
+        fieldDescriptors.value( std::to_string( fieldDescriptors.children().size() ) );
+        
+        i.addChild( types );
+        i.addChild( protocols );
+        i.addChild( conformances );
+        i.addChild( fieldDescriptors );
+        
+        return i;
+    }
+    
+    SwiftMetadata::Sequence< SwiftDescriptor > SwiftMetadata::types() const
+    {
+        return { *( this ), Record::Type, this->impl->_data->_types.address, this->impl->_data->_types.size };
+    }
+    
+    SwiftMetadata::Sequence< SwiftDescriptor > SwiftMetadata::protocols() const
+    {
+        return { *( this ), Record::Protocol, this->impl->_data->_protocols.address, this->impl->_data->_protocols.size };
+    }
+    
+    SwiftMetadata::Sequence< SwiftConformance > SwiftMetadata::conformances() const
+    {
+        return { *( this ), Record::Conformance, this->impl->_data->_conformances.address, this->impl->_data->_conformances.size };
+    }
+    
+    SwiftMetadata::Sequence< SwiftFieldDescriptor > SwiftMetadata::fieldDescriptors() const
+    {
+        return { *( this ), Record::FieldDescriptor, this->impl->_data->_fieldDescriptors.address, this->impl->_data->_fieldDescriptors.size };
+    }
+    
+    size_t SwiftMetadata::pointerSize() const
+    {
+        return this->impl->_data->_pointerSize;
+    }
+    
+    bool SwiftMetadata::contains( uint64_t address ) const
+    {
+        return address != 0 && this->impl->_data->_space.contains( address );
+    }
+    
+    uint64_t SwiftMetadata::readPointer( uint64_t address ) const
+    {
+        ChainedFixups::Pointer p( this->impl->pointer( address ) );
+        
+        return ( p.ordinal.has_value() ) ? 0 : p.target;
+    }
+    
+    std::optional< std::string > SwiftMetadata::readBinding( uint64_t address ) const
+    {
+        ChainedFixups::Pointer p( this->impl->pointer( address ) );
+        
+        if( p.ordinal.has_value() == false )
+        {
+            return {};
+        }
+        
+        return this->impl->_data->_fixups.import( *( p.ordinal ) );
+    }
+    
+    uint8_t SwiftMetadata::readUInt8( uint64_t address ) const
+    {
+        return this->impl->_data->_space.read< uint8_t >( address );
+    }
+    
+    uint16_t SwiftMetadata::readUInt16( uint64_t address ) const
+    {
+        return this->impl->_data->_space.read< uint16_t >( address );
+    }
+    
+    uint32_t SwiftMetadata::readUInt32( uint64_t address ) const
+    {
+        return this->impl->_data->_space.read< uint32_t >( address );
+    }
+    
+    std::string_view SwiftMetadata::readCString( uint64_t address ) const
+    {
+        if( address == 0 )
+        {
+            return {};
+        }
+        
+        return this->impl->_data->_space.readCString( address );
+    }
+    
+    uint64_t SwiftMetadata::readRelativePointer( uint64_t address ) const
+    {
+        int32_t offset( static_cast< int32_t >( this->readUInt32( address ) ) );
+        
+        if( offset == 0 )
+        {
+            return 0;
+        }
+        
+        return address + static_cast< uint64_t >( static_cast< int64_t >( offset ) );
+    }
+    
+    std::optional< uint64_t > SwiftMetadata::readIndirectablePointer( uint64_t address ) const
+    {
+        int32_t offset( static_cast< int32_t >( this->readUInt32( address ) ) );
+        
+        if( offset == 0 )
+        {
+            return {};
+        }
+        
+        {
+            uint64_t target( address + static_cast< uint64_t >( static_cast< int64_t >( offset & ~1 ) ) );
+            
+            if( ( offset & 1 ) == 0 )
+            {
+                return target;
+            }
+            
+            target = this->readPointer( target );
+            
+            if( target == 0 )
+            {
+                return {};
+            }
+            
+            return target;
+        }
+    }
+    
+    std::optional< std::string > SwiftMetadata::readIndirectableBinding( uint64_t address ) const
+    {
+        int32_t offset( static_cast< int32_t >( this->readUInt32( address ) ) );
+        
+        if( ( offset & 1 ) == 0 )
+        {
+            return {};
+        }
+        
+        return this->readBinding( address + static_cast< uint64_t >( static_cast< int64_t >( offset & ~1 ) ) );
+    }
+    
+    std::string SwiftMetadata::readMangledName( uint64_t address ) const
+    {
+        std::string name;
+        
+        if( address == 0 )
+        {
+            return name;
+        }
+        
+        while( true )
+        {
+            uint8_t c( this->readUInt8( address ) );
+            
+            if( c == 0 )
+            {
+                break;
+            }
+            
+            /* Symbolic references: a kind byte followed by a 32-bit relative reference */
+            if( c >= 0x01 && c <= 0x17 )
+            {
+                uint64_t                         target( this->readRelativePointer( address + 1 ) );
+                std::optional< SwiftDescriptor > descriptor;
+                
+                if( c == 0x01 && this->contains( target ) )
+                {
+                    descriptor = SwiftDescriptor( *( this ), target );
+                }
+                else if( c == 0x02 && this->contains( target ) )
+                {
+                    uint64_t indirect( this->readPointer( target ) );
+                    
+                    if( this->contains( indirect ) )
+                    {
+                        descriptor = SwiftDescriptor( *( this ), indirect );
+                    }
+                    else
+                    {
+                        std::optional< std::string > symbol( this->readBinding( target ) );
+                        
+                        name += ( symbol.has_value() ) ? *( symbol ) : "<symbolic>";
+                    }
+                }
+                else
+                {
+                    name += "<symbolic>";
+                }
+                
+                if( descriptor.has_value() )
+                {
+                    name += descriptor->fullName();
+                }
+                
+                address += 5;
+                
+                continue;
+            }
+            
+            /* Absolute symbolic references */
+            if( c >= 0x18 && c <= 0x1F )
+            {
+                name    += "<symbolic>";
+                address += 1 + this->pointerSize();
+                
+                continue;
+            }
+            
+            name += static_cast< char >( c );
+            address++;
+        }
+        
+        return name;
+    }
+    
+    uint64_t SwiftMetadata::resolveRecord( Record record, uint64_t address ) const
+    {
+        switch( record )
+        {
+            case Record::Type:
+            {
+                /* TypeReferenceKind in the two low bits: direct or indirect type descriptor */
+                uint32_t value( this->readUInt32( address ) );
+                uint64_t target( address + static_cast< uint64_t >( static_cast< int64_t >( static_cast< int32_t >( value & ~3U ) ) ) );
+                
+                if( ( value & 3 ) == 0 )
+                {
+                    return target;
+                }
+                
+                return ( ( value & 3 ) == 1 ) ? this->readPointer( target ) : 0;
+            }
+            
+            case Record::Protocol:
+            {
+                uint32_t value( this->readUInt32( address ) );
+                uint64_t target( address + static_cast< uint64_t >( static_cast< int64_t >( static_cast< int32_t >( value & ~3U ) ) ) );
+                
+                return ( ( value & 1 ) == 0 ) ? target : this->readPointer( target );
+            }
+            
+            case Record::Conformance:     return this->readRelativePointer( address );
+            case Record::FieldDescriptor: return address;
+        }
+        
+        return 0;
+    }
+    
+    uint64_t SwiftMetadata::recordSize( Record record, uint64_t address ) const
+    {
+        if( record == Record::FieldDescriptor )
+        {
+            /* mangledTypeName, superclass, kind, fieldRecordSize, numFields, then the records */
+            return 16 + static_cast< uint64_t >( this->readUInt16( address + 10 ) ) * this->readUInt32( address + 12 );
+        }
+        
+        return 4;
+    }
+    
+    void swap( SwiftMetadata & o1, SwiftMetadata & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    SwiftMetadata::IMPL::IMPL( const File & file ):
+        _data( std::make_shared< Data >( file ) )
+    {}
+    
+    SwiftMetadata::IMPL::IMPL( const IMPL & o ):
+        _data( o._data )
+    {}
+    
+    SwiftMetadata::IMPL::~IMPL()
+    {}
+    
+    ChainedFixups::Pointer SwiftMetadata::IMPL::pointer( uint64_t address ) const
+    {
+        if( this->_data->_pointerSize == 8 )
+        {
+            return this->_data->_fixups.decode( this->_data->_space.read< uint64_t >( address ) );
+        }
+        
+        return this->_data->_fixups.decode( this->_data->_space.read< uint32_t >( address ) );
+    }
+    
+    SwiftMetadata::IMPL::Data::Data( const File & file ):
+        _space(            file.addressSpace() ),
+        _fixups(           file ),
+        _pointerSize(      ( file.kind() == File::Kind::MachO64 ) ? 8 : 4 ),
+        _types(            { 0, 0 } ),
+        _protocols(        { 0, 0 } ),
+        _conformances(     { 0, 0 } ),
+        _fieldDescriptors( { 0, 0 } )
+    {
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment >() )
+        {
+            this->addSections( segment.sections() );
+        }
+        
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment64 >() )
+        {
+            this->addSections( segment.sections() );
+        }
+    }
+    
+    template< typename T >
+    void SwiftMetadata::IMPL::Data::addSections( const std::vector< T > & sections )
+    {
+        for( const auto & section: sections )
+        {
+            std::string name( section.section() );
+            Range       range( { section.address(), section.size() } );
+            
+            if( name == "__swift5_types" )
+            {
+                this->_types = range;
+            }
+            else if( name == "__swift5_protos" )
+            {
+                this->_protocols = range;
+            }
+            else if( name == "__swift5_proto" )
+            {
+                this->_conformances = range;
+            }
+            else if( name == "__swift5_fieldmd" )
+            {
+                this->_fieldDescriptors = range;
+            }
+        }
+    }
+}
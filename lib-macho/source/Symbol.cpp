@@ -38,6 +38,7 @@ namespace MachO
         public:
 
             IMPL( File::Kind kind, uint32_t stringTableOffset, XS::IO::BinaryStream & stream );
+            IMPL( const std::string & name, uint32_t nameIndex, uint8_t type, uint8_t section, uint16_t description, uint64_t value );
             IMPL( const IMPL & o );
             ~IMPL();
 
@@ -53,6 +54,10 @@ namespace MachO
         impl( std::make_unique< IMPL >( kind, stringTableOffset, stream ) )
     {}
 
+    Symbol::Symbol( const std::string & name, uint32_t nameIndex, uint8_t type, uint8_t section, uint16_t description, uint64_t value ):
+        impl( std::make_unique< IMPL >( name, nameIndex, type, section, description, value ) )
+    {}
+
     Symbol::Symbol( const Symbol & o ):
         impl( std::make_unique< IMPL >( *( o.impl ) ) )
     {}
@@ -156,6 +161,15 @@ namespace MachO
         }
     }
 
+    Symbol::IMPL::IMPL( const std::string & name, uint32_t nameIndex, uint8_t type, uint8_t section, uint16_t description, uint64_t value ):
+        _name(        name ),
+        _nameIndex(   nameIndex ),
+        _type(        type ),
+        _section(     section ),
+        _description( description ),
+        _value(       value )
+    {}
+
     Symbol::IMPL::IMPL( const IMPL & o ):
         _name( o._name ),
         _nameIndex( o._nameIndex ),
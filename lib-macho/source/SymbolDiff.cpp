@@ -0,0 +1,358 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        SymbolDiff.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/SymbolDiff.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/LoadCommands/SymTab.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <string_view>
+
+namespace MachO
+{
+    namespace SymbolDiff
+    {
+        using Entry = LoadCommands::SymTab::Entry;
+        
+        /* Keeps the names of the entries alive, i.e. the mapped tables or the decoded names */
+        struct Table
+        {
+            std::vector< LoadCommands::SymTab > symTabs;
+            std::deque< std::string >           names;
+            std::vector< Entry >                entries;
+        };
+        
+        static bool     Matches( const Entry & entry, Filter filter );
+        static bool     Less( const Entry & e1, const Entry & e2 );
+        static uint64_t Key( std::string_view name, size_t offset );
+        static void     Read( const File & file, Filter filter, Table & table );
+        static void     Sort( const std::vector< std::vector< Entry > * > & tables );
+        static void     SortChunk( std::vector< Entry >::iterator begin, std::vector< Entry >::iterator end );
+        
+        std::vector< Change > Compare( const File & before, const File & after, Filter filter )
+        {
+            Table                 tables[ 2 ];
+            std::vector< Change > changes;
+            size_t                i( 0 );
+            size_t                j( 0 );
+            
+            Parallel::For
+            (
+                2,
+                [ & ]( size_t n )
+                {
+                    Read( ( n == 0 ) ? before : after, filter, tables[ n ] );
+                }
+            );
+            
+            Sort( { &( tables[ 0 ].entries ), &( tables[ 1 ].entries ) } );
+            
+            {
+                const std::vector< Entry > & e1( tables[ 0 ].entries );
+                const std::vector< Entry > & e2( tables[ 1 ].entries );
+                
+                while( i < e1.size() || j < e2.size() )
+                {
+                    if( j == e2.size() || ( i < e1.size() && e1[ i ].name < e2[ j ].name ) )
+                    {
+                        changes.push_back( { Change::Kind::Removed, std::string( e1[ i ].name ), e1[ i ].type, 0, e1[ i ].section, 0 } );
+                        
+                        i++;
+                    }
+                    else if( i == e1.size() || e2[ j ].name < e1[ i ].name )
+                    {
+                        changes.push_back( { Change::Kind::Added, std::string( e2[ j ].name ), 0, e2[ j ].type, 0, e2[ j ].section } );
+                        
+                        j++;
+                    }
+                    else
+                    {
+                        std::string_view name( e1[ i ].name );
+                        
+                        /* Both runs of entries with the same name are sorted by type and section */
+                        for( ; i < e1.size() && j < e2.size() && e1[ i ].name == name && e2[ j ].name == name; i++, j++ )
+                        {
+                            if( e1[ i ].type != e2[ j ].type || e1[ i ].section != e2[ j ].section )
+                            {
+                                changes.push_back( { Change::Kind::Changed, std::string( name ), e1[ i ].type, e2[ j ].type, e1[ i ].section, e2[ j ].section } );
+                            }
+                        }
+                    }
+                }
+            }
+            
+            return changes;
+        }
+        
+        static bool Matches( const Entry & entry, Filter filter )
+        {
+            bool external( ( entry.type & 0x01 ) != 0 );
+            bool undefined( ( entry.type & 0x0E ) == 0 );
+            
+            switch( filter )
+            {
+                case Filter::All:     return true;
+                case Filter::Exports: return external && undefined == false;
+                case Filter::Imports: return external && undefined;
+                case Filter::Locals:  return external == false;
+            }
+            
+            return false;
+        }
+        
+        static bool Less( const Entry & e1, const Entry & e2 )
+        {
+            if( e1.name != e2.name )
+            {
+                return e1.name < e2.name;
+            }
+            
+            return ( e1.type == e2.type ) ? e1.section < e2.section : e1.type < e2.type;
+        }
+        
+        /* Eight bytes of a name, from the given offset, as a big-endian integer padded with zeros */
+        static uint64_t Key( std::string_view name, size_t offset )
+        {
+            uint64_t key( 0 );
+            
+            for( size_t i = 0; i < 8; i++ )
+            {
+                key = ( key << 8 ) | ( ( offset + i < name.size() ) ? static_cast< uint8_t >( name[ offset + i ] ) : 0 );
+            }
+            
+            return key;
+        }
+        
+        static void Read( const File & file, Filter filter, Table & table )
+        {
+            table.symTabs = file.loadCommands< LoadCommands::SymTab >();
+            
+            for( const auto & symTab: table.symTabs )
+            {
+                std::optional< std::vector< Entry > > entries( symTab.entries() );
+                
+                /* Symbol tables not backed by a mapped file are decoded, and their names kept */
+                if( entries.has_value() == false )
+                {
+                    entries = std::vector< Entry >();
+                    
+                    for( const auto & symbol: symTab.symbols() )
+                    {
+                        table.names.push_back( symbol.name() );
+                        entries->push_back( { table.names.back(), symbol.type(), symbol.section(), symbol.description(), symbol.value() } );
+                    }
+                }
+                
+                for( const auto & entry: *( entries ) )
+                {
+                    if( ( entry.type & 0xE0 ) == 0 && entry.name.empty() == false && Matches( entry, filter ) )
+                    {
+                        table.entries.push_back( entry );
+                    }
+                }
+            }
+        }
+        
+        /* Chunks of all tables are sorted in parallel, then adjacent chunks are merged in parallel */
+        static void Sort( const std::vector< std::vector< Entry > * > & tables )
+        {
+            struct Run
+            {
+                std::vector< Entry > * entries;
+                size_t                 begin;
+                size_t                 middle;
+                size_t                 end;
+            };
+            
+            std::vector< std::vector< size_t > > bounds( tables.size() );
+            size_t                               chunks( Parallel::ThreadCount() );
+            bool                                 merge( false );
+            
+            for( size_t t = 0; t < tables.size(); t++ )
+            {
+                for( size_t i = 0; i <= chunks; i++ )
+                {
+                    bounds[ t ].push_back( tables[ t ]->size() * i / chunks );
+                }
+            }
+            
+            while( true )
+            {
+                std::vector< Run > runs;
+                
+                for( size_t t = 0; t < tables.size(); t++ )
+                {
+                    std::vector< size_t > & b( bounds[ t ] );
+                    std::vector< size_t >   next;
+                    size_t                  i( 0 );
+                    
+                    if( merge == false )
+                    {
+                        for( ; i + 1 < b.size(); i++ )
+                        {
+                            runs.push_back( { tables[ t ], b[ i ], b[ i + 1 ], b[ i + 1 ] } );
+                        }
+                        
+                        continue;
+                    }
+                    
+                    for( ; i + 2 < b.size(); i += 2 )
+                    {
+                        runs.push_back( { tables[ t ], b[ i ], b[ i + 1 ], b[ i + 2 ] } );
+                        next.push_back( b[ i ] );
+                    }
+                    
+                    next.insert( next.end(), b.begin() + static_cast< std::ptrdiff_t >( i ), b.end() );
+                    
+                    b = next;
+                }
+                
+                if( runs.empty() )
+                {
+                    break;
+                }
+                
+                Parallel::For
+                (
+                    runs.size(),
+                    [ & ]( size_t n )
+                    {
+                        auto begin( runs[ n ].entries->begin() );
+                        
+                        if( merge )
+                        {
+                            std::inplace_merge( begin + static_cast< std::ptrdiff_t >( runs[ n ].begin ), begin + static_cast< std::ptrdiff_t >( runs[ n ].middle ), begin + static_cast< std::ptrdiff_t >( runs[ n ].end ), Less );
+                        }
+                        else
+                        {
+                            SortChunk( begin + static_cast< std::ptrdiff_t >( runs[ n ].begin ), begin + static_cast< std::ptrdiff_t >( runs[ n ].end ) );
+                        }
+                    }
+                );
+                
+                merge = true;
+            }
+        }
+        
+        /*
+         * Names are compared as integer keys, eight bytes at a time, and only names sharing
+         * a prefix are compared further. Ranges are kept in a list, as names may be long.
+         */
+        static void SortChunk( std::vector< Entry >::iterator begin, std::vector< Entry >::iterator end )
+        {
+            struct Item
+            {
+                uint64_t      key;
+                const Entry * entry;
+            };
+            
+            struct Range
+            {
+                size_t begin;
+                size_t end;
+                size_t offset;
+            };
+            
+            std::vector< Item >  items;
+            std::vector< Range > ranges;
+            std::vector< Entry > sorted;
+            
+            items.reserve( static_cast< size_t >( end - begin ) );
+            
+            for( auto it = begin; it != end; ++it )
+            {
+                items.push_back( { Key( it->name, 0 ), &( *( it ) ) } );
+            }
+            
+            ranges.push_back( { 0, items.size(), 0 } );
+            
+            while( ranges.empty() == false )
+            {
+                Range range( ranges.back() );
+                
+                ranges.pop_back();
+                
+                std::sort
+                (
+                    items.begin() + static_cast< std::ptrdiff_t >( range.begin ),
+                    items.begin() + static_cast< std::ptrdiff_t >( range.end ),
+                    []( const Item & i1, const Item & i2 )
+                    {
+                        return i1.key < i2.key;
+                    }
+                );
+                
+                for( size_t i = range.begin, j = range.begin; i < range.end; i = j )
+                {
+                    for( j = i + 1; j < range.end && items[ j ].key == items[ i ].key; j++ )
+                    {}
+                    
+                    if( j - i < 2 )
+                    {
+                        continue;
+                    }
+                    
+                    /* Names cannot contain a zero byte, so equal keys ending with padding are equal names */
+                    if( items[ i ].entry->name.size() <= range.offset + 8 )
+                    {
+                        std::sort
+                        (
+                            items.begin() + static_cast< std::ptrdiff_t >( i ),
+                            items.begin() + static_cast< std::ptrdiff_t >( j ),
+                            []( const Item & i1, const Item & i2 )
+                            {
+                                return Less( *( i1.entry ), *( i2.entry ) );
+                            }
+                        );
+                        
+                        continue;
+                    }
+                    
+                    for( size_t k = i; k < j; k++ )
+                    {
+                        items[ k ].key = Key( items[ k ].entry->name, range.offset + 8 );
+                    }
+                    
+                    ranges.push_back( { i, j, range.offset + 8 } );
+                }
+            }
+            
+            sorted.reserve( items.size() );
+            
+            for( const auto & item: items )
+            {
+                sorted.push_back( *( item.entry ) );
+            }
+            
+            std::copy( sorted.begin(), sorted.end(), begin );
+        }
+    }
+}
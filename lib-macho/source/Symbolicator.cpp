@@ -0,0 +1,346 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Symbolicator.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/Symbolicator.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/Symbol.hpp>
+#include <MachO/LoadCommands/LinkEditData.hpp>
+#include <MachO/LoadCommands/Segment.hpp>
+#include <MachO/LoadCommands/Segment64.hpp>
+#include <limits>
+
+namespace MachO
+{
+    class Symbolicator::IMPL
+    {
+        public:
+            
+            static constexpr uint32_t NoName = std::numeric_limits< uint32_t >::max();
+            
+            struct Function
+            {
+                uint64_t address;
+                uint32_t name;
+            };
+            
+            IMPL( const File & file );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            void addSegment( const std::string & name, uint64_t address, uint64_t size, uint32_t protection );
+            void addFunctionStarts( const File & file );
+            
+            Location locate( uint64_t address, uint64_t unslid, size_t function ) const;
+            
+            uint64_t                                       _text;
+            std::vector< Function >                        _functions;
+            std::vector< std::string >                     _names;
+            std::vector< std::pair< uint64_t, uint64_t > > _segments;
+    };
+    
+    Symbolicator::Symbolicator( const File & file ):
+        impl( std::make_unique< IMPL >( file ) )
+    {}
+    
+    Symbolicator::Symbolicator( const Symbolicator & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    Symbolicator::Symbolicator( Symbolicator && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    Symbolicator::~Symbolicator( void )
+    {}
+    
+    Symbolicator & Symbolicator::operator =( Symbolicator o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    uint64_t Symbolicator::textAddress() const
+    {
+        return this->impl->_text;
+    }
+    
+    Symbolicator::Location Symbolicator::symbolicate( uint64_t address, uint64_t slide ) const
+    {
+        const auto & functions( this->impl->_functions );
+        uint64_t     unslid( address - slide );
+        auto         it( std::upper_bound( functions.begin(), functions.end(), unslid, []( uint64_t a, const IMPL::Function & f ) { return a < f.address; } ) );
+        
+        return this->impl->locate( address, unslid, static_cast< size_t >( it - functions.begin() ) );
+    }
+    
+    std::vector< Symbolicator::Location > Symbolicator::symbolicate( const std::vector< uint64_t > & addresses, uint64_t slide ) const
+    {
+        const auto                                 & functions( this->impl->_functions );
+        std::vector< std::pair< uint64_t, size_t > > sorted;
+        std::vector< Location >                      locations( addresses.size() );
+        size_t                                       chunk( 4096 );
+        
+        sorted.reserve( addresses.size() );
+        
+        for( size_t i = 0; i < addresses.size(); i++ )
+        {
+            sorted.emplace_back( addresses[ i ] - slide, i );
+        }
+        
+        /*
+         * Sorted addresses are resolved by walking the function table forward, so each chunk
+         * only needs a single binary search and touches the table sequentially.
+         */
+        std::sort( sorted.begin(), sorted.end() );
+        
+        Parallel::For
+        (
+            ( sorted.size() + chunk - 1 ) / chunk,
+            [ & ]( size_t n )
+            {
+                size_t begin( n * chunk );
+                size_t end( std::min( begin + chunk, sorted.size() ) );
+                auto   it( std::upper_bound( functions.begin(), functions.end(), sorted[ begin ].first, []( uint64_t a, const IMPL::Function & f ) { return a < f.address; } ) );
+                size_t function( static_cast< size_t >( it - functions.begin() ) );
+                
+                for( size_t i = begin; i < end; i++ )
+                {
+                    while( function < functions.size() && functions[ function ].address <= sorted[ i ].first )
+                    {
+                        function++;
+                    }
+                    
+                    locations[ sorted[ i ].second ] = this->impl->locate( addresses[ sorted[ i ].second ], sorted[ i ].first, function );
+                }
+            }
+        );
+        
+        return locations;
+    }
+    
+    void swap( Symbolicator & o1, Symbolicator & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    Symbolicator::IMPL::IMPL( const File & file ):
+        _text( 0 )
+    {
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment >() )
+        {
+            this->addSegment( segment.name(), segment.vmAddress(), segment.vmSize(), segment.initProtection() );
+        }
+        
+        for( const auto & segment: file.loadCommands< LoadCommands::Segment64 >() )
+        {
+            this->addSegment( segment.name(), segment.vmAddress(), segment.vmSize(), segment.initProtection() );
+        }
+        
+        /* Only non-debugging symbols defined in a section have a meaningful address */
+        for( const auto & symbol: file.symbols() )
+        {
+            if( ( symbol.type() & 0xE0 ) == 0 && ( symbol.type() & 0x0E ) == 0x0E )
+            {
+                this->_functions.push_back( { symbol.value(), static_cast< uint32_t >( this->_names.size() ) } );
+                this->_names.push_back( symbol.name() );
+            }
+        }
+        
+        this->addFunctionStarts( file );
+        
+        /* Named entries sort before unnamed ones at the same address, and are the ones kept */
+        std::sort
+        (
+            this->_functions.begin(),
+            this->_functions.end(),
+            []( const Function & f1, const Function & f2 )
+            {
+                return ( f1.address == f2.address ) ? f1.name < f2.name : f1.address < f2.address;
+            }
+        );
+        
+        this->_functions.erase
+        (
+            std::unique
+            (
+                this->_functions.begin(),
+                this->_functions.end(),
+                []( const Function & f1, const Function & f2 )
+                {
+                    return f1.address == f2.address;
+                }
+            ),
+            this->_functions.end()
+        );
+        
+        std::sort( this->_segments.begin(), this->_segments.end() );
+    }
+    
+    Symbolicator::IMPL::IMPL( const IMPL & o ):
+        _text(      o._text ),
+        _functions( o._functions ),
+        _names(     o._names ),
+        _segments(  o._segments )
+    {}
+    
+    Symbolicator::IMPL::~IMPL()
+    {}
+    
+    void Symbolicator::IMPL::addSegment( const std::string & name, uint64_t address, uint64_t size, uint32_t protection )
+    {
+        std::string segment( name.substr( 0, name.find( '\0' ) ) );
+        
+        if( segment == "__TEXT" )
+        {
+            this->_text = address;
+        }
+        
+        /* Addresses in __PAGEZERO or __LINKEDIT are never code or data */
+        if( protection != 0 && segment != "__LINKEDIT" )
+        {
+            this->_segments.emplace_back( address, address + size );
+        }
+    }
+    
+    void Symbolicator::IMPL::addFunctionStarts( const File & file )
+    {
+        for( const auto & command: file.loadCommands< LoadCommands::LinkEditData >() )
+        {
+            if( command.command() != 0x26 || command.dataSize() == 0 )
+            {
+                continue;
+            }
+            
+            /* Function starts are optional, so unreadable data only leaves the symbol table */
+            try
+            {
+                std::optional< MappedFile > data( file.mappedFile() );
+                uint64_t                    address( this->_text );
+                size_t                      position( command.dataOffset() );
+                size_t                      end( position + command.dataSize() );
+                
+                /* In split dyld caches, __LINKEDIT lives in another sub-cache than the header */
+                for( const auto & segment: file.loadCommands< LoadCommands::Segment >() )
+                {
+                    if( segment.name().substr( 0, segment.name().find( '\0' ) ) == "__LINKEDIT" && segment.mappedFile().has_value() )
+                    {
+                        data = segment.mappedFile();
+                    }
+                }
+                
+                for( const auto & segment: file.loadCommands< LoadCommands::Segment64 >() )
+                {
+                    if( segment.name().substr( 0, segment.name().find( '\0' ) ) == "__LINKEDIT" && segment.mappedFile().has_value() )
+                    {
+                        data = segment.mappedFile();
+                    }
+                }
+                
+                if( data.has_value() == false || data->contains( position, command.dataSize() ) == false )
+                {
+                    return;
+                }
+                
+                /* ULEB128 deltas from the start of __TEXT, terminated by a zero delta */
+                while( position < end )
+                {
+                    uint64_t delta( 0 );
+                    unsigned shift( 0 );
+                    uint8_t  byte;
+                    
+                    do
+                    {
+                        byte   = data->read< uint8_t >( position++ );
+                        delta |= static_cast< uint64_t >( byte & 0x7F ) << shift;
+                        shift += 7;
+                    }
+                    while( ( byte & 0x80 ) != 0 && position < end && shift < 64 );
+                    
+                    if( delta == 0 )
+                    {
+                        break;
+                    }
+                    
+                    address += delta;
+                    
+                    this->_functions.push_back( { address, NoName } );
+                }
+            }
+            catch( const std::exception & )
+            {}
+            
+            return;
+        }
+    }
+    
+    Symbolicator::Location Symbolicator::IMPL::locate( uint64_t address, uint64_t unslid, size_t function ) const
+    {
+        Location location { address, false, {}, 0, 0 };
+        auto     segment
+        (
+            std::upper_bound
+            (
+                this->_segments.begin(),
+                this->_segments.end(),
+                unslid,
+                []( uint64_t a, const std::pair< uint64_t, uint64_t > & s ) { return a < s.first; }
+            )
+        );
+        
+        /* The function index is the first entry past the address */
+        if( function == 0 || segment == this->_segments.begin() || unslid >= ( segment - 1 )->second )
+        {
+            return location;
+        }
+        
+        {
+            const Function & f( this->_functions[ function - 1 ] );
+            
+            /* A function in another segment cannot contain the address */
+            if( f.address < ( segment - 1 )->first )
+            {
+                return location;
+            }
+            
+            location.resolved = true;
+            location.start    = f.address;
+            location.offset   = unslid - f.address;
+            
+            if( f.name != NoName )
+            {
+                location.symbol = this->_names[ f.name ];
+            }
+        }
+        
+        return location;
+    }
+}
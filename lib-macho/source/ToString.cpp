@@ -66,5 +66,21 @@ namespace MachO
                  + "."
                  + std::to_string( e );
         }
+        
+        std::string Bytes( const uint8_t * data, size_t size )
+        {
+            static const char digits[] = "0123456789abcdef";
+            std::string       s;
+            
+            s.reserve( size * 2 );
+            
+            for( size_t i = 0; i < size; i++ )
+            {
+                s.push_back( digits[ data[ i ] >> 4 ] );
+                s.push_back( digits[ data[ i ] & 0xF ] );
+            }
+            
+            return s;
+        }
     }
 }
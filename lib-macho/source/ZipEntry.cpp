@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ZipEntry.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ZipEntry.hpp>
+#include <MachO/ToString.hpp>
+#include <XS.hpp>
+
+namespace MachO
+{
+    class ZipEntry::IMPL
+    {
+        public:
+            
+            IMPL( const std::string & name, uint16_t flags, uint16_t method, uint32_t crc32, uint64_t compressedSize, uint64_t size, uint64_t localHeaderOffset );
+            IMPL( const IMPL & o );
+            ~IMPL( void );
+            
+            std::string _name;
+            uint16_t    _flags;
+            uint16_t    _method;
+            uint32_t    _crc32;
+            uint64_t    _compressedSize;
+            uint64_t    _size;
+            uint64_t    _localHeaderOffset;
+    };
+    
+    ZipEntry::ZipEntry( const std::string & name, uint16_t flags, uint16_t method, uint32_t crc32, uint64_t compressedSize, uint64_t size, uint64_t localHeaderOffset ):
+        impl( std::make_unique< IMPL >( name, flags, method, crc32, compressedSize, size, localHeaderOffset ) )
+    {}
+    
+    ZipEntry::ZipEntry( const ZipEntry & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ZipEntry::ZipEntry( ZipEntry && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ZipEntry::~ZipEntry( void )
+    {}
+    
+    ZipEntry & ZipEntry::operator =( ZipEntry o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info ZipEntry::getInfo() const
+    {
+        XS::Info i( "Zip entry", this->name() );
+        
+        i.addChild( { "Method",          ( this->method() == 0 ) ? "Stored" : ( ( this->method() == 8 ) ? "Deflated" : std::to_string( this->method() ) ) } );
+        i.addChild( { "CRC32",           XS::ToString::Hex( this->crc32() ) } );
+        i.addChild( { "Compressed size", XS::ToString::Size( this->compressedSize() ) } );
+        i.addChild( { "Size",            XS::ToString::Size( this->size() ) } );
+        
+        return i;
+    }
+    
+    std::string ZipEntry::name() const
+    {
+        return this->impl->_name;
+    }
+    
+    uint16_t ZipEntry::flags() const
+    {
+        return this->impl->_flags;
+    }
+    
+    uint16_t ZipEntry::method() const
+    {
+        return this->impl->_method;
+    }
+    
+    uint32_t ZipEntry::crc32() const
+    {
+        return this->impl->_crc32;
+    }
+    
+    uint64_t ZipEntry::compressedSize() const
+    {
+        return this->impl->_compressedSize;
+    }
+    
+    uint64_t ZipEntry::size() const
+    {
+        return this->impl->_size;
+    }
+    
+    uint64_t ZipEntry::localHeaderOffset() const
+    {
+        return this->impl->_localHeaderOffset;
+    }
+    
+    bool ZipEntry::isDirectory() const
+    {
+        return this->impl->_name.size() > 0 && this->impl->_name.back() == '/';
+    }
+    
+    bool ZipEntry::isEncrypted() const
+    {
+        return ( this->impl->_flags & 1 ) != 0;
+    }
+    
+    void swap( ZipEntry & o1, ZipEntry & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ZipEntry::IMPL::IMPL( const std::string & name, uint16_t flags, uint16_t method, uint32_t crc32, uint64_t compressedSize, uint64_t size, uint64_t localHeaderOffset ):
+        _name(              name ),
+        _flags(             flags ),
+        _method(            method ),
+        _crc32(             crc32 ),
+        _compressedSize(    compressedSize ),
+        _size(              size ),
+        _localHeaderOffset( localHeaderOffset )
+    {}
+    
+    ZipEntry::IMPL::IMPL( const IMPL & o ):
+        _name(              o._name ),
+        _flags(             o._flags ),
+        _method(            o._method ),
+        _crc32(             o._crc32 ),
+        _compressedSize(    o._compressedSize ),
+        _size(              o._size ),
+        _localHeaderOffset( o._localHeaderOffset )
+    {}
+    
+    ZipEntry::IMPL::~IMPL( void )
+    {}
+}
@@ -0,0 +1,465 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2020 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ZipFile.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <MachO/ZipFile.hpp>
+#include <MachO/Inflater.hpp>
+#include <MachO/Parallel.hpp>
+#include <MachO/ToString.hpp>
+#include <XS.hpp>
+#include <array>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace MachO
+{
+    class ZipFile::IMPL
+    {
+        public:
+            
+            IMPL( const std::string & path );
+            IMPL( const MappedFile & data );
+            IMPL( const IMPL & o );
+            ~IMPL( void );
+            
+            void     parse();
+            uint64_t dataOffset( const ZipEntry & entry ) const;
+            
+            static uint32_t CRC32( const uint8_t * data, size_t size );
+            
+            std::optional< std::string >              _path;
+            MappedFile                                _data;
+            std::vector< ZipEntry >                   _entries;
+            std::unordered_map< std::string, size_t > _names;
+    };
+    
+    ZipFile::ZipFile( const std::string & path ):
+        impl( std::make_unique< IMPL >( path ) )
+    {}
+    
+    ZipFile::ZipFile( const MappedFile & data ):
+        impl( std::make_unique< IMPL >( data ) )
+    {}
+    
+    ZipFile::ZipFile( const ZipFile & o ):
+        XS::Info::Object(),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ZipFile::ZipFile( ZipFile && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    ZipFile::~ZipFile( void )
+    {}
+    
+    ZipFile & ZipFile::operator =( ZipFile o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    XS::Info ZipFile::getInfo() const
+    {
+        XS::Info i( "Zip file" );
+        XS::Info entries( "Entries", std::to_string( this->impl->_entries.size() ) );
+        
+        if( this->impl->_path.has_value() )
+        {
+            i.value( XS::ToString::Filename( *( this->impl->_path ) ) );
+        }
+        
+        for( const auto & entry: this->impl->_entries )
+        {
+            entries.addChild( entry );
+        }
+        
+        i.addChild( entries );
+        
+        return i;
+    }
+    
+    bool ZipFile::IsZip( const MappedFile & data )
+    {
+        if( data.size() < 4 )
+        {
+            return false;
+        }
+        
+        {
+            uint32_t magic( data.read< uint32_t >( 0 ) );
+            
+            return magic == 0x04034B50 || magic == 0x06054B50;
+        }
+    }
+    
+    std::optional< std::string > ZipFile::path() const
+    {
+        return this->impl->_path;
+    }
+    
+    std::vector< ZipEntry > ZipFile::entries() const
+    {
+        return this->impl->_entries;
+    }
+    
+    std::optional< size_t > ZipFile::entryIndex( std::string_view name ) const
+    {
+        auto it( this->impl->_names.find( std::string( name ) ) );
+        
+        if( it == this->impl->_names.end() )
+        {
+            return {};
+        }
+        
+        return it->second;
+    }
+    
+    MappedFile ZipFile::data( size_t index ) const
+    {
+        if( index >= this->impl->_entries.size() )
+        {
+            throw std::out_of_range( "Invalid zip entry index: " + std::to_string( index ) );
+        }
+        
+        {
+            const ZipEntry & entry( this->impl->_entries[ index ] );
+            uint64_t         offset( this->impl->dataOffset( entry ) );
+            
+            if( entry.method() == 0 )
+            {
+                return this->impl->_data.slice( offset, entry.size() );
+            }
+            
+            {
+                std::vector< uint8_t > data( Inflater::Inflate( this->impl->_data.pointer( offset, entry.compressedSize() ), entry.compressedSize(), entry.size() ) );
+                
+                if( IMPL::CRC32( data.data(), data.size() ) != entry.crc32() )
+                {
+                    throw std::runtime_error( "Invalid CRC32 for zip entry: " + entry.name() );
+                }
+                
+                return data;
+            }
+        }
+    }
+    
+    std::vector< uint8_t > ZipFile::header( size_t index, size_t size ) const
+    {
+        if( index >= this->impl->_entries.size() )
+        {
+            throw std::out_of_range( "Invalid zip entry index: " + std::to_string( index ) );
+        }
+        
+        {
+            const ZipEntry       & entry( this->impl->_entries[ index ] );
+            uint64_t               offset( this->impl->dataOffset( entry ) );
+            std::vector< uint8_t > header( std::min< uint64_t >( size, entry.size() ) );
+            
+            if( entry.method() == 0 )
+            {
+                const uint8_t * data( this->impl->_data.pointer( offset, header.size() ) );
+                
+                std::copy( data, data + header.size(), header.begin() );
+            }
+            else
+            {
+                Inflater inflater( this->impl->_data.pointer( offset, entry.compressedSize() ), entry.compressedSize() );
+                
+                header.resize( inflater.read( header.data(), header.size() ) );
+            }
+            
+            return header;
+        }
+    }
+    
+    bool ZipFile::isMachO( size_t index ) const
+    {
+        std::vector< uint8_t > header( this->header( index, 8 ) );
+        
+        if( header.size() < 8 )
+        {
+            return false;
+        }
+        
+        {
+            uint32_t magic( static_cast< uint32_t >( header[ 0 ] << 24 | header[ 1 ] << 16 | header[ 2 ] << 8 | header[ 3 ] ) );
+            uint32_t count( static_cast< uint32_t >( header[ 4 ] << 24 | header[ 5 ] << 16 | header[ 6 ] << 8 | header[ 7 ] ) );
+            
+            if( magic == 0xFEEDFACE || magic == 0xFEEDFACF || magic == 0xCEFAEDFE || magic == 0xCFFAEDFE )
+            {
+                return true;
+            }
+            
+            /* Java class files share the fat magic, but have a version number where fat files have a small architecture count */
+            return magic == 0xCAFEBABE && count > 0 && count < 0x20;
+        }
+    }
+    
+    std::vector< size_t > ZipFile::machOEntries() const
+    {
+        std::vector< size_t > indexes;
+        std::vector< char >   matches( this->impl->_entries.size(), false );
+        
+        Parallel::For
+        (
+            this->impl->_entries.size(),
+            [ & ]( size_t i )
+            {
+                const ZipEntry & entry( this->impl->_entries[ i ] );
+                
+                if( entry.isDirectory() == false && entry.isEncrypted() == false && ( entry.method() == 0 || entry.method() == 8 ) )
+                {
+                    matches[ i ] = this->isMachO( i );
+                }
+            }
+        );
+        
+        for( size_t i = 0; i < matches.size(); i++ )
+        {
+            if( matches[ i ] )
+            {
+                indexes.push_back( i );
+            }
+        }
+        
+        return indexes;
+    }
+    
+    void swap( ZipFile & o1, ZipFile & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    ZipFile::IMPL::IMPL( const std::string & path ):
+        _path( path ),
+        _data( MappedFile( path ) )
+    {
+        this->parse();
+    }
+    
+    ZipFile::IMPL::IMPL( const MappedFile & data ):
+        _path( data.path() ),
+        _data( data )
+    {
+        this->parse();
+    }
+    
+    ZipFile::IMPL::IMPL( const IMPL & o ):
+        _path(    o._path ),
+        _data(    o._data ),
+        _entries( o._entries ),
+        _names(   o._names )
+    {}
+    
+    ZipFile::IMPL::~IMPL( void )
+    {}
+    
+    void ZipFile::IMPL::parse()
+    {
+        std::optional< uint64_t > end;
+        uint64_t                  count( 0 );
+        uint64_t                  offset( 0 );
+        uint64_t                  size( 0 );
+        
+        if( this->_data.size() < 22 )
+        {
+            throw std::runtime_error( "Invalid zip file: too small" );
+        }
+        
+        /* The end of central directory record is followed by a comment of up to 64KB */
+        for( uint64_t i = this->_data.size() - 22; i + 22 + 0xFFFF >= this->_data.size(); i-- )
+        {
+            if( this->_data.read< uint32_t >( i ) == 0x06054B50 )
+            {
+                end = i;
+                
+                break;
+            }
+            
+            if( i == 0 )
+            {
+                break;
+            }
+        }
+        
+        if( end.has_value() == false )
+        {
+            throw std::runtime_error( "Invalid zip file: missing end of central directory" );
+        }
+        
+        count  = this->_data.read< uint16_t >( *( end ) + 10 );
+        size   = this->_data.read< uint32_t >( *( end ) + 12 );
+        offset = this->_data.read< uint32_t >( *( end ) + 16 );
+        
+        if( *( end ) >= 20 && this->_data.read< uint32_t >( *( end ) - 20 ) == 0x07064B50 )
+        {
+            uint64_t zip64( this->_data.read< uint64_t >( *( end ) - 12 ) );
+            
+            if( this->_data.read< uint32_t >( zip64 ) != 0x06064B50 )
+            {
+                throw std::runtime_error( "Invalid zip64 end of central directory: " + XS::ToString::Hex( zip64 ) );
+            }
+            
+            count  = this->_data.read< uint64_t >( zip64 + 32 );
+            size   = this->_data.read< uint64_t >( zip64 + 40 );
+            offset = this->_data.read< uint64_t >( zip64 + 48 );
+        }
+        
+        if( this->_data.contains( offset, size ) == false )
+        {
+            throw std::runtime_error( "Invalid zip central directory offset: " + XS::ToString::Hex( offset ) );
+        }
+        
+        /* The count is not trusted, a central directory entry takes at least 46 bytes */
+        this->_entries.reserve( std::min< uint64_t >( count, size / 46 ) );
+        
+        for( uint64_t i = 0, position = offset; i < count; i++ )
+        {
+            if( this->_data.read< uint32_t >( position ) != 0x02014B50 )
+            {
+                throw std::runtime_error( "Invalid zip central directory entry: " + XS::ToString::Hex( position ) );
+            }
+            
+            {
+                uint16_t         flags( this->_data.read< uint16_t >( position + 8 ) );
+                uint16_t         method( this->_data.read< uint16_t >( position + 10 ) );
+                uint32_t         crc32( this->_data.read< uint32_t >( position + 16 ) );
+                uint64_t         compressedSize( this->_data.read< uint32_t >( position + 20 ) );
+                uint64_t         uncompressedSize( this->_data.read< uint32_t >( position + 24 ) );
+                uint16_t         nameLength( this->_data.read< uint16_t >( position + 28 ) );
+                uint16_t         extraLength( this->_data.read< uint16_t >( position + 30 ) );
+                uint16_t         commentLength( this->_data.read< uint16_t >( position + 32 ) );
+                uint64_t         localHeader( this->_data.read< uint32_t >( position + 42 ) );
+                std::string_view name( reinterpret_cast< const char * >( this->_data.pointer( position + 46, nameLength ) ), nameLength );
+                uint64_t         extra( position + 46 + nameLength );
+                
+                /* ZIP64 extended information only holds the fields saturated in the entry */
+                for( uint64_t field = extra; field + 4 <= extra + extraLength; )
+                {
+                    uint16_t id( this->_data.read< uint16_t >( field ) );
+                    uint16_t length( this->_data.read< uint16_t >( field + 2 ) );
+                    uint64_t value( field + 4 );
+                    
+                    if( id == 0x0001 )
+                    {
+                        if( uncompressedSize == 0xFFFFFFFF && value + 8 <= field + 4 + length )
+                        {
+                            uncompressedSize = this->_data.read< uint64_t >( value );
+                            value           += 8;
+                        }
+                        
+                        if( compressedSize == 0xFFFFFFFF && value + 8 <= field + 4 + length )
+                        {
+                            compressedSize = this->_data.read< uint64_t >( value );
+                            value         += 8;
+                        }
+                        
+                        if( localHeader == 0xFFFFFFFF && value + 8 <= field + 4 + length )
+                        {
+                            localHeader = this->_data.read< uint64_t >( value );
+                        }
+                    }
+                    
+                    field += 4 + length;
+                }
+                
+                this->_names.emplace( std::string( name ), this->_entries.size() );
+                this->_entries.push_back( { std::string( name ), flags, method, crc32, compressedSize, uncompressedSize, localHeader } );
+                
+                position += 46 + nameLength + extraLength + commentLength;
+            }
+        }
+    }
+    
+    uint64_t ZipFile::IMPL::dataOffset( const ZipEntry & entry ) const
+    {
+        uint64_t offset( entry.localHeaderOffset() );
+        
+        if( entry.isEncrypted() )
+        {
+            throw std::runtime_error( "Encrypted zip entries are not supported: " + entry.name() );
+        }
+        
+        if( entry.method() != 0 && entry.method() != 8 )
+        {
+            throw std::runtime_error( "Unsupported zip compression method: " + std::to_string( entry.method() ) );
+        }
+        
+        if( this->_data.read< uint32_t >( offset ) != 0x04034B50 )
+        {
+            throw std::runtime_error( "Invalid zip local header: " + XS::ToString::Hex( offset ) );
+        }
+        
+        offset += 30 + this->_data.read< uint16_t >( offset + 26 ) + this->_data.read< uint16_t >( offset + 28 );
+        
+        if( this->_data.contains( offset, ( entry.method() == 0 ) ? entry.size() : entry.compressedSize() ) == false )
+        {
+            throw std::runtime_error( "Invalid zip entry size: " + entry.name() );
+        }
+        
+        return offset;
+    }
+    
+    uint32_t ZipFile::IMPL::CRC32( const uint8_t * data, size_t size )
+    {
+        static const std::array< uint32_t, 256 > table
+        {
+            []
+            {
+                std::array< uint32_t, 256 > values {};
+                
+                for( uint32_t i = 0; i < 256; i++ )
+                {
+                    uint32_t value( i );
+                    
+                    for( int bit = 0; bit < 8; bit++ )
+                    {
+                        value = ( value & 1 ) ? 0xEDB88320 ^ ( value >> 1 ) : value >> 1;
+                    }
+                    
+                    values[ i ] = value;
+                }
+                
+                return values;
+            }()
+        };
+        
+        uint32_t crc( 0xFFFFFFFF );
+        
+        for( size_t i = 0; i < size; i++ )
+        {
+            crc = table[ ( crc ^ data[ i ] ) & 0xFF ] ^ ( crc >> 8 );
+        }
+        
+        return crc ^ 0xFFFFFFFF;
+    }
+}
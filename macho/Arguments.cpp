@@ -45,6 +45,27 @@ class Arguments::IMPL
         bool                       _showObjcClasses;
         bool                       _showObjcMethods;
         bool                       _showData;
+        bool                       _showSignature;
+        bool                       _showUUID;
+        bool                       _demangle;
+        std::string                _extract;
+        std::string                _extractImage;
+        bool                       _sign;
+        std::string                _identifier;
+        std::string                _thin;
+        bool                       _create;
+        std::string                _output;
+        std::string                _cache;
+        std::string                _since;
+        std::string                _serve;
+        std::string                _query;
+        std::string                _arch;
+        std::vector< std::string > _addresses;
+        std::string                _symbolicate;
+        std::string                _loadAddress;
+        std::string                _dsym;
+        bool                       _diffSymbols;
+        std::string                _only;
         std::string                _exec;
         std::vector< std::string > _files;
 };
@@ -84,7 +105,85 @@ XS::Info Arguments::getInfo() const
     i.addChild( { "Objective-C classes", std::to_string( this->showObjcClasses() ) } );
     i.addChild( { "Objective-C methods", std::to_string( this->showObjcMethods() ) } );
     i.addChild( { "Data",                std::to_string( this->showData() ) } );
-
+    i.addChild( { "Signature",           std::to_string( this->showSignature() ) } );
+    i.addChild( { "UUID",                std::to_string( this->showUUID() ) } );
+    i.addChild( { "Demangle",            std::to_string( this->demangle() ) } );
+    
+    if( this->extract().size() > 0 )
+    {
+        i.addChild( { "Extract", this->extract() } );
+    }
+    
+    if( this->extractImage().size() > 0 )
+    {
+        i.addChild( { "Extract image", this->extractImage() } );
+    }
+    
+    if( this->sign() )
+    {
+        i.addChild( { "Sign", this->identifier() } );
+    }
+    
+    if( this->thin().size() > 0 )
+    {
+        i.addChild( { "Thin", this->thin() } );
+    }
+    
+    if( this->create() )
+    {
+        i.addChild( { "Create", this->output() } );
+    }
+    
+    if( this->cache().size() > 0 )
+    {
+        i.addChild( { "Cache", this->cache() } );
+    }
+    
+    if( this->since().size() > 0 )
+    {
+        i.addChild( { "Since", this->since() } );
+    }
+    
+    if( this->serve().size() > 0 )
+    {
+        i.addChild( { "Serve", this->serve() } );
+    }
+    
+    if( this->query().size() > 0 )
+    {
+        i.addChild( { "Query", this->query() } );
+    }
+    
+    if( this->arch().size() > 0 )
+    {
+        i.addChild( { "Architecture", this->arch() } );
+    }
+    
+    for( const auto & address: this->addresses() )
+    {
+        i.addChild( { "Address", address } );
+    }
+    
+    if( this->symbolicate().size() > 0 )
+    {
+        i.addChild( { "Symbolicate", this->symbolicate() } );
+    }
+    
+    if( this->loadAddress().size() > 0 )
+    {
+        i.addChild( { "Load address", this->loadAddress() } );
+    }
+    
+    if( this->dsym().size() > 0 )
+    {
+        i.addChild( { "dSYM", this->dsym() } );
+    }
+    
+    if( this->diffSymbols() )
+    {
+        i.addChild( { "Diff symbols", ( this->only().size() > 0 ) ? this->only() : "all" } );
+    }
+    
     for( const auto & file: this->files() )
     {
         files.addChild( file );
@@ -139,6 +238,111 @@ bool Arguments::showData() const
     return this->impl->_showData;
 }
 
+bool Arguments::showSignature() const
+{
+    return this->impl->_showSignature;
+}
+
+bool Arguments::showUUID() const
+{
+    return this->impl->_showUUID;
+}
+
+std::string Arguments::extract() const
+{
+    return this->impl->_extract;
+}
+
+std::string Arguments::extractImage() const
+{
+    return this->impl->_extractImage;
+}
+
+bool Arguments::demangle() const
+{
+    return this->impl->_demangle;
+}
+
+bool Arguments::sign() const
+{
+    return this->impl->_sign;
+}
+
+std::string Arguments::identifier() const
+{
+    return this->impl->_identifier;
+}
+
+std::string Arguments::thin() const
+{
+    return this->impl->_thin;
+}
+
+bool Arguments::create() const
+{
+    return this->impl->_create;
+}
+
+std::string Arguments::output() const
+{
+    return this->impl->_output;
+}
+
+std::string Arguments::cache() const
+{
+    return this->impl->_cache;
+}
+
+std::string Arguments::since() const
+{
+    return this->impl->_since;
+}
+
+std::string Arguments::serve() const
+{
+    return this->impl->_serve;
+}
+
+std::string Arguments::query() const
+{
+    return this->impl->_query;
+}
+
+std::string Arguments::arch() const
+{
+    return this->impl->_arch;
+}
+
+std::vector< std::string > Arguments::addresses() const
+{
+    return this->impl->_addresses;
+}
+
+std::string Arguments::symbolicate() const
+{
+    return this->impl->_symbolicate;
+}
+
+std::string Arguments::loadAddress() const
+{
+    return this->impl->_loadAddress;
+}
+
+std::string Arguments::dsym() const
+{
+    return this->impl->_dsym;
+}
+
+bool Arguments::diffSymbols() const
+{
+    return this->impl->_diffSymbols;
+}
+
+std::string Arguments::only() const
+{
+    return this->impl->_only;
+}
+
 std::string Arguments::exec() const
 {
     return this->impl->_exec;
@@ -164,7 +368,13 @@ Arguments::IMPL::IMPL( int argc, char ** argv ):
     _showStrings(     false ),
     _showObjcClasses( false ),
     _showObjcMethods( false ),
-    _showData(        false )
+    _showData(        false ),
+    _showSignature(   false ),
+    _showUUID(        false ),
+    _demangle(        false ),
+    _sign(            false ),
+    _create(          false ),
+    _diffSymbols(     false )
 {
     if( argc == 0 || argv == nullptr )
     {
@@ -187,15 +397,36 @@ Arguments::IMPL::IMPL( int argc, char ** argv ):
             {
                 continue;
             }
-            
-                 if( arg == "--help"        ) { this->_showHelp        = true; }
-            else if( arg == "--info"        ) { this->_showInfo        = true; }
-            else if( arg == "--libs"        ) { this->_showLibs        = true; }
-            else if( arg == "--symbols"     ) { this->_showSymbols     = true; }
-            else if( arg == "--str"         ) { this->_showStrings     = true; }
-            else if( arg == "--objc-class"  ) { this->_showObjcClasses = true; }
-            else if( arg == "--objc-method" ) { this->_showObjcMethods = true; }
-            else if( arg == "--data"        ) { this->_showData        = true; }
+                 
+                 if( arg == "--help"         ) { this->_showHelp        = true; }
+            else if( arg == "--info"         ) { this->_showInfo        = true; }
+            else if( arg == "--libs"         ) { this->_showLibs        = true; }
+            else if( arg == "--symbols"      ) { this->_showSymbols     = true; }
+            else if( arg == "--str"          ) { this->_showStrings     = true; }
+            else if( arg == "--objc-class"   ) { this->_showObjcClasses = true; }
+            else if( arg == "--objc-method"  ) { this->_showObjcMethods = true; }
+            else if( arg == "--data"         ) { this->_showData        = true; }
+            else if( arg == "--signature"    ) { this->_showSignature   = true; }
+            else if( arg == "--uuid"         ) { this->_showUUID        = true; }
+            else if( arg == "--demangle"     ) { this->_demangle        = true; }
+            else if( arg == "--sign"         ) { this->_sign            = true; }
+            else if( arg == "--diff-symbols" ) { this->_diffSymbols     = true; }
+            else if( arg == "--create"       ) { this->_create          = true; }
+            else if( arg == "--extract"      && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_extract      = argv[ ++i ]; }
+            else if( arg == "--image"        && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_extractImage = argv[ ++i ]; }
+            else if( arg == "--identifier"   && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_identifier   = argv[ ++i ]; }
+            else if( arg == "--thin"         && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_thin         = argv[ ++i ]; }
+            else if( arg == "--output"       && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_output       = argv[ ++i ]; }
+            else if( arg == "--cache"        && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_cache        = argv[ ++i ]; }
+            else if( arg == "--since"        && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_since        = argv[ ++i ]; }
+            else if( arg == "--serve"        && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_serve        = argv[ ++i ]; }
+            else if( arg == "--query"        && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_query        = argv[ ++i ]; }
+            else if( arg == "--arch"         && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_arch         = argv[ ++i ]; }
+            else if( arg == "--address"      && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_addresses.push_back( argv[ ++i ] ); }
+            else if( arg == "--symbolicate"  && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_symbolicate  = argv[ ++i ]; }
+            else if( arg == "--load-address" && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_loadAddress  = argv[ ++i ]; }
+            else if( arg == "--dsym"         && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_dsym         = argv[ ++i ]; }
+            else if( arg == "--only"         && i + 1 < argc && argv[ i + 1 ] != nullptr ) { this->_only         = argv[ ++i ]; }
             else if( arg[ 0 ] == '-' )
             {
                 for( auto c: arg.substr( 1 ) )
@@ -208,6 +439,7 @@ Arguments::IMPL::IMPL( int argc, char ** argv ):
                     if( c == 'c' ) { this->_showObjcClasses = true; }
                     if( c == 'm' ) { this->_showObjcMethods = true; }
                     if( c == 'd' ) { this->_showData        = true; }
+                    if( c == 'C' ) { this->_demangle        = true; }
                 }
             }
             else
@@ -227,6 +459,27 @@ Arguments::IMPL::IMPL( const IMPL & o ):
     _showObjcClasses( o._showObjcClasses ),
     _showObjcMethods( o._showObjcMethods ),
     _showData(        o._showData ),
+    _showSignature(   o._showSignature ),
+    _showUUID(        o._showUUID ),
+    _demangle(        o._demangle ),
+    _extract(         o._extract ),
+    _extractImage(    o._extractImage ),
+    _sign(            o._sign ),
+    _identifier(      o._identifier ),
+    _thin(            o._thin ),
+    _create(          o._create ),
+    _output(          o._output ),
+    _cache(           o._cache ),
+    _since(           o._since ),
+    _serve(           o._serve ),
+    _query(           o._query ),
+    _arch(            o._arch ),
+    _addresses(       o._addresses ),
+    _symbolicate(     o._symbolicate ),
+    _loadAddress(     o._loadAddress ),
+    _dsym(            o._dsym ),
+    _diffSymbols(     o._diffSymbols ),
+    _only(            o._only ),
     _exec(            o._exec ),
     _files(           o._files )
 {}
@@ -57,6 +57,27 @@ class Arguments: public XS::Info::Object
         bool                       showObjcClasses() const;
         bool                       showObjcMethods() const;
         bool                       showData()        const;
+        bool                       showSignature()   const;
+        bool                       showUUID()        const;
+        bool                       demangle()        const;
+        std::string                extract()         const;
+        std::string                extractImage()    const;
+        bool                       sign()            const;
+        std::string                identifier()      const;
+        std::string                thin()            const;
+        bool                       create()          const;
+        std::string                output()          const;
+        std::string                cache()           const;
+        std::string                since()           const;
+        std::string                serve()           const;
+        std::string                query()           const;
+        std::string                arch()            const;
+        std::vector< std::string > addresses()       const;
+        std::string                symbolicate()     const;
+        std::string                loadAddress()     const;
+        std::string                dsym()            const;
+        bool                       diffSymbols()     const;
+        std::string                only()            const;
         std::string                exec()            const;
         std::vector< std::string > files()           const;
         
@@ -29,20 +29,27 @@
 
 #include "Display.hpp"
 #include <cctype>
+#include <sys/stat.h>
+#include <dirent.h>
 #include <XS.hpp>
 
 namespace Display
 {
+    static uint64_t    Address( const std::string & value );
+    static MachO::File Architecture( const std::string & path, const std::string & arch );
+    static std::string DWARFFile( const std::string & dsym );
+    
     void Error( const std::exception & e )
     {
         std::cerr << "Error: " << e.what() << std::endl;
     }
-
+    
     void Help()
     {
         std::cout << "Usage: macho [OPTIONS] [PATH] ...\n"
                      "\n"
-                     "Supports regular and Fat Mach-O files as well as dyld cache files.\n"
+                     "Supports regular and Fat Mach-O files, static libraries and dyld cache\n"
+                     "files, as well as Mach-O files inside .ipa and .zip archives.\n"
                      "Multiple files can be passed at once.\n"
                      "\n"
                      "Options:\n"
@@ -57,10 +64,58 @@ namespace Display
                      "                        __objc_classname.\n"
                      "    -m / --objc-method  Prints the list of Objective-C methods\n"
                      "                        from __objc_methname.\n"
-                     "    -d / --data         Prints the file data."
+                     "    -d / --data         Prints the file data.\n"
+                     "    -C / --demangle     Demangles C++ and Swift symbol names,\n"
+                     "                        with -f.\n"
+                     "    --signature         Prints the code signature and verifies\n"
+                     "                        its page hashes.\n"
+                     "    --extract <dir>     Extracts the images of a dyld cache file\n"
+                     "                        as standalone Mach-O files into <dir>.\n"
+                     "    --image <path>      Only extracts the image with the given\n"
+                     "                        install path, with --extract.\n"
+                     "    --sign              Ad-hoc signs the files in place.\n"
+                     "    --identifier <id>   Signing identifier, with --sign. Defaults\n"
+                     "                        to the file name.\n"
+                     "    --thin <arch>       Writes the given architecture of a Fat\n"
+                     "                        file as a thin file.\n"
+                     "    --create            Creates a Fat file from the given files.\n"
+                     "    --output <path>     Output file, with --thin or --create.\n"
+                     "                        Defaults to <file>.<arch> with --thin.\n"
+                     "    --cache <dir>       Caches parsed Mach-O files in <dir>, and\n"
+                     "                        reuses them while the files are unchanged.\n"
+                     "    --since <manifest>  Scans the given files and directories, and\n"
+                     "                        prints the libraries, symbols and UUIDs\n"
+                     "                        changed since the manifest was written.\n"
+                     "                        Only changed files are parsed again.\n"
+                     "    --serve <socket>    Runs a query server on the given Unix\n"
+                     "                        socket, keeping parsed files in memory.\n"
+                     "    --query <socket>    Queries a server for the given files,\n"
+                     "                        with -l, -f, --uuid and --address.\n"
+                     "    --uuid              Prints the UUID, with --query.\n"
+                     "    --address <addr>    Prints the symbol containing the given\n"
+                     "                        address, with --query. Can be repeated.\n"
+                     "    --arch <arch>       Architecture of a Fat file, with --query\n"
+                     "                        and --symbolicate.\n"
+                     "                        Images of a dyld cache are selected\n"
+                     "                        with --image.\n"
+                     "    --symbolicate <bin> Reads addresses from the standard input,\n"
+                     "                        and prints the symbol containing each\n"
+                     "                        address, with --arch for Fat files.\n"
+                     "    --load-address <a>  Load address of the binary, with\n"
+                     "                        --symbolicate. Addresses are unslid by\n"
+                     "                        the difference with the __TEXT address.\n"
+                     "    --dsym <path>       dSYM bundle or DWARF file, with\n"
+                     "                        --symbolicate. Prints the source file and\n"
+                     "                        line, and the inlined functions, of each\n"
+                     "                        address. Indexes are kept in --cache <dir>.\n"
+                     "    --diff-symbols      Prints the symbols added, removed, or whose\n"
+                     "                        type or section changed, between two\n"
+                     "                        files, with --arch for Fat files.\n"
+                     "    --only <kind>       Only compares exports, imports or locals,\n"
+                     "                        with --diff-symbols."
                   << std::endl;
     }
-
+    
     XS::Info FileInfo( const MachO::File & file, const Arguments & args )
     {
         XS::Info i( file.getInfo() );
@@ -87,9 +142,39 @@ namespace Display
         {
             XS::Info syms( "Symbols" );
             
-            for( const auto & sym: file.symbols() )
+            std::vector< MachO::Symbol > symbols( file.symbols() );
+            std::vector< std::string >   demangled;
+            
+            if( args.demangle() )
             {
-                syms.addChild( sym );
+                static MachO::Demangler demangler;
+                
+                std::vector< std::string > names;
+                
+                names.reserve( symbols.size() );
+                
+                for( const auto & sym: symbols )
+                {
+                    names.push_back( sym.name() );
+                }
+                
+                demangled = demangler.demangle( names );
+            }
+            
+            for( size_t n = 0; n < symbols.size(); n++ )
+            {
+                XS::Info info( symbols[ n ] );
+                
+                /* The demangled name follows the mangled one, which is kept for searching */
+                if( n < demangled.size() && demangled[ n ] != symbols[ n ].name() )
+                {
+                    std::vector< XS::Info > children( info.children() );
+                    
+                    children.insert( children.begin() + 1, XS::Info( "Demangled Name", demangled[ n ] ) );
+                    info.children( children );
+                }
+                
+                syms.addChild( info );
             }
             
             syms.value( std::to_string( syms.children().size() ) );
@@ -161,6 +246,34 @@ namespace Display
             }
         }
         
+        if( args.showSignature() )
+        {
+            MachO::CodeSignature signature( file.codeSignature() );
+            XS::Info             info( signature.getInfo() );
+            
+            if( signature.isSigned() )
+            {
+                MachO::CodeSignature::Verification result( signature.verify() );
+                XS::Info                           verification( "Verification", ( result.valid ) ? "valid" : "invalid" );
+                
+                verification.addChild( { "Pages", std::to_string( result.pages ) } );
+                
+                for( auto page: result.mismatchedPages )
+                {
+                    verification.addChild( { "Mismatched page", std::to_string( page ) } );
+                }
+                
+                for( auto slot: result.mismatchedSpecialSlots )
+                {
+                    verification.addChild( { "Mismatched special slot", std::to_string( slot ) } );
+                }
+                
+                info.addChild( verification );
+            }
+            
+            i.addChild( info );
+        }
+        
         return i;
     }
     
@@ -178,6 +291,11 @@ namespace Display
                 children.push_back( FileInfo( p.second, args ) );
             }
             
+            for( const auto & p: file.archives() )
+            {
+                children.push_back( FileInfo( p.second, args ) );
+            }
+            
             i.children( children );
         }
         
@@ -201,6 +319,63 @@ namespace Display
         return i;
     }
     
+    XS::Info FileInfo( const MachO::ArchiveFile & file, const Arguments & args )
+    {
+        XS::Info                i( file.getInfo() );
+        std::vector< XS::Info > children;
+        
+        if( args.showInfo() )
+        {
+            children = i.children();
+        }
+        
+        for( const auto & p: file.parseMembers() )
+        {
+            XS::Info member( FileInfo( p.second, args ) );
+            
+            member.value( p.first.name() );
+            children.push_back( member );
+        }
+        
+        i.children( children );
+        
+        return i;
+    }
+    
+    XS::Info FileInfo( const MachO::ZipFile & file, const Arguments & args )
+    {
+        XS::Info                       i( file.getInfo() );
+        std::vector< XS::Info >        children;
+        std::vector< MachO::ZipEntry > entries( file.entries() );
+        
+        if( args.showInfo() )
+        {
+            children = i.children();
+        }
+        
+        for( size_t index: file.machOEntries() )
+        {
+            XS::Info entry
+            (
+                std::visit
+                (
+                    [ & ]( const auto & var )
+                    {
+                        return FileInfo( var, args );
+                    },
+                    MachO::Parse( file.data( index ) )
+                )
+            );
+            
+            entry.value( entries[ index ].name() );
+            children.push_back( entry );
+        }
+        
+        i.children( children );
+        
+        return i;
+    }
+    
     void File( const MachO::File & file, const Arguments & args )
     {
         std::cout << FileInfo( file, args ) << std::endl;
@@ -208,11 +383,519 @@ namespace Display
     
     void File( const MachO::FatFile & file, const Arguments & args )
     {
-        std::cout << FileInfo( file, args ) << std::endl;
+        if( args.thin().size() > 0 )
+        {
+            Thin( file, args );
+        }
+        else
+        {
+            std::cout << FileInfo( file, args ) << std::endl;
+        }
     }
     
     void File( const MachO::CacheFile & file, const Arguments & args )
+    {
+        if( args.extract().size() > 0 )
+        {
+            Extract( file, args );
+        }
+        else
+        {
+            std::cout << FileInfo( file, args ) << std::endl;
+        }
+    }
+    
+    void File( const MachO::ArchiveFile & file, const Arguments & args )
+    {
+        std::cout << FileInfo( file, args ) << std::endl;
+    }
+    
+    void File( const MachO::ZipFile & file, const Arguments & args )
     {
         std::cout << FileInfo( file, args ) << std::endl;
     }
+    
+    void Extract( const MachO::CacheFile & file, const Arguments & args )
+    {
+        MachO::CacheExtractor extractor( file );
+        
+        if( args.extractImage().size() > 0 )
+        {
+            std::optional< size_t > index( file.imageIndex( args.extractImage() ) );
+            std::string             path( args.extract() + "/" + XS::ToString::Filename( args.extractImage() ) );
+            
+            if( index.has_value() == false )
+            {
+                throw std::runtime_error( "No such image in cache: " + args.extractImage() );
+            }
+            
+            extractor.extract( *( index ), path );
+            
+            std::cout << path << std::endl;
+        }
+        else
+        {
+            std::vector< std::string > paths( extractor.extractAll( args.extract() ) );
+            
+            std::cout << "Extracted " << paths.size() << " images to " << args.extract() << std::endl;
+        }
+    }
+    
+    void Sign( const std::string & path, const Arguments & args )
+    {
+        std::string identifier( ( args.identifier().size() > 0 ) ? args.identifier() : XS::ToString::Filename( path ) );
+        
+        MachO::CodeSigner( path ).sign( identifier );
+        
+        std::cout << "Signed " << path << " as " << identifier << std::endl;
+    }
+    
+    void Thin( const MachO::FatFile & file, const Arguments & args )
+    {
+        std::string output( args.output() );
+        
+        if( output.size() == 0 && file.path().has_value() )
+        {
+            output = *( file.path() ) + "." + args.thin();
+        }
+        
+        if( output.size() == 0 )
+        {
+            throw std::runtime_error( "No output path for architecture: " + args.thin() );
+        }
+        
+        file.extract( args.thin(), output );
+        
+        std::cout << output << std::endl;
+    }
+    
+    void Create( const Arguments & args )
+    {
+        if( args.output().size() == 0 )
+        {
+            throw std::runtime_error( "No output path for the Fat file" );
+        }
+        
+        MachO::FatFile::Create( args.files(), args.output() );
+        
+        std::cout << "Created " << args.output() << " from " << args.files().size() << " files" << std::endl;
+    }
+    
+    void Since( const Arguments & args )
+    {
+        struct stat         st;
+        MachO::ScanManifest before;
+        MachO::ScanManifest after;
+        size_t              counts[ 3 ] = { 0, 0, 0 };
+        
+        if( stat( args.since().c_str(), &st ) == 0 )
+        {
+            before = MachO::ScanManifest( args.since() );
+        }
+        
+        after = before.rescan( args.files() );
+        
+        for( const auto & change: MachO::ScanManifest::Compare( before, after ) )
+        {
+            switch( change.kind )
+            {
+                case MachO::ScanManifest::Change::Kind::Added:   std::cout << "Added:   "; break;
+                case MachO::ScanManifest::Change::Kind::Removed: std::cout << "Removed: "; break;
+                case MachO::ScanManifest::Change::Kind::Changed: std::cout << "Changed: "; break;
+            }
+            
+            std::cout << change.path << " (" << change.architecture << ")" << std::endl;
+            
+            if( change.oldUUID != change.newUUID )
+            {
+                std::cout << "    UUID:    " << change.oldUUID.value_or( "-" ) << " -> " << change.newUUID.value_or( "-" ) << std::endl;
+            }
+            
+            for( const auto & library: change.addedLibraries )   { std::cout << "    Library: + " << library << std::endl; }
+            for( const auto & library: change.removedLibraries ) { std::cout << "    Library: - " << library << std::endl; }
+            for( const auto & symbol:  change.addedSymbols )     { std::cout << "    Symbol:  + " << symbol  << std::endl; }
+            for( const auto & symbol:  change.removedSymbols )   { std::cout << "    Symbol:  - " << symbol  << std::endl; }
+            
+            counts[ static_cast< size_t >( change.kind ) ]++;
+        }
+        
+        after.write( args.since() );
+        
+        std::cout << "Scanned "
+                  << after.entries().size() << " files, parsed "
+                  << after.parsed()         << ": "
+                  << counts[ 0 ]            << " added, "
+                  << counts[ 1 ]            << " removed, "
+                  << counts[ 2 ]            << " changed"
+                  << std::endl;
+    }
+    
+    void Serve( const Arguments & args )
+    {
+        MachO::QueryServer server( args.serve() );
+        
+        std::cout << "Listening on " << server.socket() << std::endl;
+        
+        server.run();
+    }
+    
+    void Query( const Arguments & args )
+    {
+        std::string image( ( args.arch().size() > 0 ) ? args.arch() : args.extractImage() );
+        
+        for( const auto & file: args.files() )
+        {
+            std::vector< MachO::QueryServer::Query > queries;
+            std::vector< MachO::QueryServer::Reply > replies;
+            XS::Info                                 i( file );
+            
+            if( args.showUUID() || ( args.showLibs() == false && args.showSymbols() == false && args.addresses().size() == 0 ) )
+            {
+                queries.push_back( { MachO::QueryServer::Request::UUID, file, image, 0 } );
+            }
+            
+            if( args.showLibs() )
+            {
+                queries.push_back( { MachO::QueryServer::Request::Libraries, file, image, 0 } );
+            }
+            
+            if( args.showSymbols() )
+            {
+                queries.push_back( { MachO::QueryServer::Request::Symbols, file, image, 0 } );
+            }
+            
+            for( const auto & address: args.addresses() )
+            {
+                queries.push_back( { MachO::QueryServer::Request::Symbolicate, file, image, Address( address ) } );
+            }
+            
+            /* All queries for a file are sent as a single batch */
+            replies = MachO::QueryServer::Send( args.query(), queries );
+            
+            for( size_t n = 0; n < replies.size(); n++ )
+            {
+                const auto & query( queries[ n ] );
+                const auto & reply( replies[ n ] );
+                XS::Info     result;
+                
+                switch( query.request )
+                {
+                    case MachO::QueryServer::Request::UUID:        result = XS::Info( "UUID" );                             break;
+                    case MachO::QueryServer::Request::Libraries:   result = XS::Info( "Libraries" );                        break;
+                    case MachO::QueryServer::Request::Symbols:     result = XS::Info( "Symbols" );                          break;
+                    case MachO::QueryServer::Request::Symbolicate: result = XS::Info( XS::ToString::Hex( query.address ) ); break;
+                }
+                
+                if( reply.success == false )
+                {
+                    result.value( "Error: " + ( ( reply.values.size() > 0 ) ? reply.values[ 0 ] : std::string() ) );
+                }
+                else if( query.request == MachO::QueryServer::Request::Libraries || query.request == MachO::QueryServer::Request::Symbols )
+                {
+                    for( const auto & value: reply.values )
+                    {
+                        result.addChild( ( query.request == MachO::QueryServer::Request::Libraries ) ? XS::ToString::Filename( value ) : value );
+                    }
+                    
+                    result.value( std::to_string( result.children().size() ) );
+                }
+                else if( reply.values.size() > 0 )
+                {
+                    result.value( reply.values[ 0 ] );
+                }
+                
+                i.addChild( result );
+            }
+            
+            std::cout << i << std::endl;
+        }
+    }
+    
+    void Symbolicate( const Arguments & args )
+    {
+        MachO::File                       file( Architecture( args.symbolicate(), args.arch() ) );
+        std::string                       name( XS::ToString::Filename( args.symbolicate() ) );
+        std::optional< MachO::DebugInfo > debug;
+        
+        if( args.dsym().size() > 0 )
+        {
+            MachO::File                  dwarf( Architecture( DWARFFile( args.dsym() ), file.cpu().name() ) );
+            std::optional< std::string > binaryUUID;
+            std::optional< std::string > dwarfUUID;
+            
+            for( const auto & command: file.loadCommands< MachO::LoadCommands::UUID >() )
+            {
+                binaryUUID = command.uuid();
+            }
+            
+            for( const auto & command: dwarf.loadCommands< MachO::LoadCommands::UUID >() )
+            {
+                dwarfUUID = command.uuid();
+            }
+            
+            /* Line information from another build would silently be wrong */
+            if( binaryUUID.has_value() && dwarfUUID.has_value() && binaryUUID != dwarfUUID )
+            {
+                throw std::runtime_error( "dSYM UUID mismatch: " + *( binaryUUID ) + " - " + *( dwarfUUID ) );
+            }
+            
+            debug = ( args.cache().size() > 0 ) ? MachO::DebugInfo( dwarf, args.cache() ) : MachO::DebugInfo( dwarf );
+            
+            if( debug->hasDebugInfo() == false )
+            {
+                throw std::runtime_error( "No DWARF data: " + args.dsym() );
+            }
+        }
+        
+        {
+            MachO::Symbolicator symbolicator( file );
+            uint64_t            slide( ( args.loadAddress().size() > 0 ) ? Address( args.loadAddress() ) - symbolicator.textAddress() : 0 );
+            std::string         line;
+            bool                done( false );
+            
+            std::ios::sync_with_stdio( false );
+            
+            /* Lines are read in large batches, which are resolved at once and written in input order */
+            while( done == false )
+            {
+                std::vector< std::string >                   lines;
+                std::vector< std::optional< size_t > >       indexes;
+                std::vector< uint64_t >                      addresses;
+                std::vector< MachO::Symbolicator::Location > locations;
+                std::vector< MachO::DebugInfo::Location >    sources;
+                std::string                                  output;
+                
+                while( lines.size() < 65536 )
+                {
+                    if( std::getline( std::cin, line ).fail() )
+                    {
+                        done = true;
+                        
+                        break;
+                    }
+                    
+                    {
+                        size_t begin( line.find_first_not_of( " \t\r" ) );
+                        size_t end(   line.find_last_not_of(  " \t\r" ) );
+                        
+                        line = ( begin == std::string::npos ) ? std::string() : line.substr( begin, end - begin + 1 );
+                    }
+                    
+                    try
+                    {
+                        addresses.push_back( Address( line ) );
+                        indexes.push_back( addresses.size() - 1 );
+                    }
+                    catch( const std::exception & )
+                    {
+                        indexes.push_back( {} );
+                    }
+                    
+                    lines.push_back( line );
+                }
+                
+                locations = symbolicator.symbolicate( addresses, slide );
+                
+                if( debug.has_value() )
+                {
+                    std::vector< uint64_t > unslid;
+                    
+                    for( auto address: addresses )
+                    {
+                        unslid.push_back( address - slide );
+                    }
+                    
+                    sources = debug->lookup( unslid );
+                }
+                
+                for( size_t i = 0; i < lines.size(); i++ )
+                {
+                    if( indexes[ i ].has_value() == false || locations[ *( indexes[ i ] ) ].resolved == false )
+                    {
+                        output += lines[ i ] + "\n";
+                        
+                        continue;
+                    }
+                    
+                    {
+                        const auto & location( locations[ *( indexes[ i ] ) ] );
+                        std::string  symbol( location.symbol.value_or( XS::ToString::Hex( location.start ) ) + " (in " + name + ") + " + std::to_string( location.offset ) );
+                        
+                        if( sources.size() == 0 || sources[ *( indexes[ i ] ) ].frames.size() == 0 )
+                        {
+                            output += symbol + "\n";
+                            
+                            continue;
+                        }
+                        
+                        /* Like atos -i, one line per inlined function, innermost first */
+                        for( const auto & frame: sources[ *( indexes[ i ] ) ].frames )
+                        {
+                            output += ( frame.function.size() > 0 ) ? frame.function + " (in " + name + ")" : symbol;
+                            
+                            if( frame.line > 0 )
+                            {
+                                output += " (" + XS::ToString::Filename( frame.file ) + ":" + std::to_string( frame.line ) + ")";
+                            }
+                            
+                            output += "\n";
+                        }
+                    }
+                }
+                
+                std::cout << output;
+            }
+            
+            std::cout.flush();
+        }
+    }
+    
+    void DiffSymbols( const Arguments & args )
+    {
+        std::vector< std::string >               files( args.files() );
+        MachO::SymbolDiff::Filter                filter( MachO::SymbolDiff::Filter::All );
+        std::vector< MachO::SymbolDiff::Change > changes;
+        std::vector< std::string >               names;
+        std::string                              output;
+        size_t                                   counts[ 3 ] = { 0, 0, 0 };
+        
+        if( files.size() != 2 )
+        {
+            throw std::runtime_error( "Two files are required with --diff-symbols" );
+        }
+             
+             if( args.only() == "exports" ) { filter = MachO::SymbolDiff::Filter::Exports; }
+        else if( args.only() == "imports" ) { filter = MachO::SymbolDiff::Filter::Imports; }
+        else if( args.only() == "locals" )  { filter = MachO::SymbolDiff::Filter::Locals; }
+        else if( args.only().size() > 0 )   { throw std::runtime_error( "Invalid symbol filter: " + args.only() ); }
+        
+        changes = MachO::SymbolDiff::Compare( Architecture( files[ 0 ], args.arch() ), Architecture( files[ 1 ], args.arch() ), filter );
+        
+        for( const auto & change: changes )
+        {
+            names.push_back( change.name );
+        }
+        
+        if( args.demangle() )
+        {
+            names = MachO::Demangler().demangle( names );
+        }
+        
+        for( size_t i = 0; i < changes.size(); i++ )
+        {
+            const auto & change( changes[ i ] );
+            
+            switch( change.kind )
+            {
+                case MachO::SymbolDiff::Change::Kind::Added:   output += "Added:   "; break;
+                case MachO::SymbolDiff::Change::Kind::Removed: output += "Removed: "; break;
+                case MachO::SymbolDiff::Change::Kind::Changed: output += "Changed: "; break;
+            }
+            
+            output += names[ i ];
+            
+            if( change.kind == MachO::SymbolDiff::Change::Kind::Changed )
+            {
+                output += " (type "    + XS::ToString::Hex( change.oldType )    + " -> " + XS::ToString::Hex( change.newType )
+                        +  ", section " + XS::ToString::Hex( change.oldSection ) + " -> " + XS::ToString::Hex( change.newSection ) + ")";
+            }
+            
+            output += "\n";
+            
+            counts[ static_cast< size_t >( change.kind ) ]++;
+        }
+        
+        std::cout << output
+                  << counts[ 0 ] << " added, "
+                  << counts[ 1 ] << " removed, "
+                  << counts[ 2 ] << " changed"
+                  << std::endl;
+    }
+    
+    static uint64_t Address( const std::string & value )
+    {
+        try
+        {
+            size_t   end( 0 );
+            uint64_t address( std::stoull( value, &end, 0 ) );
+            
+            if( end == value.size() )
+            {
+                return address;
+            }
+        }
+        catch( const std::exception & )
+        {}
+        
+        throw std::runtime_error( "Invalid address: " + value );
+    }
+    
+    static MachO::File Architecture( const std::string & path, const std::string & arch )
+    {
+        /* Parsed in place, so symbol tables are only decoded when accessed */
+        auto parsed( MachO::Parse( MachO::MappedFile( path ) ) );
+        
+        if( const MachO::File * thin = std::get_if< MachO::File >( &parsed ) )
+        {
+            if( arch.size() > 0 && arch != thin->cpu().name() )
+            {
+                throw std::runtime_error( "No such architecture: " + arch );
+            }
+            
+            return *( thin );
+        }
+        else if( const MachO::FatFile * fat = std::get_if< MachO::FatFile >( &parsed ) )
+        {
+            std::vector< std::pair< MachO::FatArch, MachO::File > > archs( fat->architectures() );
+            std::string                                             names;
+            
+            for( const auto & architecture: archs )
+            {
+                if( architecture.first.cpu().name() == arch || ( arch.size() == 0 && archs.size() == 1 ) )
+                {
+                    return architecture.second;
+                }
+                
+                names += ( ( names.size() > 0 ) ? ", " : "" ) + architecture.first.cpu().name();
+            }
+            
+            throw std::runtime_error( "Select an architecture with --arch: " + names );
+        }
+        
+        throw std::runtime_error( "Not a Mach-O file: " + path );
+    }
+    
+    static std::string DWARFFile( const std::string & dsym )
+    {
+        struct stat s;
+        std::string directory( dsym + "/Contents/Resources/DWARF" );
+        DIR       * dir;
+        
+        if( stat( dsym.c_str(), &s ) != 0 || S_ISDIR( s.st_mode ) == false )
+        {
+            return dsym;
+        }
+        
+        /* A dSYM bundle holds a single DWARF file, named after the binary */
+        if( ( dir = opendir( directory.c_str() ) ) != nullptr )
+        {
+            struct dirent * entry;
+            
+            while( ( entry = readdir( dir ) ) != nullptr )
+            {
+                std::string path( directory + "/" + entry->d_name );
+                
+                if( entry->d_name[ 0 ] != '.' && stat( path.c_str(), &s ) == 0 && S_ISREG( s.st_mode ) )
+                {
+                    closedir( dir );
+                    
+                    return path;
+                }
+            }
+            
+            closedir( dir );
+        }
+        
+        throw std::runtime_error( "No DWARF file in dSYM bundle: " + dsym );
+    }
 }
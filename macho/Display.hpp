@@ -41,13 +41,27 @@ namespace Display
     void Error( const std::exception & e );
     void Help();
     
-    XS::Info FileInfo( const MachO::File      & file, const Arguments & args );
-    XS::Info FileInfo( const MachO::FatFile   & file, const Arguments & args );
-    XS::Info FileInfo( const MachO::CacheFile & file, const Arguments & args );
+    XS::Info FileInfo( const MachO::File        & file, const Arguments & args );
+    XS::Info FileInfo( const MachO::FatFile     & file, const Arguments & args );
+    XS::Info FileInfo( const MachO::CacheFile   & file, const Arguments & args );
+    XS::Info FileInfo( const MachO::ArchiveFile & file, const Arguments & args );
+    XS::Info FileInfo( const MachO::ZipFile     & file, const Arguments & args );
     
-    void File( const MachO::File      & file, const Arguments & args );
-    void File( const MachO::FatFile   & file, const Arguments & args );
-    void File( const MachO::CacheFile & file, const Arguments & args );
+    void File( const MachO::File        & file, const Arguments & args );
+    void File( const MachO::FatFile     & file, const Arguments & args );
+    void File( const MachO::CacheFile   & file, const Arguments & args );
+    void File( const MachO::ArchiveFile & file, const Arguments & args );
+    void File( const MachO::ZipFile     & file, const Arguments & args );
+    
+    void Extract( const MachO::CacheFile & file, const Arguments & args );
+    void Sign( const std::string & path, const Arguments & args );
+    void Thin( const MachO::FatFile & file, const Arguments & args );
+    void Create( const Arguments & args );
+    void Since( const Arguments & args );
+    void Serve( const Arguments & args );
+    void Query( const Arguments & args );
+    void Symbolicate( const Arguments & args );
+    void DiffSymbols( const Arguments & args );
 }
 
 #endif /* DISPLAY_HPP */
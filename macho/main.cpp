@@ -30,33 +30,107 @@
 #include "Arguments.hpp"
 #include "Display.hpp"
 #include <MachO.hpp>
+#include <optional>
 #include <vector>
 
 int main( int argc, char * argv[] )
 {
     Arguments args( argc, argv );
     
-    if( args.showHelp() || args.files().size() == 0 )
+    if( args.showHelp() || ( args.files().size() == 0 && args.serve().size() == 0 && args.symbolicate().size() == 0 ) )
     {
         Display::Help();
         
         return EXIT_SUCCESS;
     }
     
+    if( args.create() )
     {
-        int status( EXIT_SUCCESS );
+        try
+        {
+            Display::Create( args );
+        }
+        catch( const std::exception & e )
+        {
+            Display::Error( e );
+            
+            return EXIT_FAILURE;
+        }
+        
+        return EXIT_SUCCESS;
+    }
+    
+    if( args.since().size() > 0 || args.serve().size() > 0 || args.query().size() > 0 || args.symbolicate().size() > 0 || args.diffSymbols() )
+    {
+        try
+        {
+            if( args.since().size() > 0 )
+            {
+                Display::Since( args );
+            }
+            else if( args.serve().size() > 0 )
+            {
+                Display::Serve( args );
+            }
+            else if( args.symbolicate().size() > 0 )
+            {
+                Display::Symbolicate( args );
+            }
+            else if( args.diffSymbols() )
+            {
+                Display::DiffSymbols( args );
+            }
+            else
+            {
+                Display::Query( args );
+            }
+        }
+        catch( const std::exception & e )
+        {
+            Display::Error( e );
+            
+            return EXIT_FAILURE;
+        }
+        
+        return EXIT_SUCCESS;
+    }
+    
+    {
+        int                                status( EXIT_SUCCESS );
+        std::optional< MachO::ParseCache > cache;
+        
+        try
+        {
+            if( args.cache().size() > 0 )
+            {
+                cache = MachO::ParseCache( args.cache() );
+            }
+        }
+        catch( const std::exception & e )
+        {
+            Display::Error( e );
+            
+            return EXIT_FAILURE;
+        }
         
         for( const auto & file: args.files() )
         {
             try
             {
+                if( args.sign() )
+                {
+                    Display::Sign( file, args );
+                    
+                    continue;
+                }
+                
                 std::visit
                 (
                     [ & ]( const auto & var )
                     {
                         Display::File( var, args );
                     },
-                    MachO::Parse( file )
+                    ( cache.has_value() ) ? MachO::Parse( file, *( cache ) ) : MachO::Parse( file )
                 );
             }
             catch( const std::exception & e )